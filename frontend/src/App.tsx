@@ -17,6 +17,7 @@ import MemoList from "./pages/MemoList";
 import MemoView from "./pages/MemoView";
 import Settings from "./pages/Settings";
 import DebugProcess from "./pages/DebugProcess";
+import DebugPerformance from "./pages/DebugPerformance";
 
 export default function App(): React.JSX.Element {
   return (
@@ -34,6 +35,7 @@ export default function App(): React.JSX.Element {
           <Route path="/memo/edit/:memoId" element={<MemoEditor />} />
           <Route path="/memo/view/:memoId" element={<MemoView />} />
           <Route path="/debug/process" element={<DebugProcess />} />
+          <Route path="/debug/performance" element={<DebugPerformance />} />
         </Route>
       </Routes>
     </ErrorBoundary>
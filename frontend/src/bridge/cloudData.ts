@@ -9,6 +9,7 @@ import {
   ListCloudGameSummaries,
   GetDirectoryTree,
   GetGameDirectoryNode,
+  GetDirectoryChildren,
   DeleteCloudData,
   DeleteFile,
   GetCloudFileDetails,
@@ -37,6 +38,18 @@ export function createCloudDataBridge(): WindowApi["cloudData"] {
         ? { success: true, data: normalizeCloudDirectoryNode(result.data) }
         : { success: false, message: result.error?.message ?? "エラー" };
     },
+    getDirectoryChildren: async (gameId, path, cursor) => {
+      const result = await GetDirectoryChildren(gameId, path, cursor ?? "");
+      return result.success && result.data
+        ? {
+            success: true,
+            data: {
+              nodes: (result.data.nodes ?? []).map(normalizeCloudDirectoryNode),
+              nextCursor: result.data.nextCursor ?? "",
+            },
+          }
+        : { success: false, message: result.error?.message ?? "エラー" };
+    },
     deleteCloudData: async (path) => toApiResultVoid(await DeleteCloudData(path)),
     deleteFile: async (path) => toApiResultVoid(await DeleteFile(path)),
     getCloudFileDetails: async (path) =>
@@ -6,16 +6,21 @@
 
 import {
   SyncStatus,
+  SyncStatusMany,
   PushSync,
   PullSync,
   ResolveConflict,
   DeleteGameFromCloud,
+  CollectCloudGarbage,
 } from "../../wailsjs/go/app/App";
 import { EventsOn } from "../../wailsjs/runtime/runtime";
 import { toApiResultVoid } from "./helpers";
 import type {
   SyncStatus as SyncStatusType,
   SyncMetaSnapshot,
+  SyncStatusDetail,
+  GameSyncStatus,
+  GCReport,
   PullResult,
   SyncProgressEvent,
   WindowApi,
@@ -60,6 +65,14 @@ export function createCloudSyncBridge(): WindowApi["cloudSync"] {
         },
       };
     },
+    statusMany: async (gameIds) => {
+      const result = await SyncStatusMany(gameIds);
+      if (!result.success) {
+        return { success: false, message: result.error?.message ?? "エラー" };
+      }
+      const items = (result.data ?? []) as GameSyncStatus[];
+      return { success: true, data: items.map(normalizeGameSyncStatus) };
+    },
     push: async (gameId) => toApiResultVoid(await PushSync(gameId)),
     pull: async (gameId, deleteUntracked = false) => {
       const result = await PullSync(gameId, deleteUntracked);
@@ -74,10 +87,34 @@ export function createCloudSyncBridge(): WindowApi["cloudSync"] {
         : { success: false, message: result.error?.message ?? "エラー" };
     },
     deleteFromCloud: async (gameId) => toApiResultVoid(await DeleteGameFromCloud(gameId)),
+    collectGarbage: async (gameId = "", dryRun = false) => {
+      const result = await CollectCloudGarbage(gameId, dryRun);
+      return result.success
+        ? { success: true, data: (result.data ?? []) as GCReport[] }
+        : { success: false, message: result.error?.message ?? "エラー" };
+    },
     onProgress: (callback: (event: SyncProgressEvent) => void) => {
       // EventsOff("sync:progress") は同名リスナーを全削除する。
       // EventsOn の戻り値で当該登録だけ解除する。
       return EventsOn("sync:progress", callback);
     },
+    onStatus: (callback: (event: GameSyncStatus) => void) => {
+      return EventsOn("sync:status", (event: GameSyncStatus) =>
+        callback(normalizeGameSyncStatus(event)),
+      );
+    },
+  };
+}
+
+// 一括判定では競合時しか meta を返さないため savesDiffer と meta の日付だけを整える
+function normalizeGameSyncStatus(item: GameSyncStatus): GameSyncStatus {
+  const normalizeMeta = (m?: SyncMetaSnapshot): SyncMetaSnapshot | undefined =>
+    m ? { ...m, createdAt: new Date(m.createdAt) } : undefined;
+  const detail: SyncStatusDetail = {
+    ...item.detail,
+    savesDiffer: item.detail?.savesDiffer ?? false,
+    localMeta: normalizeMeta(item.detail?.localMeta),
+    remoteMeta: normalizeMeta(item.detail?.remoteMeta),
   };
+  return { ...item, detail };
 }
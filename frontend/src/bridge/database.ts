@@ -6,6 +6,7 @@
 
 import {
   ListGames,
+  ListGamesPage,
   GetGameByID,
   CreateGame,
   UpdateGame,
@@ -15,8 +16,8 @@ import {
   UpdateSessionName,
   DeleteSession,
 } from "../../wailsjs/go/app/App";
-import { toGameType, toPlaySessionType, toApiResultVoid } from "./helpers";
-import type { modelsServices, modelsTime } from "./helpers";
+import { toGameType, toPlaySessionType, toApiResult, toApiResultVoid } from "./helpers";
+import type { modelsDomain, modelsServices, modelsTime } from "./helpers";
 import type { PlayStatus } from "src/types/game";
 import type { WindowApi } from "./types";
 
@@ -26,6 +27,22 @@ export function createDatabaseBridge(): WindowApi["database"] {
       const result = await ListGames(searchWord, filter, sort, sortDirection ?? "asc");
       return result.success && result.data ? result.data.map(toGameType) : [];
     },
+    listGamesPage: async (query) =>
+      toApiResult(
+        await ListGamesPage({
+          searchText: query.searchWord,
+          filter: query.filter,
+          sortBy: query.sort,
+          sortDirection: query.sortDirection ?? "asc",
+          cursor: query.cursor,
+          limit: query.limit ?? 0,
+        } as modelsDomain.GameListQuery),
+        "ゲーム一覧取得に失敗しました",
+        (data) => {
+          const page = data as modelsDomain.GamePage;
+          return { items: (page.items ?? []).map(toGameType), nextCursor: page.nextCursor };
+        },
+      ),
     getGameById: async (id) => {
       const result = await GetGameByID(id);
       if (!result.success) {
@@ -4,12 +4,22 @@
  * ID / タイトル検索の入力検証と URL 組み立てをフロント側で行い、Go に委譲する。
  */
 
-import { FetchFromErogameScape, SearchErogameScape } from "../../wailsjs/go/app/App";
+import {
+  FetchFromErogameScape,
+  FetchManyFromErogameScape,
+  SearchErogameScape,
+} from "../../wailsjs/go/app/App";
 import { getErrorMessage } from "./helpers";
 import type { GameImport } from "src/types/game";
-import type { ErogameScapeSearchResult } from "src/types/erogamescape";
+import type { ErogameScapeSearchResult, GameImportResult } from "src/types/erogamescape";
 import type { WindowApi } from "./types";
 
+function buildGameUrl(id: string): string {
+  return `https://erogamescape.dyndns.org/~ap2/ero/toukei_kaiseki/game.php?game=${encodeURIComponent(
+    id,
+  )}`;
+}
+
 export function createErogameScapeBridge(): WindowApi["erogameScape"] {
   return {
     fetchById: async (id) => {
@@ -17,9 +27,7 @@ export function createErogameScapeBridge(): WindowApi["erogameScape"] {
       if (!trimmed) {
         return { success: false, message: "批評空間IDを入力してください" };
       }
-      const url = `https://erogamescape.dyndns.org/~ap2/ero/toukei_kaiseki/game.php?game=${encodeURIComponent(
-        trimmed,
-      )}`;
+      const url = buildGameUrl(trimmed);
       try {
         const result = await FetchFromErogameScape(url);
         return { success: true, data: result as GameImport };
@@ -30,6 +38,21 @@ export function createErogameScapeBridge(): WindowApi["erogameScape"] {
         };
       }
     },
+    fetchManyByIds: async (ids) => {
+      const urls = ids.map((id) => id.trim()).filter((id) => id !== "").map(buildGameUrl);
+      if (urls.length === 0) {
+        return { success: false, message: "批評空間IDを入力してください" };
+      }
+      try {
+        const result = await FetchManyFromErogameScape(urls);
+        return { success: true, data: (result ?? []) as GameImportResult[] };
+      } catch (error) {
+        return {
+          success: false,
+          message: getErrorMessage(error, "批評空間からの一括取得に失敗しました"),
+        };
+      }
+    },
     searchByTitle: async (query, pageUrl) => {
       const trimmed = query.trim();
       if (!trimmed && !pageUrl) {
@@ -43,6 +43,7 @@ export function normalizeCloudDirectoryNode(
     lastModified: normalizeApiDate(node.lastModified),
     children: node.children?.map(normalizeCloudDirectoryNode),
     objectKey: node.objectKey,
+    fileCount: node.fileCount,
   };
 }
 
@@ -1,19 +1,23 @@
 /**
  * @fileoverview 画像 URL 解決ブリッジ。
  *
- * ローカルは Go 経由で data URL 化。Web はパスをそのまま返す（追加 fetch しない）。
+ * ローカルは Go のアセットハンドラ（/local-image）の URL に変換し、WebView に直接読ませる
+ * （data URL を bridge で受け渡さない）。Web はパスをそのまま返す（追加 fetch しない）。
  */
 
-import { LoadImageFromLocal } from "../../wailsjs/go/app/App";
 import type { WindowApi } from "./types";
 
+/** Go 側 internal/app/image_assets.go の localImageRoute と揃える。 */
+const LOCAL_IMAGE_ROUTE = "/local-image";
+
 export function createLoadImageBridge(): WindowApi["loadImage"] {
   return {
-    loadImageFromLocal: async (path) => {
-      const result = await LoadImageFromLocal(path);
-      return result.success
-        ? { success: true, data: result.data as string }
-        : { success: false, message: result.error?.message ?? "エラー" };
+    loadImageFromLocal: async (path, options) => {
+      const params = new URLSearchParams({ path });
+      if (options?.thumbnail) {
+        params.set("size", "thumb");
+      }
+      return { success: true, data: `${LOCAL_IMAGE_ROUTE}?${params.toString()}` };
     },
     // http(s) / data URL はそのまま <img src> に渡せるので Go を経由しない。
     loadImageFromWeb: async (src) => ({ success: true, data: src }),
@@ -1,10 +1,18 @@
 /**
- * @fileoverview エクスポート・フルバックアップ / リストアブリッジ。
+ * @fileoverview エクスポート・フルバックアップ / リストア・計測結果ブリッジ。
  */
 
-import { ExportGameData, CreateFullBackup, RestoreFullBackup } from "../../wailsjs/go/app/App";
+import {
+  ExportGameData,
+  CreateFullBackup,
+  CreateIncrementalBackup,
+  RestoreFullBackup,
+  RebuildGameStats,
+  GetPerformanceMetrics,
+  ResetPerformanceMetrics,
+} from "../../wailsjs/go/app/App";
 import { toApiResult, toApiResultVoid } from "./helpers";
-import type { WindowApi } from "./types";
+import type { PerformancePhaseMetrics, WindowApi } from "./types";
 
 export function createMaintenanceBridge(): WindowApi["maintenance"] {
   return {
@@ -16,6 +24,17 @@ export function createMaintenanceBridge(): WindowApi["maintenance"] {
       ),
     createFullBackup: async (outputDir) =>
       toApiResult(await CreateFullBackup(outputDir), "エラー", (d) => d as string),
+    createIncrementalBackup: async (baseBackupPath) =>
+      toApiResult(await CreateIncrementalBackup(baseBackupPath), "エラー", (d) => d as string),
     restoreFullBackup: async (backupPath) => toApiResultVoid(await RestoreFullBackup(backupPath)),
+    rebuildGameStats: async () =>
+      toApiResult(await RebuildGameStats(), "エラー", (d) => d as number),
+    getPerformanceMetrics: async () =>
+      toApiResult(
+        await GetPerformanceMetrics(),
+        "エラー",
+        (d) => (d ?? []) as PerformancePhaseMetrics[],
+      ),
+    resetPerformanceMetrics: async () => toApiResultVoid(await ResetPerformanceMetrics()),
   };
 }
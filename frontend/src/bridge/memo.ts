@@ -8,6 +8,7 @@ import {
   ListAllMemos,
   GetMemoByID,
   ListMemosByGame,
+  SearchMemos,
   CreateMemo,
   UpdateMemo,
   DeleteMemo,
@@ -27,6 +28,7 @@ import {
   toApiResultOptional,
   toApiResultVoid,
 } from "./helpers";
+import type { modelsDomain } from "./helpers";
 import type { MemoSyncResult } from "src/types/memo";
 import type { WindowApi } from "./types";
 
@@ -35,6 +37,20 @@ export function createMemoBridge(): WindowApi["memo"] {
     getAllMemos: async () => toApiResultArray(await ListAllMemos(), toMemoType),
     getMemoById: async (memoId) => toApiResultOptional(await GetMemoByID(memoId), toMemoType),
     getMemosByGameId: async (gameId) => toApiResultArray(await ListMemosByGame(gameId), toMemoType),
+    searchMemos: async (query) =>
+      toApiResult(
+        await SearchMemos({
+          query: query.query,
+          gameId: query.gameId,
+          cursor: query.cursor,
+          limit: query.limit ?? 0,
+        } as modelsDomain.MemoSearchQuery),
+        "メモ検索に失敗しました",
+        (data) => {
+          const page = data as modelsDomain.MemoPage;
+          return { items: (page.items ?? []).map(toMemoType), nextCursor: page.nextCursor };
+        },
+      ),
     createMemo: async (data) =>
       toApiResultOptional(
         await CreateMemo({ Title: data.title, Content: data.content, GameID: data.gameId }),
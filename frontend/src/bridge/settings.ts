@@ -17,6 +17,8 @@ import {
   UpdateScreenshotHotkeyNotify,
   UpdateS3ForcePathStyle,
   UpdateS3UseTLS,
+  UpdateS3Compression,
+  UpdateSaveHashParanoid,
   UpdateLogLevel,
 } from "../../wailsjs/go/app/App";
 import { toApiResultVoid } from "./helpers";
@@ -43,6 +45,9 @@ export function createSettingsBridge(): WindowApi["settings"] {
     updateS3ForcePathStyle: async (enabled) =>
       toApiResultVoid(await UpdateS3ForcePathStyle(enabled)),
     updateS3UseTLS: async (enabled) => toApiResultVoid(await UpdateS3UseTLS(enabled)),
+    updateS3Compression: async (enabled) => toApiResultVoid(await UpdateS3Compression(enabled)),
+    updateSaveHashParanoid: async (enabled) =>
+      toApiResultVoid(await UpdateSaveHashParanoid(enabled)),
     updateLogLevel: async (level) => toApiResultVoid(await UpdateLogLevel(level)),
   };
 }
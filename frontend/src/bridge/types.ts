@@ -13,7 +13,7 @@ import type {
   MonitoringGameStatus,
   GameImport,
 } from "src/types/game";
-import type { ErogameScapeSearchResult } from "src/types/erogamescape";
+import type { ErogameScapeSearchResult, GameImportResult } from "src/types/erogamescape";
 import type { SortOption, FilterOption, SortDirection } from "src/types/menu";
 import type {
   MemoType,
@@ -23,7 +23,61 @@ import type {
   CloudMemoInfo,
 } from "src/types/memo";
 import type { Creds } from "src/types/creds";
-import type { CloudDataItem, CloudDirectoryNode, CloudFileDetail } from "src/types/cloud";
+import type {
+  CloudDataItem,
+  CloudDirectoryChildren,
+  CloudDirectoryNode,
+  CloudFileDetail,
+} from "src/types/cloud";
+
+/** キーセットページングの1ページ分。nextCursor が無ければ最終ページ。 */
+export type Page<T> = {
+  items: T[];
+  nextCursor?: string;
+};
+
+export type GameListQuery = {
+  searchWord: string;
+  filter: FilterOption;
+  sort: SortOption;
+  sortDirection?: SortDirection;
+  /** 前ページの nextCursor。省略時は先頭から */
+  cursor?: string;
+  limit?: number;
+};
+
+export type MemoSearchQuery = {
+  query: string;
+  /** 省略時は全ゲームのメモを対象にする */
+  gameId?: string;
+  cursor?: string;
+  limit?: number;
+};
+
+/**
+ * 1段階分の計測結果。回数・量は起動からの通算、所要時間の分位点は直近 samples 件から計算する。
+ * name は "push" / "push.upload" / "push.upload.list_blobs" のようにドット区切りで入れ子を表す。
+ */
+export type PerformancePhaseMetrics = {
+  name: string;
+  count: number;
+  errors: number;
+  samples: number;
+  meanMs: number;
+  p50Ms: number;
+  p90Ms: number;
+  p99Ms: number;
+  maxMs: number;
+  /** ローカルで扱ったバイト数（セーブフォルダの走査など） */
+  bytes: number;
+  /** 扱ったファイル・ブロブ・ゲームの数 */
+  objects: number;
+  requests: number;
+  retries: number;
+  bytesSent: number;
+  bytesReceived: number;
+  lastAt: string;
+};
 
 export type SyncStatus = "never_synced" | "in_sync" | "push_needed" | "pull_needed" | "conflict";
 
@@ -47,6 +101,33 @@ export type SyncMetaSnapshot = {
   createdAt: Date;
 };
 
+/**
+ * statusMany の1ゲーム分。error があるときは detail を使わない。
+ * 判定が終わったゲームから "sync:status" イベントでも届く。
+ */
+export type GameSyncStatus = {
+  gameId: string;
+  detail: SyncStatusDetail;
+  error?: string;
+};
+
+/**
+ * collectGarbage の1ゲーム分。dryRun のときは deleted* が削除予定の件数・サイズ。
+ * graceBlobs は未参照だが猶予期間内のため残したブロブ数。
+ */
+export type GCReport = {
+  gameId: string;
+  dryRun: boolean;
+  head: string;
+  commits: number;
+  keptCommits: number;
+  scannedBlobs: number;
+  deletedBlobs: number;
+  deletedBytes: number;
+  graceBlobs: number;
+  sampleKeys?: string[];
+};
+
 export type SyncProgressEvent = {
   operation: "push" | "pull";
   current: number;
@@ -88,6 +169,8 @@ export type WindowApi = {
     updateScreenshotHotkeyNotify: (enabled: boolean) => Promise<ApiResult<void>>;
     updateS3ForcePathStyle: (enabled: boolean) => Promise<ApiResult<void>>;
     updateS3UseTLS: (enabled: boolean) => Promise<ApiResult<void>>;
+    updateS3Compression: (enabled: boolean) => Promise<ApiResult<void>>;
+    updateSaveHashParanoid: (enabled: boolean) => Promise<ApiResult<void>>;
     updateLogLevel: (level: string) => Promise<ApiResult<void>>;
   };
   maintenance: {
@@ -95,7 +178,15 @@ export type WindowApi = {
       outputDir: string,
     ) => Promise<ApiResult<{ jsonPath: string; csvPath: string }>>;
     createFullBackup: (outputDir: string) => Promise<ApiResult<string>>;
+    /** baseBackupPath（フル・増分）以降に変わったファイルだけを同じフォルダに保存する */
+    createIncrementalBackup: (baseBackupPath: string) => Promise<ApiResult<string>>;
+    /** 増分バックアップなら同じフォルダの基準バックアップを辿って復元する */
     restoreFullBackup: (backupPath: string) => Promise<ApiResult<void>>;
+    /** プレイ統計を再集計し、食い違っていたゲーム・ルートの数を返す */
+    rebuildGameStats: () => Promise<ApiResult<number>>;
+    /** 同期・一覧・プロセス監視の段階ごとの計測結果（段階名の昇順） */
+    getPerformanceMetrics: () => Promise<ApiResult<PerformancePhaseMetrics[]>>;
+    resetPerformanceMetrics: () => Promise<ApiResult<void>>;
   };
   file: {
     selectFile: (filters?: { name: string; extensions: string[] }[]) => Promise<ApiResult<string>>;
@@ -111,6 +202,8 @@ export type WindowApi = {
       sort: SortOption,
       sortDirection?: SortDirection,
     ) => Promise<GameType[]>;
+    /** 仮想スクロール・入力中の検索向けに1ページ分だけ取得する */
+    listGamesPage: (query: GameListQuery) => Promise<ApiResult<Page<GameType>>>;
     getGameById: (id: string) => Promise<GameType | undefined>;
     createGame: (game: InputGameData) => Promise<ApiResult<void>>;
     updateGame: (id: string, game: InputGameData) => Promise<ApiResult<void>>;
@@ -130,6 +223,8 @@ export type WindowApi = {
     // Go は該当なしで nil。undefined 込みにし、無いデータを有値キャストしない。
     getMemoById: (memoId: string) => Promise<ApiResult<MemoType | undefined>>;
     getMemosByGameId: (gameId: string) => Promise<ApiResult<MemoType[]>>;
+    /** タイトル・本文を全文検索し、更新日時の新しい順に1ページ分取得する */
+    searchMemos: (query: MemoSearchQuery) => Promise<ApiResult<Page<MemoType>>>;
     createMemo: (data: CreateMemoData) => Promise<ApiResult<MemoType | undefined>>;
     updateMemo: (memoId: string, data: UpdateMemoData) => Promise<ApiResult<void>>;
     deleteMemo: (memoId: string) => Promise<ApiResult<void>>;
@@ -154,6 +249,12 @@ export type WindowApi = {
     getDirectoryTree: () => Promise<ApiResult<CloudDirectoryNode[]>>;
     /** 開いたゲームだけファイル一覧を遅延取得する。 */
     getGameDirectoryNode: (gameId: string) => Promise<ApiResult<CloudDirectoryNode>>;
+    /** ゲーム内の path（"" はゲーム直下）直下を1ページ分取得する。ディレクトリの children は未取得。 */
+    getDirectoryChildren: (
+      gameId: string,
+      path: string,
+      cursor?: string,
+    ) => Promise<ApiResult<CloudDirectoryChildren>>;
     deleteCloudData: (path: string) => Promise<ApiResult<void>>;
     deleteFile: (path: string) => Promise<ApiResult<void>>;
     getCloudFileDetails: (path: string) => Promise<ApiResult<CloudFileDetail[]>>;
@@ -166,7 +267,11 @@ export type WindowApi = {
     };
   };
   loadImage: {
-    loadImageFromLocal: (path: string) => Promise<ApiResult<string>>;
+    /** ローカル画像の表示用 URL を返す。thumbnail なら縮小済みのサムネイルを配信する。 */
+    loadImageFromLocal: (
+      path: string,
+      options?: { thumbnail?: boolean },
+    ) => Promise<ApiResult<string>>;
     loadImageFromWeb: (src: string) => Promise<ApiResult<string>>;
   };
   processMonitor: {
@@ -196,6 +301,7 @@ export type WindowApi = {
   };
   cloudSync: {
     status: (gameId: string) => Promise<ApiResult<SyncStatusDetail>>;
+    statusMany: (gameIds: string[]) => Promise<ApiResult<GameSyncStatus[]>>;
     push: (gameId: string) => Promise<ApiResult<void>>;
     pull: (gameId: string, deleteUntracked?: boolean) => Promise<ApiResult<PullResult>>;
     resolveConflict: (
@@ -204,7 +310,10 @@ export type WindowApi = {
       deleteUntracked?: boolean,
     ) => Promise<ApiResult<PullResult>>;
     deleteFromCloud: (gameId: string) => Promise<ApiResult<void>>;
+    /** gameId 省略時は全ゲーム。dryRun なら削除せず報告のみ */
+    collectGarbage: (gameId?: string, dryRun?: boolean) => Promise<ApiResult<GCReport[]>>;
     onProgress: (callback: (event: SyncProgressEvent) => void) => () => void;
+    onStatus: (callback: (event: GameSyncStatus) => void) => () => void;
   };
   game: {
     launchGame: (exePath: string) => Promise<ApiResult<void>>;
@@ -212,6 +321,8 @@ export type WindowApi = {
   };
   erogameScape: {
     fetchById: (id: string) => Promise<ApiResult<GameImport>>;
+    /** 複数IDをまとめて取得する。結果は入力順で、失敗は1件ごとに error に入る。 */
+    fetchManyByIds: (ids: string[]) => Promise<ApiResult<GameImportResult[]>>;
     searchByTitle: (
       query: string,
       pageUrl?: string,
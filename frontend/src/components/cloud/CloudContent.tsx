@@ -9,6 +9,7 @@ import { FiCloud, FiFolder } from "react-icons/fi";
 
 import type { ViewMode } from "./CloudHeader";
 import { DirectoryNodeCard } from "./CloudItemCard";
+import CloudLoadMoreButton from "./CloudLoadMoreButton";
 import CloudTreeNode from "./CloudTreeNode";
 import type { CloudDirectoryNode } from "src/types/cloud";
 import type { CloudPathSegment } from "@renderer/utils/cloudUtils";
@@ -16,8 +17,8 @@ import type { CloudPathSegment } from "@renderer/utils/cloudUtils";
 type CloudContentProps = {
   viewMode: ViewMode;
   loading: boolean;
-  gameLoading?: boolean;
-  loadingGameIds?: Set<string>;
+  directoryLoading?: boolean;
+  loadingPaths?: Set<string>;
   directoryTree: CloudDirectoryNode[];
   currentPath: CloudPathSegment[];
   currentDirectoryNodes: CloudDirectoryNode[];
@@ -27,8 +28,13 @@ type CloudContentProps = {
   onDelete: (item: CloudDirectoryNode) => void;
   onNavigateToDirectory: (node: CloudDirectoryNode) => void;
   onViewDetails: (item: CloudDirectoryNode) => void;
+  /** カードビューで開いているディレクトリに続きのページがあるか */
+  currentDirectoryHasMore?: boolean;
+  /** path のディレクトリの続きのページを読み込む */
+  onLoadMore?: (path: string) => void;
 };
 
+
 function EmptyState({
   icon: Icon,
   title,
@@ -50,8 +56,8 @@ function EmptyState({
 export function CloudContent({
   viewMode,
   loading,
-  gameLoading = false,
-  loadingGameIds,
+  directoryLoading = false,
+  loadingPaths,
   directoryTree,
   currentPath,
   currentDirectoryNodes,
@@ -61,7 +67,11 @@ export function CloudContent({
   onDelete,
   onNavigateToDirectory,
   onViewDetails,
+  currentDirectoryHasMore = false,
+  onLoadMore,
 }: CloudContentProps): React.JSX.Element {
+  const openDirectoryPath = currentPath.length > 0 ? currentPath[currentPath.length - 1].id : "";
+
   if (loading) {
     return (
       <div className="flex justify-center py-12">
@@ -94,7 +104,7 @@ export function CloudContent({
               ))}
             </div>
           )
-        ) : gameLoading ? (
+        ) : directoryLoading ? (
           <div className="flex justify-center py-12">
             <div className="loading loading-spinner loading-lg"></div>
           </div>
@@ -106,17 +116,27 @@ export function CloudContent({
             description="ファイルやサブディレクトリがありません"
           />
         ) : (
-          <div className="grid grid-cols-1 md:grid-cols-2 lg:grid-cols-3 gap-4">
-            {currentDirectoryNodes.map((node, index) => (
-              <DirectoryNodeCard
-                key={`${node.path}-${index}`}
-                node={node}
-                onNavigate={node.isDirectory ? () => onNavigateToDirectory(node) : undefined}
-                onViewDetails={onViewDetails}
-                // onDelete は渡さない：サブノードの個別削除は履歴破壊になるため不可
-              />
-            ))}
-          </div>
+          <>
+            <div className="grid grid-cols-1 md:grid-cols-2 lg:grid-cols-3 gap-4">
+              {currentDirectoryNodes.map((node, index) => (
+                <DirectoryNodeCard
+                  key={`${node.path}-${index}`}
+                  node={node}
+                  onNavigate={node.isDirectory ? () => onNavigateToDirectory(node) : undefined}
+                  onViewDetails={onViewDetails}
+                  // onDelete は渡さない：サブノードの個別削除は履歴破壊になるため不可
+                />
+              ))}
+            </div>
+            {currentDirectoryHasMore && onLoadMore && (
+              <div className="flex justify-center mt-4">
+                <CloudLoadMoreButton
+                  loading={loadingPaths?.has(openDirectoryPath) ?? false}
+                  onClick={() => onLoadMore(openDirectoryPath)}
+                />
+              </div>
+            )}
+          </>
         )}
       </div>
     );
@@ -138,10 +158,11 @@ export function CloudContent({
                 node={node}
                 level={0}
                 expandedNodes={expandedNodes}
-                loadingGameIds={loadingGameIds}
+                loadingPaths={loadingPaths}
                 onToggleExpand={onToggleExpand}
                 onDelete={onDelete}
                 onSelect={onSelectNode}
+                onLoadMore={onLoadMore}
               />
             </div>
           ))}
@@ -0,0 +1,22 @@
+/**
+ * @fileoverview クラウドディレクトリの続き読み込みボタン
+ *
+ * 大きなディレクトリは開いた時点では先頭ページだけ取得し、続きはこのボタンで1ページずつ読み込む。
+ */
+
+type CloudLoadMoreButtonProps = {
+  loading: boolean;
+  onClick: () => void;
+};
+
+export default function CloudLoadMoreButton({
+  loading,
+  onClick,
+}: CloudLoadMoreButtonProps): React.JSX.Element {
+  return (
+    <button type="button" className="btn btn-sm btn-ghost" onClick={onClick} disabled={loading}>
+      {loading && <span className="loading loading-spinner loading-xs"></span>}
+      {loading ? "読み込み中..." : "さらに読み込む"}
+    </button>
+  );
+}
@@ -6,6 +6,7 @@
 
 import { FiFolder, FiFile, FiTrash2, FiChevronRight, FiChevronDown } from "react-icons/fi";
 
+import CloudLoadMoreButton from "./CloudLoadMoreButton";
 import type { CloudDirectoryNode } from "src/types/cloud";
 import {
   formatFileSize,
@@ -18,26 +19,29 @@ type CloudTreeNodeProps = {
   node: CloudDirectoryNode;
   level: number;
   expandedNodes: Set<string>;
-  loadingGameIds?: Set<string>;
+  loadingPaths?: Set<string>;
   onToggleExpand: (path: string) => void;
   onDelete: (node: CloudDirectoryNode) => void;
   onSelect: (node: CloudDirectoryNode) => void;
+  /** 途中のページまで取得したディレクトリの続きを読み込む */
+  onLoadMore?: (path: string) => void;
 };
 
 export default function CloudTreeNode({
   node,
   level,
   expandedNodes,
-  loadingGameIds,
+  loadingPaths,
   onToggleExpand,
   onDelete,
   onSelect,
+  onLoadMore,
 }: CloudTreeNodeProps): React.JSX.Element {
   const isExpanded = expandedNodes.has(node.path);
   const hasChildren = node.children && node.children.length > 0;
-  const isLoading = loadingGameIds?.has(node.path) ?? false;
+  const isLoading = loadingPaths?.has(node.path) ?? false;
   // 表示用メトリクスとナビゲーション可否を共通ヘルパーから取り出す。
-  // childrenLoaded は未取得ゲームの展開ボタン表示／ローディング案内に使う。
+  // childrenLoaded は未取得ディレクトリの展開ボタン表示／ローディング案内に使う。
   const {
     childrenLoaded,
     count: displayCount,
@@ -121,16 +125,26 @@ export default function CloudTreeNode({
               node={child}
               level={level + 1}
               expandedNodes={expandedNodes}
-              loadingGameIds={loadingGameIds}
+              loadingPaths={loadingPaths}
               onToggleExpand={onToggleExpand}
               onDelete={onDelete}
               onSelect={onSelect}
+              onLoadMore={onLoadMore}
             />
           ))}
         </div>
       )}
 
-      {/* 未取得ゲームを展開した直後はファイル一覧を遅延取得中 */}
+      {isExpanded && node.nextCursor && onLoadMore && (
+        <div
+          className="px-3 py-1"
+          style={{ paddingLeft: `${(level + 1) * 1.5 + 0.75}rem` }}
+        >
+          <CloudLoadMoreButton loading={isLoading} onClick={() => onLoadMore(node.path)} />
+        </div>
+      )}
+
+      {/* 未取得ディレクトリを展開した直後は直下を遅延取得中 */}
       {isExpanded && !childrenLoaded && (
         <div
           className="flex items-center gap-2 px-3 py-2 text-xs text-base-content/60"
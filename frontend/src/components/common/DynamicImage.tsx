@@ -5,21 +5,28 @@
  * 画像が存在しない場合にNoImage画像を表示します。
  */
 
-import { memo } from "react";
+import { memo, useEffect, useState } from "react";
 
-import { useImageLoader } from "@renderer/hooks/useImageLoader";
+import { createNoImageDataUrl, useImageLoader } from "@renderer/hooks/useImageLoader";
 
 import type { ImgHTMLAttributes } from "react";
 
 type DynamicImgProps = Omit<ImgHTMLAttributes<HTMLImageElement>, "src"> & {
   src: string; // 普通のURL or ローカルファイルパス（空文字列の場合はNoImage）
+  thumbnail?: boolean; // ローカル画像を縮小済みサムネイルで表示する（一覧のカード向け）
 };
 
 const DynamicImage = memo(function DynamicImage({
   src: originalSrc,
+  thumbnail = false,
   ...imgProps
 }: DynamicImgProps): React.JSX.Element {
-  const { imageSrc, isLoading } = useImageLoader(originalSrc);
+  const { imageSrc, isLoading } = useImageLoader(originalSrc, thumbnail);
+  // ローカル画像は URL を返すだけなので、ファイルが無い等の失敗は <img> の読み込みで初めて分かる
+  const [failed, setFailed] = useState(false);
+  useEffect(() => {
+    setFailed(false);
+  }, [imageSrc]);
 
   if (isLoading && !imageSrc) {
     return (
@@ -37,7 +44,16 @@ const DynamicImage = memo(function DynamicImage({
   }
 
   if (imageSrc) {
-    return <img src={imageSrc} {...imgProps} />;
+    return (
+      <img
+        src={failed ? createNoImageDataUrl() : imageSrc}
+        {...imgProps}
+        onError={(event) => {
+          setFailed(true);
+          imgProps.onError?.(event);
+        }}
+      />
+    );
   }
 
   // フォールバック（通常は発生しない）
@@ -10,18 +10,30 @@ import { Link } from "react-router-dom";
 
 import DynamicImage from "../common/DynamicImage";
 import type { GameType } from "src/types/game";
+import type { SyncStatus } from "src/wailsBridge";
 
 type GameCardProps = {
   game: GameType;
   onLaunchGame: (game: GameType) => void;
   hasLaunchWarning?: boolean;
+  /** クラウドとの同期状態（未判定・対象外なら undefined） */
+  syncStatus?: SyncStatus;
+};
+
+// 同期が必要な状態だけバッジを出す（in_sync / never_synced は出さない）
+const SYNC_BADGES: Partial<Record<SyncStatus, { label: string; className: string }>> = {
+  push_needed: { label: "未アップロード", className: "badge-info" },
+  pull_needed: { label: "クラウドが新しい", className: "badge-warning" },
+  conflict: { label: "競合", className: "badge-error" },
 };
 
 const GameCard = memo(function GameCard({
   game,
   onLaunchGame,
   hasLaunchWarning = false,
+  syncStatus,
 }: GameCardProps): React.JSX.Element {
+  const syncBadge = syncStatus ? SYNC_BADGES[syncStatus] : undefined;
   const handleLaunchClick = useCallback(
     (e: React.MouseEvent) => {
       e.preventDefault();
@@ -42,10 +54,16 @@ const GameCard = memo(function GameCard({
         <div className="group relative h-40 w-full bg-base-200">
           <DynamicImage
             src={game.imagePath || ""}
+            thumbnail
             alt={game.title}
             className="h-full w-full object-cover"
             loading="lazy"
           />
+          {syncBadge && (
+            <span className={`badge badge-sm ${syncBadge.className} absolute top-2 left-2`}>
+              {syncBadge.label}
+            </span>
+          )}
           <div
             className="
             absolute inset-0
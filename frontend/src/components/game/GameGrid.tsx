@@ -4,23 +4,61 @@
  * このコンポーネントは、ゲームカードをグリッド形式で表示します。
  */
 
-import { memo } from "react";
+import { memo, useEffect, useRef } from "react";
 
 import GameCard from "./GameCard";
 import type { GameType } from "src/types/game";
+import type { SyncStatus } from "src/wailsBridge";
 
 type GameGridProps = {
   games: GameType[];
   onLaunchGame: (game: GameType) => void;
   /** 起動警告が必要なゲームID一覧 */
   warningGameIds?: ReadonlySet<string>;
+  /** ゲームID → クラウドとの同期状態（判定済みのゲームだけ） */
+  syncStatuses?: ReadonlyMap<string, SyncStatus>;
+  /** 続きのページがあるか。true の間、末尾が見えたら onLoadMore を呼ぶ */
+  hasMore?: boolean;
+  onLoadMore?: () => void;
 };
 
 const GameGrid = memo(function GameGrid({
   games,
   onLaunchGame,
   warningGameIds,
+  syncStatuses,
+  hasMore = false,
+  onLoadMore,
 }: GameGridProps): React.JSX.Element {
+  const scrollRef = useRef<HTMLDivElement>(null);
+  const sentinelRef = useRef<HTMLDivElement>(null);
+
+  // 末尾の番兵が見えたら続きを読む。件数が変わるたびに監視し直すので、
+  // 読み込んだページで画面が埋まらなければ続けて次のページを読む。
+  useEffect(() => {
+    const root = scrollRef.current;
+    const sentinel = sentinelRef.current;
+    if (
+      !hasMore ||
+      !onLoadMore ||
+      !root ||
+      !sentinel ||
+      typeof IntersectionObserver === "undefined"
+    ) {
+      return;
+    }
+    const observer = new IntersectionObserver(
+      (entries) => {
+        if (entries.some((entry) => entry.isIntersecting)) {
+          onLoadMore();
+        }
+      },
+      { root, rootMargin: "0px 0px 400px 0px" },
+    );
+    observer.observe(sentinel);
+    return () => observer.disconnect();
+  }, [games.length, hasMore, onLoadMore]);
+
   if (games.length === 0) {
     return (
       <div className="flex-1 flex items-center justify-center min-h-0">
@@ -37,7 +75,10 @@ const GameGrid = memo(function GameGrid({
   }
 
   return (
-    <div className="flex-1 overflow-auto scrollbar-thin scrollbar-thumb-base-content/30 scrollbar-track-transparent min-h-0">
+    <div
+      ref={scrollRef}
+      className="flex-1 overflow-auto scrollbar-thin scrollbar-thumb-base-content/30 scrollbar-track-transparent min-h-0"
+    >
       <div className="relative">
         <div
           className="grid gap-5 justify-center px-6 pb-6"
@@ -49,9 +90,11 @@ const GameGrid = memo(function GameGrid({
               game={game}
               onLaunchGame={onLaunchGame}
               hasLaunchWarning={warningGameIds?.has(game.id) ?? false}
+              syncStatus={syncStatuses?.get(game.id)}
             />
           ))}
         </div>
+        {hasMore && <div ref={sentinelRef} aria-hidden="true" className="h-px" />}
       </div>
     </div>
   );
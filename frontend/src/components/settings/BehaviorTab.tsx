@@ -13,10 +13,12 @@ export default function BehaviorTab(): React.JSX.Element {
     offlineMode,
     autoTracking,
     transferConcurrency,
+    saveHashParanoid,
     setTransferConcurrency,
     handleOfflineModeChange,
     handleAutoTrackingChange,
     handleTransferConcurrencyChange,
+    handleSaveHashParanoidChange,
   } = useBehaviorSettings();
 
   return (
@@ -84,6 +86,25 @@ export default function BehaviorTab(): React.JSX.Element {
               アップロード/ダウンロード共通の同時転送数です
             </p>
           </div>
+
+          <div className="form-control mt-4">
+            <label className="label cursor-pointer justify-start p-0">
+              <input
+                type="checkbox"
+                className="toggle toggle-primary mr-3"
+                checked={saveHashParanoid}
+                onChange={(e) => void handleSaveHashParanoidChange(e.target.checked)}
+              />
+              <div>
+                <span className="label-text font-medium">セーブファイルを毎回再ハッシュ</span>
+                <p className="text-xs text-base-content/50 mt-1">
+                  {saveHashParanoid
+                    ? "サイズ・更新日時が同じファイルも毎回読み直して比較（低速）"
+                    : "サイズ・更新日時が変わっていないファイルはキャッシュ済みハッシュを使用"}
+                </p>
+              </div>
+            </label>
+          </div>
         </div>
       </div>
     </div>
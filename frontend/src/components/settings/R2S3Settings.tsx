@@ -13,7 +13,7 @@ import { SettingsToggle } from "./SettingsToggle";
 import { useConnectionStatus } from "../../hooks/useConnectionStatus";
 import { useOfflineMode } from "../../hooks/useOfflineMode";
 import { useSettingsFormZod } from "../../hooks/useSettingsFormZod";
-import { s3ForcePathStyleAtom, s3UseTLSAtom } from "../../state/settings";
+import { s3CompressionAtom, s3ForcePathStyleAtom, s3UseTLSAtom } from "../../state/settings";
 import { getOfflineDisabledClasses } from "../../utils/offlineUtils";
 import { logger } from "../../utils/logger";
 
@@ -37,6 +37,7 @@ export default function R2S3Settings(): React.JSX.Element {
   const { isOfflineMode, checkNetworkFeature } = useOfflineMode();
   const [s3ForcePathStyle, setS3ForcePathStyle] = useAtom(s3ForcePathStyleAtom);
   const [s3UseTLS, setS3UseTLS] = useAtom(s3UseTLSAtom);
+  const [s3Compression, setS3Compression] = useAtom(s3CompressionAtom);
 
   const handleForcePathStyleChange = async (enabled: boolean): Promise<void> => {
     const result = await window.api.settings.updateS3ForcePathStyle(enabled);
@@ -66,6 +67,20 @@ export default function R2S3Settings(): React.JSX.Element {
     setS3UseTLS(enabled);
   };
 
+  const handleCompressionChange = async (enabled: boolean): Promise<void> => {
+    const result = await window.api.settings.updateS3Compression(enabled);
+    if (!result.success) {
+      logger.error("Compression 更新エラー:", {
+        component: "R2S3Settings",
+        function: "handleCompressionChange",
+        data: result.message,
+      });
+      toast.error("圧縮設定の更新に失敗しました");
+      return;
+    }
+    setS3Compression(enabled);
+  };
+
   const handleConnectionTest = (): void => {
     if (!checkNetworkFeature("接続テスト")) {
       return;
@@ -221,6 +236,13 @@ export default function R2S3Settings(): React.JSX.Element {
           onChange={(value) => void handleUseTLSChange(value)}
           disabled={isOfflineMode}
         />
+        <SettingsToggle
+          label="セーブデータを圧縮して転送"
+          description="縮むブロブだけ gzip で保存します。圧縮済みデータは旧バージョンでは読めません"
+          checked={s3Compression}
+          onChange={(value) => void handleCompressionChange(value)}
+          disabled={isOfflineMode}
+        />
       </div>
 
       <div className="form-control mt-6 flex justify-end space-x-2">
@@ -24,6 +24,7 @@ export default function SyncAndLogsTab(): React.JSX.Element {
     handleSyncAllGames,
     handleExportGameData,
     handleCreateBackup,
+    handleCreateIncrementalBackup,
     handleRestoreBackup,
     handleOpenLogsDirectory,
   } = useSyncAndLogsActions();
@@ -115,6 +116,13 @@ export default function SyncAndLogsTab(): React.JSX.Element {
           >
             {isCreatingBackup ? "バックアップ作成中..." : "バックアップを作成"}
           </button>
+          <button
+            className="btn btn-outline btn-sm w-fit"
+            onClick={() => void handleCreateIncrementalBackup()}
+            disabled={isCreatingBackup}
+          >
+            増分バックアップを作成
+          </button>
           <button
             className="btn btn-warning btn-sm w-fit"
             onClick={() => void handleRestoreBackup()}
@@ -123,6 +131,7 @@ export default function SyncAndLogsTab(): React.JSX.Element {
             {isRestoringBackup ? "復元中..." : "バックアップを復元"}
           </button>
           <p className="text-xs text-base-content/50 mt-1">
+            増分は選んだバックアップ以降の変更だけを同じフォルダに保存します。復元時は同じフォルダの元のバックアップも必要です。
             復元時は現在のローカルデータを上書きします（認証情報はOS管理のため対象外）
           </p>
         </div>
@@ -177,6 +186,13 @@ export default function SyncAndLogsTab(): React.JSX.Element {
             プロセス監視デバッグを開く
           </Link>
           <p className="text-xs text-base-content/50 mt-2">プロセス監視の取得結果を確認します</p>
+
+          <Link to="/debug/performance" className="btn btn-outline btn-sm w-fit mt-4">
+            計測デバッグを開く
+          </Link>
+          <p className="text-xs text-base-content/50 mt-2">
+            同期や一覧の段階ごとの所要時間・リクエスト数を確認します（詳細はログレベル debug で記録）
+          </p>
         </div>
       </div>
     </div>
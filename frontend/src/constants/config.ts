@@ -29,6 +29,8 @@ export const CONFIG = {
     CARD_WIDTH: "220px",
     FLOATING_BUTTON_POSITION: "bottom-16 right-6",
     ICON_SIZE: 28,
+    /** ホームのゲーム一覧で1回に読み込む件数（続きはスクロールで読み込む） */
+    GAME_LIST_PAGE_SIZE: 60,
   },
 
   // ファイル関連
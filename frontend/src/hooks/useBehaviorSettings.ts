@@ -1,5 +1,5 @@
 /**
- * @fileoverview 動作設定（オフライン / 自動検出 / 同時転送）の更新ハンドラ。
+ * @fileoverview 動作設定（オフライン / 自動検出 / 同時転送 / ハッシュ検証）の更新ハンドラ。
  *
  * atom はバックエンド更新成功後に書き換える（同時転送の入力中ドラフトは除く）。
  */
@@ -12,12 +12,14 @@ import {
   offlineModeAtom,
   autoTrackingAtom,
   transferConcurrencyAtom,
+  saveHashParanoidAtom,
 } from "@renderer/state/settings";
 
 export function useBehaviorSettings() {
   const [offlineMode, setOfflineMode] = useAtom(offlineModeAtom);
   const [autoTracking, setAutoTracking] = useAtom(autoTrackingAtom);
   const [transferConcurrency, setTransferConcurrency] = useAtom(transferConcurrencyAtom);
+  const [saveHashParanoid, setSaveHashParanoid] = useAtom(saveHashParanoidAtom);
 
   const handleOfflineModeChange = async (enabled: boolean): Promise<void> => {
     // バックエンド ContentSyncService にも反映しないと、process_monitor 経由の
@@ -87,13 +89,29 @@ export function useBehaviorSettings() {
     await applyTransferConcurrency(nextValue, true);
   };
 
+  const handleSaveHashParanoidChange = async (enabled: boolean): Promise<void> => {
+    const result = await window.api.settings.updateSaveHashParanoid(enabled);
+    if (!result.success) {
+      logger.error("ハッシュ検証設定の更新エラー:", {
+        component: "useBehaviorSettings",
+        function: "handleSaveHashParanoidChange",
+        data: result.message,
+      });
+      toast.error("ハッシュ検証設定の更新に失敗しました");
+      return;
+    }
+    setSaveHashParanoid(enabled);
+  };
+
   return {
     offlineMode,
     autoTracking,
     transferConcurrency,
+    saveHashParanoid,
     setTransferConcurrency,
     handleOfflineModeChange,
     handleAutoTrackingChange,
     handleTransferConcurrencyChange,
+    handleSaveHashParanoidChange,
   };
 }
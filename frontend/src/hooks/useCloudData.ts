@@ -11,9 +11,11 @@ import { logger } from "@renderer/utils/logger";
 
 import type { CloudDataItem, CloudDirectoryNode, CloudFileDetail } from "src/types/cloud";
 import {
+  appendCloudNodeChildren,
   computeCloudNodeMetrics,
   getNodesByPath,
   latestModifiedRecursively,
+  replaceCloudNodeChildren,
   type CloudPathSegment,
 } from "@renderer/utils/cloudUtils";
 
@@ -26,10 +28,13 @@ export type UseCloudDataReturn = {
   loading: boolean;
   currentPath: CloudPathSegment[];
   currentDirectoryNodes: CloudDirectoryNode[];
-  loadingGameIds: Set<string>;
+  loadingPaths: Set<string>;
 
   fetchCloudData: () => Promise<void>;
-  ensureGameLoaded: (gameId: string) => Promise<void>;
+  /** ディレクトリ（ゲームノード含む）の直下を遅延取得する */
+  ensureDirectoryLoaded: (path: string) => Promise<void>;
+  /** ensureDirectoryLoaded で途中のページまで取得したディレクトリの次のページを取得する */
+  loadMoreDirectory: (path: string) => Promise<void>;
   navigateToDirectory: (node: CloudDirectoryNode) => void;
   navigateBack: () => void;
   navigateToPath: (newPath: CloudPathSegment[]) => void;
@@ -59,14 +64,16 @@ export function useCloudData(): UseCloudDataReturn {
     directoryTree: [] as CloudDirectoryNode[],
     loading: true,
     currentPath: [] as CloudPathSegment[],
-    loadingGameIds: new Set<string>(),
+    loadingPaths: new Set<string>(),
   });
 
   const navigationCacheRef = useRef<Map<string, CloudDirectoryNode[]>>(new Map());
-  // 詳細を取得済みのゲームID（再ナビゲーション時の二重取得を防ぐ）
-  const loadedGamesRef = useRef<Set<string>>(new Set());
-  // 取得中のゲームID（同時呼び出しによる二重取得を防ぐ）
-  const loadingGamesRef = useRef<Set<string>>(new Set());
+  // 直下を取得済みのディレクトリ path（再ナビゲーション時の二重取得を防ぐ）
+  const loadedPathsRef = useRef<Set<string>>(new Set());
+  // 取得中のディレクトリ path（同時呼び出しによる二重取得を防ぐ）
+  const loadingPathsRef = useRef<Set<string>>(new Set());
+  // 途中のページまで取得したディレクトリ path → 続きのカーソル
+  const nextCursorsRef = useRef<Map<string, string>>(new Map());
 
   const currentDirectoryNodes = useMemo(() => {
     if (state.directoryTree.length === 0) return [];
@@ -79,7 +86,7 @@ export function useCloudData(): UseCloudDataReturn {
 
   /**
    * クラウドデータ一覧（タイトルのみ）を取得する。
-   * 初期表示ではファイル数・サイズは取得せず、ゲームを開いたときに ensureGameLoaded で遅延取得する。
+   * 初期表示ではファイル一覧は取得せず、ディレクトリを開いたときに ensureDirectoryLoaded で1階層ずつ遅延取得する。
    */
   const fetchCloudData = useCallback(async (): Promise<void> => {
     setState((prev) => ({ ...prev, loading: true }));
@@ -110,15 +117,16 @@ export function useCloudData(): UseCloudDataReturn {
         fileCount: summary.fileCount,
       }));
 
-      loadedGamesRef.current.clear();
-      loadingGamesRef.current.clear();
+      loadedPathsRef.current.clear();
+      loadingPathsRef.current.clear();
+      nextCursorsRef.current.clear();
       clearNavigationCache();
       setState({
         cloudData: buildCloudDataFromTree(topNodes),
         directoryTree: topNodes,
         loading: false,
         currentPath: [],
-        loadingGameIds: new Set(),
+        loadingPaths: new Set(),
       });
     } catch (error) {
       logger.error("クラウドデータ取得エラー:", {
@@ -132,47 +140,47 @@ export function useCloudData(): UseCloudDataReturn {
   }, [clearNavigationCache]);
 
   /**
-   * 指定ゲームのファイル一覧（サイズ付き）を遅延取得し、ディレクトリツリーへマージする。
-   * 取得済み・取得中のゲームは再取得しない。
+   * path のディレクトリ直下の1ページ（cursor が空なら先頭）を取得してツリーへマージする。
+   * 先頭ページは children を差し替え、続きのページは後ろに足す。取得中の path は二重に取得しない。
    */
-  const ensureGameLoaded = useCallback(
-    async (gameId: string): Promise<void> => {
-      if (!gameId) {
-        return;
-      }
-      if (loadedGamesRef.current.has(gameId) || loadingGamesRef.current.has(gameId)) {
-        return;
-      }
-      loadingGamesRef.current.add(gameId);
+  const fetchDirectoryPage = useCallback(
+    async (path: string, cursor: string): Promise<void> => {
+      // path は "<gameId>" または "<gameId>/<ゲーム内の相対パス>"。
+      const separator = path.indexOf("/");
+      const gameId = separator < 0 ? path : path.slice(0, separator);
+      const relPath = separator < 0 ? "" : path.slice(separator + 1);
+      loadingPathsRef.current.add(path);
       setState((prev) => {
-        const next = new Set(prev.loadingGameIds);
-        next.add(gameId);
-        return { ...prev, loadingGameIds: next };
+        const next = new Set(prev.loadingPaths);
+        next.add(path);
+        return { ...prev, loadingPaths: next };
       });
 
       try {
-        const result = await window.api.cloudData.getGameDirectoryNode(gameId);
+        const result = await window.api.cloudData.getDirectoryChildren(gameId, relPath, cursor);
         if (!result.success || !result.data) {
-          logger.warn("ゲームのディレクトリ取得に失敗しました", {
+          logger.warn("クラウドのディレクトリ取得に失敗しました", {
             component: "useCloudData",
-            function: "ensureGameLoaded",
-            data: gameId,
+            function: "fetchDirectoryPage",
+            data: path,
           });
           toast.error("ゲームのデータ取得に失敗しました");
           return;
         }
+        const { nodes, nextCursor } = result.data;
 
-        // undefined=未取得、[]=取得済み空。区別しないと再取得が走る／走らないが壊れる。
-        const loadedNode: CloudDirectoryNode = {
-          ...result.data,
-          children: result.data.children ?? [],
-        };
-        loadedGamesRef.current.add(gameId);
+        loadedPathsRef.current.add(path);
+        if (nextCursor) {
+          nextCursorsRef.current.set(path, nextCursor);
+        } else {
+          nextCursorsRef.current.delete(path);
+        }
         clearNavigationCache();
         setState((prev) => {
-          const directoryTree = prev.directoryTree.map((node) =>
-            node.path === gameId ? loadedNode : node,
-          );
+          // undefined=未取得、[]=取得済み空。区別しないと再取得が走る／走らないが壊れる。
+          const directoryTree = cursor
+            ? appendCloudNodeChildren(prev.directoryTree, path, nodes, nextCursor)
+            : replaceCloudNodeChildren(prev.directoryTree, path, nodes, nextCursor);
           return {
             ...prev,
             directoryTree,
@@ -180,24 +188,54 @@ export function useCloudData(): UseCloudDataReturn {
           };
         });
       } catch (error) {
-        logger.error("ゲームのデータ取得エラー:", {
+        logger.error("クラウドのディレクトリ取得エラー:", {
           component: "useCloudData",
-          function: "ensureGameLoaded",
+          function: "fetchDirectoryPage",
           data: error,
         });
         toast.error("ゲームのデータ取得に失敗しました");
       } finally {
-        loadingGamesRef.current.delete(gameId);
+        loadingPathsRef.current.delete(path);
         setState((prev) => {
-          const next = new Set(prev.loadingGameIds);
-          next.delete(gameId);
-          return { ...prev, loadingGameIds: next };
+          const next = new Set(prev.loadingPaths);
+          next.delete(path);
+          return { ...prev, loadingPaths: next };
         });
       }
     },
     [clearNavigationCache],
   );
 
+  /**
+   * 指定ディレクトリ（ゲームノードまたはサブディレクトリの path）の直下の先頭ページを遅延取得し、
+   * ディレクトリツリーへマージする。1階層ずつ取得するため、ゲームを開いても
+   * 全セーブファイルの一覧は取らない。続きのページは loadMoreDirectory で必要になってから取得する。
+   * 取得済み・取得中のディレクトリは再取得しない。
+   */
+  const ensureDirectoryLoaded = useCallback(
+    async (path: string): Promise<void> => {
+      if (!path) {
+        return;
+      }
+      if (loadedPathsRef.current.has(path) || loadingPathsRef.current.has(path)) {
+        return;
+      }
+      await fetchDirectoryPage(path, "");
+    },
+    [fetchDirectoryPage],
+  );
+
+  const loadMoreDirectory = useCallback(
+    async (path: string): Promise<void> => {
+      const cursor = nextCursorsRef.current.get(path);
+      if (!cursor || loadingPathsRef.current.has(path)) {
+        return;
+      }
+      await fetchDirectoryPage(path, cursor);
+    },
+    [fetchDirectoryPage],
+  );
+
   /**
    * カードビューでディレクトリに移動。
    * 対象ノードを丸ごと受け取り、一意識別子（node.path）と表示名（node.name）を
@@ -302,10 +340,11 @@ export function useCloudData(): UseCloudDataReturn {
     loading: state.loading,
     currentPath: state.currentPath,
     currentDirectoryNodes,
-    loadingGameIds: state.loadingGameIds,
+    loadingPaths: state.loadingPaths,
 
     fetchCloudData,
-    ensureGameLoaded,
+    ensureDirectoryLoaded,
+    loadMoreDirectory,
     navigateToDirectory,
     navigateBack,
     navigateToPath,
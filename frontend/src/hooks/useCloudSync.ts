@@ -7,7 +7,7 @@
 
 import { useCallback } from "react";
 import type { ApiResult } from "src/types/result";
-import type { SyncStatusDetail, SyncProgressEvent } from "src/wailsBridge";
+import type { GameSyncStatus, SyncStatusDetail, SyncProgressEvent } from "src/wailsBridge";
 
 export type CloudSyncOp = {
   ok: boolean;
@@ -25,6 +25,13 @@ export function useCloudSync(_isOfflineMode: boolean) {
     [],
   );
 
+  // 複数ゲームは1回の呼び出しで判定する（ゲームごとに Status を呼ぶと S3 クライアントの作成から繰り返す）。
+  const getStatusMany = useCallback(
+    (gameIds: string[]): Promise<ApiResult<GameSyncStatus[]>> =>
+      window.api.cloudSync.statusMany(gameIds),
+    [],
+  );
+
   const push = useCallback(async (gameId: string): Promise<CloudSyncOp> => {
     const result = await window.api.cloudSync.push(gameId);
     return {
@@ -64,5 +71,19 @@ export function useCloudSync(_isOfflineMode: boolean) {
     [],
   );
 
-  return { getStatus, push, pull, resolveConflict, subscribeProgress };
+  // getStatusMany の判定が終わったゲームから順に届く
+  const subscribeStatus = useCallback(
+    (cb: (e: GameSyncStatus) => void): (() => void) => window.api.cloudSync.onStatus(cb),
+    [],
+  );
+
+  return {
+    getStatus,
+    getStatusMany,
+    push,
+    pull,
+    resolveConflict,
+    subscribeProgress,
+    subscribeStatus,
+  };
 }
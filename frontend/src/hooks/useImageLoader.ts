@@ -17,7 +17,7 @@ type ImageLoadState = {
   error?: string;
 };
 
-const createNoImageDataUrl = (): string => {
+export const createNoImageDataUrl = (): string => {
   const svg = `
     <svg width="400" height="300" xmlns="http://www.w3.org/2000/svg">
       <rect width="100%" height="100%" fill="#f3f4f6"/>
@@ -30,7 +30,11 @@ const createNoImageDataUrl = (): string => {
   return `data:image/svg+xml;base64,${btoa(svg)}`;
 };
 
-export const useImageLoader = (src: string): ImageLoadState => {
+/**
+ * @param src 画像の URL またはローカルパス
+ * @param thumbnail ローカル画像を縮小済みのサムネイルで表示するか（一覧のカード向け）
+ */
+export const useImageLoader = (src: string, thumbnail = false): ImageLoadState => {
   const [state, setState] = useState<ImageLoadState>(() => ({
     imageSrc: undefined,
     isLoading: true,
@@ -58,7 +62,7 @@ export const useImageLoader = (src: string): ImageLoadState => {
       }
 
       try {
-        const result = await validateAndLoadImage(src);
+        const result = await validateAndLoadImage(src, thumbnail);
 
         if (mounted) {
           if (result.success && result.data) {
@@ -114,12 +118,15 @@ export const useImageLoader = (src: string): ImageLoadState => {
     return () => {
       mounted = false;
     };
-  }, [src]);
+  }, [src, thumbnail]);
 
   return state;
 };
 
-const validateAndLoadImage = async (src: string): Promise<ApiResult<string>> => {
+const validateAndLoadImage = async (
+  src: string,
+  thumbnail: boolean,
+): Promise<ApiResult<string>> => {
   const isHttpUrl = src.startsWith("http://") || src.startsWith("https://");
   const isFileUrl = src.startsWith("file://");
   const isAbsolutePath = /^[A-Za-z]:\\/.test(src) || src.startsWith("/");
@@ -147,7 +154,9 @@ const validateAndLoadImage = async (src: string): Promise<ApiResult<string>> =>
   try {
     if (isLocal) {
       const path = src.replace(/^file:\/\//, "");
-      const result = (await window.api.loadImage.loadImageFromLocal(path)) as ApiResult<string>;
+      const result = (await window.api.loadImage.loadImageFromLocal(path, {
+        thumbnail,
+      })) as ApiResult<string>;
       return result;
     } else {
       const result = (await window.api.loadImage.loadImageFromWeb(src)) as ApiResult<string>;
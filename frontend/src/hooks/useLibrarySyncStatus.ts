@@ -0,0 +1,99 @@
+/**
+ * @fileoverview ライブラリ一覧の同期バッジ用フック
+ *
+ * 表示中のゲームの同期状態を statusMany で1回にまとめて判定し、
+ * "sync:status" イベントで判定が終わったゲームから順にバッジへ反映する。
+ */
+
+import { useEffect, useRef, useState } from "react";
+
+import { useCloudSync } from "./useCloudSync";
+import { logger } from "@renderer/utils/logger";
+import type { GameType } from "src/types/game";
+import type { GameSyncStatus, SyncStatus } from "src/wailsBridge";
+
+/**
+ * games のうちセーブフォルダのあるゲームの同期状態を gameId → SyncStatus で返す。
+ * 判定済みのゲームは一覧が伸びても（続きのページの読み込み）判定し直さず、新しく見えたゲームだけを問い合わせる。
+ * enabled が false（オフライン・認証情報なし）の間は何も問い合わせず、空のマップを返す。
+ */
+export function useLibrarySyncStatus(
+  games: GameType[],
+  enabled: boolean,
+): ReadonlyMap<string, SyncStatus> {
+  const { getStatusMany, subscribeStatus } = useCloudSync(!enabled);
+  const [statuses, setStatuses] = useState<ReadonlyMap<string, SyncStatus>>(new Map());
+  // 問い合わせ済み・問い合わせ中の gameId（イベントの到着前に同じゲームを重ねて問い合わせない）
+  const requestedRef = useRef<Set<string>>(new Set());
+  // enabled が切り替わるたびに進める。切り替え前の問い合わせの結果を反映しない。
+  const generationRef = useRef(0);
+
+  useEffect(() => {
+    generationRef.current += 1;
+    requestedRef.current = new Set();
+    setStatuses(new Map());
+    if (!enabled) {
+      return;
+    }
+    const apply = (item: GameSyncStatus): void => {
+      if (item.error) {
+        return;
+      }
+      setStatuses((prev) => {
+        if (prev.get(item.gameId) === item.detail.status) {
+          return prev;
+        }
+        const next = new Map(prev);
+        next.set(item.gameId, item.detail.status);
+        return next;
+      });
+    };
+    // 別の画面の一括判定（全ゲーム同期など）の結果も反映する
+    return subscribeStatus(apply);
+  }, [enabled, subscribeStatus]);
+
+  useEffect(() => {
+    if (!enabled) {
+      return;
+    }
+    const gameIds = games
+      .filter((game) => game.saveFolderPath && !requestedRef.current.has(game.id))
+      .map((game) => game.id);
+    if (gameIds.length === 0) {
+      return;
+    }
+    for (const id of gameIds) {
+      requestedRef.current.add(id);
+    }
+    const generation = generationRef.current;
+    void getStatusMany(gameIds).then((result) => {
+      if (generation !== generationRef.current) {
+        return;
+      }
+      if (!result.success) {
+        logger.warn("同期状態の一括取得に失敗しました", {
+          component: "useLibrarySyncStatus",
+          function: "getStatusMany",
+          data: result.message,
+        });
+        // 次に一覧が変わったときに問い合わせ直す
+        for (const id of gameIds) {
+          requestedRef.current.delete(id);
+        }
+        return;
+      }
+      // イベントを取りこぼしても最終結果で揃える
+      setStatuses((prev) => {
+        const next = new Map(prev);
+        for (const item of result.data ?? []) {
+          if (!item.error) {
+            next.set(item.gameId, item.detail.status);
+          }
+        }
+        return next;
+      });
+    });
+  }, [enabled, games, getStatusMany]);
+
+  return statuses;
+}
@@ -21,6 +21,8 @@ import {
   screenshotHotkeyNotifyAtom,
   s3ForcePathStyleAtom,
   s3UseTLSAtom,
+  s3CompressionAtom,
+  saveHashParanoidAtom,
 } from "@renderer/state/settings";
 import { logLevelManager } from "@renderer/utils/logLevel";
 
@@ -45,6 +47,8 @@ export function useSettingsBootSync(): void {
   const screenshotHotkeyNotify = useAtomValue(screenshotHotkeyNotifyAtom);
   const s3ForcePathStyle = useAtomValue(s3ForcePathStyleAtom);
   const s3UseTLS = useAtomValue(s3UseTLSAtom);
+  const s3Compression = useAtomValue(s3CompressionAtom);
+  const saveHashParanoid = useAtomValue(saveHashParanoidAtom);
 
   // boot sync は初回のみ。以降の atom→backend は各設定ハンドラの責務。
   // eslint-disable-next-line react-hooks/exhaustive-deps
@@ -74,6 +78,8 @@ export function useSettingsBootSync(): void {
       void settings.updateScreenshotLocalJpeg(screenshotLocalJpeg);
       void settings.updateS3ForcePathStyle(s3ForcePathStyle);
       void settings.updateS3UseTLS(s3UseTLS);
+      void settings.updateS3Compression(s3Compression);
+      void settings.updateSaveHashParanoid(saveHashParanoid);
       const feLevel = logLevelManager.getCurrentLevel();
       if (feLevel !== "off") {
         void settings.updateLogLevel(feLevel);
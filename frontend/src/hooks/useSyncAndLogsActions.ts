@@ -14,7 +14,7 @@ import { logger } from "@renderer/utils/logger";
 
 export function useSyncAndLogsActions() {
   const offlineMode = useAtomValue(offlineModeAtom);
-  const { getStatus, push, pull } = useCloudSync(offlineMode);
+  const { getStatusMany, push, pull } = useCloudSync(offlineMode);
   const [isSyncingAll, setIsSyncingAll] = useState(false);
   const [isExportingData, setIsExportingData] = useState(false);
   const [isCreatingBackup, setIsCreatingBackup] = useState(false);
@@ -52,22 +52,26 @@ export function useSyncAndLogsActions() {
       let failed = 0;
       let skipped = 0;
 
-      for (const game of games) {
-        if (!game.saveFolderPath) continue;
+      // 状態の判定は全ゲーム分を1回で済ませ、転送が必要なゲームだけ順に push / pull する。
+      const gameIds = games.filter((game) => game.saveFolderPath).map((game) => game.id);
+      const statusResult = gameIds.length > 0 ? await getStatusMany(gameIds) : undefined;
+      if (statusResult && !statusResult.success) {
+        throw new Error(statusResult.message);
+      }
 
-        const statusResult = await getStatus(game.id);
-        if (!statusResult.success || !statusResult.data) {
+      for (const item of statusResult?.data ?? []) {
+        if (item.error) {
           failed++;
           continue;
         }
 
-        const { status } = statusResult.data;
+        const { status } = item.detail;
         if (status === "push_needed") {
-          const op = await push(game.id);
+          const op = await push(item.gameId);
           if (op.ok) uploaded++;
           else failed++;
         } else if (status === "pull_needed") {
-          const op = await pull(game.id);
+          const op = await pull(item.gameId);
           // 同期管理外ファイルの削除確認が必要な場合は破壊を避けてスキップ（詳細画面で確認）
           if (op.ok && op.applied === false) skipped++;
           else if (op.ok) downloaded++;
@@ -150,6 +154,33 @@ export function useSyncAndLogsActions() {
     }
   };
 
+  const handleCreateIncrementalBackup = async (): Promise<void> => {
+    const selected = await window.api.file.selectFile([
+      { name: "CloudLaunch backup", extensions: ["zip"] },
+    ]);
+    if (!selected.success || !selected.data) {
+      return;
+    }
+    setIsCreatingBackup(true);
+    try {
+      const result = await window.api.maintenance.createIncrementalBackup(selected.data);
+      if (!result.success || !result.data) {
+        toast.error((!result.success && result.message) || "増分バックアップ作成に失敗しました");
+        return;
+      }
+      toast.success("増分バックアップを作成しました");
+    } catch (error) {
+      logger.error("増分バックアップ作成エラー:", {
+        component: "useSyncAndLogsActions",
+        function: "handleCreateIncrementalBackup",
+        data: error,
+      });
+      toast.error("増分バックアップ作成に失敗しました");
+    } finally {
+      setIsCreatingBackup(false);
+    }
+  };
+
   const handleRestoreBackup = async (): Promise<void> => {
     const selected = await window.api.file.selectFile([
       { name: "CloudLaunch backup", extensions: ["zip"] },
@@ -196,6 +227,7 @@ export function useSyncAndLogsActions() {
     handleSyncAllGames,
     handleExportGameData,
     handleCreateBackup,
+    handleCreateIncrementalBackup,
     handleRestoreBackup,
     handleOpenLogsDirectory,
   };
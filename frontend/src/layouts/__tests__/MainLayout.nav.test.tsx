@@ -20,6 +20,8 @@ function mockApi(): void {
     updateScreenshotHotkey: vi.fn().mockResolvedValue({ success: true }),
     updateS3ForcePathStyle: vi.fn().mockResolvedValue({ success: true }),
     updateS3UseTLS: vi.fn().mockResolvedValue({ success: true }),
+    updateS3Compression: vi.fn().mockResolvedValue({ success: true }),
+    updateSaveHashParanoid: vi.fn().mockResolvedValue({ success: true }),
     updateLogLevel: vi.fn().mockResolvedValue({ success: true }),
   };
   (window as unknown as { api: unknown }).api = {
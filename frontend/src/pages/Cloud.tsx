@@ -23,7 +23,11 @@ import { useValidateCreds } from "@renderer/hooks/useValidCreds";
 
 import { logger } from "@renderer/utils/logger";
 
-import { countFilesRecursively, sumSizesRecursively } from "@renderer/utils/cloudUtils";
+import {
+  countFilesRecursively,
+  findCloudNode,
+  sumSizesRecursively,
+} from "@renderer/utils/cloudUtils";
 import type { CloudDataItem, CloudDirectoryNode, CloudFileDetail } from "src/types/cloud";
 
 export default function Cloud(): React.JSX.Element {
@@ -52,9 +56,10 @@ export default function Cloud(): React.JSX.Element {
     loading,
     currentPath,
     currentDirectoryNodes,
-    loadingGameIds,
+    loadingPaths,
     fetchCloudData,
-    ensureGameLoaded,
+    ensureDirectoryLoaded,
+    loadMoreDirectory,
     navigateToDirectory,
     navigateBack,
     navigateToPath,
@@ -85,29 +90,30 @@ export default function Cloud(): React.JSX.Element {
 
   /**
    * ディレクトリ（ゲームまたはサブフォルダ）を開く。
-   * ルートレベル（=ゲーム）を開くときは、そのゲームのファイル一覧を遅延取得する。
+   * 開いたディレクトリの直下だけを遅延取得する（取得済みなら何もしない）。
    * ナビゲーションは表示名ではなく node（実体）で辿るため、同名ゲームが 2 件あっても
    * 1 件に集約されない。
    */
   const handleNavigateToDirectory = useCallback(
     (node: CloudDirectoryNode): void => {
-      if (currentPath.length === 0) {
-        // ルート node.path はゲームID。配下パスと混同しない。
-        void ensureGameLoaded(node.path);
+      if (node.isDirectory && node.children === undefined) {
+        void ensureDirectoryLoaded(node.path);
       }
       navigateToDirectory(node);
     },
-    [currentPath.length, ensureGameLoaded, navigateToDirectory],
+    [ensureDirectoryLoaded, navigateToDirectory],
   );
 
-  // ルートで開いているゲームノード（カードビューのサブ階層表示用）。
-  // 表示名ではなくパス（一意）で解決する。
-  const openGameNode =
-    currentPath.length > 0
-      ? directoryTree.find((node) => node.path === currentPath[0].id)
-      : undefined;
-  // 遅延取得中は空一覧を「0ファイル」と誤表示しないためのフラグ。
-  const isOpenGameLoading = openGameNode ? loadingGameIds.has(openGameNode.path) : false;
+  // カードビューで開いているディレクトリ。先頭ページの取得中は空一覧を「0ファイル」と誤表示しないためのフラグ
+  // （続きのページの取得中は取得済みの分をそのまま表示する）。
+  const openDirectoryPath = currentPath.length > 0 ? currentPath[currentPath.length - 1].id : "";
+  const openDirectoryNode = openDirectoryPath
+    ? findCloudNode(directoryTree, openDirectoryPath)
+    : undefined;
+  const isOpenDirectoryLoading =
+    !!openDirectoryPath &&
+    loadingPaths.has(openDirectoryPath) &&
+    openDirectoryNode?.children === undefined;
 
   const handleToggleExpand = (path: string): void => {
     const newExpanded = new Set(expandedNodes);
@@ -115,11 +121,8 @@ export default function Cloud(): React.JSX.Element {
       newExpanded.delete(path);
     } else {
       newExpanded.add(path);
-      // トップレベル（=ゲーム）を展開するときにファイル一覧を遅延取得する。
-      // ゲームノードの path は remotePath（ゲームID）と一致する。
-      if (directoryTree.some((node) => node.path === path)) {
-        void ensureGameLoaded(path);
-      }
+      // 展開したディレクトリの直下を遅延取得する（取得済み・取得中なら hook 側で無視される）。
+      void ensureDirectoryLoaded(path);
     }
     setExpandedNodes(newExpanded);
   };
@@ -263,8 +266,8 @@ export default function Cloud(): React.JSX.Element {
       <CloudContent
         viewMode={viewMode}
         loading={loading}
-        gameLoading={isOpenGameLoading}
-        loadingGameIds={loadingGameIds}
+        directoryLoading={isOpenDirectoryLoading}
+        loadingPaths={loadingPaths}
         directoryTree={directoryTree}
         currentPath={currentPath}
         currentDirectoryNodes={currentDirectoryNodes}
@@ -274,6 +277,8 @@ export default function Cloud(): React.JSX.Element {
         onDelete={(item) => setDeleteConfirm(item)}
         onNavigateToDirectory={handleNavigateToDirectory}
         onViewDetails={handleViewDetails}
+        currentDirectoryHasMore={!!openDirectoryNode?.nextCursor}
+        onLoadMore={(path) => void loadMoreDirectory(path)}
       />
 
       <CloudDeleteModal
@@ -0,0 +1,117 @@
+/**
+ * @fileoverview 同期・一覧・プロセス監視の計測結果のデバッグページ
+ */
+
+import { useCallback, useEffect, useState } from "react";
+import toast from "react-hot-toast";
+
+import { formatFileSize } from "@renderer/utils/cloudUtils";
+import type { PerformancePhaseMetrics } from "src/wailsBridge";
+
+const formatMs = (value: number): string =>
+  value >= 1000 ? `${(value / 1000).toFixed(2)} s` : `${value.toFixed(1)} ms`;
+
+export default function DebugPerformance(): React.JSX.Element {
+  const [phases, setPhases] = useState<PerformancePhaseMetrics[]>([]);
+  const [isLoading, setIsLoading] = useState(false);
+
+  const loadMetrics = useCallback(async () => {
+    setIsLoading(true);
+    try {
+      const result = await window.api.maintenance.getPerformanceMetrics();
+      if (!result.success) {
+        toast.error(result.message || "計測結果を取得できませんでした");
+        return;
+      }
+      setPhases(result.data ?? []);
+    } finally {
+      setIsLoading(false);
+    }
+  }, []);
+
+  const resetMetrics = useCallback(async () => {
+    const result = await window.api.maintenance.resetPerformanceMetrics();
+    if (!result.success) {
+      toast.error(result.message || "計測結果をリセットできませんでした");
+      return;
+    }
+    setPhases([]);
+  }, []);
+
+  useEffect(() => {
+    void loadMetrics();
+  }, [loadMetrics]);
+
+  return (
+    <div className="container mx-auto px-6 py-8">
+      <div className="flex items-center justify-between mb-6">
+        <div>
+          <h1 className="text-3xl font-bold">計測デバッグ</h1>
+          <p className="text-sm text-base-content/70">
+            Push / Pull / 同期状態 / クラウド一覧 / プロセス監視の段階ごとの所要時間と転送量（分位点は直近の実行から計算）
+          </p>
+        </div>
+        <div className="flex gap-2">
+          <button className="btn btn-outline" onClick={() => void resetMetrics()}>
+            リセット
+          </button>
+          <button
+            className={`btn btn-primary ${isLoading ? "btn-disabled" : ""}`}
+            onClick={() => void loadMetrics()}
+          >
+            {isLoading ? "取得中..." : "再取得"}
+          </button>
+        </div>
+      </div>
+
+      <div className="overflow-x-auto bg-base-100 rounded-lg border border-base-200">
+        <table className="table table-zebra table-sm">
+          <thead>
+            <tr>
+              <th>段階</th>
+              <th className="text-right">回数</th>
+              <th className="text-right">失敗</th>
+              <th className="text-right">p50</th>
+              <th className="text-right">p90</th>
+              <th className="text-right">p99</th>
+              <th className="text-right">最大</th>
+              <th className="text-right">件数</th>
+              <th className="text-right">ローカル</th>
+              <th className="text-right">リクエスト</th>
+              <th className="text-right">再試行</th>
+              <th className="text-right">送信</th>
+              <th className="text-right">受信</th>
+            </tr>
+          </thead>
+          <tbody>
+            {phases.length === 0 ? (
+              <tr>
+                <td colSpan={13} className="text-center text-sm text-base-content/60">
+                  まだ計測結果がありません
+                </td>
+              </tr>
+            ) : (
+              phases.map((phase) => (
+                <tr key={phase.name}>
+                  <td className="font-mono text-xs">{phase.name}</td>
+                  <td className="text-right">{phase.count}</td>
+                  <td className="text-right">{phase.errors}</td>
+                  <td className="text-right">{formatMs(phase.p50Ms)}</td>
+                  <td className="text-right">{formatMs(phase.p90Ms)}</td>
+                  <td className="text-right">{formatMs(phase.p99Ms)}</td>
+                  <td className="text-right">{formatMs(phase.maxMs)}</td>
+                  <td className="text-right">{phase.objects}</td>
+                  <td className="text-right">{formatFileSize(phase.bytes)}</td>
+                  <td className="text-right">{phase.requests}</td>
+                  <td className="text-right">{phase.retries}</td>
+                  <td className="text-right">{formatFileSize(phase.bytesSent)}</td>
+                  <td className="text-right">{formatFileSize(phase.bytesReceived)}</td>
+                </tr>
+              ))
+            )}
+          </tbody>
+        </table>
+      </div>
+    </div>
+  );
+}
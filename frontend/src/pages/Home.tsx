@@ -5,7 +5,7 @@
  */
 
 import { useAtom, useAtomValue } from "jotai";
-import { useEffect, useState, useCallback } from "react";
+import { useEffect, useState, useCallback, useRef } from "react";
 import { IoIosAdd } from "react-icons/io";
 
 import ConfirmModal from "@renderer/components/common/ConfirmModal";
@@ -22,6 +22,7 @@ import { UNCONFIGURED_EXE_PATH } from "@renderer/constants/game";
 import { useDebounce } from "@renderer/hooks/useDebounce";
 import { useGameActions } from "@renderer/hooks/useGameActions";
 import { useGameSaveData } from "@renderer/hooks/useGameSaveData";
+import { useLibrarySyncStatus } from "@renderer/hooks/useLibrarySyncStatus";
 import { useCloudSync } from "@renderer/hooks/useCloudSync";
 import { useLoadingState } from "@renderer/hooks/useLoadingState";
 import { useOfflineMode } from "@renderer/hooks/useOfflineMode";
@@ -62,11 +63,16 @@ export default function Home(): React.ReactElement {
     remoteMeta?: SyncMetaSnapshot;
   } | null>(null);
   const [warningGameIds, setWarningGameIds] = useState<Set<string>>(new Set());
+  const [nextCursor, setNextCursor] = useState<string | undefined>(undefined);
+  const [isLoadingMore, setIsLoadingMore] = useState(false);
+  // 先頭ページを読み直すたびに進める。古い検索条件の続きのページが後から来ても一覧に混ぜない。
+  const listGenerationRef = useRef(0);
   const isValidCreds = useAtomValue(isValidCredsAtom);
   const validateCreds = useValidateCreds();
   const { isOfflineMode } = useOfflineMode();
   const { getStatus, resolveConflict } = useCloudSync(isOfflineMode);
   const { downloadSaveData } = useGameSaveData();
+  const syncStatuses = useLibrarySyncStatus(visibleGames, !isOfflineMode && isValidCreds);
   const { formatDateWithTime } = useTimeFormat();
   const { showToast } = useToastHandler();
 
@@ -80,46 +86,77 @@ export default function Home(): React.ReactElement {
     filter,
     sort,
     sortDirection,
-    onGamesUpdate: setVisibleGames,
+    // 追加後は全件を取り直すので、ページングの続きは無い
+    onGamesUpdate: (games) => {
+      listGenerationRef.current += 1;
+      setVisibleGames(games);
+      setNextCursor(undefined);
+    },
     onModalClose: () => setIsGameFormOpen(false),
   });
 
+  const fetchGamesPage = useCallback(
+    async (cursor?: string) => {
+      const result = await window.api.database.listGamesPage({
+        searchWord: debouncedSearchWord,
+        filter,
+        sort,
+        sortDirection,
+        cursor,
+        limit: CONFIG.UI.GAME_LIST_PAGE_SIZE,
+      });
+      if (!result.success) {
+        throw new Error(result.message);
+      }
+      return result.data ?? { items: [] };
+    },
+    [debouncedSearchWord, filter, sort, sortDirection],
+  );
+
+  // 先頭ページを読み直す。検索のたびに全件を取らず、続きはスクロールで loadMoreGames が読む。
   const refreshGameList = useCallback(async (): Promise<void> => {
-    const games = await gameListLoading.executeWithLoading(
-      () => window.api.database.listGames(debouncedSearchWord, filter, sort, sortDirection),
-      {
-        errorMessage: MESSAGES.GAME.LIST_FETCH_FAILED,
-        showToast: true,
-      },
-    );
-
-    if (games) {
-      setVisibleGames(games as GameType[]);
+    const generation = ++listGenerationRef.current;
+    const page = await gameListLoading.executeWithLoading(() => fetchGamesPage(), {
+      errorMessage: MESSAGES.GAME.LIST_FETCH_FAILED,
+      showToast: true,
+    });
+
+    // 検索条件が変わって古い一覧応答が後から来ても、表示を巻き戻さない。
+    if (page && generation === listGenerationRef.current) {
+      setVisibleGames(page.items);
+      setNextCursor(page.nextCursor);
     }
-  }, [debouncedSearchWord, filter, gameListLoading, setVisibleGames, sort, sortDirection]);
-
-  useEffect(() => {
-    let cancelled = false;
+  }, [fetchGamesPage, gameListLoading, setVisibleGames]);
 
-    const fetchGames = async (): Promise<void> => {
-      const games = await gameListLoading.executeWithLoading(
-        () => window.api.database.listGames(debouncedSearchWord, filter, sort, sortDirection),
-        {
-          errorMessage: MESSAGES.GAME.LIST_FETCH_FAILED,
-          showToast: true,
-        },
-      );
-
-      // 検索条件が変わって古い一覧応答が後から来ても、表示を巻き戻さない。
-      if (!cancelled && games) {
-        setVisibleGames(games as GameType[]);
+  const loadMoreGames = useCallback(async (): Promise<void> => {
+    if (!nextCursor || isLoadingMore) {
+      return;
+    }
+    const generation = listGenerationRef.current;
+    setIsLoadingMore(true);
+    try {
+      const page = await fetchGamesPage(nextCursor);
+      if (generation !== listGenerationRef.current) {
+        return;
       }
-    };
+      setVisibleGames((prev) => {
+        const seen = new Set(prev.map((game) => game.id));
+        return [...prev, ...page.items.filter((game) => !seen.has(game.id))];
+      });
+      setNextCursor(page.nextCursor);
+    } catch {
+      if (generation === listGenerationRef.current) {
+        showToast(MESSAGES.GAME.LIST_FETCH_FAILED, "error");
+        // 同じ位置で失敗し続けないよう、続きの読み込みは検索し直すまで止める
+        setNextCursor(undefined);
+      }
+    } finally {
+      setIsLoadingMore(false);
+    }
+  }, [fetchGamesPage, isLoadingMore, nextCursor, setVisibleGames, showToast]);
 
-    fetchGames();
-    return () => {
-      cancelled = true;
-    };
+  useEffect(() => {
+    void refreshGameList();
     // eslint-disable-next-line react-hooks/exhaustive-deps
   }, [debouncedSearchWord, filter, sort, sortDirection]);
 
@@ -342,6 +379,9 @@ export default function Home(): React.ReactElement {
         games={visibleGames}
         onLaunchGame={handleLaunchGame}
         warningGameIds={warningGameIds}
+        syncStatuses={syncStatuses}
+        hasMore={nextCursor !== undefined && nextCursor !== ""}
+        onLoadMore={loadMoreGames}
       />
 
       <FloatingButton
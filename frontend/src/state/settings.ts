@@ -44,6 +44,10 @@ export const s3ForcePathStyleAtom = atomWithStorage<boolean>("s3ForcePathStyle",
 
 export const s3UseTLSAtom = atomWithStorage<boolean>("s3UseTLS", true);
 
+export const s3CompressionAtom = atomWithStorage<boolean>("s3Compression", false);
+
+export const saveHashParanoidAtom = atomWithStorage<boolean>("saveHashParanoid", false);
+
 // 一時的な状態なので LocalStorage には保存しない（atomWithStorage を使わない）
 export const isChangingThemeAtom = atom(false);
 
@@ -31,10 +31,21 @@ export type CloudDirectoryNode = {
   children?: CloudDirectoryNode[];
   objectKey?: string;
   /**
-   * トップレベル（ゲーム）の遅延取得状態でも commit メタから持ち越したファイル数。
-   * children を取得済みのノードでは undefined（countFilesRecursively で算出する）。
+   * 配下を未取得のディレクトリのファイル数（ゲームは commit メタ、サブディレクトリはサーバー側の集計）。
+   * children を取得済みのノードでは使わない（countFilesRecursively で算出する）。
    */
   fileCount?: number;
+  /**
+   * 配下の続きのページのカーソル。children が途中までしか無い間だけ入り、最後のページまで取得したら undefined。
+   * 途中までのディレクトリのファイル数・サイズは fileCount / size（サーバー側の集計）を使う。
+   */
+  nextCursor?: string;
+};
+
+/** ディレクトリ1階層分の1ページ。nextCursor が空なら最後のページ。 */
+export type CloudDirectoryChildren = {
+  nodes: CloudDirectoryNode[];
+  nextCursor: string;
 };
 
 export type CloudGameMetadata = {
@@ -4,6 +4,8 @@
  * ErogameScape 検索結果・取得結果の TypeScript 型。
  */
 
+import type { GameImport } from "./game";
+
 export type ErogameScapeSearchItem = {
   erogameScapeId: string;
   title: string;
@@ -15,3 +17,10 @@ export type ErogameScapeSearchResult = {
   items: ErogameScapeSearchItem[];
   nextPageUrl?: string;
 };
+
+/** 一括取得の1件分。失敗した場合は import が無く error に理由が入る。 */
+export type GameImportResult = {
+  url: string;
+  import?: GameImport;
+  error?: string;
+};
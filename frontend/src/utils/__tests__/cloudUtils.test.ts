@@ -0,0 +1,67 @@
+import { describe, expect, it } from "vitest";
+
+import {
+  appendCloudNodeChildren,
+  computeCloudNodeMetrics,
+  findCloudNode,
+  replaceCloudNodeChildren,
+} from "../cloudUtils";
+import type { CloudDirectoryNode } from "src/types/cloud";
+
+function file(path: string, size: number): CloudDirectoryNode {
+  return {
+    name: path.split("/").pop() ?? path,
+    path,
+    isDirectory: false,
+    size,
+    lastModified: new Date("2026-01-01T00:00:00Z"),
+  };
+}
+
+function game(): CloudDirectoryNode {
+  return {
+    name: "Game",
+    path: "game-1",
+    isDirectory: true,
+    size: 600,
+    lastModified: new Date("2026-01-01T00:00:00Z"),
+    fileCount: 3,
+  };
+}
+
+describe("paged cloud directory children", () => {
+  it("uses the server totals until every page has been loaded", () => {
+    let tree = replaceCloudNodeChildren(
+      [game()],
+      "game-1",
+      [file("game-1/a.sav", 100)],
+      "cursor-1",
+    );
+    let node = findCloudNode(tree, "game-1")!;
+    expect(node.children).toHaveLength(1);
+    expect(node.nextCursor).toBe("cursor-1");
+    expect(computeCloudNodeMetrics(node)).toMatchObject({ count: 3, size: 600 });
+
+    tree = appendCloudNodeChildren(tree, "game-1", [file("game-1/b.sav", 200)], "cursor-2");
+    node = findCloudNode(tree, "game-1")!;
+    expect(node.children!.map((child) => child.path)).toEqual(["game-1/a.sav", "game-1/b.sav"]);
+    expect(node.nextCursor).toBe("cursor-2");
+
+    tree = appendCloudNodeChildren(tree, "game-1", [file("game-1/c.sav", 300)], "");
+    node = findCloudNode(tree, "game-1")!;
+    expect(node.children).toHaveLength(3);
+    expect(node.nextCursor).toBeUndefined();
+    expect(computeCloudNodeMetrics(node)).toMatchObject({ count: 3, size: 600 });
+  });
+
+  it("finds and updates nested directories only along their path", () => {
+    const sub: CloudDirectoryNode = { ...game(), name: "sub", path: "game-1/sub", children: [] };
+    const other: CloudDirectoryNode = { ...game(), name: "Other", path: "game-2" };
+    const tree = [{ ...game(), children: [sub] }, other];
+
+    const next = appendCloudNodeChildren(tree, "game-1/sub", [file("game-1/sub/x.sav", 1)]);
+    expect(findCloudNode(next, "game-1/sub")!.children).toHaveLength(1);
+    expect(next[1]).toBe(other);
+    expect(findCloudNode(next, "game-3")).toBeUndefined();
+  });
+});
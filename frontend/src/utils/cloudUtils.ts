@@ -67,8 +67,10 @@ export function computeCloudNodeMetrics(node: CloudDirectoryNode): CloudNodeMetr
     return { childrenLoaded: true, count: 1, size: node.size, hasMetrics: true };
   }
   const childrenLoaded = node.children !== undefined;
-  const count = childrenLoaded ? countFilesRecursively(node) : (node.fileCount ?? 0);
-  const size = childrenLoaded ? sumSizesRecursively(node) : node.size;
+  // 途中のページまでしか無いディレクトリは、配下を集計すると少なく見えるのでサマリ値を使う
+  const childrenComplete = childrenLoaded && !node.nextCursor;
+  const count = childrenComplete ? countFilesRecursively(node) : (node.fileCount ?? 0);
+  const size = childrenComplete ? sumSizesRecursively(node) : node.size;
   return {
     childrenLoaded,
     count,
@@ -77,31 +79,35 @@ export function computeCloudNodeMetrics(node: CloudDirectoryNode): CloudNodeMetr
   };
 }
 
+/**
+ * 配下のファイル数を数える。配下を未取得・途中のページまでのディレクトリ（1階層ずつの遅延取得）は
+ * サーバーが集計した fileCount を使う。
+ */
 export function countFilesRecursively(node: CloudDirectoryNode): number {
   if (!node.isDirectory) {
     return 1;
   }
+  if (!node.children || node.nextCursor) {
+    return node.fileCount ?? 0;
+  }
 
   let fileCount = 0;
-  if (node.children) {
-    node.children.forEach((child) => {
-      fileCount += countFilesRecursively(child);
-    });
-  }
+  node.children.forEach((child) => {
+    fileCount += countFilesRecursively(child);
+  });
   return fileCount;
 }
 
+/** 配下の合計サイズ。配下を未取得・途中のページまでのディレクトリはサーバーが集計した size を使う。 */
 export function sumSizesRecursively(node: CloudDirectoryNode): number {
-  if (!node.isDirectory) {
+  if (!node.isDirectory || !node.children || node.nextCursor) {
     return node.size;
   }
 
   let totalSize = 0;
-  if (node.children) {
-    node.children.forEach((child) => {
-      totalSize += sumSizesRecursively(child);
-    });
-  }
+  node.children.forEach((child) => {
+    totalSize += sumSizesRecursively(child);
+  });
   return totalSize;
 }
 
@@ -156,3 +162,70 @@ export function getNodesByPath(
   }
   return currentNodes;
 }
+
+/** path（CloudDirectoryNode.path）のノードを返す。未取得の階層にあって見つからなければ undefined。 */
+export function findCloudNode(
+  tree: CloudDirectoryNode[],
+  path: string,
+): CloudDirectoryNode | undefined {
+  for (const node of tree) {
+    if (node.path === path) {
+      return node;
+    }
+    if (node.isDirectory && node.children && path.startsWith(`${node.path}/`)) {
+      return findCloudNode(node.children, path);
+    }
+  }
+  return undefined;
+}
+
+/**
+ * path のノードを update で置き換えたツリーを返す。
+ * 経路上のノードだけを作り直し、それ以外は同じ参照を使い回す。
+ */
+function updateCloudNode(
+  tree: CloudDirectoryNode[],
+  path: string,
+  update: (node: CloudDirectoryNode) => CloudDirectoryNode,
+): CloudDirectoryNode[] {
+  return tree.map((node) => {
+    if (node.path === path) {
+      return update(node);
+    }
+    if (node.isDirectory && node.children && path.startsWith(`${node.path}/`)) {
+      return { ...node, children: updateCloudNode(node.children, path, update) };
+    }
+    return node;
+  });
+}
+
+/**
+ * path（CloudDirectoryNode.path）のディレクトリの children を差し替えたツリーを返す。
+ * nextCursor は続きのページのカーソル（最後のページまで取得済みなら省略）。
+ */
+export function replaceCloudNodeChildren(
+  tree: CloudDirectoryNode[],
+  path: string,
+  children: CloudDirectoryNode[],
+  nextCursor?: string,
+): CloudDirectoryNode[] {
+  return updateCloudNode(tree, path, (node) => ({
+    ...node,
+    children,
+    nextCursor: nextCursor || undefined,
+  }));
+}
+
+/** path のディレクトリの children の後ろに続きのページを足したツリーを返す。 */
+export function appendCloudNodeChildren(
+  tree: CloudDirectoryNode[],
+  path: string,
+  children: CloudDirectoryNode[],
+  nextCursor?: string,
+): CloudDirectoryNode[] {
+  return updateCloudNode(tree, path, (node) => ({
+    ...node,
+    children: [...(node.children ?? []), ...children],
+    nextCursor: nextCursor || undefined,
+  }));
+}
@@ -11,9 +11,11 @@ export type {
   WindowApi,
   SyncStatus,
   SyncStatusDetail,
+  GameSyncStatus,
   SyncMetaSnapshot,
   SyncProgressEvent,
   PullResult,
+  PerformancePhaseMetrics,
 } from "./bridge/types";
 
 // ---- ドメインブリッジ合成 -----------------------------------------------
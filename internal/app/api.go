@@ -22,6 +22,7 @@ import (
 	"CloudLaunch_Go/internal/result"
 	"CloudLaunch_Go/internal/services"
 
+	"github.com/aws/aws-sdk-go-v2/service/s3"
 	"github.com/wailsapp/wails/v2/pkg/runtime"
 )
 
@@ -33,6 +34,13 @@ func (app *App) ListGames(searchText string, filter string, sortBy string, sortD
 	return serviceResult(games, err, "ゲーム一覧取得に失敗しました")
 }
 
+// ListGamesPage はゲーム一覧を1ページ分取得する。
+func (app *App) ListGamesPage(query domain.GameListQuery) result.ApiResult[domain.GamePage] {
+	query.Filter = normalizePlayStatus(string(query.Filter))
+	page, err := app.GameService.ListGamesPage(app.context(), query)
+	return serviceResult(page, err, "ゲーム一覧取得に失敗しました")
+}
+
 // GetGameByID はゲームを取得する。
 func (app *App) GetGameByID(gameID string) result.ApiResult[*domain.Game] {
 	game, err := app.GameService.GetGameByID(app.context(), gameID)
@@ -191,6 +199,12 @@ func (app *App) ListAllMemos() result.ApiResult[[]domain.Memo] {
 	return serviceResult(memos, err, "メモ取得に失敗しました")
 }
 
+// SearchMemos はメモを検索して1ページ分取得する。
+func (app *App) SearchMemos(query domain.MemoSearchQuery) result.ApiResult[domain.MemoPage] {
+	page, err := app.MemoService.SearchMemos(app.context(), query)
+	return serviceResult(page, err, "メモ検索に失敗しました")
+}
+
 // ListMemosByGame はメモ一覧を取得する。
 func (app *App) ListMemosByGame(gameID string) result.ApiResult[[]domain.Memo] {
 	memos, err := app.MemoService.ListMemosByGame(app.context(), gameID)
@@ -322,6 +336,7 @@ func (app *App) UpdateUploadConcurrency(value int) result.ApiResult[bool] {
 // UpdateS3ForcePathStyle は S3 path-style アドレス指定を更新する（MinIO 等向け）。
 func (app *App) UpdateS3ForcePathStyle(enabled bool) result.ApiResult[bool] {
 	app.Config.S3ForcePathStyle = enabled
+	storage.InvalidateSharedClients()
 	if app.ContentSyncService != nil {
 		app.ContentSyncService.SetS3ForcePathStyle(enabled)
 	}
@@ -334,6 +349,7 @@ func (app *App) UpdateS3ForcePathStyle(enabled bool) result.ApiResult[bool] {
 // UpdateS3UseTLS は S3 通信の TLS 有効/無効を更新する。
 func (app *App) UpdateS3UseTLS(enabled bool) result.ApiResult[bool] {
 	app.Config.S3UseTLS = enabled
+	storage.InvalidateSharedClients()
 	if app.ContentSyncService != nil {
 		app.ContentSyncService.SetS3UseTLS(enabled)
 	}
@@ -343,6 +359,24 @@ func (app *App) UpdateS3UseTLS(enabled bool) result.ApiResult[bool] {
 	return result.OkResult(true)
 }
 
+// UpdateS3Compression はセーブデータのブロブを gzip 圧縮してアップロードするかを更新する。
+func (app *App) UpdateS3Compression(enabled bool) result.ApiResult[bool] {
+	app.Config.S3Compression = enabled
+	if app.ContentSyncService != nil {
+		app.ContentSyncService.SetS3Compression(enabled)
+	}
+	return result.OkResult(true)
+}
+
+// UpdateSaveHashParanoid はセーブファイルのハッシュキャッシュを無視して常に再ハッシュするかを更新する。
+func (app *App) UpdateSaveHashParanoid(enabled bool) result.ApiResult[bool] {
+	app.Config.SaveHashParanoid = enabled
+	if app.ContentSyncService != nil {
+		app.ContentSyncService.SetSaveHashParanoid(enabled)
+	}
+	return result.OkResult(true)
+}
+
 // UpdateLogLevel はバックエンドのログレベルを実行時に変更する。
 // 受け付ける値: debug / info / warn / error（大文字小文字・空白は無視）。
 func (app *App) UpdateLogLevel(level string) result.ApiResult[bool] {
@@ -616,6 +650,7 @@ func (app *App) OpenLogsDirectory() result.ApiResult[string] {
 
 // SaveCredential は認証情報を保存する。
 func (app *App) SaveCredential(key string, input services.CredentialInput) result.ApiResult[bool] {
+	defer storage.InvalidateSharedClients()
 	return boolResult(app.CredentialService.SaveCredential(app.context(), key, input), "認証情報保存に失敗しました")
 }
 
@@ -626,6 +661,7 @@ func (app *App) LoadCredential(key string) result.ApiResult[*services.Credential
 
 // DeleteCredential は認証情報を削除する。
 func (app *App) DeleteCredential(key string) result.ApiResult[bool] {
+	defer storage.InvalidateSharedClients()
 	return boolResult(app.CredentialService.DeleteCredential(app.context(), key), "認証情報削除に失敗しました")
 }
 
@@ -676,7 +712,27 @@ func (app *App) uploadScreenshot(ctx context.Context, gameID string, filePath st
 	if err != nil {
 		return err
 	}
+	return app.putScreenshot(ctx, client, bucket, gameID, filePath)
+}
+
+// uploadScreenshotBatch はアップロードキューの1回分をまとめて送る。S3 クライアントの解決は1回だけ行う。
+func (app *App) uploadScreenshotBatch(ctx context.Context, batch []screenshotUploadJob) []error {
+	errs := make([]error, len(batch))
+	client, bucket, err := app.getDefaultS3Client(ctx)
+	if err != nil {
+		for index := range errs {
+			errs[index] = err
+		}
+		return errs
+	}
+	for index, job := range batch {
+		errs[index] = app.putScreenshot(ctx, client, bucket, job.gameID, job.path)
+	}
+	return errs
+}
 
+// putScreenshot は filePath を screenshots/<gameID>/ 以下に送る。ScreenshotUploadJpeg なら JPEG に変換してから送る。
+func (app *App) putScreenshot(ctx context.Context, client *s3.Client, bucket string, gameID string, filePath string) error {
 	baseName := strings.TrimSuffix(filepath.Base(filePath), filepath.Ext(filePath))
 	key := filepath.ToSlash(filepath.Join("screenshots", gameID, baseName))
 
@@ -26,6 +26,10 @@ func (r noopAppGameRepository) ListGames(ctx context.Context, searchText string,
 	return nil, r.listErr
 }
 
+func (r noopAppGameRepository) ListGamesPage(ctx context.Context, query domain.GameListQuery) (domain.GamePage, error) {
+	return domain.GamePage{}, r.listErr
+}
+
 func (r noopAppGameRepository) GetGameByID(ctx context.Context, gameID string) (*domain.Game, error) {
 	return nil, nil
 }
@@ -162,6 +166,10 @@ func (noopAppMemoRepository) ListAllMemos(ctx context.Context) ([]domain.Memo, e
 	return nil, nil
 }
 
+func (noopAppMemoRepository) SearchMemos(ctx context.Context, query domain.MemoSearchQuery) (domain.MemoPage, error) {
+	return domain.MemoPage{}, nil
+}
+
 func (noopAppMemoRepository) DeleteMemo(ctx context.Context, memoID string) error {
 	return nil
 }
@@ -197,6 +205,7 @@ func TestAppGetCloudMemosConvertsServiceError(t *testing.T) {
 			&adapterTestCredentialStore{},
 			services.NewGameService(noopAppGameRepository{}, newAdapterTestLogger()),
 			services.NewMemoService(noopAppMemoRepository{}, nil, newAdapterTestLogger()),
+			nil,
 			newAdapterTestLogger(),
 		),
 	}
@@ -230,6 +239,7 @@ func TestAppUploadMemoToCloudConvertsNotFoundError(t *testing.T) {
 			store,
 			services.NewGameService(noopAppGameRepository{}, newAdapterTestLogger()),
 			services.NewMemoService(noopAppMemoRepository{}, nil, newAdapterTestLogger()),
+			nil,
 			newAdapterTestLogger(),
 		),
 	}
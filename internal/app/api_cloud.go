@@ -39,6 +39,14 @@ type CloudDirectoryNode struct {
 	LastModified time.Time            `json:"lastModified"`
 	Children     []CloudDirectoryNode `json:"children,omitempty"`
 	ObjectKey    *string              `json:"objectKey,omitempty"`
+	// FileCount は配下をまだ返していないディレクトリ（遅延取得）のファイル数。Children を返すノードでは 0。
+	FileCount int64 `json:"fileCount,omitempty"`
+}
+
+// CloudDirectoryChildren は GetDirectoryChildren の1ページ分。NextCursor が空なら最後のページ。
+type CloudDirectoryChildren struct {
+	Nodes      []CloudDirectoryNode `json:"nodes"`
+	NextCursor string               `json:"nextCursor"`
 }
 
 // CloudFileDetail はクラウドファイル詳細を表す。
@@ -91,7 +99,7 @@ type CloudGameSummaryItem struct {
 // ListCloudGameSummaries はクラウド上の全ゲームの軽量サマリ（タイトル一覧）を取得する。
 // 初期表示用。ファイル数・サイズは含めず、各ゲームの詳細は GetGameDirectoryNode で遅延取得する。
 func (app *App) ListCloudGameSummaries() result.ApiResult[[]CloudGameSummaryItem] {
-	ctx := app.context()
+	ctx := app.interactiveContext()
 	summaries, err := app.ContentSyncService.ListCloudGameSummaries(ctx)
 	if err != nil {
 		return errorResultWithLog[[]CloudGameSummaryItem](app, "クラウドデータ取得に失敗しました", err, "operation", "ListCloudGameSummaries.ListCloudGameSummaries")
@@ -133,21 +141,68 @@ func (app *App) GetGameDirectoryNode(gameID string) result.ApiResult[CloudDirect
 	return result.OkResult(node)
 }
 
-// GetDirectoryTree はクラウドのディレクトリツリー（ゲーム単位の論理ビュー）を取得する。
+// GetDirectoryTree はクラウドのディレクトリツリーの最上位（ゲーム単位）を返す。
+// 各ゲームはサマリ（カタログ）から作った子なしノードで、配下は GetDirectoryChildren で1階層ずつ取得する。
 func (app *App) GetDirectoryTree() result.ApiResult[[]CloudDirectoryNode] {
-	ctx := app.context()
-	views, err := app.ContentSyncService.ListCloudGameViews(ctx)
+	ctx := app.interactiveContext()
+	summaries, err := app.ContentSyncService.ListCloudGameSummaries(ctx)
 	if err != nil {
-		return errorResultWithLog[[]CloudDirectoryNode](app, "ディレクトリツリー取得に失敗しました", err, "operation", "GetDirectoryTree.ListCloudGameViews")
+		return errorResultWithLog[[]CloudDirectoryNode](app, "ディレクトリツリー取得に失敗しました", err, "operation", "GetDirectoryTree.ListCloudGameSummaries")
 	}
 
-	nodes := make([]CloudDirectoryNode, 0, len(views))
-	for _, view := range views {
-		nodes = append(nodes, buildGameDirectoryNode(view))
+	nodes := make([]CloudDirectoryNode, 0, len(summaries))
+	for _, s := range summaries {
+		nodes = append(nodes, CloudDirectoryNode{
+			Name:         s.Title,
+			Path:         s.GameID,
+			IsDirectory:  true,
+			Size:         s.TotalSize,
+			LastModified: s.LastModified,
+			FileCount:    s.FileCount,
+		})
 	}
 	return result.OkResult(nodes)
 }
 
+// GetDirectoryChildren は1ゲームのクラウド論理ツリーのうち path 直下を1ページ分返す。
+// path はゲーム直下からのスラッシュ区切り（"" はゲーム直下）、cursor は前ページの NextCursor（先頭は ""）。
+// 返すノードの Path は GetDirectoryTree と同じく "<gameID>/<相対パス>" で、ディレクトリは子なし（FileCount 付き）。
+func (app *App) GetDirectoryChildren(gameID string, path string, cursor string) result.ApiResult[CloudDirectoryChildren] {
+	ctx := app.interactiveContext()
+	trimmed := strings.TrimSpace(gameID)
+	if trimmed == "" {
+		return result.ErrorResult[CloudDirectoryChildren]("ゲームIDが不正です", "game id is empty")
+	}
+	page, err := app.ContentSyncService.ListCloudDirectory(ctx, trimmed, path, cursor, 0)
+	if err != nil {
+		return errorResultWithLog[CloudDirectoryChildren](app, "ディレクトリ取得に失敗しました", err, "operation", "GetDirectoryChildren.ListCloudDirectory", "gameId", trimmed, "path", path)
+	}
+	if page == nil {
+		// HEAD 未設定でも UI が空ディレクトリとして描けるよう空ページを返す。
+		return result.OkResult(CloudDirectoryChildren{Nodes: []CloudDirectoryNode{}})
+	}
+	return result.OkResult(cloudDirectoryChildren(*page))
+}
+
+// cloudDirectoryChildren は1階層分のページを UI 向けのノードへ変換する。
+func cloudDirectoryChildren(page services.CloudDirectoryPage) CloudDirectoryChildren {
+	nodes := make([]CloudDirectoryNode, 0, len(page.Entries))
+	for _, entry := range page.Entries {
+		node := CloudDirectoryNode{
+			Name:         entry.Name,
+			Path:         page.GameID + "/" + entry.RelPath,
+			IsDirectory:  entry.IsDirectory,
+			Size:         entry.Size,
+			LastModified: page.LastModified,
+		}
+		if entry.IsDirectory {
+			node.FileCount = entry.FileCount
+		}
+		nodes = append(nodes, node)
+	}
+	return CloudDirectoryChildren{Nodes: nodes, NextCursor: page.NextCursor}
+}
+
 // buildGameDirectoryNode は1ゲームの論理ファイル一覧から階層ディレクトリツリーを構築する。
 // トップノードはゲーム（IsDirectory=true, Path=gameID）で、配下にセーブファイルの階層を持つ。
 func buildGameDirectoryNode(view services.CloudGameView) CloudDirectoryNode {
@@ -367,7 +422,7 @@ func (app *App) ValidateSavedCredential(key string) result.ApiResult[bool] {
 	if error != nil {
 		return errorResultWithLog[bool](app, "認証情報検証に失敗しました", error, "operation", "ValidateSavedCredential.resolveS3Config")
 	}
-	client, error := storage.NewClient(ctx, cfg, credential)
+	client, error := storage.SharedClient(ctx, cfg, credential, app.Config.S3UploadConcurrency)
 	if error != nil {
 		return errorResultWithLog[bool](app, "認証情報検証に失敗しました", error, "operation", "ValidateSavedCredential.newClient", "bucket", cfg.Bucket)
 	}
@@ -392,7 +447,7 @@ func (app *App) getDefaultS3Client(ctx context.Context) (*s3.Client, string, err
 	if error != nil {
 		return nil, "", error
 	}
-	client, error := storage.NewClient(ctx, cfg, credential)
+	client, error := storage.SharedClient(ctx, cfg, credential, app.Config.S3UploadConcurrency)
 	if error != nil {
 		return nil, "", error
 	}
@@ -430,6 +485,12 @@ func detectImageMime(filePath string) string {
 		return "image/gif"
 	case ".jpg", ".jpeg":
 		return "image/jpeg"
+	case ".webp":
+		return "image/webp"
+	case ".bmp":
+		return "image/bmp"
+	case ".avif":
+		return "image/avif"
 	default:
 		return "image/jpeg"
 	}
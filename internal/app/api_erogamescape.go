@@ -35,3 +35,22 @@ func (app *App) SearchErogameScape(query string, pageURL string) (domain.Erogame
 	}
 	return result, nil
 }
+
+// FetchManyFromErogameScape は複数の批評空間URLからゲーム情報をまとめて取得する（結果は入力順、失敗は1件ごと）。
+func (app *App) FetchManyFromErogameScape(gamePageURLs []string) ([]domain.GameImportResult, error) {
+	if app.ErogameScapeService == nil {
+		app.Logger.Error("批評空間サービスが未初期化です", "operation", "FetchManyFromErogameScape")
+		return nil, errors.New("ErogameScapeService is not initialized")
+	}
+	results := app.ErogameScapeService.FetchManyFromErogameScape(app.context(), gamePageURLs)
+	failed := 0
+	for _, item := range results {
+		if item.Error != "" {
+			failed++
+		}
+	}
+	if failed > 0 {
+		app.Logger.Warn("批評空間の一括取得で一部が失敗しました", "operation", "FetchManyFromErogameScape", "total", len(results), "failed", failed)
+	}
+	return results, nil
+}
@@ -2,9 +2,7 @@
 package app
 
 import (
-	"fmt"
 	"os"
-	"strings"
 
 	"CloudLaunch_Go/internal/infrastructure/db"
 	"CloudLaunch_Go/internal/result"
@@ -17,13 +15,25 @@ func (app *App) ExportGameData(outputDir string) result.ApiResult[services.GameE
 	return serviceResult(exported, err, "ゲーム一覧の出力に失敗しました")
 }
 
+// RebuildGameStats はプレイ統計をセッションから再集計し、食い違っていた件数を返す。
+func (app *App) RebuildGameStats() result.ApiResult[int] {
+	corrected, err := app.MaintenanceService.RebuildGameStats(app.context())
+	return serviceResult(corrected, err, "統計の再集計に失敗しました")
+}
+
 // CreateFullBackup はアプリデータ一式のバックアップZIPを作成する。
 func (app *App) CreateFullBackup(outputDir string) result.ApiResult[string] {
 	path, err := app.MaintenanceService.CreateFullBackup(outputDir)
 	return serviceResult(path, err, "バックアップ作成に失敗しました")
 }
 
-// RestoreFullBackup はバックアップZIPから全データを復元する。
+// CreateIncrementalBackup は baseBackupPath 以降に変わったファイルだけの増分バックアップZIPを同じフォルダに作成する。
+func (app *App) CreateIncrementalBackup(baseBackupPath string) result.ApiResult[string] {
+	path, err := app.MaintenanceService.CreateIncrementalBackup(baseBackupPath)
+	return serviceResult(path, err, "増分バックアップ作成に失敗しました")
+}
+
+// RestoreFullBackup はバックアップZIP（増分なら基準のバックアップも辿って）から全データを復元する。
 func (app *App) RestoreFullBackup(backupPath string) result.ApiResult[bool] {
 	if err := app.MaintenanceService.RestoreFullBackup(backupPath); err != nil {
 		return serviceErrorResult[bool](err, "バックアップ復元に失敗しました")
@@ -32,15 +42,20 @@ func (app *App) RestoreFullBackup(backupPath string) result.ApiResult[bool] {
 }
 
 func (app *App) createDatabaseSnapshot(destinationPath string) error {
-	_ = os.Remove(destinationPath)
 	if app.dbConnection == nil {
+		_ = os.Remove(destinationPath)
 		return services.CopyFilePath(app.Config.DatabasePath, destinationPath)
 	}
-	escaped := strings.ReplaceAll(destinationPath, "'", "''")
-	statement := fmt.Sprintf("VACUUM INTO '%s'", escaped)
-	if _, err := app.dbConnection.Exec(statement); err == nil {
+	err := db.Snapshot(app.dbConnection, destinationPath)
+	if err == nil {
 		return nil
 	}
+	app.Logger.Warn("VACUUM INTO によるスナップショットに失敗したためファイルをコピーします", "error", err)
+	// WAL モードでは本体ファイルにチェックポイント前の更新が無いため、コピーの前に書き戻す
+	if _, err := app.dbConnection.Exec("PRAGMA wal_checkpoint(TRUNCATE)"); err != nil {
+		app.Logger.Warn("WAL のチェックポイントに失敗しました", "error", err)
+	}
+	_ = os.Remove(destinationPath)
 	return services.CopyFilePath(app.Config.DatabasePath, destinationPath)
 }
 
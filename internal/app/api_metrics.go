@@ -0,0 +1,18 @@
+// 同期・一覧・プロセス監視の段階ごとの計測結果を返す API を提供する。
+package app
+
+import (
+	"CloudLaunch_Go/internal/result"
+	"CloudLaunch_Go/internal/services"
+)
+
+// GetPerformanceMetrics は段階名ごとの所要時間の分布と転送量の集計を返す（デバッグ表示用）。
+func (app *App) GetPerformanceMetrics() result.ApiResult[[]services.PerfPhaseMetrics] {
+	return result.OkResult(app.perfMetrics.Snapshot())
+}
+
+// ResetPerformanceMetrics は計測結果を捨てる。
+func (app *App) ResetPerformanceMetrics() result.ApiResult[bool] {
+	app.perfMetrics.Reset()
+	return result.OkResult(true)
+}
@@ -32,6 +32,20 @@ func (app *App) SyncStatus(gameID string) result.ApiResult[domain.SyncStatusDeta
 	return result.OkResult(detail)
 }
 
+// SyncStatusMany は複数ゲームの同期状態をまとめて返す（ライブラリ一覧のバッジ用）。
+// 判定が終わったゲームから順に "sync:status" イベント（GameSyncStatus）を送るので、
+// 画面は戻り値を待たずに1件ずつ反映できる。個別ゲームの失敗は各要素の error に入る。
+func (app *App) SyncStatusMany(gameIDs []string) result.ApiResult[[]services.GameSyncStatus] {
+	ctx := app.context()
+	statuses, err := app.ContentSyncService.StatusMany(ctx, gameIDs, func(item services.GameSyncStatus) {
+		wailsruntime.EventsEmit(ctx, "sync:status", item)
+	})
+	if err != nil {
+		return serviceErrorResult[[]services.GameSyncStatus](err, "同期状態の取得に失敗しました")
+	}
+	return result.OkResult(statuses)
+}
+
 // PushSync は指定ゲームのデータをリモートへアップロードする。
 func (app *App) PushSync(gameID string) result.ApiResult[any] {
 	trimmed, errResult, ok := requireGameID[any](gameID)
@@ -129,3 +143,22 @@ func (app *App) DeleteGameFromCloud(gameID string) result.ApiResult[any] {
 	}
 	return result.OkResult[any](nil)
 }
+
+// CollectCloudGarbage はクラウド上のどの保持コミットからも参照されないブロブを削除する。
+// gameID が空なら全ゲームが対象。dryRun が true なら何も消さず、削除対象の件数・サイズだけを返す。
+// 保持条件は CLOUDLAUNCH_GC_KEEP_COMMITS / CLOUDLAUNCH_GC_KEEP_DAYS / CLOUDLAUNCH_GC_GRACE_HOURS に従う。
+func (app *App) CollectCloudGarbage(gameID string, dryRun bool) result.ApiResult[[]services.GCReport] {
+	opts := services.GCOptions{DryRun: dryRun}
+	if trimmed := strings.TrimSpace(gameID); trimmed != "" {
+		report, err := app.ContentSyncService.CollectGarbage(app.context(), trimmed, opts)
+		if err != nil {
+			return serviceErrorResult[[]services.GCReport](err, "クラウドの不要データ削除に失敗しました")
+		}
+		return result.OkResult([]services.GCReport{report})
+	}
+	reports, err := app.ContentSyncService.CollectAllGarbage(app.context(), opts)
+	if err != nil {
+		return serviceErrorResult[[]services.GCReport](err, "クラウドの不要データ削除に失敗しました")
+	}
+	return result.OkResult(reports)
+}
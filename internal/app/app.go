@@ -12,6 +12,7 @@ import (
 	"CloudLaunch_Go/internal/config"
 	"CloudLaunch_Go/internal/infrastructure/credentials"
 	"CloudLaunch_Go/internal/infrastructure/db"
+	"CloudLaunch_Go/internal/infrastructure/storage"
 	"CloudLaunch_Go/internal/logging"
 	"CloudLaunch_Go/internal/memo"
 	"CloudLaunch_Go/internal/services"
@@ -31,6 +32,7 @@ type App struct {
 	CredentialService   *services.CredentialService
 	ContentSyncService  *services.ContentSyncService
 	ErogameScapeService *services.ErogameScapeService
+	Thumbnails          *services.ThumbnailCache
 	ProcessMonitor      *services.ProcessMonitorService
 	ScreenshotService   *services.ScreenshotService
 	MemoCloudService    *services.MemoCloudService
@@ -41,12 +43,16 @@ type App struct {
 	autoTracking        bool
 	isMonitoring        bool
 	syncCoalescer       *asyncCoalescer
+	syncScheduler       *services.SyncScheduler
+	perfMetrics         *services.PerfMetrics
+	screenshotUploads   *screenshotUploadQueue
+	closeLog            func(ctx context.Context) error
 }
 
 // NewApp はアプリケーションを初期化する。
 func NewApp(ctx context.Context) (*App, error) {
 	cfg := config.LoadFromEnv()
-	logger, logLevel := logging.NewLogger(cfg.AppDataDir, cfg.LogLevel)
+	logger, logLevel, closeLog := newLogger(cfg)
 
 	if error := os.MkdirAll(cfg.AppDataDir, 0o700); error != nil {
 		return nil, error
@@ -80,13 +86,24 @@ func NewApp(ctx context.Context) (*App, error) {
 		dbConnection: connection,
 		autoTracking: true,
 		isMonitoring: false,
+		closeLog:     closeLog,
 	}
 	app.configureServices(repository, credentialStore)
+	app.screenshotUploads = newScreenshotUploadQueue(app.uploadScreenshotBatch, logger)
 
 	logger.Info("CloudLaunch backend initialized")
 	return app, nil
 }
 
+// newLogger は設定に応じて同期・非同期のロガーを作る。戻り値の関数は残りのログを書き出して止める。
+func newLogger(cfg config.Config) (*slog.Logger, *slog.LevelVar, func(ctx context.Context) error) {
+	if cfg.LogAsync {
+		return logging.NewAsyncLogger(cfg.AppDataDir, cfg.LogLevel)
+	}
+	logger, logLevel := logging.NewLogger(cfg.AppDataDir, cfg.LogLevel)
+	return logger, logLevel, func(context.Context) error { return nil }
+}
+
 // Startup はWailsの起動時に呼ばれる。
 func (app *App) Startup(ctx context.Context) {
 	app.ctx = ctx
@@ -97,6 +114,15 @@ func (app *App) Startup(ctx context.Context) {
 	if err := app.startHotkey(); err != nil {
 		app.Logger.Warn("ホットキーの開始に失敗しました", "error", err)
 	}
+	contentSync := app.ContentSyncService
+	go func() {
+		defer logging.Recover(app.Logger, "app.abortStaleMultipartUploads")
+		// 前回までに中断して再開されなかったマルチパートの断片は課金が続くため、起動のたびに掃除する
+		if err := contentSync.AbortStaleMultipartUploads(ctx); err != nil {
+			app.Logger.Warn("未完了マルチパートアップロードの掃除に失敗しました", "error", err)
+		}
+	}()
+	go app.warmThumbnails(ctx)
 }
 
 func (app *App) context() context.Context {
@@ -106,9 +132,18 @@ func (app *App) context() context.Context {
 	return context.Background()
 }
 
+// interactiveContext は画面操作に応答する API 用の ctx。同期スケジューラでバックグラウンドの同期より先に実行枠を得る。
+func (app *App) interactiveContext() context.Context {
+	return services.WithSyncPriority(app.context(), services.SyncPriorityInteractive)
+}
+
 // Shutdown はアプリケーションの終了処理を行う。
 func (app *App) Shutdown(ctx context.Context) error {
 	app.Logger.Info("CloudLaunch backend shutting down")
+	if app.closeLog != nil {
+		// 終了処理中のログまで書き出してから止める
+		defer func() { _ = app.closeLog(ctx) }()
+	}
 	if app.ProcessMonitor != nil {
 		app.ProcessMonitor.StopMonitoring()
 	}
@@ -118,6 +153,9 @@ func (app *App) Shutdown(ctx context.Context) error {
 			app.Logger.Warn("スクリーンショットログのクローズに失敗しました", "error", err)
 		}
 	}
+	if app.screenshotUploads != nil {
+		app.screenshotUploads.stop(ctx)
+	}
 	if app.dbConnection != nil {
 		return app.dbConnection.Close()
 	}
@@ -130,9 +168,20 @@ func (app *App) configureServices(repository *db.Repository, credentialStore cre
 	app.RouteService = services.NewRouteService(repository, app.Logger)
 	app.MemoService = services.NewMemoService(repository, app.MemoFiles, app.Logger)
 	app.CredentialService = services.NewCredentialService(credentialStore, app.Logger)
+	// 同期の実行枠・転送予算・計測結果はアプリで1つ。DB の開き直しでサービスを作り直しても引き継ぐ
+	if app.syncScheduler == nil {
+		app.syncScheduler = services.NewSyncScheduler(app.Config.SyncMaxJobs)
+	}
+	if app.perfMetrics == nil {
+		app.perfMetrics = services.NewPerfMetrics(app.Logger)
+	}
+	storage.SetTransferLimits(app.Config.S3MaxConnections, int64(app.Config.S3BandwidthLimitKBps)<<10)
 	app.ContentSyncService = services.NewContentSyncService(app.Config, credentialStore, repository, app.Logger)
+	app.ContentSyncService.SetScheduler(app.syncScheduler)
+	app.ContentSyncService.SetPerfMetrics(app.perfMetrics)
 	app.syncCoalescer = newAsyncCoalescer(func(id string) {
-		if err := app.ContentSyncService.Push(app.context(), id, nil); err != nil {
+		ctx := services.WithSyncPriority(app.context(), services.SyncPriorityPostSession)
+		if err := app.ContentSyncService.Push(ctx, id, nil); err != nil {
 			app.Logger.Warn("クラウド同期に失敗", "gameId", id, "detail", err)
 		}
 	})
@@ -140,9 +189,13 @@ func (app *App) configureServices(repository *db.Repository, credentialStore cre
 		app.Logger.Error("クラウド同期中に panic を回収", "gameId", id, "recovered", recovered)
 	}
 	app.ErogameScapeService = services.NewErogameScapeService(app.Config, app.Logger)
+	app.Thumbnails = services.NewThumbnailCache(filepath.Join(app.Config.AppDataDir, "cache", "thumbnails"), app.Logger)
 	app.ProcessMonitor = services.NewProcessMonitorService(repository, app.Logger, app.ContentSyncService)
+	app.ProcessMonitor.SetPerfMetrics(app.perfMetrics)
+	app.GameService.SetGamesChangedHook(app.ProcessMonitor.InvalidateGameIndex)
+	app.ContentSyncService.SetGamesChangedHook(app.ProcessMonitor.InvalidateGameIndex)
 	app.ScreenshotService = services.NewScreenshotService(app.Config, repository, app.ProcessMonitor, app.Logger)
-	app.MemoCloudService = services.NewMemoCloudService(app.Config, credentialStore, app.GameService, app.MemoService, app.Logger)
+	app.MemoCloudService = services.NewMemoCloudService(app.Config, credentialStore, app.GameService, app.MemoService, repository, app.Logger)
 	app.MaintenanceService = services.NewMaintenanceService(
 		app.Config,
 		repository,
@@ -153,6 +206,7 @@ func (app *App) configureServices(repository *db.Repository, credentialStore cre
 			CloseDatabaseConnection:   app.closeDatabaseConnection,
 			ReopenDatabaseAndServices: app.reopenDatabaseAndServices,
 			ResumeRuntimeServices:     app.resumeRuntimeServicesAfterRestore,
+			VerifyDatabase:            db.Verify,
 		},
 	)
 }
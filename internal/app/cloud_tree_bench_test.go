@@ -0,0 +1,37 @@
+package app
+
+import (
+	"fmt"
+	"testing"
+	"time"
+
+	"CloudLaunch_Go/internal/services"
+)
+
+// benchCloudGameView はスロット 100 個 × 4 段の階層に 10k ファイルを持つゲーム1件分のクラウドビュー。
+func benchCloudGameView() services.CloudGameView {
+	view := services.CloudGameView{
+		GameID:       "game-1",
+		Title:        "Bench Game",
+		LastModified: time.Date(2026, 1, 1, 0, 0, 0, 0, time.UTC),
+	}
+	for i := range 10000 {
+		relPath := fmt.Sprintf("slot%03d/area%d/chapter%d/save%05d.dat", i%100, i%7, i%3, i)
+		view.Files = append(view.Files, services.CloudLogicalFile{RelPath: relPath, Size: 1 << 10})
+		view.TotalSize += 1 << 10
+	}
+	return view
+}
+
+// BenchmarkBuildGameDirectoryNode はクラウドのファイル一覧から階層ツリーを組み立てる処理を測る。
+func BenchmarkBuildGameDirectoryNode(b *testing.B) {
+	view := benchCloudGameView()
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		node := buildGameDirectoryNode(view)
+		if node.Size != view.TotalSize {
+			b.Fatalf("expected size %d, got %d", view.TotalSize, node.Size)
+		}
+	}
+}
@@ -32,6 +32,7 @@ func (app *App) startHotkeyLocked() error {
 		return err
 	}
 	app.HotkeyService = service
+	go app.ScreenshotService.PrewarmCapture()
 	return nil
 }
 
@@ -80,13 +81,12 @@ func (app *App) handleHotkeyCapture() bool {
 	return true
 }
 
+// syncScreenshotAfterHotkey はアップロードをキューに預けてすぐ戻る。連写中も次の撮影を送信で待たせない。
 func (app *App) syncScreenshotAfterHotkey(gameID string, path string) {
-	if strings.TrimSpace(gameID) == "" {
+	if strings.TrimSpace(gameID) == "" || !app.Config.ScreenshotSyncEnabled || app.screenshotUploads == nil {
 		return
 	}
-	if app.Config.ScreenshotSyncEnabled {
-		if syncErr := app.uploadScreenshot(app.context(), gameID, path); syncErr != nil {
-			app.Logger.Error("スクリーンショット同期に失敗", "error", syncErr)
-		}
+	if !app.screenshotUploads.enqueue(gameID, path) {
+		app.Logger.Warn("アップロード待ちが上限に達したためスクリーンショットを同期しません", "gameId", gameID, "path", path)
 	}
 }
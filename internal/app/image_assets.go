@@ -0,0 +1,104 @@
+// ローカル画像を Wails のアセットサーバー経由で配信するハンドラを提供する。
+package app
+
+import (
+	"context"
+	"net/http"
+	"os"
+	"path/filepath"
+	"strings"
+
+	"CloudLaunch_Go/internal/domain"
+	"CloudLaunch_Go/internal/logging"
+)
+
+// localImageRoute はローカル画像の配信パス。フロントエンドの loadImage ブリッジと揃える。
+const localImageRoute = "/local-image"
+
+// AssetHandler は Wails の AssetServer.Handler に渡すハンドラを返す（埋め込みアセットに無いパスだけが届く）。
+// /local-image?path=<絶対パス>[&size=thumb] でローカル画像を返し、size=thumb ならサムネイルキャッシュを経由する。
+// base64 の data URL を bridge で受け渡すと UI スレッドが数 MB の文字列をデコードすることになるため、
+// WebView に直接読ませ、ETag / Last-Modified の再検証でスクロールのたびに読み直させない。
+func (app *App) AssetHandler() http.Handler {
+	mux := http.NewServeMux()
+	mux.HandleFunc(localImageRoute, app.serveLocalImage)
+	return mux
+}
+
+func (app *App) serveLocalImage(w http.ResponseWriter, r *http.Request) {
+	if r.Method != http.MethodGet && r.Method != http.MethodHead {
+		w.WriteHeader(http.StatusMethodNotAllowed)
+		return
+	}
+	sourcePath := r.URL.Query().Get("path")
+	// 画像以外のローカルファイルを WebView から読めないよう、絶対パスの画像拡張子に限る
+	if !filepath.IsAbs(sourcePath) || !isImagePath(sourcePath) {
+		http.NotFound(w, r)
+		return
+	}
+
+	servePath, etag := sourcePath, ""
+	if r.URL.Query().Get("size") == "thumb" && app.Thumbnails != nil {
+		thumbnail, hash, err := app.Thumbnails.Thumbnail(sourcePath)
+		if err != nil {
+			app.Logger.Debug("サムネイルを作れないため元画像を配信します", "path", sourcePath, "error", err)
+		} else {
+			servePath, etag = thumbnail, hash
+		}
+	}
+
+	file, err := os.Open(servePath)
+	if err != nil {
+		app.Logger.Warn("画像読み込みに失敗しました", "operation", "serveLocalImage.open", "path", servePath, "error", err)
+		http.NotFound(w, r)
+		return
+	}
+	defer func() {
+		if closeErr := file.Close(); closeErr != nil {
+			app.Logger.Warn("画像ファイルのクローズに失敗", "error", closeErr)
+		}
+	}()
+	info, err := file.Stat()
+	if err != nil || info.IsDir() {
+		http.NotFound(w, r)
+		return
+	}
+
+	w.Header().Set("Content-Type", detectImageMime(servePath))
+	// パスが同じでも画像は差し替わりうるため、短時間だけ再利用させて以降は再検証で済ませる
+	w.Header().Set("Cache-Control", "private, max-age=300, must-revalidate")
+	if etag != "" {
+		w.Header().Set("ETag", `"`+etag+`"`)
+	}
+	http.ServeContent(w, r, "", info.ModTime(), file)
+}
+
+// isImagePath は配信を許可する画像の拡張子かを返す。
+func isImagePath(filePath string) bool {
+	switch strings.ToLower(filepath.Ext(filePath)) {
+	case ".png", ".jpg", ".jpeg", ".gif", ".webp", ".bmp", ".avif":
+		return true
+	default:
+		return false
+	}
+}
+
+// warmThumbnails は登録済みゲームのカバー画像のサムネイルを事前に作る。
+func (app *App) warmThumbnails(ctx context.Context) {
+	defer logging.Recover(app.Logger, "app.warmThumbnails")
+	if app.Thumbnails == nil || app.GameService == nil {
+		return
+	}
+	games, err := app.GameService.ListGames(ctx, "", domain.PlayStatus(""), "title", "asc")
+	if err != nil {
+		app.Logger.Warn("サムネイルの事前生成のためのゲーム一覧取得に失敗しました", "error", err)
+		return
+	}
+	paths := make([]string, 0, len(games))
+	for _, game := range games {
+		if game.ImagePath != nil && isImagePath(*game.ImagePath) {
+			paths = append(paths, *game.ImagePath)
+		}
+	}
+	app.Thumbnails.Warm(ctx, paths)
+}
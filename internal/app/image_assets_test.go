@@ -0,0 +1,180 @@
+package app
+
+import (
+	"bytes"
+	"image"
+	"image/png"
+	"io"
+	"log/slog"
+	"net/http"
+	"net/http/httptest"
+	"net/url"
+	"os"
+	"path/filepath"
+	"testing"
+
+	"CloudLaunch_Go/internal/services"
+)
+
+// newImageAssetsTestApp はサムネイルキャッシュだけを持つ App を返す。
+func newImageAssetsTestApp(t *testing.T) *App {
+	t.Helper()
+	logger := slog.New(slog.NewTextHandler(io.Discard, nil))
+	return &App{
+		Logger:     logger,
+		Thumbnails: services.NewThumbnailCache(filepath.Join(t.TempDir(), "thumbnails"), logger),
+	}
+}
+
+// writeAssetPNG は w×h の PNG を path に書き、その内容を返す。
+func writeAssetPNG(t *testing.T, path string, w, h int) []byte {
+	t.Helper()
+	var buf bytes.Buffer
+	if err := png.Encode(&buf, image.NewRGBA(image.Rect(0, 0, w, h))); err != nil {
+		t.Fatalf("png.Encode: %v", err)
+	}
+	if err := os.WriteFile(path, buf.Bytes(), 0o600); err != nil {
+		t.Fatal(err)
+	}
+	return buf.Bytes()
+}
+
+// getLocalImage は /local-image に path（と size）を付けて GET し、応答を返す。header は追加のリクエストヘッダ。
+func getLocalImage(app *App, method, sourcePath, size string, header map[string]string) *httptest.ResponseRecorder {
+	query := url.Values{"path": {sourcePath}}
+	if size != "" {
+		query.Set("size", size)
+	}
+	req := httptest.NewRequest(method, localImageRoute+"?"+query.Encode(), nil)
+	for key, value := range header {
+		req.Header.Set(key, value)
+	}
+	rec := httptest.NewRecorder()
+	app.AssetHandler().ServeHTTP(rec, req)
+	return rec
+}
+
+// TestServeLocalImageRejectsNonImageRequests は、相対パス・画像以外の拡張子・存在しないファイル・GET/HEAD 以外を
+// 配信しないことを確認する。
+func TestServeLocalImageRejectsNonImageRequests(t *testing.T) {
+	t.Parallel()
+
+	app := newImageAssetsTestApp(t)
+	dir := t.TempDir()
+	textPath := filepath.Join(dir, "notes.txt")
+	if err := os.WriteFile(textPath, []byte("secret"), 0o600); err != nil {
+		t.Fatal(err)
+	}
+	imagePath := filepath.Join(dir, "cover.png")
+	writeAssetPNG(t, imagePath, 8, 8)
+	folderPath := filepath.Join(dir, "folder.png")
+	if err := os.Mkdir(folderPath, 0o700); err != nil {
+		t.Fatal(err)
+	}
+
+	cases := []struct {
+		name   string
+		method string
+		path   string
+		want   int
+	}{
+		{"relative path", http.MethodGet, "cover.png", http.StatusNotFound},
+		{"non-image extension", http.MethodGet, textPath, http.StatusNotFound},
+		{"missing file", http.MethodGet, filepath.Join(dir, "missing.png"), http.StatusNotFound},
+		{"directory with image extension", http.MethodGet, folderPath, http.StatusNotFound},
+		{"unsupported method", http.MethodPost, imagePath, http.StatusMethodNotAllowed},
+	}
+	for _, tc := range cases {
+		rec := getLocalImage(app, tc.method, tc.path, "", nil)
+		if rec.Code != tc.want {
+			t.Fatalf("%s: status = %d, want %d", tc.name, rec.Code, tc.want)
+		}
+		if bytes.Contains(rec.Body.Bytes(), []byte("secret")) {
+			t.Fatalf("%s: response must not leak the file content", tc.name)
+		}
+	}
+}
+
+// TestServeLocalImageServesOriginalWithRevalidation は、size 指定なしでは元画像をそのまま返し、
+// Cache-Control と Last-Modified を付け、If-Modified-Since の再検証に 304 で応えることを確認する。
+func TestServeLocalImageServesOriginalWithRevalidation(t *testing.T) {
+	t.Parallel()
+
+	app := newImageAssetsTestApp(t)
+	imagePath := filepath.Join(t.TempDir(), "cover.png")
+	original := writeAssetPNG(t, imagePath, 1280, 720)
+
+	rec := getLocalImage(app, http.MethodGet, imagePath, "", nil)
+	if rec.Code != http.StatusOK {
+		t.Fatalf("status = %d, want 200", rec.Code)
+	}
+	if !bytes.Equal(rec.Body.Bytes(), original) {
+		t.Fatal("original request should return the source image unchanged")
+	}
+	if got := rec.Header().Get("Content-Type"); got != "image/png" {
+		t.Fatalf("Content-Type = %q", got)
+	}
+	if got := rec.Header().Get("Cache-Control"); got != "private, max-age=300, must-revalidate" {
+		t.Fatalf("Cache-Control = %q", got)
+	}
+	if got := rec.Header().Get("ETag"); got != "" {
+		t.Fatalf("original should be revalidated by Last-Modified only, got ETag %q", got)
+	}
+	lastModified := rec.Header().Get("Last-Modified")
+	if lastModified == "" {
+		t.Fatal("expected Last-Modified")
+	}
+
+	rec = getLocalImage(app, http.MethodGet, imagePath, "", map[string]string{"If-Modified-Since": lastModified})
+	if rec.Code != http.StatusNotModified || rec.Body.Len() != 0 {
+		t.Fatalf("revalidation: status = %d body = %d bytes, want 304 and empty", rec.Code, rec.Body.Len())
+	}
+}
+
+// TestServeLocalImageServesThumbnailWithETag は、size=thumb では大きな画像を縮小したサムネイルを、
+// 小さな画像は元画像をそれぞれ内容ハッシュの ETag 付きで返し、If-None-Match の再検証に 304 で応えることを確認する。
+func TestServeLocalImageServesThumbnailWithETag(t *testing.T) {
+	t.Parallel()
+
+	app := newImageAssetsTestApp(t)
+	dir := t.TempDir()
+	largePath := filepath.Join(dir, "large.png")
+	large := writeAssetPNG(t, largePath, 1280, 720)
+	smallPath := filepath.Join(dir, "small.png")
+	small := writeAssetPNG(t, smallPath, 64, 64)
+
+	rec := getLocalImage(app, http.MethodGet, largePath, "thumb", nil)
+	if rec.Code != http.StatusOK {
+		t.Fatalf("status = %d, want 200", rec.Code)
+	}
+	if bytes.Equal(rec.Body.Bytes(), large) {
+		t.Fatal("thumbnail request for a large image should not return the original")
+	}
+	thumb, err := png.Decode(bytes.NewReader(rec.Body.Bytes()))
+	if err != nil {
+		t.Fatalf("thumbnail should be a PNG: %v", err)
+	}
+	if bounds := thumb.Bounds(); min(bounds.Dx(), bounds.Dy()) >= 720 {
+		t.Fatalf("thumbnail was not resized: %v", bounds)
+	}
+	etag := rec.Header().Get("ETag")
+	if etag == "" {
+		t.Fatal("thumbnail should carry the content hash as ETag")
+	}
+	if got := rec.Header().Get("Cache-Control"); got != "private, max-age=300, must-revalidate" {
+		t.Fatalf("Cache-Control = %q", got)
+	}
+
+	rec = getLocalImage(app, http.MethodGet, largePath, "thumb", map[string]string{"If-None-Match": etag})
+	if rec.Code != http.StatusNotModified || rec.Body.Len() != 0 {
+		t.Fatalf("revalidation: status = %d body = %d bytes, want 304 and empty", rec.Code, rec.Body.Len())
+	}
+
+	rec = getLocalImage(app, http.MethodGet, smallPath, "thumb", nil)
+	if rec.Code != http.StatusOK || !bytes.Equal(rec.Body.Bytes(), small) {
+		t.Fatalf("small image should be served as is: status = %d", rec.Code)
+	}
+	if got := rec.Header().Get("ETag"); got == "" || got == etag {
+		t.Fatalf("small image should carry its own ETag, got %q", got)
+	}
+}
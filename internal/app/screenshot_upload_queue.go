@@ -0,0 +1,161 @@
+// ホットキー撮影したスクリーンショットを撮影から切り離してアップロードするキューを提供する。
+package app
+
+import (
+	"context"
+	"fmt"
+	"log/slog"
+	"sync"
+	"time"
+)
+
+const (
+	// screenshotUploadQueueSize はアップロード待ちの上限。連写しても撮影側を待たせず、溢れた分はローカルに残すだけにする。
+	screenshotUploadQueueSize = 64
+	// screenshotUploadBatchSize は1回の送信でまとめるジョブ数（S3 クライアントの解決をまとめて1回にする）。
+	screenshotUploadBatchSize = 8
+	// screenshotUploadAttempts は1件あたりの送信回数の上限（初回を含む）。
+	screenshotUploadAttempts = 3
+	// screenshotUploadRetryDelay は再送までの待ち時間の初期値。再送のたびに倍にする。
+	screenshotUploadRetryDelay = 2 * time.Second
+)
+
+// screenshotUploadJob はアップロード待ちのスクリーンショット1件。
+type screenshotUploadJob struct {
+	gameID  string
+	path    string
+	attempt int
+}
+
+// screenshotUploadQueue は有界のアップロード待ち行列と、それを送る1つのワーカー。
+// enqueue は待たずに返り、ワーカーは溜まっている分を最大 batchSize 件ずつまとめて send に渡す。
+// 失敗したジョブは retryDelay から倍々に待ってから attempts 回まで送り直す（待つ間も後続の送信は止めない）。
+type screenshotUploadQueue struct {
+	send       func(ctx context.Context, batch []screenshotUploadJob) []error
+	logger     *slog.Logger
+	batchSize  int
+	attempts   int
+	retryDelay time.Duration
+
+	mu     sync.Mutex
+	jobs   chan screenshotUploadJob
+	closed bool
+	ctx    context.Context
+	cancel context.CancelFunc
+	done   chan struct{}
+}
+
+// newScreenshotUploadQueue は send で送るキューを生成し、ワーカーを開始する。
+// send は batch と同じ長さのエラー列（成功は nil）を返す。
+func newScreenshotUploadQueue(send func(ctx context.Context, batch []screenshotUploadJob) []error, logger *slog.Logger) *screenshotUploadQueue {
+	ctx, cancel := context.WithCancel(context.Background())
+	queue := &screenshotUploadQueue{
+		send:       send,
+		logger:     logger,
+		batchSize:  screenshotUploadBatchSize,
+		attempts:   screenshotUploadAttempts,
+		retryDelay: screenshotUploadRetryDelay,
+		jobs:       make(chan screenshotUploadJob, screenshotUploadQueueSize),
+		ctx:        ctx,
+		cancel:     cancel,
+		done:       make(chan struct{}),
+	}
+	go queue.run()
+	return queue
+}
+
+// enqueue はアップロードを予約する。満杯・停止後は false を返す（ファイルはローカルに残る）。
+func (queue *screenshotUploadQueue) enqueue(gameID string, path string) bool {
+	return queue.push(screenshotUploadJob{gameID: gameID, path: path})
+}
+
+func (queue *screenshotUploadQueue) push(job screenshotUploadJob) bool {
+	queue.mu.Lock()
+	defer queue.mu.Unlock()
+	if queue.closed {
+		return false
+	}
+	select {
+	case queue.jobs <- job:
+		return true
+	default:
+		return false
+	}
+}
+
+// stop は新規の予約を締め切り、待ち行列に残った分を送り終えるまで待つ。
+// ctx が先に終われば送信中のアップロードを中断して戻る。再送待ちのジョブは捨てる。多重呼び出しは安全。
+func (queue *screenshotUploadQueue) stop(ctx context.Context) {
+	queue.mu.Lock()
+	if !queue.closed {
+		queue.closed = true
+		close(queue.jobs)
+	}
+	queue.mu.Unlock()
+	select {
+	case <-queue.done:
+	case <-ctx.Done():
+		queue.cancel()
+		<-queue.done
+	}
+	queue.cancel()
+}
+
+func (queue *screenshotUploadQueue) run() {
+	defer close(queue.done)
+	for job := range queue.jobs {
+		batch := []screenshotUploadJob{job}
+	collect:
+		for len(batch) < queue.batchSize {
+			select {
+			case next, ok := <-queue.jobs:
+				if !ok {
+					break collect
+				}
+				batch = append(batch, next)
+			default:
+				break collect
+			}
+		}
+		queue.sendBatch(batch)
+	}
+}
+
+func (queue *screenshotUploadQueue) sendBatch(batch []screenshotUploadJob) {
+	errs := queue.sendSafely(batch)
+	for index, job := range batch {
+		var err error
+		if index < len(errs) {
+			err = errs[index]
+		}
+		if err == nil {
+			continue
+		}
+		job.attempt++
+		if job.attempt >= queue.attempts || queue.ctx.Err() != nil {
+			queue.logger.Error("スクリーンショット同期に失敗", "gameId", job.gameID, "path", job.path, "attempts", job.attempt, "error", err)
+			continue
+		}
+		delay := queue.retryDelay << (job.attempt - 1)
+		queue.logger.Warn("スクリーンショット同期に失敗したため再送します", "gameId", job.gameID, "path", job.path, "retryIn", delay, "error", err)
+		time.AfterFunc(delay, func() {
+			if !queue.push(job) {
+				queue.logger.Warn("スクリーンショットを再送できませんでした", "gameId", job.gameID, "path", job.path)
+			}
+		})
+	}
+}
+
+// sendSafely は send を実行し、panic は全件の失敗として扱ってワーカーを止めない。
+func (queue *screenshotUploadQueue) sendSafely(batch []screenshotUploadJob) (errs []error) {
+	defer func() {
+		if recovered := recover(); recovered != nil {
+			queue.logger.Error("スクリーンショット同期中に panic を回収", "recovered", recovered)
+			errs = make([]error, len(batch))
+			for index := range errs {
+				errs[index] = fmt.Errorf("panic: %v", recovered)
+			}
+		}
+	}()
+	return queue.send(queue.ctx, batch)
+}
@@ -0,0 +1,111 @@
+package app
+
+import (
+	"context"
+	"errors"
+	"io"
+	"log/slog"
+	"sync"
+	"testing"
+	"time"
+)
+
+// recordingUploader は送られたバッチを記録し、failures 回まで各ジョブを失敗させる。
+type recordingUploader struct {
+	mu       sync.Mutex
+	batches  [][]screenshotUploadJob
+	failures map[string]int
+	release  chan struct{}
+}
+
+func (uploader *recordingUploader) send(_ context.Context, batch []screenshotUploadJob) []error {
+	if uploader.release != nil {
+		<-uploader.release
+	}
+	uploader.mu.Lock()
+	defer uploader.mu.Unlock()
+	uploader.batches = append(uploader.batches, append([]screenshotUploadJob(nil), batch...))
+	errs := make([]error, len(batch))
+	for index, job := range batch {
+		if uploader.failures[job.path] > 0 {
+			uploader.failures[job.path]--
+			errs[index] = errors.New("upload failed")
+		}
+	}
+	return errs
+}
+
+func (uploader *recordingUploader) sentPaths() []string {
+	uploader.mu.Lock()
+	defer uploader.mu.Unlock()
+	var paths []string
+	for _, batch := range uploader.batches {
+		for _, job := range batch {
+			paths = append(paths, job.path)
+		}
+	}
+	return paths
+}
+
+func newTestUploadQueue(uploader *recordingUploader) *screenshotUploadQueue {
+	queue := newScreenshotUploadQueue(uploader.send, slog.New(slog.NewTextHandler(io.Discard, nil)))
+	queue.retryDelay = time.Millisecond
+	return queue
+}
+
+// TestScreenshotUploadQueueBatchesPendingJobs は、送信中に溜まったジョブを次の送信でまとめ、
+// stop が残りを送り終えてから戻ることを確認する。
+func TestScreenshotUploadQueueBatchesPendingJobs(t *testing.T) {
+	t.Parallel()
+
+	uploader := &recordingUploader{release: make(chan struct{})}
+	queue := newTestUploadQueue(uploader)
+	for _, path := range []string{"a.png", "b.png", "c.png"} {
+		if !queue.enqueue("game-1", path) {
+			t.Fatalf("enqueue %s rejected", path)
+		}
+	}
+	close(uploader.release)
+	queue.stop(context.Background())
+
+	if paths := uploader.sentPaths(); len(paths) != 3 {
+		t.Fatalf("expected 3 uploads, got %v", paths)
+	}
+	if len(uploader.batches) >= 3 {
+		t.Fatalf("expected pending jobs to be batched, got %d batches", len(uploader.batches))
+	}
+	if queue.enqueue("game-1", "d.png") {
+		t.Fatalf("expected enqueue after stop to be rejected")
+	}
+}
+
+// TestScreenshotUploadQueueRetriesFailedJobs は、失敗したジョブだけを上限回数まで送り直すことを確認する。
+func TestScreenshotUploadQueueRetriesFailedJobs(t *testing.T) {
+	t.Parallel()
+
+	uploader := &recordingUploader{failures: map[string]int{"flaky.png": 1, "broken.png": screenshotUploadAttempts + 1}}
+	queue := newTestUploadQueue(uploader)
+	queue.enqueue("game-1", "flaky.png")
+	queue.enqueue("game-1", "broken.png")
+
+	deadline := time.Now().Add(2 * time.Second)
+	for time.Now().Before(deadline) {
+		if len(uploader.sentPaths()) >= 2+screenshotUploadAttempts-1 {
+			break
+		}
+		time.Sleep(5 * time.Millisecond)
+	}
+	time.Sleep(20 * time.Millisecond)
+	queue.stop(context.Background())
+
+	counts := map[string]int{}
+	for _, path := range uploader.sentPaths() {
+		counts[path]++
+	}
+	if counts["flaky.png"] != 2 {
+		t.Fatalf("expected flaky upload to succeed on retry, got %d attempts", counts["flaky.png"])
+	}
+	if counts["broken.png"] != screenshotUploadAttempts {
+		t.Fatalf("expected broken upload to stop after %d attempts, got %d", screenshotUploadAttempts, counts["broken.png"])
+	}
+}
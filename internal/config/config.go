@@ -12,6 +12,7 @@ type Config struct {
 	AppDataDir             string
 	DatabasePath           string
 	LogLevel               string
+	LogAsync               bool // ログをキュー経由でまとめて書き出す（error 以上と終了時は待たずに書き出して fsync する）
 	ScreenshotSyncEnabled  bool
 	ScreenshotUploadJpeg   bool
 	ScreenshotJpegQuality  int
@@ -19,12 +20,28 @@ type Config struct {
 	ScreenshotLocalJpeg    bool
 	ScreenshotHotkey       string
 	ScreenshotHotkeyNotify bool
+	ScreencapResident      bool // screencap-cli を常駐させて撮影のたびの起動を省く（serve 対応版が必要。非対応の版なら自動で単発実行に戻る）
 	S3Endpoint             string
 	S3Region               string
 	S3Bucket               string
 	S3ForcePathStyle       bool
 	S3UseTLS               bool
 	S3UploadConcurrency    int
+	S3MaxConnections       int // 全操作で共有する S3 の同時リクエスト数の上限
+	S3BandwidthLimitKBps   int // 送信・受信それぞれの帯域上限（KiB/s）。0 は無制限
+	SyncMaxJobs            int // 同時に実行する同期ジョブ（Push / Pull / 一覧）の数
+	S3Compression          bool
+	SaveHashParanoid       bool
+	HashConcurrency        int // セーブファイルのハッシュ並列数。0 は論理 CPU 数
+	RemoteIndexMaxAgeHours int // リモートブロブ控えを全件列挙なしで信用する最長時間
+	BlobCacheMaxMB         int // commit / tree / meta ブロブのローカルキャッシュ上限（MiB）
+	GCKeepCommits          int // GC で HEAD を含めて新しい順に残すコミット数
+	GCKeepDays             int // GC でこの日数以内に作られたコミットも残す
+	GCGraceHours           int // GC で未参照でもこの時間以内に置かれたブロブは消さない（実行中の Push を壊さないため）
+	ErogameScapeCacheHours int // 批評空間のページ・検索結果をリクエストせずに再利用する時間（画像はこの30倍）
+	ErogameScapeCacheMaxMB int // 批評空間のレスポンスキャッシュの上限（MiB）。超えたら古いものから消す。0 は上限なし
+	ErogameScapeIntervalMs int // 批評空間へのリクエストの最小間隔（ミリ秒）。並行取得でも全体でこの間隔を空ける
+	ErogameScapeWorkers    int // 批評空間の一括取り込みの並列数
 	CredentialNamespace    string
 }
 
@@ -37,6 +54,7 @@ func LoadFromEnv() Config {
 		AppDataDir:             appDataDir,
 		DatabasePath:           databasePath,
 		LogLevel:               getEnv("CLOUDLAUNCH_LOG_LEVEL", "info"),
+		LogAsync:               getEnvBool("CLOUDLAUNCH_LOG_ASYNC", true),
 		ScreenshotSyncEnabled:  getEnvBool("CLOUDLAUNCH_SCREENSHOT_SYNC", false),
 		ScreenshotUploadJpeg:   getEnvBool("CLOUDLAUNCH_SCREENSHOT_UPLOAD_JPEG", true),
 		ScreenshotJpegQuality:  getEnvInt("CLOUDLAUNCH_SCREENSHOT_JPEG_QUALITY", 85),
@@ -44,12 +62,28 @@ func LoadFromEnv() Config {
 		ScreenshotLocalJpeg:    getEnvBool("CLOUDLAUNCH_SCREENSHOT_LOCAL_JPEG", false),
 		ScreenshotHotkey:       getEnv("CLOUDLAUNCH_SCREENSHOT_HOTKEY", "Ctrl+Alt+S"),
 		ScreenshotHotkeyNotify: getEnvBool("CLOUDLAUNCH_SCREENSHOT_HOTKEY_NOTIFY", true),
+		ScreencapResident:      getEnvBool("CLOUDLAUNCH_SCREENCAP_RESIDENT", false),
 		S3Endpoint:             getEnv("CLOUDLAUNCH_S3_ENDPOINT", ""),
 		S3Region:               getEnv("CLOUDLAUNCH_S3_REGION", "auto"),
 		S3Bucket:               getEnv("CLOUDLAUNCH_S3_BUCKET", ""),
 		S3ForcePathStyle:       getEnvBool("CLOUDLAUNCH_S3_FORCE_PATH_STYLE", false),
 		S3UseTLS:               getEnvBool("CLOUDLAUNCH_S3_USE_TLS", true),
 		S3UploadConcurrency:    getEnvInt("CLOUDLAUNCH_S3_UPLOAD_CONCURRENCY", 6),
+		S3MaxConnections:       getEnvInt("CLOUDLAUNCH_S3_MAX_CONNECTIONS", 16),
+		S3BandwidthLimitKBps:   getEnvInt("CLOUDLAUNCH_S3_BANDWIDTH_LIMIT_KBPS", 0),
+		SyncMaxJobs:            getEnvInt("CLOUDLAUNCH_SYNC_MAX_JOBS", 2),
+		S3Compression:          getEnvBool("CLOUDLAUNCH_S3_COMPRESSION", false),
+		SaveHashParanoid:       getEnvBool("CLOUDLAUNCH_SAVE_HASH_PARANOID", false),
+		HashConcurrency:        getEnvInt("CLOUDLAUNCH_HASH_CONCURRENCY", 0),
+		RemoteIndexMaxAgeHours: getEnvInt("CLOUDLAUNCH_REMOTE_INDEX_MAX_AGE_HOURS", 7*24),
+		BlobCacheMaxMB:         getEnvInt("CLOUDLAUNCH_BLOB_CACHE_MAX_MB", 64),
+		GCKeepCommits:          getEnvInt("CLOUDLAUNCH_GC_KEEP_COMMITS", 10),
+		GCKeepDays:             getEnvInt("CLOUDLAUNCH_GC_KEEP_DAYS", 30),
+		GCGraceHours:           getEnvInt("CLOUDLAUNCH_GC_GRACE_HOURS", 24),
+		ErogameScapeCacheHours: getEnvInt("CLOUDLAUNCH_EROGAMESCAPE_CACHE_HOURS", 24),
+		ErogameScapeCacheMaxMB: getEnvInt("CLOUDLAUNCH_EROGAMESCAPE_CACHE_MAX_MB", 64),
+		ErogameScapeIntervalMs: getEnvInt("CLOUDLAUNCH_EROGAMESCAPE_INTERVAL_MS", 1000),
+		ErogameScapeWorkers:    getEnvInt("CLOUDLAUNCH_EROGAMESCAPE_WORKERS", 4),
 		CredentialNamespace:    getEnv("CLOUDLAUNCH_CREDENTIAL_NAMESPACE", "CloudLaunch"),
 	}
 }
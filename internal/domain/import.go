@@ -9,3 +9,10 @@ type GameImport struct {
 	ImagePath      string `json:"imagePath"`
 	ImageURL       string `json:"imageUrl,omitempty"`
 }
+
+// GameImportResult は一括取り込みの1件分の結果。取得に失敗した場合は Import が nil で Error に理由が入る。
+type GameImportResult struct {
+	URL    string      `json:"url"`
+	Import *GameImport `json:"import,omitempty"`
+	Error  string      `json:"error,omitempty"`
+}
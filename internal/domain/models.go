@@ -67,6 +67,16 @@ type Memo struct {
 	UpdatedAt time.Time `json:"updatedAt"`
 }
 
+// MemoCloudState はメモを最後にクラウドと同期した時点のクラウド側オブジェクトの控え。
+// CloudKey / ETag / Size がクラウドの一覧と一致する間は、クラウドの本文が ContentHash のままだとみなす。
+type MemoCloudState struct {
+	MemoID      string
+	CloudKey    string
+	ETag        string
+	Size        int64
+	ContentHash string
+}
+
 // RouteOrderItem はルート順序の一括更新1件分を表す。
 type RouteOrderItem struct {
 	ID    string
@@ -83,6 +93,14 @@ type RouteStat struct {
 	Order        int64   `json:"order"`
 }
 
+// GameStats はゲームごとのプレイセッションの集計を表す（GameStats テーブルで差分更新される）。
+type GameStats struct {
+	GameID        string     `json:"gameId"`
+	SessionCount  int64      `json:"sessionCount"`
+	TotalDuration int64      `json:"totalDuration"`
+	LastPlayedAt  *time.Time `json:"lastPlayedAt,omitempty"`
+}
+
 // MonitoringGameStatus はゲーム監視の状態を表す。
 type MonitoringGameStatus struct {
 	GameID            string `json:"gameId"`
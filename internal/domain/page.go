@@ -0,0 +1,34 @@
+// 一覧のページ取得（キーセットページング）の条件と結果を定義する。
+package domain
+
+// GameListQuery はゲーム一覧の1ページ分の取得条件。
+// Cursor は前ページの NextCursor（空なら先頭から）、Limit は 1 ページの件数（0 なら既定値）。
+type GameListQuery struct {
+	SearchText    string     `json:"searchText"`
+	Filter        PlayStatus `json:"filter"`
+	SortBy        string     `json:"sortBy"`
+	SortDirection string     `json:"sortDirection"`
+	Cursor        string     `json:"cursor,omitempty"`
+	Limit         int        `json:"limit"`
+}
+
+// GamePage はゲーム一覧の1ページ分。NextCursor が空なら最終ページ。
+type GamePage struct {
+	Items      []Game `json:"items"`
+	NextCursor string `json:"nextCursor,omitempty"`
+}
+
+// MemoSearchQuery はメモ検索の1ページ分の取得条件。GameID が空なら全ゲームのメモを対象にする。
+// 結果は更新日時の新しい順。
+type MemoSearchQuery struct {
+	Query  string `json:"query"`
+	GameID string `json:"gameId,omitempty"`
+	Cursor string `json:"cursor,omitempty"`
+	Limit  int    `json:"limit"`
+}
+
+// MemoPage はメモ検索の1ページ分。NextCursor が空なら最終ページ。
+type MemoPage struct {
+	Items      []Memo `json:"items"`
+	NextCursor string `json:"nextCursor,omitempty"`
+}
@@ -6,8 +6,57 @@ import "time"
 type BlobHash = string
 
 // SaveSnapshot はセーブフォルダのファイル一覧とそのハッシュを表す（git のツリー相当）。
+// Chunked は Files のうちチャンク分割形式（manifests/ + chunks/）で保存したパスの昇順リスト。
+// 該当ファイルが無ければ省略され、JSON は単一ブロブ形式のみだった頃と同一になる（旧 commit と互換）。
 type SaveSnapshot struct {
-	Files map[string]BlobHash `json:"files"`
+	Files   map[string]BlobHash `json:"files"`
+	Chunked []string            `json:"chunked,omitempty"`
+}
+
+// SaveHashCacheEntry はセーブファイル1件の stat（サイズ・更新時刻）とハッシュのキャッシュを表す。
+// ModTime は UnixNano。stat が一致する限りファイル内容は変わっていないとみなす。
+type SaveHashCacheEntry struct {
+	Size    int64
+	ModTime int64
+	Hash    BlobHash
+}
+
+// RemoteBlobIndex はゲームのリモート（games/<id>/ 配下）に存在が確認済みのブロブハッシュの控え。
+// Head はこの控えを最後に更新した時点のリモート HEAD、ListedAt は最後に全件列挙した時刻（UnixNano）。
+// Hashes は kind（objects / manifests / chunks）→ ハッシュ集合。
+type RemoteBlobIndex struct {
+	Head     BlobHash
+	ListedAt int64
+	Hashes   map[string]map[BlobHash]struct{}
+}
+
+// TransferJournal は中断した Push / Pull を再開するための進捗記録。
+// Direction は "push" / "pull"、Head は記録を始めた時点のリモート HEAD（Push は開始時点、Pull は取得対象）。
+// 対象の集合は Head とローカルのスナップショットから決まるため列挙せず、完了分だけを Entries に持つ。
+type TransferJournal struct {
+	Direction string
+	Head      BlobHash
+	StartedAt int64
+	Entries   []TransferJournalEntry
+}
+
+// TransferJournalEntry は転送が完了した1件。Push はブロブ（Kind / Hash）、
+// Pull は書き込んだファイル（Path と書き込み直後の Size / ModTime(UnixNano)）を表す。
+type TransferJournalEntry struct {
+	Kind    string
+	Hash    BlobHash
+	Path    string
+	Size    int64
+	ModTime int64
+}
+
+// MultipartUpload は開始済みで未完了のマルチパートアップロード。Push の再開時に送信済みパートを引き継ぐ。
+type MultipartUpload struct {
+	Key       string
+	UploadID  string
+	GameID    string
+	Size      int64
+	CreatedAt int64
 }
 
 // MetaSnapshot はある時点のゲームデータ全体を表す（git のコミット相当）。
@@ -4,6 +4,8 @@ package db
 import (
 	"database/sql"
 	"fmt"
+	"os"
+	"strings"
 
 	_ "modernc.org/sqlite"
 )
@@ -13,12 +15,12 @@ import (
 // busy_timeout: ApplyPullResult 等の複数文の書き込みトランザクションと、バックグラウンドの
 // 自動 Push・別 Pull が別コネクションで競合したとき、即 SQLITE_BUSY（"database is
 // locked"）で失敗せず一定時間（5秒）待機・リトライさせる。
-// （journal_mode=WAL は読み書き並行性を高められるが、フルバックアップがDBファイルの
-//
-//	コピー方式のため WAL 化するとチェックポイント未済データを取りこぼす。ここでは採用しない。）
+// journal_mode=WAL: UI の読み取りとプロセス監視のセッション保存・Pull の適用が互いを待たないようにする。
+// バックアップは VACUUM INTO で整合したスナップショットを取るため、チェックポイント前のデータも取りこぼさない。
+// WAL では synchronous=NORMAL でも破損しない（電源断で直近のコミットが失われうるだけ）ため、fsync を減らす。
 func Open(databasePath string) (*sql.DB, error) {
 	dsn := fmt.Sprintf(
-		"file:%s?_pragma=foreign_keys(1)&_pragma=busy_timeout(5000)",
+		"file:%s?_pragma=foreign_keys(1)&_pragma=busy_timeout(5000)&_pragma=journal_mode(WAL)&_pragma=synchronous(NORMAL)",
 		databasePath,
 	)
 	connection, error := sql.Open("sqlite", dsn)
@@ -32,3 +34,35 @@ func Open(databasePath string) (*sql.DB, error) {
 
 	return connection, nil
 }
+
+// Snapshot は VACUUM INTO で稼働中のデータベースの整合したコピーを destinationPath に作る。
+// WAL のチェックポイント前の更新も含まれ、書き込み中の接続を止める必要もない。
+// destinationPath に既存ファイルがあると VACUUM INTO は失敗するため、先に削除する。
+func Snapshot(connection *sql.DB, destinationPath string) error {
+	if err := os.Remove(destinationPath); err != nil && !os.IsNotExist(err) {
+		return err
+	}
+	escaped := strings.ReplaceAll(destinationPath, "'", "''")
+	_, err := connection.Exec(fmt.Sprintf("VACUUM INTO '%s'", escaped))
+	return err
+}
+
+// Verify は databasePath を読み取り専用で開き、PRAGMA quick_check でページ構造が壊れていないかを確かめる。
+// 復元で現在のデータと入れ替える前に、展開したバックアップの DB が開けることを確認するために使う。
+func Verify(databasePath string) error {
+	connection, err := sql.Open("sqlite", fmt.Sprintf("file:%s?mode=ro", databasePath))
+	if err != nil {
+		return err
+	}
+	defer func() {
+		_ = connection.Close()
+	}()
+	var result string
+	if err := connection.QueryRow("PRAGMA quick_check").Scan(&result); err != nil {
+		return err
+	}
+	if result != "ok" {
+		return fmt.Errorf("database integrity check failed: %s", result)
+	}
+	return nil
+}
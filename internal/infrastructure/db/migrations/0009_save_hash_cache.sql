@@ -0,0 +1,12 @@
+-- SaveHashCache はセーブファイルごとの (size, mtime) → SHA-256 のキャッシュ。
+-- Status / Push / Pull の差分判定で stat が変わっていないファイルの再ハッシュを省く。
+-- 内容の正はあくまでファイル実体であり、この表を消しても再計算されるだけで整合性に影響しない。
+CREATE TABLE IF NOT EXISTS "SaveHashCache" (
+  "gameId"  TEXT NOT NULL,
+  "relPath" TEXT NOT NULL,
+  "size"    INTEGER NOT NULL,
+  "mtime"   INTEGER NOT NULL,
+  "hash"    TEXT NOT NULL,
+  PRIMARY KEY ("gameId", "relPath"),
+  FOREIGN KEY ("gameId") REFERENCES "Game"("id") ON DELETE CASCADE ON UPDATE CASCADE
+);
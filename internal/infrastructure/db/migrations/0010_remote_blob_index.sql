@@ -0,0 +1,19 @@
+-- RemoteBlobIndex はリモートに存在が確認済みのブロブハッシュの控え（kind は objects / manifests / chunks）。
+-- Push のたびに games/<id>/objects/ を全件列挙する代わりに参照する。
+-- 控えを消しても次回 Push で全件列挙に戻るだけで、整合性には影響しない。
+CREATE TABLE IF NOT EXISTS "RemoteBlobIndex" (
+  "gameId" TEXT NOT NULL,
+  "kind"   TEXT NOT NULL,
+  "hash"   TEXT NOT NULL,
+  PRIMARY KEY ("gameId", "kind", "hash"),
+  FOREIGN KEY ("gameId") REFERENCES "Game"("id") ON DELETE CASCADE ON UPDATE CASCADE
+);
+
+-- RemoteBlobIndexState は控えの有効性判定に使う。
+-- head は控えを最後に更新した Push が書いたリモート HEAD、listedAt は最後に全件列挙した時刻（UnixNano）。
+CREATE TABLE IF NOT EXISTS "RemoteBlobIndexState" (
+  "gameId"   TEXT PRIMARY KEY NOT NULL,
+  "head"     TEXT NOT NULL,
+  "listedAt" INTEGER NOT NULL,
+  FOREIGN KEY ("gameId") REFERENCES "Game"("id") ON DELETE CASCADE ON UPDATE CASCADE
+);
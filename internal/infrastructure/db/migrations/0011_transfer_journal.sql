@@ -0,0 +1,36 @@
+-- TransferJournal は中断した Push / Pull の再開用の進捗記録（direction は push / pull）。
+-- head が現在のリモート HEAD と食い違う記録は再開に使わず、次の開始時に捨てる。
+-- 記録を消しても最初から転送し直すだけで、整合性には影響しない。
+CREATE TABLE IF NOT EXISTS "TransferJournal" (
+  "gameId"    TEXT NOT NULL,
+  "direction" TEXT NOT NULL,
+  "head"      TEXT NOT NULL,
+  "startedAt" INTEGER NOT NULL,
+  PRIMARY KEY ("gameId", "direction"),
+  FOREIGN KEY ("gameId") REFERENCES "Game"("id") ON DELETE CASCADE ON UPDATE CASCADE
+);
+
+-- TransferJournalEntry は完了した転送1件。Push は kind / hash、Pull は path と書き込み直後の size / modTime を使う。
+CREATE TABLE IF NOT EXISTS "TransferJournalEntry" (
+  "gameId"    TEXT NOT NULL,
+  "direction" TEXT NOT NULL,
+  "kind"      TEXT NOT NULL,
+  "hash"      TEXT NOT NULL,
+  "path"      TEXT NOT NULL DEFAULT '',
+  "size"      INTEGER NOT NULL DEFAULT 0,
+  "modTime"   INTEGER NOT NULL DEFAULT 0,
+  PRIMARY KEY ("gameId", "direction", "kind", "hash", "path"),
+  FOREIGN KEY ("gameId", "direction") REFERENCES "TransferJournal"("gameId", "direction") ON DELETE CASCADE ON UPDATE CASCADE
+);
+
+-- MultipartUpload は開始済みで未完了のマルチパートアップロード（objectKey はバケット内のキー）。
+-- ゲームを削除してもリモートの断片は残るため Game への外部キーは張らず、起動時の掃除で古い行ごと破棄する。
+CREATE TABLE IF NOT EXISTS "MultipartUpload" (
+  "objectKey" TEXT PRIMARY KEY NOT NULL,
+  "uploadId"  TEXT NOT NULL,
+  "gameId"    TEXT NOT NULL,
+  "size"      INTEGER NOT NULL,
+  "createdAt" INTEGER NOT NULL
+);
+
+CREATE INDEX IF NOT EXISTS "idx_multipart_upload_game" ON "MultipartUpload"("gameId");
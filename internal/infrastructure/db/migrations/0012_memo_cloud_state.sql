@@ -0,0 +1,11 @@
+-- MemoCloudState はメモを最後に同期した時点のクラウド側オブジェクト（キー・ETag・サイズ）と本文ハッシュの控え。
+-- クラウドの一覧の ETag / サイズが控えと一致する間は、ダウンロードせずに本文の一致を判定する。
+-- 控えを消しても次回の同期でダウンロードして比較し直すだけで、整合性には影響しない。
+CREATE TABLE IF NOT EXISTS "MemoCloudState" (
+  "memoId"      TEXT PRIMARY KEY NOT NULL,
+  "cloudKey"    TEXT NOT NULL,
+  "etag"        TEXT NOT NULL,
+  "size"        INTEGER NOT NULL,
+  "contentHash" TEXT NOT NULL,
+  FOREIGN KEY ("memoId") REFERENCES "Memo"("id") ON DELETE CASCADE ON UPDATE CASCADE
+);
@@ -0,0 +1,67 @@
+-- GameSearch / MemoSearch はゲームのタイトル・ブランドとメモのタイトル・本文の全文検索索引。
+-- 日本語は空白で区切られないため trigram で分割し、3文字以上の部分一致を索引で引く。
+-- "Game" / "Memo" の主キーは rowid ではなく VACUUM で rowid が振り直されうるため、外部コンテンツにはせず
+-- 本文ごと複製して id を UNINDEXED 列で持ち、トリガで元テーブルと同期する。
+CREATE VIRTUAL TABLE IF NOT EXISTS "GameSearch" USING fts5(
+  "id" UNINDEXED,
+  "title",
+  "publisher",
+  tokenize = 'trigram'
+);
+
+INSERT INTO "GameSearch" ("id", "title", "publisher")
+SELECT "id", "title", "publisher" FROM "Game";
+
+CREATE TRIGGER IF NOT EXISTS "trigger_game_search_insert"
+AFTER INSERT ON "Game"
+FOR EACH ROW
+BEGIN
+  INSERT INTO "GameSearch" ("id", "title", "publisher") VALUES (NEW."id", NEW."title", NEW."publisher");
+END;
+
+CREATE TRIGGER IF NOT EXISTS "trigger_game_search_update"
+AFTER UPDATE OF "id", "title", "publisher" ON "Game"
+FOR EACH ROW
+BEGIN
+  DELETE FROM "GameSearch" WHERE "id" = OLD."id";
+  INSERT INTO "GameSearch" ("id", "title", "publisher") VALUES (NEW."id", NEW."title", NEW."publisher");
+END;
+
+CREATE TRIGGER IF NOT EXISTS "trigger_game_search_delete"
+AFTER DELETE ON "Game"
+FOR EACH ROW
+BEGIN
+  DELETE FROM "GameSearch" WHERE "id" = OLD."id";
+END;
+
+CREATE VIRTUAL TABLE IF NOT EXISTS "MemoSearch" USING fts5(
+  "id" UNINDEXED,
+  "title",
+  "content",
+  tokenize = 'trigram'
+);
+
+INSERT INTO "MemoSearch" ("id", "title", "content")
+SELECT "id", "title", "content" FROM "Memo";
+
+CREATE TRIGGER IF NOT EXISTS "trigger_memo_search_insert"
+AFTER INSERT ON "Memo"
+FOR EACH ROW
+BEGIN
+  INSERT INTO "MemoSearch" ("id", "title", "content") VALUES (NEW."id", NEW."title", NEW."content");
+END;
+
+CREATE TRIGGER IF NOT EXISTS "trigger_memo_search_update"
+AFTER UPDATE OF "id", "title", "content" ON "Memo"
+FOR EACH ROW
+BEGIN
+  DELETE FROM "MemoSearch" WHERE "id" = OLD."id";
+  INSERT INTO "MemoSearch" ("id", "title", "content") VALUES (NEW."id", NEW."title", NEW."content");
+END;
+
+CREATE TRIGGER IF NOT EXISTS "trigger_memo_search_delete"
+AFTER DELETE ON "Memo"
+FOR EACH ROW
+BEGIN
+  DELETE FROM "MemoSearch" WHERE "id" = OLD."id";
+END;
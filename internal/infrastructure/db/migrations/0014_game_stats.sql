@@ -0,0 +1,89 @@
+-- GameStats / RouteStats はゲーム・ルートごとのプレイセッションの集計（件数・合計時間・最終プレイ日時）。
+-- "PlaySession" のトリガで行の追加・削除・更新と同じ文の中で差分更新するため、Pull の一括反映や
+-- ゲーム削除のカスケードでも集計がずれない。セッションの無いゲーム・ルートは行が無く、0 件として扱う。
+-- 最終プレイ日時は削除で巻き戻りうるため、("gameId", "playedAt") の索引で最大値を引き直す。
+-- 削除側は UPDATE だけにする（カスケードで先に消えたゲームの行を挿入し直して FK 違反にしない）。
+CREATE TABLE IF NOT EXISTS "GameStats" (
+  "gameId"        TEXT PRIMARY KEY NOT NULL,
+  "sessionCount"  INTEGER NOT NULL DEFAULT 0,
+  "totalDuration" INTEGER NOT NULL DEFAULT 0,
+  "lastPlayedAt"  DATETIME,
+  FOREIGN KEY ("gameId") REFERENCES "Game"("id") ON DELETE CASCADE ON UPDATE CASCADE
+);
+
+CREATE TABLE IF NOT EXISTS "RouteStats" (
+  "routeId"       TEXT PRIMARY KEY NOT NULL,
+  "sessionCount"  INTEGER NOT NULL DEFAULT 0,
+  "totalDuration" INTEGER NOT NULL DEFAULT 0,
+  FOREIGN KEY ("routeId") REFERENCES "Route"("id") ON DELETE CASCADE ON UPDATE CASCADE
+);
+
+INSERT INTO "GameStats" ("gameId", "sessionCount", "totalDuration", "lastPlayedAt")
+SELECT "gameId", COUNT(*), COALESCE(SUM("duration"), 0), MAX("playedAt")
+FROM "PlaySession"
+WHERE "gameId" IN (SELECT "id" FROM "Game")
+GROUP BY "gameId";
+
+INSERT INTO "RouteStats" ("routeId", "sessionCount", "totalDuration")
+SELECT "routeId", COUNT(*), COALESCE(SUM("duration"), 0)
+FROM "PlaySession"
+WHERE "routeId" IN (SELECT "id" FROM "Route")
+GROUP BY "routeId";
+
+CREATE TRIGGER IF NOT EXISTS "trigger_play_session_stats_insert"
+AFTER INSERT ON "PlaySession"
+FOR EACH ROW
+BEGIN
+  INSERT INTO "GameStats" ("gameId", "sessionCount", "totalDuration", "lastPlayedAt")
+  VALUES (NEW."gameId", 1, NEW."duration", NEW."playedAt")
+  ON CONFLICT("gameId") DO UPDATE SET
+    "sessionCount" = "sessionCount" + 1,
+    "totalDuration" = "totalDuration" + excluded."totalDuration",
+    "lastPlayedAt" = (SELECT MAX("playedAt") FROM "PlaySession" WHERE "gameId" = excluded."gameId");
+  INSERT INTO "RouteStats" ("routeId", "sessionCount", "totalDuration")
+  SELECT NEW."routeId", 1, NEW."duration" WHERE NEW."routeId" IS NOT NULL
+  ON CONFLICT("routeId") DO UPDATE SET
+    "sessionCount" = "sessionCount" + 1,
+    "totalDuration" = "totalDuration" + excluded."totalDuration";
+END;
+
+CREATE TRIGGER IF NOT EXISTS "trigger_play_session_stats_delete"
+AFTER DELETE ON "PlaySession"
+FOR EACH ROW
+BEGIN
+  UPDATE "GameStats" SET
+    "sessionCount" = "sessionCount" - 1,
+    "totalDuration" = "totalDuration" - OLD."duration",
+    "lastPlayedAt" = (SELECT MAX("playedAt") FROM "PlaySession" WHERE "gameId" = OLD."gameId")
+  WHERE "gameId" = OLD."gameId";
+  UPDATE "RouteStats" SET
+    "sessionCount" = "sessionCount" - 1,
+    "totalDuration" = "totalDuration" - OLD."duration"
+  WHERE "routeId" = OLD."routeId";
+END;
+
+CREATE TRIGGER IF NOT EXISTS "trigger_play_session_stats_update"
+AFTER UPDATE OF "gameId", "playedAt", "duration", "routeId" ON "PlaySession"
+FOR EACH ROW
+BEGIN
+  UPDATE "GameStats" SET
+    "sessionCount" = "sessionCount" - 1,
+    "totalDuration" = "totalDuration" - OLD."duration",
+    "lastPlayedAt" = (SELECT MAX("playedAt") FROM "PlaySession" WHERE "gameId" = OLD."gameId")
+  WHERE "gameId" = OLD."gameId";
+  UPDATE "RouteStats" SET
+    "sessionCount" = "sessionCount" - 1,
+    "totalDuration" = "totalDuration" - OLD."duration"
+  WHERE "routeId" = OLD."routeId";
+  INSERT INTO "GameStats" ("gameId", "sessionCount", "totalDuration", "lastPlayedAt")
+  VALUES (NEW."gameId", 1, NEW."duration", NEW."playedAt")
+  ON CONFLICT("gameId") DO UPDATE SET
+    "sessionCount" = "sessionCount" + 1,
+    "totalDuration" = "totalDuration" + excluded."totalDuration",
+    "lastPlayedAt" = (SELECT MAX("playedAt") FROM "PlaySession" WHERE "gameId" = excluded."gameId");
+  INSERT INTO "RouteStats" ("routeId", "sessionCount", "totalDuration")
+  SELECT NEW."routeId", 1, NEW."duration" WHERE NEW."routeId" IS NOT NULL
+  ON CONFLICT("routeId") DO UPDATE SET
+    "sessionCount" = "sessionCount" + 1,
+    "totalDuration" = "totalDuration" + excluded."totalDuration";
+END;
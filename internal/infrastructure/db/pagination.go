@@ -0,0 +1,125 @@
+// ゲーム・メモ一覧のキーセットページングとカーソルの符号化を提供する。
+package db
+
+import (
+	"encoding/base64"
+	"encoding/json"
+	"errors"
+	"fmt"
+	"strings"
+	"unicode/utf8"
+)
+
+const (
+	// defaultPageLimit / maxPageLimit は1ページの既定件数と上限。
+	defaultPageLimit = 50
+	maxPageLimit     = 200
+	// ftsMinQueryRunes は trigram の全文検索索引で引ける最短の検索語の長さ。これより短い語は LIKE で探す。
+	ftsMinQueryRunes = 3
+)
+
+// pageCursor はキーセットページングの続きの位置（前ページ末尾の行のソートキーと ID）。
+// ソートキーは SQLite から読んだ値のまま持ち、次ページの条件に同じ値で渡して比較をずらさない。
+type pageCursor struct {
+	Key any    `json:"k"`
+	ID  string `json:"id"`
+}
+
+func encodePageCursor(key any, id string) string {
+	raw, err := json.Marshal(pageCursor{Key: key, ID: id})
+	if err != nil {
+		return ""
+	}
+	return base64.RawURLEncoding.EncodeToString(raw)
+}
+
+// decodePageCursor はカーソル文字列を復元する。空文字なら nil（先頭から）を返す。
+func decodePageCursor(cursor string) (*pageCursor, error) {
+	if cursor == "" {
+		return nil, nil
+	}
+	raw, err := base64.RawURLEncoding.DecodeString(cursor)
+	if err != nil {
+		return nil, fmt.Errorf("invalid cursor: %w", err)
+	}
+	var decoded pageCursor
+	if err := json.Unmarshal(raw, &decoded); err != nil || decoded.ID == "" {
+		return nil, errors.New("invalid cursor")
+	}
+	return &decoded, nil
+}
+
+func normalizePageLimit(limit int) int {
+	if limit <= 0 {
+		return defaultPageLimit
+	}
+	return min(limit, maxPageLimit)
+}
+
+// keysetClause は (sortKey, id) が cursor より後ろの行に絞る条件を返す。
+func keysetClause(sortKey string, direction string, cursor *pageCursor) (string, []any) {
+	operator := ">"
+	if direction == "DESC" {
+		operator = "<"
+	}
+	return fmt.Sprintf("(%s, id) %s (?, ?)", sortKey, operator), []any{cursor.Key, cursor.ID}
+}
+
+// textSearchClause は searchText を含む行に絞る条件を返す。
+// 3文字以上なら ftsTable の trigram 索引で部分一致を引き、短い語は likeColumns の LIKE で探す。
+func textSearchClause(searchText string, ftsTable string, likeColumns ...string) (string, []any) {
+	if utf8.RuneCountInString(searchText) >= ftsMinQueryRunes {
+		// フレーズとして引用し、検索語中の記号を FTS5 の演算子として解釈させない
+		phrase := `"` + strings.ReplaceAll(searchText, `"`, `""`) + `"`
+		return fmt.Sprintf(`id IN (SELECT id FROM "%[1]s" WHERE "%[1]s" MATCH ?)`, ftsTable), []any{phrase}
+	}
+	pattern := fmt.Sprintf("%%%s%%", searchText)
+	clauses := make([]string, len(likeColumns))
+	args := make([]any, len(likeColumns))
+	for i, column := range likeColumns {
+		clauses[i] = column + " LIKE ?"
+		args[i] = pattern
+	}
+	return "(" + strings.Join(clauses, " OR ") + ")", args
+}
+
+// keyedScanner は行の末尾の列（ソートキー）を key に読み、残りの列を呼び出し側の dest に読む。
+type keyedScanner struct {
+	row scanner
+	key *any
+}
+
+func (s keyedScanner) Scan(dest ...any) error {
+	return s.row.Scan(append(dest, s.key)...)
+}
+
+// keyedRow は1行分の domain 型と、その行のソートキー。
+type keyedRow[T any] struct {
+	item T
+	key  any
+}
+
+// scanKeyed は scan を末尾のソートキーつきの行を読む関数に変換する。
+func scanKeyed[T any](scan func(scanner) (*T, error)) func(scanner) (*keyedRow[T], error) {
+	return func(row scanner) (*keyedRow[T], error) {
+		var key any
+		item, err := scan(keyedScanner{row: row, key: &key})
+		if err != nil {
+			return nil, err
+		}
+		return &keyedRow[T]{item: *item, key: key}, nil
+	}
+}
+
+// splitPage は limit+1 件まで読んだ行を1ページ分に切り詰め、続きがあれば次ページのカーソルを返す。
+func splitPage[T any](rows []keyedRow[T], limit int, idOf func(T) string) ([]T, string) {
+	items := make([]T, 0, min(len(rows), limit))
+	for _, row := range rows[:min(len(rows), limit)] {
+		items = append(items, row.item)
+	}
+	if len(rows) <= limit {
+		return items, ""
+	}
+	last := rows[limit-1]
+	return items, encodePageCursor(last.key, idOf(last.item))
+}
@@ -6,6 +6,7 @@ import (
 	"errors"
 	"fmt"
 	"strings"
+	"sync"
 	"time"
 
 	"CloudLaunch_Go/internal/domain"
@@ -14,11 +15,40 @@ import (
 // Repository は主要テーブルへのCRUDを提供する。
 type Repository struct {
 	connection *sql.DB
+
+	// statements は頻繁に呼ばれるクエリの準備済みステートメント（クエリ文字列 → Stmt）。
+	statementsMu sync.Mutex
+	statements   map[string]*sql.Stmt
 }
 
 // NewRepository は Repository を初期化する。
 func NewRepository(connection *sql.DB) *Repository {
-	return &Repository{connection: connection}
+	return &Repository{connection: connection, statements: make(map[string]*sql.Stmt)}
+}
+
+// 準備済みステートメントで実行するホットパスのクエリ。
+// ゲーム詳細の表示・プロセス監視のセッション保存・設定の読み取りのたびに SQL を解析し直さない。
+const (
+	getGameByIDQuery            = `SELECT ` + gameSelectCols + ` FROM "Game" WHERE id = ?`
+	listPlaySessionsByGameQuery = `SELECT ` + playSessionSelectCols + ` FROM "PlaySession" WHERE gameId = ? ORDER BY playedAt DESC, id`
+	getSettingQuery             = `SELECT value FROM "Settings" WHERE key = ?`
+)
+
+// statement は query の準備済みステートメントを返す。初回に Prepare し、以降は使い回す。
+// sql.Stmt はコネクションプールの各コネクションで必要に応じて再準備されるため、並行に使ってよい。
+// 各コネクション上の準備済み文は connection の Close で一緒に閉じられる。
+func (repository *Repository) statement(ctx context.Context, query string) (*sql.Stmt, error) {
+	repository.statementsMu.Lock()
+	defer repository.statementsMu.Unlock()
+	if statement, ok := repository.statements[query]; ok {
+		return statement, nil
+	}
+	statement, err := repository.connection.PrepareContext(ctx, query)
+	if err != nil {
+		return nil, err
+	}
+	repository.statements[query] = statement
+	return statement, nil
 }
 
 // 同じカラム並びで SELECT する箇所をまとめ、列追加時の更新漏れを防ぐ。
@@ -44,6 +74,11 @@ func queryAll[T any](
 	if err != nil {
 		return nil, err
 	}
+	return collectRows(rows, scan)
+}
+
+// collectRows は rows を scan で domain 型のスライスに変換し、rows を閉じる。
+func collectRows[T any](rows *sql.Rows, scan func(scanner) (*T, error)) (results []T, err error) {
 	defer func() {
 		if closeErr := rows.Close(); closeErr != nil && err == nil {
 			err = closeErr
@@ -66,8 +101,11 @@ func queryAll[T any](
 
 // GetGameByID はID指定でゲームを取得する。
 func (repository *Repository) GetGameByID(ctx context.Context, gameID string) (*domain.Game, error) {
-	row := repository.connection.QueryRowContext(ctx, `SELECT `+gameSelectCols+` FROM "Game" WHERE id = ?`, gameID)
-	game, error := scanGame(row)
+	statement, error := repository.statement(ctx, getGameByIDQuery)
+	if error != nil {
+		return nil, error
+	}
+	game, error := scanGame(statement.QueryRowContext(ctx, gameID))
 	if error == sql.ErrNoRows {
 		return nil, nil
 	}
@@ -105,25 +143,77 @@ func (repository *Repository) ListGames(
 	queryBuilder := strings.Builder{}
 	queryBuilder.WriteString(`SELECT ` + gameSelectCols + ` FROM "Game"`)
 
-	whereClauses := make([]string, 0, 2)
-	args := make([]any, 0, 2)
+	whereClauses, args := gameFilterClauses(searchText, filter)
+	if len(whereClauses) > 0 {
+		queryBuilder.WriteString(" WHERE ")
+		queryBuilder.WriteString(strings.Join(whereClauses, " AND "))
+	}
+
+	_, _ = fmt.Fprintf(&queryBuilder, " ORDER BY %s %s", normalizeSortColumn(sortBy), normalizeSortDirection(sortDirection))
+	return queryAll(ctx, repository.connection, queryBuilder.String(), scanGame, args...)
+}
+
+// ListGamesPage は検索・フィルタ・ソート付きでゲームを1ページ分取得する。
+// (ソートキー, id) のキーセットで続きを引くため、ページが深くても OFFSET のように読み飛ばさない。
+func (repository *Repository) ListGamesPage(ctx context.Context, query domain.GameListQuery) (domain.GamePage, error) {
+	cursor, err := decodePageCursor(query.Cursor)
+	if err != nil {
+		return domain.GamePage{}, err
+	}
+	limit := normalizePageLimit(query.Limit)
+	sortKey := gameSortKey(query.SortBy)
+	direction := normalizeSortDirection(query.SortDirection)
+
+	whereClauses, args := gameFilterClauses(query.SearchText, query.Filter)
+	if cursor != nil {
+		clause, clauseArgs := keysetClause(sortKey, direction, cursor)
+		whereClauses = append(whereClauses, clause)
+		args = append(args, clauseArgs...)
+	}
+	queryBuilder := strings.Builder{}
+	queryBuilder.WriteString(`SELECT ` + gameSelectCols + `, ` + sortKey + ` FROM "Game"`)
+	if len(whereClauses) > 0 {
+		queryBuilder.WriteString(" WHERE ")
+		queryBuilder.WriteString(strings.Join(whereClauses, " AND "))
+	}
+	_, _ = fmt.Fprintf(&queryBuilder, " ORDER BY %[1]s %[2]s, id %[2]s LIMIT ?", sortKey, direction)
+	args = append(args, limit+1)
+
+	rows, err := queryAll(ctx, repository.connection, queryBuilder.String(), scanKeyed(scanGame), args...)
+	if err != nil {
+		return domain.GamePage{}, err
+	}
+	items, next := splitPage(rows, limit, func(game domain.Game) string { return game.ID })
+	return domain.GamePage{Items: items, NextCursor: next}, nil
+}
+
+// gameFilterClauses はゲーム一覧の検索語・プレイ状況の絞り込み条件を返す。
+func gameFilterClauses(searchText string, filter domain.PlayStatus) ([]string, []any) {
+	whereClauses := make([]string, 0, 3)
+	args := make([]any, 0, 4)
 	if searchText != "" {
-		whereClauses = append(whereClauses, "(title LIKE ? OR publisher LIKE ?)")
-		pattern := fmt.Sprintf("%%%s%%", searchText)
-		args = append(args, pattern, pattern)
+		clause, clauseArgs := textSearchClause(searchText, "GameSearch", "title", "publisher")
+		whereClauses = append(whereClauses, clause)
+		args = append(args, clauseArgs...)
 	}
 	switch filter {
 	case domain.PlayStatusPlayed, domain.PlayStatusPlaying, domain.PlayStatusUnplayed:
 		whereClauses = append(whereClauses, "playStatus = ?")
 		args = append(args, string(filter))
 	}
-	if len(whereClauses) > 0 {
-		queryBuilder.WriteString(" WHERE ")
-		queryBuilder.WriteString(strings.Join(whereClauses, " AND "))
-	}
+	return whereClauses, args
+}
 
-	_, _ = fmt.Fprintf(&queryBuilder, " ORDER BY %s %s", normalizeSortColumn(sortBy), normalizeSortDirection(sortDirection))
-	return queryAll(ctx, repository.connection, queryBuilder.String(), scanGame, args...)
+// gameSortKey はキーセットページングのソートキーの式を返す。
+// NULL は行値の比較が不定になるため空文字に寄せ（ASC で先頭になる ORDER BY の並びと同じ）、
+// DATETIME 列は宣言型による time.Time への変換を避けて格納値のまま比較できるよう式にする。
+func gameSortKey(sortBy string) string {
+	switch column := normalizeSortColumn(sortBy); column {
+	case "lastPlayed", "createdAt":
+		return fmt.Sprintf("COALESCE(%s, '')", column)
+	default:
+		return column
+	}
 }
 
 // CreateGame はゲームを作成して返す。
@@ -316,9 +406,15 @@ func (repository *Repository) GetPlaySessionByID(ctx context.Context, sessionID
 // playedAt が同値のときも順序が安定するよう id を第2ソートキーにしている。
 // （sessions.json のシリアライズ結果が環境ごとにブレてハッシュが変わるのを防ぐ）
 func (repository *Repository) ListPlaySessionsByGame(ctx context.Context, gameID string) ([]domain.PlaySession, error) {
-	return queryAll(ctx, repository.connection,
-		`SELECT `+playSessionSelectCols+` FROM "PlaySession" WHERE gameId = ? ORDER BY playedAt DESC, id`,
-		scanPlaySession, gameID)
+	statement, err := repository.statement(ctx, listPlaySessionsByGameQuery)
+	if err != nil {
+		return nil, err
+	}
+	rows, err := statement.QueryContext(ctx, gameID)
+	if err != nil {
+		return nil, err
+	}
+	return collectRows(rows, scanPlaySession)
 }
 
 // DeletePlaySession はセッションを削除する。
@@ -364,9 +460,10 @@ func (repository *Repository) DeletePlaySessionsByGame(ctx context.Context, game
 }
 
 // SumPlaySessionDurationsByGame はゲームIDのセッション合計時間を取得する。
+// セッションを走査せず、トリガで差分更新される GameStats を引く。
 func (repository *Repository) SumPlaySessionDurationsByGame(ctx context.Context, gameID string) (int64, error) {
 	row := repository.connection.QueryRowContext(ctx, `
-		SELECT COALESCE(SUM(duration), 0) FROM "PlaySession" WHERE gameId = ?
+		SELECT COALESCE((SELECT totalDuration FROM "GameStats" WHERE gameId = ?), 0)
 	`, gameID)
 	var total int64
 	if err := row.Scan(&total); err != nil {
@@ -375,6 +472,83 @@ func (repository *Repository) SumPlaySessionDurationsByGame(ctx context.Context,
 	return total, nil
 }
 
+// ListGameStats は全ゲームのセッション集計を gameID→集計 の map で返す。
+// セッションの無いゲームは含まない（呼び出し側で 0 件として扱う）。
+func (repository *Repository) ListGameStats(ctx context.Context) (map[string]domain.GameStats, error) {
+	stats, err := queryAll(ctx, repository.connection, `
+		SELECT gameId, sessionCount, totalDuration, lastPlayedAt FROM "GameStats"
+	`, scanGameStats)
+	if err != nil {
+		return nil, err
+	}
+	result := make(map[string]domain.GameStats, len(stats))
+	for _, stat := range stats {
+		result[stat.GameID] = stat
+	}
+	return result, nil
+}
+
+// RebuildGameStats はセッションから GameStats / RouteStats を集計し直し、
+// 差分更新の結果と食い違っていたゲーム・ルートの数を返す（整合性の確認用）。
+func (repository *Repository) RebuildGameStats(ctx context.Context) (corrected int, err error) {
+	tx, err := repository.connection.BeginTx(ctx, nil)
+	if err != nil {
+		return 0, err
+	}
+	defer func() {
+		if err != nil {
+			_ = tx.Rollback()
+		}
+	}()
+
+	var gameDiffs, routeDiffs int
+	if err = tx.QueryRowContext(ctx, `
+		WITH actual AS (
+			SELECT g.id AS gameId, COUNT(ps.id) AS sessionCount,
+			       COALESCE(SUM(ps.duration), 0) AS totalDuration, MAX(ps.playedAt) AS lastPlayedAt
+			FROM "Game" g LEFT JOIN "PlaySession" ps ON ps.gameId = g.id
+			GROUP BY g.id
+		)
+		SELECT COUNT(*) FROM actual a LEFT JOIN "GameStats" s ON s.gameId = a.gameId
+		WHERE COALESCE(s.sessionCount, 0) != a.sessionCount
+		   OR COALESCE(s.totalDuration, 0) != a.totalDuration
+		   OR s.lastPlayedAt IS NOT a.lastPlayedAt
+	`).Scan(&gameDiffs); err != nil {
+		return 0, err
+	}
+	if err = tx.QueryRowContext(ctx, `
+		WITH actual AS (
+			SELECT r.id AS routeId, COUNT(ps.id) AS sessionCount, COALESCE(SUM(ps.duration), 0) AS totalDuration
+			FROM "Route" r LEFT JOIN "PlaySession" ps ON ps.routeId = r.id
+			GROUP BY r.id
+		)
+		SELECT COUNT(*) FROM actual a LEFT JOIN "RouteStats" s ON s.routeId = a.routeId
+		WHERE COALESCE(s.sessionCount, 0) != a.sessionCount
+		   OR COALESCE(s.totalDuration, 0) != a.totalDuration
+	`).Scan(&routeDiffs); err != nil {
+		return 0, err
+	}
+
+	for _, statement := range []string{
+		`DELETE FROM "GameStats"`,
+		`DELETE FROM "RouteStats"`,
+		`INSERT INTO "GameStats" (gameId, sessionCount, totalDuration, lastPlayedAt)
+		 SELECT gameId, COUNT(*), COALESCE(SUM(duration), 0), MAX(playedAt)
+		 FROM "PlaySession" WHERE gameId IN (SELECT id FROM "Game") GROUP BY gameId`,
+		`INSERT INTO "RouteStats" (routeId, sessionCount, totalDuration)
+		 SELECT routeId, COUNT(*), COALESCE(SUM(duration), 0)
+		 FROM "PlaySession" WHERE routeId IN (SELECT id FROM "Route") GROUP BY routeId`,
+	} {
+		if _, err = tx.ExecContext(ctx, statement); err != nil {
+			return 0, err
+		}
+	}
+	if err = tx.Commit(); err != nil {
+		return 0, err
+	}
+	return gameDiffs + routeDiffs, nil
+}
+
 // UpdateGameTotalPlayTime はゲームの総プレイ時間のみ更新する。
 func (repository *Repository) UpdateGameTotalPlayTime(ctx context.Context, gameID string, totalPlayTime int64) error {
 	_, error := repository.connection.ExecContext(ctx, `
@@ -434,12 +608,346 @@ func (repository *Repository) SetLocalSaveTree(ctx context.Context, gameID, tree
 	return err
 }
 
+// GetSaveHashCache はゲームのセーブファイルハッシュキャッシュを relPath → エントリで返す。
+func (repository *Repository) GetSaveHashCache(ctx context.Context, gameID string) (entries map[string]domain.SaveHashCacheEntry, err error) {
+	rows, err := repository.connection.QueryContext(ctx, `
+		SELECT relPath, size, mtime, hash FROM "SaveHashCache" WHERE gameId = ?
+	`, gameID)
+	if err != nil {
+		return nil, err
+	}
+	defer func() {
+		if closeErr := rows.Close(); closeErr != nil && err == nil {
+			err = closeErr
+		}
+	}()
+
+	entries = make(map[string]domain.SaveHashCacheEntry)
+	for rows.Next() {
+		var relPath string
+		var entry domain.SaveHashCacheEntry
+		if err := rows.Scan(&relPath, &entry.Size, &entry.ModTime, &entry.Hash); err != nil {
+			return nil, err
+		}
+		entries[relPath] = entry
+	}
+	if err := rows.Err(); err != nil {
+		return nil, err
+	}
+	return entries, nil
+}
+
+// UpdateSaveHashCache は upserts の書き込みと deletes の削除を単一トランザクションで行う。
+// 変化分だけを渡す前提（数千ファイルのセーブでも毎回全行を書き直さない）。
+func (repository *Repository) UpdateSaveHashCache(
+	ctx context.Context,
+	gameID string,
+	upserts map[string]domain.SaveHashCacheEntry,
+	deletes []string,
+) (err error) {
+	if len(upserts) == 0 && len(deletes) == 0 {
+		return nil
+	}
+	tx, err := repository.connection.BeginTx(ctx, nil)
+	if err != nil {
+		return err
+	}
+	defer func() {
+		if err != nil {
+			_ = tx.Rollback()
+		}
+	}()
+	for relPath, entry := range upserts {
+		if _, err = tx.ExecContext(ctx, `
+			INSERT INTO "SaveHashCache" (gameId, relPath, size, mtime, hash)
+			VALUES (?, ?, ?, ?, ?)
+			ON CONFLICT(gameId, relPath) DO UPDATE SET
+				size = excluded.size,
+				mtime = excluded.mtime,
+				hash = excluded.hash
+		`, gameID, relPath, entry.Size, entry.ModTime, entry.Hash); err != nil {
+			return err
+		}
+	}
+	for _, relPath := range deletes {
+		if _, err = tx.ExecContext(ctx, `DELETE FROM "SaveHashCache" WHERE gameId = ? AND relPath = ?`, gameID, relPath); err != nil {
+			return err
+		}
+	}
+	err = tx.Commit()
+	return err
+}
+
+// GetRemoteBlobIndex はゲームのリモート存在済みブロブの控えを返す。控えが無い場合は nil を返す。
+func (repository *Repository) GetRemoteBlobIndex(ctx context.Context, gameID string) (index *domain.RemoteBlobIndex, err error) {
+	state := domain.RemoteBlobIndex{Hashes: make(map[string]map[domain.BlobHash]struct{})}
+	err = repository.connection.QueryRowContext(ctx, `
+		SELECT head, listedAt FROM "RemoteBlobIndexState" WHERE gameId = ?
+	`, gameID).Scan(&state.Head, &state.ListedAt)
+	if err == sql.ErrNoRows {
+		return nil, nil
+	}
+	if err != nil {
+		return nil, err
+	}
+
+	rows, err := repository.connection.QueryContext(ctx, `
+		SELECT kind, hash FROM "RemoteBlobIndex" WHERE gameId = ?
+	`, gameID)
+	if err != nil {
+		return nil, err
+	}
+	defer func() {
+		if closeErr := rows.Close(); closeErr != nil && err == nil {
+			err = closeErr
+		}
+	}()
+	for rows.Next() {
+		var kind, hash string
+		if err := rows.Scan(&kind, &hash); err != nil {
+			return nil, err
+		}
+		if state.Hashes[kind] == nil {
+			state.Hashes[kind] = make(map[domain.BlobHash]struct{})
+		}
+		state.Hashes[kind][hash] = struct{}{}
+	}
+	if err := rows.Err(); err != nil {
+		return nil, err
+	}
+	return &state, nil
+}
+
+// SaveRemoteBlobIndex は控えの Head / ListedAt を更新し、index.Hashes を書き込む。
+// replace が true（全件列挙した直後）なら既存の行を捨てて index.Hashes で置き換え、
+// false なら既存の行に追加する（呼び出し側は前回からの増分だけを渡せばよい）。
+func (repository *Repository) SaveRemoteBlobIndex(ctx context.Context, gameID string, index domain.RemoteBlobIndex, replace bool) (err error) {
+	tx, err := repository.connection.BeginTx(ctx, nil)
+	if err != nil {
+		return err
+	}
+	defer func() {
+		if err != nil {
+			_ = tx.Rollback()
+		}
+	}()
+	if replace {
+		if _, err = tx.ExecContext(ctx, `DELETE FROM "RemoteBlobIndex" WHERE gameId = ?`, gameID); err != nil {
+			return err
+		}
+	}
+	for kind, hashes := range index.Hashes {
+		for hash := range hashes {
+			if _, err = tx.ExecContext(ctx, `
+				INSERT OR IGNORE INTO "RemoteBlobIndex" (gameId, kind, hash) VALUES (?, ?, ?)
+			`, gameID, kind, hash); err != nil {
+				return err
+			}
+		}
+	}
+	if _, err = tx.ExecContext(ctx, `
+		INSERT INTO "RemoteBlobIndexState" (gameId, head, listedAt)
+		VALUES (?, ?, ?)
+		ON CONFLICT(gameId) DO UPDATE SET
+			head = excluded.head,
+			listedAt = excluded.listedAt
+	`, gameID, index.Head, index.ListedAt); err != nil {
+		return err
+	}
+	err = tx.Commit()
+	return err
+}
+
+// ClearRemoteBlobIndex はゲームのリモート存在済みブロブの控えを削除する。
+func (repository *Repository) ClearRemoteBlobIndex(ctx context.Context, gameID string) (err error) {
+	tx, err := repository.connection.BeginTx(ctx, nil)
+	if err != nil {
+		return err
+	}
+	defer func() {
+		if err != nil {
+			_ = tx.Rollback()
+		}
+	}()
+	if _, err = tx.ExecContext(ctx, `DELETE FROM "RemoteBlobIndex" WHERE gameId = ?`, gameID); err != nil {
+		return err
+	}
+	if _, err = tx.ExecContext(ctx, `DELETE FROM "RemoteBlobIndexState" WHERE gameId = ?`, gameID); err != nil {
+		return err
+	}
+	err = tx.Commit()
+	return err
+}
+
+// GetTransferJournal はゲームの direction の転送記録を返す。記録が無い場合は nil を返す。
+func (repository *Repository) GetTransferJournal(ctx context.Context, gameID, direction string) (journal *domain.TransferJournal, err error) {
+	state := domain.TransferJournal{Direction: direction}
+	err = repository.connection.QueryRowContext(ctx, `
+		SELECT head, startedAt FROM "TransferJournal" WHERE gameId = ? AND direction = ?
+	`, gameID, direction).Scan(&state.Head, &state.StartedAt)
+	if err == sql.ErrNoRows {
+		return nil, nil
+	}
+	if err != nil {
+		return nil, err
+	}
+
+	rows, err := repository.connection.QueryContext(ctx, `
+		SELECT kind, hash, path, size, modTime FROM "TransferJournalEntry" WHERE gameId = ? AND direction = ?
+	`, gameID, direction)
+	if err != nil {
+		return nil, err
+	}
+	defer func() {
+		if closeErr := rows.Close(); closeErr != nil && err == nil {
+			err = closeErr
+		}
+	}()
+	for rows.Next() {
+		var entry domain.TransferJournalEntry
+		if err := rows.Scan(&entry.Kind, &entry.Hash, &entry.Path, &entry.Size, &entry.ModTime); err != nil {
+			return nil, err
+		}
+		state.Entries = append(state.Entries, entry)
+	}
+	if err := rows.Err(); err != nil {
+		return nil, err
+	}
+	return &state, nil
+}
+
+// StartTransferJournal は direction の転送記録を head で開始する。
+// 既存の記録が同じ head なら完了分を残し（再開）、異なる head なら完了分を捨てて開始し直す。
+func (repository *Repository) StartTransferJournal(ctx context.Context, gameID, direction, head string, startedAt int64) (err error) {
+	tx, err := repository.connection.BeginTx(ctx, nil)
+	if err != nil {
+		return err
+	}
+	defer func() {
+		if err != nil {
+			_ = tx.Rollback()
+		}
+	}()
+	if _, err = tx.ExecContext(ctx, `
+		DELETE FROM "TransferJournalEntry"
+		WHERE gameId = ? AND direction = ?
+			AND NOT EXISTS (
+				SELECT 1 FROM "TransferJournal" WHERE gameId = ? AND direction = ? AND head = ?
+			)
+	`, gameID, direction, gameID, direction, head); err != nil {
+		return err
+	}
+	if _, err = tx.ExecContext(ctx, `
+		INSERT INTO "TransferJournal" (gameId, direction, head, startedAt)
+		VALUES (?, ?, ?, ?)
+		ON CONFLICT(gameId, direction) DO UPDATE SET
+			head = excluded.head,
+			startedAt = CASE WHEN head = excluded.head THEN startedAt ELSE excluded.startedAt END
+	`, gameID, direction, head, startedAt); err != nil {
+		return err
+	}
+	err = tx.Commit()
+	return err
+}
+
+// AppendTransferJournal は direction の転送記録に完了分を追記する。記録が開始されていなければ外部キー違反になる。
+func (repository *Repository) AppendTransferJournal(ctx context.Context, gameID, direction string, entries []domain.TransferJournalEntry) (err error) {
+	if len(entries) == 0 {
+		return nil
+	}
+	tx, err := repository.connection.BeginTx(ctx, nil)
+	if err != nil {
+		return err
+	}
+	defer func() {
+		if err != nil {
+			_ = tx.Rollback()
+		}
+	}()
+	for _, entry := range entries {
+		if _, err = tx.ExecContext(ctx, `
+			INSERT INTO "TransferJournalEntry" (gameId, direction, kind, hash, path, size, modTime)
+			VALUES (?, ?, ?, ?, ?, ?, ?)
+			ON CONFLICT(gameId, direction, kind, hash, path) DO UPDATE SET
+				size = excluded.size,
+				modTime = excluded.modTime
+		`, gameID, direction, entry.Kind, entry.Hash, entry.Path, entry.Size, entry.ModTime); err != nil {
+			return err
+		}
+	}
+	err = tx.Commit()
+	return err
+}
+
+// ClearTransferJournal は direction の転送記録を完了分ごと削除する。
+func (repository *Repository) ClearTransferJournal(ctx context.Context, gameID, direction string) error {
+	_, err := repository.connection.ExecContext(ctx, `
+		DELETE FROM "TransferJournal" WHERE gameId = ? AND direction = ?
+	`, gameID, direction)
+	return err
+}
+
+// ListMultipartUploads はゲームの未完了マルチパートアップロードを返す。
+func (repository *Repository) ListMultipartUploads(ctx context.Context, gameID string) (uploads []domain.MultipartUpload, err error) {
+	rows, err := repository.connection.QueryContext(ctx, `
+		SELECT objectKey, uploadId, gameId, size, createdAt FROM "MultipartUpload" WHERE gameId = ?
+	`, gameID)
+	if err != nil {
+		return nil, err
+	}
+	defer func() {
+		if closeErr := rows.Close(); closeErr != nil && err == nil {
+			err = closeErr
+		}
+	}()
+	for rows.Next() {
+		var upload domain.MultipartUpload
+		if err := rows.Scan(&upload.Key, &upload.UploadID, &upload.GameID, &upload.Size, &upload.CreatedAt); err != nil {
+			return nil, err
+		}
+		uploads = append(uploads, upload)
+	}
+	if err := rows.Err(); err != nil {
+		return nil, err
+	}
+	return uploads, nil
+}
+
+// SaveMultipartUpload は未完了マルチパートアップロードを記録する。同じキーの古い記録は置き換える。
+func (repository *Repository) SaveMultipartUpload(ctx context.Context, upload domain.MultipartUpload) error {
+	_, err := repository.connection.ExecContext(ctx, `
+		INSERT INTO "MultipartUpload" (objectKey, uploadId, gameId, size, createdAt)
+		VALUES (?, ?, ?, ?, ?)
+		ON CONFLICT(objectKey) DO UPDATE SET
+			uploadId = excluded.uploadId,
+			gameId = excluded.gameId,
+			size = excluded.size,
+			createdAt = excluded.createdAt
+	`, upload.Key, upload.UploadID, upload.GameID, upload.Size, upload.CreatedAt)
+	return err
+}
+
+// DeleteMultipartUpload はキーのマルチパートアップロードの記録を削除する。
+func (repository *Repository) DeleteMultipartUpload(ctx context.Context, key string) error {
+	_, err := repository.connection.ExecContext(ctx, `DELETE FROM "MultipartUpload" WHERE objectKey = ?`, key)
+	return err
+}
+
+// DeleteMultipartUploadsBefore は createdAt（UnixNano）が before より前の記録を削除する。
+// リモート側の断片を破棄した後に呼び、再開に使えなくなった記録を片付ける。
+func (repository *Repository) DeleteMultipartUploadsBefore(ctx context.Context, before int64) error {
+	_, err := repository.connection.ExecContext(ctx, `DELETE FROM "MultipartUpload" WHERE createdAt < ?`, before)
+	return err
+}
+
 // GetSetting は Settings テーブルから値を取得する。存在しない場合は "" を返す。
 func (repository *Repository) GetSetting(ctx context.Context, key string) (string, error) {
+	statement, err := repository.statement(ctx, getSettingQuery)
+	if err != nil {
+		return "", err
+	}
 	var value string
-	err := repository.connection.QueryRowContext(ctx, `
-		SELECT value FROM "Settings" WHERE key = ?
-	`, key).Scan(&value)
+	err = statement.QueryRowContext(ctx, key).Scan(&value)
 	if err == sql.ErrNoRows {
 		return "", nil
 	}
@@ -666,12 +1174,11 @@ func (repository *Repository) ListMemosByGame(ctx context.Context, gameID string
 func (repository *Repository) GetRouteStats(ctx context.Context, gameID string) (stats []domain.RouteStat, err error) {
 	rows, err := repository.connection.QueryContext(ctx, `
 		SELECT r.id, r.name, r."order",
-		       COALESCE(SUM(ps.duration), 0) as total_time,
-		       COUNT(ps.id) as session_count
+		       COALESCE(rs.totalDuration, 0) as total_time,
+		       COALESCE(rs.sessionCount, 0) as session_count
 		FROM "Route" r
-		LEFT JOIN "PlaySession" ps ON ps.routeId = r.id
+		LEFT JOIN "RouteStats" rs ON rs.routeId = r.id
 		WHERE r.gameId = ?
-		GROUP BY r.id, r.name, r."order"
 		ORDER BY r."order" ASC
 	`, gameID)
 	if err != nil {
@@ -721,12 +1228,83 @@ func (repository *Repository) ListAllMemos(ctx context.Context) ([]domain.Memo,
 		scanMemo)
 }
 
+// SearchMemos はメモのタイトル・本文を検索し、更新日時の新しい順に1ページ分取得する。
+// Query が空なら絞り込まずに全メモ（GameID 指定時はそのゲームのメモ）をページングする。
+func (repository *Repository) SearchMemos(ctx context.Context, query domain.MemoSearchQuery) (domain.MemoPage, error) {
+	cursor, err := decodePageCursor(query.Cursor)
+	if err != nil {
+		return domain.MemoPage{}, err
+	}
+	limit := normalizePageLimit(query.Limit)
+	const sortKey = "COALESCE(updatedAt, '')"
+
+	whereClauses := make([]string, 0, 3)
+	args := make([]any, 0, 5)
+	if searchText := strings.TrimSpace(query.Query); searchText != "" {
+		clause, clauseArgs := textSearchClause(searchText, "MemoSearch", "title", "content")
+		whereClauses = append(whereClauses, clause)
+		args = append(args, clauseArgs...)
+	}
+	if query.GameID != "" {
+		whereClauses = append(whereClauses, "gameId = ?")
+		args = append(args, query.GameID)
+	}
+	if cursor != nil {
+		clause, clauseArgs := keysetClause(sortKey, "DESC", cursor)
+		whereClauses = append(whereClauses, clause)
+		args = append(args, clauseArgs...)
+	}
+	queryBuilder := strings.Builder{}
+	queryBuilder.WriteString(`SELECT ` + memoSelectCols + `, ` + sortKey + ` FROM "Memo"`)
+	if len(whereClauses) > 0 {
+		queryBuilder.WriteString(" WHERE ")
+		queryBuilder.WriteString(strings.Join(whereClauses, " AND "))
+	}
+	queryBuilder.WriteString(" ORDER BY " + sortKey + " DESC, id DESC LIMIT ?")
+	args = append(args, limit+1)
+
+	rows, err := queryAll(ctx, repository.connection, queryBuilder.String(), scanKeyed(scanMemo), args...)
+	if err != nil {
+		return domain.MemoPage{}, err
+	}
+	items, next := splitPage(rows, limit, func(memo domain.Memo) string { return memo.ID })
+	return domain.MemoPage{Items: items, NextCursor: next}, nil
+}
+
 // DeleteMemo はメモを削除する。
 func (repository *Repository) DeleteMemo(ctx context.Context, memoID string) error {
 	_, error := repository.connection.ExecContext(ctx, `DELETE FROM "Memo" WHERE id = ?`, memoID)
 	return error
 }
 
+// ListMemoCloudStates はゲームのメモのクラウド同期状態の控えを返す（gameID が空なら全ゲーム）。
+func (repository *Repository) ListMemoCloudStates(ctx context.Context, gameID string) ([]domain.MemoCloudState, error) {
+	query := `
+		SELECT s.memoId, s.cloudKey, s.etag, s.size, s.contentHash
+		FROM "MemoCloudState" s
+		JOIN "Memo" m ON m.id = s.memoId`
+	args := []any{}
+	if gameID != "" {
+		query += ` WHERE m.gameId = ?`
+		args = append(args, gameID)
+	}
+	return queryAll(ctx, repository.connection, query, scanMemoCloudState, args...)
+}
+
+// SaveMemoCloudState はメモのクラウド同期状態の控えを書き込む（既存の控えは置き換える）。
+func (repository *Repository) SaveMemoCloudState(ctx context.Context, state domain.MemoCloudState) error {
+	_, error := repository.connection.ExecContext(ctx, `
+		INSERT INTO "MemoCloudState" (memoId, cloudKey, etag, size, contentHash)
+		VALUES (?, ?, ?, ?, ?)
+		ON CONFLICT(memoId) DO UPDATE SET
+			cloudKey = excluded.cloudKey,
+			etag = excluded.etag,
+			size = excluded.size,
+			contentHash = excluded.contentHash
+	`, state.MemoID, state.CloudKey, state.ETag, state.Size, state.ContentHash)
+	return error
+}
+
 // normalizeSortColumn は許可されたソート対象に変換する。
 func normalizeSortColumn(sortBy string) string {
 	switch sortBy {
@@ -840,6 +1418,25 @@ func scanMemo(row scanner) (*domain.Memo, error) {
 	return &memo, nil
 }
 
+func scanGameStats(row scanner) (*domain.GameStats, error) {
+	var lastPlayedAt sql.NullTime
+	stats := domain.GameStats{}
+	if err := row.Scan(&stats.GameID, &stats.SessionCount, &stats.TotalDuration, &lastPlayedAt); err != nil {
+		return nil, err
+	}
+	stats.LastPlayedAt = nullTimePtr(lastPlayedAt)
+	return &stats, nil
+}
+
+func scanMemoCloudState(row scanner) (*domain.MemoCloudState, error) {
+	state := domain.MemoCloudState{}
+	error := row.Scan(&state.MemoID, &state.CloudKey, &state.ETag, &state.Size, &state.ContentHash)
+	if error != nil {
+		return nil, error
+	}
+	return &state, nil
+}
+
 // nullStringPtr は NULL 文字列をポインタに変換する。
 func nullStringPtr(value sql.NullString) *string {
 	if !value.Valid {
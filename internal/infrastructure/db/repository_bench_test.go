@@ -0,0 +1,74 @@
+package db_test
+
+import (
+	"context"
+	"fmt"
+	"testing"
+
+	"CloudLaunch_Go/internal/domain"
+	"CloudLaunch_Go/internal/infrastructure/db"
+)
+
+const benchGameCount = 5000
+
+// newBenchLibrary は 5k 件のゲームを登録したリポジトリを返す（出版社 50 社、プレイ状況は3種類を順に割り当てる）。
+func newBenchLibrary(b *testing.B) *db.Repository {
+	b.Helper()
+	repo := newTestRepo(b)
+	ctx := context.Background()
+	statuses := []domain.PlayStatus{domain.PlayStatusUnplayed, domain.PlayStatusPlaying, domain.PlayStatusPlayed}
+	for i := range benchGameCount {
+		game := newGame(fmt.Sprintf("Title %04d", i), fmt.Sprintf(`D:\Games\Title%04d\game.exe`, i))
+		game.Publisher = fmt.Sprintf("Studio%02d", i%50)
+		game.PlayStatus = statuses[i%len(statuses)]
+		game.TotalPlayTime = int64(i * 60)
+		if _, err := repo.CreateGame(ctx, game); err != nil {
+			b.Fatalf("CreateGame: %v", err)
+		}
+	}
+	return repo
+}
+
+// BenchmarkRepositoryListGames は 5k 件のライブラリで、ゲーム一覧の全件取得・検索（全文検索と短い語の LIKE）・絞り込みと
+// 1ページ分の取得を測る。
+func BenchmarkRepositoryListGames(b *testing.B) {
+	repo := newBenchLibrary(b)
+	ctx := context.Background()
+	cases := []struct {
+		name     string
+		search   string
+		filter   domain.PlayStatus
+		sortBy   string
+		minCount int
+	}{
+		{"all/title", "", "", "title", benchGameCount},
+		{"all/totalPlayTime", "", "", "totalPlayTime", benchGameCount},
+		{"search", "Studio07", "", "title", 1},
+		{"search/short", "07", "", "title", 1},
+		{"filter", "", domain.PlayStatusPlaying, "title", 1},
+	}
+	for _, tc := range cases {
+		b.Run(tc.name, func(b *testing.B) {
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				games, err := repo.ListGames(ctx, tc.search, tc.filter, tc.sortBy, "asc")
+				if err != nil {
+					b.Fatal(err)
+				}
+				if len(games) < tc.minCount {
+					b.Fatalf("expected at least %d games, got %d", tc.minCount, len(games))
+				}
+			}
+		})
+	}
+	b.Run("page", func(b *testing.B) {
+		b.ReportAllocs()
+		b.ResetTimer()
+		for i := 0; i < b.N; i++ {
+			if _, err := repo.ListGamesPage(ctx, domain.GameListQuery{SortBy: "title", SortDirection: "asc", Limit: 100}); err != nil {
+				b.Fatal(err)
+			}
+		}
+	})
+}
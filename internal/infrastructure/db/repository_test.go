@@ -2,7 +2,9 @@ package db_test
 
 import (
 	"context"
+	"fmt"
 	"path/filepath"
+	"sync"
 	"testing"
 	"time"
 
@@ -10,7 +12,7 @@ import (
 	"CloudLaunch_Go/internal/infrastructure/db"
 )
 
-func newTestRepo(t *testing.T) *db.Repository {
+func newTestRepo(t testing.TB) *db.Repository {
 	t.Helper()
 	conn, err := db.Open(filepath.Join(t.TempDir(), "test.db"))
 	if err != nil {
@@ -289,6 +291,247 @@ func TestApplyPullResultPersistsHeadAndTree(t *testing.T) {
 	}
 }
 
+// --- SaveHashCache ---
+
+func TestSaveHashCacheUpsertDeleteAndCascade(t *testing.T) {
+	t.Parallel()
+	repo := newTestRepo(t)
+	ctx := context.Background()
+
+	created, err := repo.CreateGame(ctx, newGame("CacheGame", "/cache.exe"))
+	if err != nil {
+		t.Fatalf("CreateGame: %v", err)
+	}
+
+	first := map[string]domain.SaveHashCacheEntry{
+		"a.sav":     {Size: 10, ModTime: 100, Hash: "ha"},
+		"dir/b.sav": {Size: 20, ModTime: 200, Hash: "hb"},
+	}
+	if err := repo.UpdateSaveHashCache(ctx, created.ID, first, nil); err != nil {
+		t.Fatalf("UpdateSaveHashCache: %v", err)
+	}
+	// 既存行の上書きと削除を同時に行う
+	if err := repo.UpdateSaveHashCache(ctx, created.ID,
+		map[string]domain.SaveHashCacheEntry{"a.sav": {Size: 11, ModTime: 101, Hash: "ha2"}},
+		[]string{"dir/b.sav"}); err != nil {
+		t.Fatalf("UpdateSaveHashCache(2): %v", err)
+	}
+
+	got, err := repo.GetSaveHashCache(ctx, created.ID)
+	if err != nil {
+		t.Fatalf("GetSaveHashCache: %v", err)
+	}
+	if len(got) != 1 || got["a.sav"] != (domain.SaveHashCacheEntry{Size: 11, ModTime: 101, Hash: "ha2"}) {
+		t.Fatalf("unexpected cache: %+v", got)
+	}
+
+	if err := repo.DeleteGame(ctx, created.ID); err != nil {
+		t.Fatalf("DeleteGame: %v", err)
+	}
+	got, err = repo.GetSaveHashCache(ctx, created.ID)
+	if err != nil || len(got) != 0 {
+		t.Fatalf("expected cache cascade deleted, got %d, err=%v", len(got), err)
+	}
+}
+
+// --- RemoteBlobIndex ---
+
+func TestRemoteBlobIndexAppendReplaceAndClear(t *testing.T) {
+	t.Parallel()
+	repo := newTestRepo(t)
+	ctx := context.Background()
+
+	created, err := repo.CreateGame(ctx, newGame("IndexGame", "/index.exe"))
+	if err != nil {
+		t.Fatalf("CreateGame: %v", err)
+	}
+	if got, err := repo.GetRemoteBlobIndex(ctx, created.ID); err != nil || got != nil {
+		t.Fatalf("expected no index, got %+v, err=%v", got, err)
+	}
+
+	set := func(hashes ...string) map[string]struct{} {
+		out := make(map[string]struct{}, len(hashes))
+		for _, h := range hashes {
+			out[h] = struct{}{}
+		}
+		return out
+	}
+	if err := repo.SaveRemoteBlobIndex(ctx, created.ID, domain.RemoteBlobIndex{
+		Head: "h1", ListedAt: 100, Hashes: map[string]map[string]struct{}{"objects": set("a", "b")},
+	}, true); err != nil {
+		t.Fatalf("SaveRemoteBlobIndex: %v", err)
+	}
+	// 追加モードは既存行を残したまま増分を足す
+	if err := repo.SaveRemoteBlobIndex(ctx, created.ID, domain.RemoteBlobIndex{
+		Head: "h2", ListedAt: 100, Hashes: map[string]map[string]struct{}{"chunks": set("c")},
+	}, false); err != nil {
+		t.Fatalf("SaveRemoteBlobIndex(append): %v", err)
+	}
+	got, err := repo.GetRemoteBlobIndex(ctx, created.ID)
+	if err != nil {
+		t.Fatalf("GetRemoteBlobIndex: %v", err)
+	}
+	if got.Head != "h2" || got.ListedAt != 100 || len(got.Hashes["objects"]) != 2 || len(got.Hashes["chunks"]) != 1 {
+		t.Fatalf("unexpected index after append: %+v", got)
+	}
+
+	// 置き換えモードは古い行を捨てる
+	if err := repo.SaveRemoteBlobIndex(ctx, created.ID, domain.RemoteBlobIndex{
+		Head: "h3", ListedAt: 200, Hashes: map[string]map[string]struct{}{"objects": set("b")},
+	}, true); err != nil {
+		t.Fatalf("SaveRemoteBlobIndex(replace): %v", err)
+	}
+	got, _ = repo.GetRemoteBlobIndex(ctx, created.ID)
+	if _, ok := got.Hashes["objects"]["b"]; !ok || len(got.Hashes["objects"]) != 1 || len(got.Hashes["chunks"]) != 0 {
+		t.Fatalf("unexpected index after replace: %+v", got)
+	}
+
+	if err := repo.ClearRemoteBlobIndex(ctx, created.ID); err != nil {
+		t.Fatalf("ClearRemoteBlobIndex: %v", err)
+	}
+	if got, err := repo.GetRemoteBlobIndex(ctx, created.ID); err != nil || got != nil {
+		t.Fatalf("expected index cleared, got %+v, err=%v", got, err)
+	}
+}
+
+// --- TransferJournal ---
+
+func TestTransferJournalResumesSameHeadAndResetsOnNewHead(t *testing.T) {
+	t.Parallel()
+	repo := newTestRepo(t)
+	ctx := context.Background()
+
+	created, err := repo.CreateGame(ctx, newGame("JournalGame", "/journal.exe"))
+	if err != nil {
+		t.Fatalf("CreateGame: %v", err)
+	}
+	if got, err := repo.GetTransferJournal(ctx, created.ID, "push"); err != nil || got != nil {
+		t.Fatalf("expected no journal, got %+v, err=%v", got, err)
+	}
+	if err := repo.StartTransferJournal(ctx, created.ID, "push", "h1", 100); err != nil {
+		t.Fatalf("StartTransferJournal: %v", err)
+	}
+	if err := repo.AppendTransferJournal(ctx, created.ID, "push", []domain.TransferJournalEntry{
+		{Kind: "objects", Hash: "a"}, {Kind: "chunks", Hash: "b"},
+	}); err != nil {
+		t.Fatalf("AppendTransferJournal: %v", err)
+	}
+
+	// 同じ head で開始し直しても完了分と開始時刻は残る
+	if err := repo.StartTransferJournal(ctx, created.ID, "push", "h1", 200); err != nil {
+		t.Fatalf("StartTransferJournal(resume): %v", err)
+	}
+	got, err := repo.GetTransferJournal(ctx, created.ID, "push")
+	if err != nil {
+		t.Fatalf("GetTransferJournal: %v", err)
+	}
+	if got.Head != "h1" || got.StartedAt != 100 || len(got.Entries) != 2 {
+		t.Fatalf("unexpected journal after resume: %+v", got)
+	}
+
+	// head が変わったら完了分を捨てる
+	if err := repo.StartTransferJournal(ctx, created.ID, "push", "h2", 300); err != nil {
+		t.Fatalf("StartTransferJournal(new head): %v", err)
+	}
+	got, _ = repo.GetTransferJournal(ctx, created.ID, "push")
+	if got.Head != "h2" || got.StartedAt != 300 || len(got.Entries) != 0 {
+		t.Fatalf("unexpected journal after head change: %+v", got)
+	}
+
+	if err := repo.ClearTransferJournal(ctx, created.ID, "push"); err != nil {
+		t.Fatalf("ClearTransferJournal: %v", err)
+	}
+	if got, err := repo.GetTransferJournal(ctx, created.ID, "push"); err != nil || got != nil {
+		t.Fatalf("expected journal cleared, got %+v, err=%v", got, err)
+	}
+}
+
+func TestMultipartUploadRecordsSurviveUntilPruned(t *testing.T) {
+	t.Parallel()
+	repo := newTestRepo(t)
+	ctx := context.Background()
+
+	for _, upload := range []domain.MultipartUpload{
+		{Key: "games/g/objects/old", UploadID: "u1", GameID: "g", Size: 10, CreatedAt: 100},
+		{Key: "games/g/objects/new", UploadID: "u2", GameID: "g", Size: 20, CreatedAt: 500},
+		{Key: "games/other/objects/x", UploadID: "u3", GameID: "other", Size: 30, CreatedAt: 500},
+	} {
+		if err := repo.SaveMultipartUpload(ctx, upload); err != nil {
+			t.Fatalf("SaveMultipartUpload: %v", err)
+		}
+	}
+	uploads, err := repo.ListMultipartUploads(ctx, "g")
+	if err != nil || len(uploads) != 2 {
+		t.Fatalf("expected 2 uploads for g, got %+v, err=%v", uploads, err)
+	}
+
+	if err := repo.DeleteMultipartUploadsBefore(ctx, 200); err != nil {
+		t.Fatalf("DeleteMultipartUploadsBefore: %v", err)
+	}
+	if err := repo.DeleteMultipartUpload(ctx, "games/other/objects/x"); err != nil {
+		t.Fatalf("DeleteMultipartUpload: %v", err)
+	}
+	uploads, _ = repo.ListMultipartUploads(ctx, "g")
+	if len(uploads) != 1 || uploads[0].UploadID != "u2" {
+		t.Fatalf("expected only the recent upload left, got %+v", uploads)
+	}
+	if uploads, _ := repo.ListMultipartUploads(ctx, "other"); len(uploads) != 0 {
+		t.Fatalf("expected deleted upload gone, got %+v", uploads)
+	}
+}
+
+// --- MemoCloudState ---
+
+func TestMemoCloudStateUpsertScopedByGameAndCascades(t *testing.T) {
+	t.Parallel()
+	repo := newTestRepo(t)
+	ctx := context.Background()
+
+	gameA, err := repo.CreateGame(ctx, newGame("MemoGameA", "/memo-a.exe"))
+	if err != nil {
+		t.Fatalf("CreateGame: %v", err)
+	}
+	gameB, err := repo.CreateGame(ctx, newGame("MemoGameB", "/memo-b.exe"))
+	if err != nil {
+		t.Fatalf("CreateGame: %v", err)
+	}
+	memoA, err := repo.CreateMemo(ctx, domain.Memo{Title: "A", Content: "a", GameID: gameA.ID})
+	if err != nil {
+		t.Fatalf("CreateMemo: %v", err)
+	}
+	memoB, err := repo.CreateMemo(ctx, domain.Memo{Title: "B", Content: "b", GameID: gameB.ID})
+	if err != nil {
+		t.Fatalf("CreateMemo: %v", err)
+	}
+	for _, state := range []domain.MemoCloudState{
+		{MemoID: memoA.ID, CloudKey: "ka", ETag: "e1", Size: 1, ContentHash: "h1"},
+		{MemoID: memoA.ID, CloudKey: "ka", ETag: "e2", Size: 2, ContentHash: "h2"},
+		{MemoID: memoB.ID, CloudKey: "kb", ETag: "e3", Size: 3, ContentHash: "h3"},
+	} {
+		if err := repo.SaveMemoCloudState(ctx, state); err != nil {
+			t.Fatalf("SaveMemoCloudState: %v", err)
+		}
+	}
+
+	got, err := repo.ListMemoCloudStates(ctx, gameA.ID)
+	if err != nil {
+		t.Fatalf("ListMemoCloudStates: %v", err)
+	}
+	if len(got) != 1 || got[0].ETag != "e2" || got[0].Size != 2 || got[0].ContentHash != "h2" {
+		t.Fatalf("unexpected states for game A: %+v", got)
+	}
+	if all, err := repo.ListMemoCloudStates(ctx, ""); err != nil || len(all) != 2 {
+		t.Fatalf("expected 2 states across games, got %d, err=%v", len(all), err)
+	}
+
+	if err := repo.DeleteMemo(ctx, memoA.ID); err != nil {
+		t.Fatalf("DeleteMemo: %v", err)
+	}
+	if got, err := repo.ListMemoCloudStates(ctx, gameA.ID); err != nil || len(got) != 0 {
+		t.Fatalf("expected state cascade deleted, got %d, err=%v", len(got), err)
+	}
+}
+
 // --- Route カスケード削除 ---
 
 func TestRepositoryRoutesDeletedWithGame(t *testing.T) {
@@ -335,3 +578,290 @@ func TestOpenSetsBusyTimeout(t *testing.T) {
 		t.Fatalf("busy_timeout should be >= 5000ms, got %d", timeout)
 	}
 }
+
+// TestOpenEnablesWALAndSnapshotCapturesUncheckpointedWrites は Open が WAL を有効にし、
+// Snapshot がチェックポイント前の更新も含むコピーを作ることを確認する。
+func TestOpenEnablesWALAndSnapshotCapturesUncheckpointedWrites(t *testing.T) {
+	t.Parallel()
+	dir := t.TempDir()
+	conn, err := db.Open(filepath.Join(dir, "wal.db"))
+	if err != nil {
+		t.Fatalf("Open: %v", err)
+	}
+	t.Cleanup(func() { _ = conn.Close() })
+	if err := db.ApplyMigrations(conn); err != nil {
+		t.Fatalf("ApplyMigrations: %v", err)
+	}
+
+	var mode string
+	if err := conn.QueryRow("PRAGMA journal_mode").Scan(&mode); err != nil {
+		t.Fatalf("PRAGMA journal_mode: %v", err)
+	}
+	if mode != "wal" {
+		t.Fatalf("expected journal_mode=wal, got %q", mode)
+	}
+
+	repo := db.NewRepository(conn)
+	ctx := context.Background()
+	if err := repo.UpsertSetting(ctx, "theme", "dark"); err != nil {
+		t.Fatalf("UpsertSetting: %v", err)
+	}
+
+	snapshotPath := filepath.Join(dir, "snapshot.db")
+	if err := db.Snapshot(conn, snapshotPath); err != nil {
+		t.Fatalf("Snapshot: %v", err)
+	}
+	snapshot, err := db.Open(snapshotPath)
+	if err != nil {
+		t.Fatalf("Open snapshot: %v", err)
+	}
+	t.Cleanup(func() { _ = snapshot.Close() })
+	value, err := db.NewRepository(snapshot).GetSetting(ctx, "theme")
+	if err != nil || value != "dark" {
+		t.Fatalf("expected snapshot to contain the setting, got %q, err=%v", value, err)
+	}
+}
+
+// TestRepositoryPreparedQueriesAreSafeConcurrently は準備済みステートメントを使う読み取りが
+// 並行な呼び出しと書き込みの間でも正しい結果を返すことを確認する。
+func TestRepositoryPreparedQueriesAreSafeConcurrently(t *testing.T) {
+	t.Parallel()
+	repo := newTestRepo(t)
+	ctx := context.Background()
+
+	game, err := repo.CreateGame(ctx, newGame("Game", "/game.exe"))
+	if err != nil {
+		t.Fatalf("CreateGame: %v", err)
+	}
+
+	var wg sync.WaitGroup
+	errs := make(chan error, 16)
+	for i := range 8 {
+		wg.Add(2)
+		go func() {
+			defer wg.Done()
+			got, err := repo.GetGameByID(ctx, game.ID)
+			if err == nil && (got == nil || got.Title != "Game") {
+				err = fmt.Errorf("unexpected game %#v", got)
+			}
+			errs <- err
+		}()
+		go func() {
+			defer wg.Done()
+			_, err := repo.CreatePlaySession(ctx, domain.PlaySession{GameID: game.ID, PlayedAt: time.Now(), Duration: int64(i + 1)})
+			errs <- err
+		}()
+	}
+	wg.Wait()
+	close(errs)
+	for err := range errs {
+		if err != nil {
+			t.Fatalf("concurrent access failed: %v", err)
+		}
+	}
+
+	sessions, err := repo.ListPlaySessionsByGame(ctx, game.ID)
+	if err != nil || len(sessions) != 8 {
+		t.Fatalf("expected 8 sessions, got %d, err=%v", len(sessions), err)
+	}
+}
+
+// TestRepositoryListGamesPageWalksAllPagesInOrder はキーセットページングで全ページをたどると
+// 重複・欠落なくソート順の全件が得られることを確認する。
+func TestRepositoryListGamesPageWalksAllPagesInOrder(t *testing.T) {
+	t.Parallel()
+	repo := newTestRepo(t)
+	ctx := context.Background()
+
+	titles := []string{"Echo", "Alpha", "Delta", "Bravo", "Charlie"}
+	for i, title := range titles {
+		game := newGame(title, fmt.Sprintf("/game%d.exe", i))
+		game.TotalPlayTime = int64(i % 2) // 同じソートキーの行を作り、id での並びも通す
+		if _, err := repo.CreateGame(ctx, game); err != nil {
+			t.Fatalf("CreateGame: %v", err)
+		}
+	}
+
+	for _, sortBy := range []string{"title", "totalPlayTime", "lastPlayed"} {
+		all, err := repo.ListGamesPage(ctx, domain.GameListQuery{SortBy: sortBy, SortDirection: "desc", Limit: 100})
+		if err != nil {
+			t.Fatalf("ListGamesPage(%s): %v", sortBy, err)
+		}
+		query := domain.GameListQuery{SortBy: sortBy, SortDirection: "desc", Limit: 2}
+		walked := make([]string, 0, len(titles))
+		for pages := 0; ; pages++ {
+			if pages > len(titles) {
+				t.Fatalf("pagination by %s did not terminate", sortBy)
+			}
+			page, err := repo.ListGamesPage(ctx, query)
+			if err != nil {
+				t.Fatalf("ListGamesPage(%s): %v", sortBy, err)
+			}
+			for _, game := range page.Items {
+				walked = append(walked, game.ID)
+			}
+			if page.NextCursor == "" {
+				break
+			}
+			query.Cursor = page.NextCursor
+		}
+		if len(walked) != len(all.Items) {
+			t.Fatalf("sort %s: expected %d games, got %d", sortBy, len(all.Items), len(walked))
+		}
+		for i, game := range all.Items {
+			if walked[i] != game.ID {
+				t.Fatalf("sort %s: page walk diverged at %d", sortBy, i)
+			}
+		}
+	}
+
+	if _, err := repo.ListGamesPage(ctx, domain.GameListQuery{Cursor: "not-a-cursor"}); err == nil {
+		t.Fatalf("expected invalid cursor to fail")
+	}
+}
+
+// TestRepositorySearchIndexFollowsGamesAndMemos は全文検索索引がトリガで追従し、
+// 日本語の部分一致と短い検索語（LIKE）の両方で引けることを確認する。
+func TestRepositorySearchIndexFollowsGamesAndMemos(t *testing.T) {
+	t.Parallel()
+	repo := newTestRepo(t)
+	ctx := context.Background()
+
+	game, err := repo.CreateGame(ctx, newGame("冬の終わりの物語", "/winter.exe"))
+	if err != nil {
+		t.Fatalf("CreateGame: %v", err)
+	}
+	if _, err := repo.CreateGame(ctx, newGame("Summer Days", "/summer.exe")); err != nil {
+		t.Fatalf("CreateGame: %v", err)
+	}
+
+	search := func(text string) []domain.Game {
+		t.Helper()
+		page, err := repo.ListGamesPage(ctx, domain.GameListQuery{SearchText: text})
+		if err != nil {
+			t.Fatalf("ListGamesPage(%q): %v", text, err)
+		}
+		return page.Items
+	}
+	if got := search("終わりの"); len(got) != 1 || got[0].ID != game.ID {
+		t.Fatalf("expected FTS substring match, got %#v", got)
+	}
+	if got := search("summer"); len(got) != 1 || got[0].Title != "Summer Days" {
+		t.Fatalf("expected case-insensitive match, got %#v", got)
+	}
+	if got := search("冬"); len(got) != 1 || got[0].ID != game.ID {
+		t.Fatalf("expected short query to fall back to LIKE, got %#v", got)
+	}
+
+	game.Title = "春の訪れ"
+	if _, err := repo.UpdateGame(ctx, *game); err != nil {
+		t.Fatalf("UpdateGame: %v", err)
+	}
+	if got := search("終わりの"); len(got) != 0 {
+		t.Fatalf("expected stale title to be removed from the index, got %#v", got)
+	}
+	if got := search("春の訪れ"); len(got) != 1 {
+		t.Fatalf("expected updated title to be indexed, got %#v", got)
+	}
+
+	memo, err := repo.CreateMemo(ctx, domain.Memo{Title: "攻略", Content: "ルートBは三日目の選択肢で分岐", GameID: game.ID})
+	if err != nil {
+		t.Fatalf("CreateMemo: %v", err)
+	}
+	page, err := repo.SearchMemos(ctx, domain.MemoSearchQuery{Query: "三日目の選択"})
+	if err != nil || len(page.Items) != 1 || page.Items[0].ID != memo.ID {
+		t.Fatalf("expected memo content match, got %#v, err=%v", page.Items, err)
+	}
+
+	if err := repo.DeleteGame(ctx, game.ID); err != nil {
+		t.Fatalf("DeleteGame: %v", err)
+	}
+	page, err = repo.SearchMemos(ctx, domain.MemoSearchQuery{Query: "三日目の選択"})
+	if err != nil || len(page.Items) != 0 {
+		t.Fatalf("expected cascaded memo to leave the index, got %#v, err=%v", page.Items, err)
+	}
+}
+
+// TestGameStatsFollowSessionChangesAndRebuildFindsNoDrift はセッションの追加・ルート変更・削除と
+// Pull の一括反映に集計が追従し、再集計で食い違いが見つからないことを確認する。
+func TestGameStatsFollowSessionChangesAndRebuildFindsNoDrift(t *testing.T) {
+	t.Parallel()
+	repo := newTestRepo(t)
+	ctx := context.Background()
+
+	game, err := repo.CreateGame(ctx, newGame("Game", "/game.exe"))
+	if err != nil {
+		t.Fatalf("CreateGame: %v", err)
+	}
+	route, err := repo.CreateRoute(ctx, domain.Route{Name: "Route A", Order: 0, GameID: game.ID})
+	if err != nil {
+		t.Fatalf("CreateRoute: %v", err)
+	}
+	base := time.Date(2024, 1, 1, 12, 0, 0, 0, time.UTC)
+	first, err := repo.CreatePlaySession(ctx, domain.PlaySession{GameID: game.ID, PlayedAt: base, Duration: 60})
+	if err != nil {
+		t.Fatalf("CreatePlaySession: %v", err)
+	}
+	latest, err := repo.CreatePlaySession(ctx, domain.PlaySession{GameID: game.ID, PlayedAt: base.Add(time.Hour), Duration: 30, RouteID: &route.ID})
+	if err != nil {
+		t.Fatalf("CreatePlaySession: %v", err)
+	}
+
+	expectStats := func(sessions, total int64, lastPlayed time.Time) {
+		t.Helper()
+		stats, err := repo.ListGameStats(ctx)
+		if err != nil {
+			t.Fatalf("ListGameStats: %v", err)
+		}
+		got := stats[game.ID]
+		if got.SessionCount != sessions || got.TotalDuration != total {
+			t.Fatalf("expected %d sessions / %ds, got %#v", sessions, total, got)
+		}
+		if sessions > 0 && (got.LastPlayedAt == nil || !got.LastPlayedAt.Equal(lastPlayed)) {
+			t.Fatalf("expected last played %v, got %v", lastPlayed, got.LastPlayedAt)
+		}
+		sum, err := repo.SumPlaySessionDurationsByGame(ctx, game.ID)
+		if err != nil || sum != total {
+			t.Fatalf("SumPlaySessionDurationsByGame = %d, err=%v", sum, err)
+		}
+	}
+	expectRoute := func(sessions, total int64) {
+		t.Helper()
+		stats, err := repo.GetRouteStats(ctx, game.ID)
+		if err != nil || len(stats) != 1 {
+			t.Fatalf("GetRouteStats: %#v, err=%v", stats, err)
+		}
+		if stats[0].SessionCount != sessions || stats[0].TotalTime != total {
+			t.Fatalf("expected route %d sessions / %ds, got %#v", sessions, total, stats[0])
+		}
+	}
+
+	expectStats(2, 90, base.Add(time.Hour))
+	expectRoute(1, 30)
+
+	if err := repo.UpdatePlaySessionRoute(ctx, first.ID, &route.ID); err != nil {
+		t.Fatalf("UpdatePlaySessionRoute: %v", err)
+	}
+	expectRoute(2, 90)
+
+	if err := repo.DeletePlaySession(ctx, latest.ID); err != nil {
+		t.Fatalf("DeletePlaySession: %v", err)
+	}
+	expectStats(1, 60, base)
+	expectRoute(1, 60)
+
+	pulled := []domain.PlaySession{
+		{ID: "pulled-1", GameID: game.ID, PlayedAt: base.Add(2 * time.Hour), Duration: 10},
+		{ID: "pulled-2", GameID: game.ID, PlayedAt: base.Add(3 * time.Hour), Duration: 20},
+	}
+	if err := repo.ApplyPullResult(ctx, *game, pulled, "head", ""); err != nil {
+		t.Fatalf("ApplyPullResult: %v", err)
+	}
+	expectStats(2, 30, base.Add(3*time.Hour))
+	expectRoute(0, 0)
+
+	corrected, err := repo.RebuildGameStats(ctx)
+	if err != nil || corrected != 0 {
+		t.Fatalf("expected no drift, got corrected=%d err=%v", corrected, err)
+	}
+}
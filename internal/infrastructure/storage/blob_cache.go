@@ -0,0 +1,234 @@
+// 不変ブロブ（commit / tree / meta）のローカルディスク LRU キャッシュと、リモート HEAD の ETag 控えを提供する。
+package storage
+
+import (
+	"container/list"
+	"os"
+	"path/filepath"
+	"sort"
+	"sync"
+	"time"
+)
+
+// blobCacheEntry は LRU の1要素。key は "kind/hash"。
+type blobCacheEntry struct {
+	key  string
+	size int64
+}
+
+// headCacheEntry は直近に読んだリモート HEAD の内容と ETag。
+type headCacheEntry struct {
+	hash string
+	etag string
+}
+
+// BlobCache は content-addressed で内容が変わらないブロブを dir 配下に保存し、合計 maxBytes を超えたら
+// 最後に使われてから最も長いものから捨てる。ハッシュが同じなら内容も同じなので、ゲームやバケットをまたいで共有する。
+// キャッシュは取得の近道でしかないため、ディスク I/O の失敗は「キャッシュに無い」として扱い、呼び出し側には返さない。
+// nil の *BlobCache は常に空のキャッシュとして振る舞う。
+type BlobCache struct {
+	dir      string
+	maxBytes int64
+
+	mu      sync.Mutex
+	loaded  bool
+	order   *list.List               // 先頭ほど最近使ったもの（値は *blobCacheEntry）
+	entries map[string]*list.Element // key → order の要素
+	size    int64
+	heads   map[string]headCacheEntry // "bucket/gameID" → 直近の HEAD（プロセス内のみ）
+}
+
+// NewBlobCache は dir をキャッシュ置き場とする BlobCache を返す。
+// ディレクトリの走査は初回利用時まで遅らせる（起動を遅くしないため）。
+func NewBlobCache(dir string, maxBytes int64) *BlobCache {
+	return &BlobCache{
+		dir:      dir,
+		maxBytes: maxBytes,
+		order:    list.New(),
+		entries:  make(map[string]*list.Element),
+		heads:    make(map[string]headCacheEntry),
+	}
+}
+
+// isCacheableKind は一度取得すれば変わらない kind かを返す。
+// objects / chunks はセーブ本体で容量が大きく、Pull ではローカルファイルとの比較で取得を省けるため対象外。
+func isCacheableKind(kind string) bool {
+	switch kind {
+	case BlobKindCommit, BlobKindTree, BlobKindMeta:
+		return true
+	}
+	return false
+}
+
+// isBlobHash は SHA-256 の16進表記かを返す。リモート由来の文字列をパスに使う前の検証。
+func isBlobHash(hash string) bool {
+	if len(hash) != 64 {
+		return false
+	}
+	for _, r := range hash {
+		if (r < '0' || r > '9') && (r < 'a' || r > 'f') {
+			return false
+		}
+	}
+	return true
+}
+
+func (c *BlobCache) usable(kind, hash string) bool {
+	return c != nil && c.dir != "" && c.maxBytes > 0 && isCacheableKind(kind) && isBlobHash(hash)
+}
+
+func (c *BlobCache) path(key string) string {
+	return filepath.Join(c.dir, filepath.FromSlash(key))
+}
+
+// Get はキャッシュ済みブロブを返す。読めない・内容がハッシュと一致しない場合は捨てて false を返す。
+func (c *BlobCache) Get(kind, hash string) ([]byte, bool) {
+	if !c.usable(kind, hash) {
+		return nil, false
+	}
+	key := kind + "/" + hash
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	c.loadLocked()
+	element, ok := c.entries[key]
+	if !ok {
+		return nil, false
+	}
+	data, err := os.ReadFile(c.path(key))
+	if err != nil || blobHashBytes(data) != hash {
+		c.removeLocked(element)
+		return nil, false
+	}
+	c.order.MoveToFront(element)
+	// 更新時刻を LRU の順序として再起動後も引き継ぐ
+	now := time.Now()
+	_ = os.Chtimes(c.path(key), now, now)
+	return data, true
+}
+
+// Put はブロブをキャッシュに入れる。data は呼び出し側でハッシュ検証済みであること。
+func (c *BlobCache) Put(kind, hash string, data []byte) {
+	if !c.usable(kind, hash) || int64(len(data)) > c.maxBytes {
+		return
+	}
+	key := kind + "/" + hash
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	c.loadLocked()
+	if element, ok := c.entries[key]; ok {
+		c.order.MoveToFront(element)
+		return
+	}
+	target := c.path(key)
+	if err := os.MkdirAll(filepath.Dir(target), 0o700); err != nil {
+		return
+	}
+	// 書きかけのファイルを Get が読まないよう、一時ファイルに書いてから置き換える
+	tmp, err := os.CreateTemp(filepath.Dir(target), ".tmp-*")
+	if err != nil {
+		return
+	}
+	_, writeErr := tmp.Write(data)
+	closeErr := tmp.Close()
+	if writeErr != nil || closeErr != nil || os.Rename(tmp.Name(), target) != nil {
+		_ = os.Remove(tmp.Name())
+		return
+	}
+	c.entries[key] = c.order.PushFront(&blobCacheEntry{key: key, size: int64(len(data))})
+	c.size += int64(len(data))
+	c.evictLocked()
+}
+
+// loadLocked は初回だけ dir を走査し、更新時刻の新しい順に LRU を組み立てる。
+func (c *BlobCache) loadLocked() {
+	if c.loaded {
+		return
+	}
+	c.loaded = true
+	type found struct {
+		entry   blobCacheEntry
+		modTime time.Time
+	}
+	var files []found
+	for _, kind := range []string{BlobKindCommit, BlobKindTree, BlobKindMeta} {
+		dirEntries, err := os.ReadDir(filepath.Join(c.dir, kind))
+		if err != nil {
+			continue
+		}
+		for _, dirEntry := range dirEntries {
+			key := kind + "/" + dirEntry.Name()
+			if !dirEntry.Type().IsRegular() || !isBlobHash(dirEntry.Name()) {
+				// 中断した Put の一時ファイルなど
+				if dirEntry.Type().IsRegular() {
+					_ = os.Remove(c.path(key))
+				}
+				continue
+			}
+			info, err := dirEntry.Info()
+			if err != nil {
+				continue
+			}
+			files = append(files, found{entry: blobCacheEntry{key: key, size: info.Size()}, modTime: info.ModTime()})
+		}
+	}
+	sort.Slice(files, func(i, j int) bool { return files[i].modTime.After(files[j].modTime) })
+	for _, f := range files {
+		entry := f.entry
+		c.entries[entry.key] = c.order.PushBack(&entry)
+		c.size += entry.size
+	}
+	// 上限を下げて起動した場合に備えて、読み込み直後にも切り詰める
+	c.evictLocked()
+}
+
+func (c *BlobCache) evictLocked() {
+	for c.size > c.maxBytes {
+		oldest := c.order.Back()
+		if oldest == nil {
+			return
+		}
+		c.removeLocked(oldest)
+	}
+}
+
+func (c *BlobCache) removeLocked(element *list.Element) {
+	entry := element.Value.(*blobCacheEntry)
+	c.order.Remove(element)
+	delete(c.entries, entry.key)
+	c.size -= entry.size
+	_ = os.Remove(c.path(entry.key))
+}
+
+func headCacheKey(bucket, gameID string) string {
+	return bucket + "/" + gameID
+}
+
+func (c *BlobCache) cachedHEAD(bucket, gameID string) (headCacheEntry, bool) {
+	if c == nil {
+		return headCacheEntry{}, false
+	}
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	entry, ok := c.heads[headCacheKey(bucket, gameID)]
+	return entry, ok
+}
+
+func (c *BlobCache) rememberHEAD(bucket, gameID, hash, etag string) {
+	if c == nil || etag == "" {
+		return
+	}
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	c.heads[headCacheKey(bucket, gameID)] = headCacheEntry{hash: hash, etag: etag}
+}
+
+// ForgetHEAD は HEAD の控えを捨てる。自分で HEAD を書き換えた・削除したときに呼ぶ
+// （書き込み後の ETag は分からないため、次回は条件なしで読む）。
+func (c *BlobCache) ForgetHEAD(bucket, gameID string) {
+	if c == nil {
+		return
+	}
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	delete(c.heads, headCacheKey(bucket, gameID))
+}
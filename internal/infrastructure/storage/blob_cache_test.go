@@ -0,0 +1,71 @@
+package storage
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+)
+
+func TestBlobCacheEvictsLeastRecentlyUsedAndSurvivesReload(t *testing.T) {
+	t.Parallel()
+
+	dir := t.TempDir()
+	a, b, c := []byte("commit a"), []byte("commit b"), []byte("commit c")
+	hashA, hashB, hashC := blobHashBytes(a), blobHashBytes(b), blobHashBytes(c)
+
+	// 2 件分の容量しかない
+	cache := NewBlobCache(dir, int64(len(a)+len(b)))
+	cache.Put(BlobKindCommit, hashA, a)
+	cache.Put(BlobKindCommit, hashB, b)
+	if _, ok := cache.Get(BlobKindCommit, hashA); !ok {
+		t.Fatal("expected a to be cached")
+	}
+	cache.Put(BlobKindCommit, hashC, c)
+	if _, ok := cache.Get(BlobKindCommit, hashB); ok {
+		t.Fatal("b was least recently used and should be evicted")
+	}
+
+	// 再起動後もディスクから読み直せる
+	reloaded := NewBlobCache(dir, 1<<20)
+	for _, hash := range []string{hashA, hashC} {
+		if _, ok := reloaded.Get(BlobKindCommit, hash); !ok {
+			t.Fatalf("expected %s after reload", hash)
+		}
+	}
+}
+
+func TestBlobCacheRejectsCorruptFilesAndMutableKinds(t *testing.T) {
+	t.Parallel()
+
+	dir := t.TempDir()
+	data := []byte("tree")
+	hash := blobHashBytes(data)
+	cache := NewBlobCache(dir, 1<<20)
+
+	cache.Put(BlobKindObject, hash, data)
+	if _, ok := cache.Get(BlobKindObject, hash); ok {
+		t.Fatal("objects should not be cached")
+	}
+	cache.Put(BlobKindTree, "../escape", data)
+	if _, err := os.Stat(filepath.Join(dir, "escape")); !os.IsNotExist(err) {
+		t.Fatal("invalid hash should not be written")
+	}
+
+	cache.Put(BlobKindTree, hash, data)
+	if err := os.WriteFile(filepath.Join(dir, BlobKindTree, hash), []byte("tampered"), 0o600); err != nil {
+		t.Fatal(err)
+	}
+	if _, ok := cache.Get(BlobKindTree, hash); ok {
+		t.Fatal("corrupt entry should be treated as a miss")
+	}
+	if _, err := os.Stat(filepath.Join(dir, BlobKindTree, hash)); !os.IsNotExist(err) {
+		t.Fatal("corrupt entry should be removed")
+	}
+
+	var nilCache *BlobCache
+	nilCache.Put(BlobKindTree, hash, data)
+	if _, ok := nilCache.Get(BlobKindTree, hash); ok {
+		t.Fatal("nil cache should always miss")
+	}
+	nilCache.ForgetHEAD("bucket", "game")
+}
@@ -0,0 +1,121 @@
+// ブロブの転送時圧縮（gzip）と、その形式を記録するオブジェクトメタデータの扱いを提供する。
+package storage
+
+import (
+	"bytes"
+	"compress/gzip"
+	"context"
+	"io"
+	"strings"
+
+	"github.com/aws/aws-sdk-go-v2/service/s3"
+)
+
+const (
+	// blobEncodingMetaKey は圧縮形式を記録するユーザーメタデータ（x-amz-meta-cl-encoding）。
+	// Content-Encoding にしないのは、途中の CDN / HTTP クライアントに透過展開されると
+	// 「メタデータは gzip なのに本文は展開済み」という食い違いが起きうるため。
+	blobEncodingMetaKey = "cl-encoding"
+	blobEncodingGzip    = "gzip"
+
+	// maxCompressibleBlobSize を超えるブロブは圧縮しない（圧縮にはメモリ上での全量保持が必要）。
+	// チャンク（最大 chunkMaxSize）や JSON、一般的なセーブファイルはこの範囲に収まる。
+	maxCompressibleBlobSize = 8 << 20
+)
+
+// encodeBlob は compress が true で、かつ圧縮で 1 割以上縮む場合に gzip 済みの本文とメタデータを返す。
+// それ以外（既に圧縮済みのアーカイブ等）は data をそのまま返す。
+// ハッシュは常に元の内容に対して計算するため、圧縮の有無は dedup や fingerprint に影響しない。
+func encodeBlob(data []byte, compress bool) ([]byte, map[string]string) {
+	if !compress || len(data) == 0 || len(data) > maxCompressibleBlobSize {
+		return data, nil
+	}
+	var buf bytes.Buffer
+	writer := gzip.NewWriter(&buf)
+	if _, err := writer.Write(data); err != nil {
+		return data, nil
+	}
+	if err := writer.Close(); err != nil {
+		return data, nil
+	}
+	if buf.Len() > len(data)*9/10 {
+		return data, nil
+	}
+	return buf.Bytes(), map[string]string{blobEncodingMetaKey: blobEncodingGzip}
+}
+
+// uploadBlobBytes は data を encodeBlob の判定に従って（必要なら圧縮して）アップロードする。
+func uploadBlobBytes(ctx context.Context, client *s3.Client, bucket, key string, data []byte, contentType string, compress bool) error {
+	body, metadata := encodeBlob(data, compress)
+	input := &s3.PutObjectInput{
+		Bucket:   &bucket,
+		Key:      &key,
+		Body:     bytes.NewReader(body),
+		Metadata: metadata,
+	}
+	if strings.TrimSpace(contentType) != "" {
+		input.ContentType = stringPtr(contentType)
+	}
+	_, err := client.PutObject(ctx, input)
+	return err
+}
+
+// openBlobObject はオブジェクトを取得し、メタデータに従って展開しながら読む ReadCloser を返す。
+// 圧縮設定に関係なく常にメタデータで判定するので、圧縮・無圧縮のブロブが混在していても読める。
+func openBlobObject(ctx context.Context, client *s3.Client, bucket, key string) (io.ReadCloser, error) {
+	response, err := client.GetObject(ctx, &s3.GetObjectInput{
+		Bucket: &bucket,
+		Key:    &key,
+	})
+	if err != nil {
+		return nil, err
+	}
+	if !strings.EqualFold(metadataValue(response.Metadata, blobEncodingMetaKey), blobEncodingGzip) {
+		return response.Body, nil
+	}
+	reader, err := gzip.NewReader(response.Body)
+	if err != nil {
+		_ = response.Body.Close()
+		return nil, err
+	}
+	return &gzipBlobReader{Reader: reader, body: response.Body}, nil
+}
+
+// readBlobObject は openBlobObject で展開した全体を読み込む（JSON などの小さなブロブ用）。
+func readBlobObject(ctx context.Context, client *s3.Client, bucket, key string) (data []byte, err error) {
+	reader, err := openBlobObject(ctx, client, bucket, key)
+	if err != nil {
+		return nil, err
+	}
+	defer func() {
+		if closeErr := reader.Close(); closeErr != nil && err == nil {
+			err = closeErr
+		}
+	}()
+	return io.ReadAll(reader)
+}
+
+// metadataValue はキーの大文字小文字を区別せずにユーザーメタデータを引く
+// （S3 互換ストレージによって返すキーの正規化が異なる）。
+func metadataValue(metadata map[string]string, key string) string {
+	for k, v := range metadata {
+		if strings.EqualFold(k, key) {
+			return v
+		}
+	}
+	return ""
+}
+
+// gzipBlobReader は展開リーダーと元の本文をまとめて閉じる。
+type gzipBlobReader struct {
+	*gzip.Reader
+	body io.ReadCloser
+}
+
+func (r *gzipBlobReader) Close() error {
+	gzErr := r.Reader.Close()
+	if err := r.body.Close(); err != nil {
+		return err
+	}
+	return gzErr
+}
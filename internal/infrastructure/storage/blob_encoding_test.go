@@ -0,0 +1,68 @@
+package storage
+
+import (
+	"bytes"
+	"compress/gzip"
+	"io"
+	"math/rand"
+	"testing"
+)
+
+func TestEncodeBlobCompressesWhenSmaller(t *testing.T) {
+	t.Parallel()
+
+	data := bytes.Repeat([]byte("save-slot-0001:"), 4096)
+	body, metadata := encodeBlob(data, true)
+	if metadata[blobEncodingMetaKey] != blobEncodingGzip {
+		t.Fatalf("expected gzip metadata, got %v", metadata)
+	}
+	if len(body) >= len(data) {
+		t.Fatalf("compressed body (%d) not smaller than input (%d)", len(body), len(data))
+	}
+	reader, err := gzip.NewReader(bytes.NewReader(body))
+	if err != nil {
+		t.Fatalf("gzip.NewReader: %v", err)
+	}
+	restored, err := io.ReadAll(reader)
+	if err != nil {
+		t.Fatalf("read gzip: %v", err)
+	}
+	if !bytes.Equal(restored, data) {
+		t.Fatal("round trip mismatch")
+	}
+}
+
+func TestEncodeBlobKeepsRawData(t *testing.T) {
+	t.Parallel()
+
+	random := make([]byte, 64<<10)
+	rand.New(rand.NewSource(3)).Read(random)
+	compressible := bytes.Repeat([]byte("a"), 64<<10)
+
+	cases := []struct {
+		name     string
+		data     []byte
+		compress bool
+	}{
+		{name: "disabled", data: compressible, compress: false},
+		{name: "incompressible", data: random, compress: true},
+		{name: "empty", data: nil, compress: true},
+	}
+	for _, tc := range cases {
+		body, metadata := encodeBlob(tc.data, tc.compress)
+		if metadata != nil || !bytes.Equal(body, tc.data) {
+			t.Fatalf("%s: expected raw data without metadata, got %d bytes, %v", tc.name, len(body), metadata)
+		}
+	}
+}
+
+func TestMetadataValueIgnoresKeyCase(t *testing.T) {
+	t.Parallel()
+
+	if got := metadataValue(map[string]string{"Cl-Encoding": "gzip"}, blobEncodingMetaKey); got != "gzip" {
+		t.Fatalf("metadataValue = %q, want gzip", got)
+	}
+	if got := metadataValue(nil, blobEncodingMetaKey); got != "" {
+		t.Fatalf("metadataValue(nil) = %q, want empty", got)
+	}
+}
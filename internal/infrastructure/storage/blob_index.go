@@ -0,0 +1,36 @@
+// リモートに存在が分かっているブロブハッシュの集合（PutBlobs の重複判定用）を提供する。
+package storage
+
+// blobIndexVerifyMinSize 以上のブロブは、控えに無くても送る前に HeadObject で存在を確かめる。
+// 小さいブロブは HEAD の往復より再送のほうが安く、content-addressed なので再送しても内容は変わらない。
+const blobIndexVerifyMinSize = 1 << 20
+
+// BlobIndex は kind（objects / manifests / chunks）→ リモートに存在するハッシュ集合。
+// kind のエントリが nil なら「その kind は未列挙」を意味し、PutBlobs は必要になった時点で全件列挙する。
+// 空でない集合は列挙結果とその後のアップロードだけから作られている前提で、載っていないハッシュは未アップロードとみなす。
+type BlobIndex map[string]map[string]struct{}
+
+func (index BlobIndex) has(kind, hash string) bool {
+	_, ok := index[kind][hash]
+	return ok
+}
+
+func (index BlobIndex) add(kind, hash string) {
+	if index[kind] == nil {
+		index[kind] = make(map[string]struct{})
+	}
+	index[kind][hash] = struct{}{}
+}
+
+// ensureListed は kind が未列挙なら全件列挙して埋め、列挙したかを返す。
+func (index BlobIndex) ensureListed(list func(kind string) (map[string]struct{}, error), kind string) (bool, error) {
+	if index[kind] != nil {
+		return false, nil
+	}
+	hashes, err := list(kind)
+	if err != nil {
+		return false, err
+	}
+	index[kind] = hashes
+	return true, nil
+}
@@ -3,12 +3,17 @@ package storage
 
 import (
 	"context"
+	"crypto/sha256"
+	"encoding/hex"
 	"fmt"
+	"io"
 	"os"
 	"path"
 	"path/filepath"
+	"sort"
 	"strings"
 	"sync"
+	"time"
 
 	"CloudLaunch_Go/internal/util"
 
@@ -23,15 +28,42 @@ const (
 	BlobKindTree   BlobKind = "trees"   // SaveSnapshot（git の tree 相当）
 	BlobKindMeta   BlobKind = "meta"    // ゲーム情報・セッション情報 JSON
 	BlobKindObject BlobKind = "objects" // セーブファイル実データ・画像
+
+	// ChunkedFileThreshold 以上のセーブファイルは objects/ の代わりに以下の2種で保存する。
+	BlobKindManifest BlobKind = "manifests" // ChunkManifest（キーはファイル全体のハッシュ）
+	BlobKindChunk    BlobKind = "chunks"    // 内容定義チャンクの実データ
 )
 
+// BlobSource はアップロード対象ブロブのローカル実体を表す。
+// Size / ModTime は走査時点の値で、アップロード直前・直後の再 stat と突き合わせて
+// 「ハッシュ計算後に書き換わったファイルを別内容のまま content-addressed キーに置く」のを防ぐ。
+// Chunked はチャンク分割形式（manifests/ + chunks/）で保存するかを表す。
+type BlobSource struct {
+	Path    string
+	Size    int64
+	ModTime time.Time
+	Chunked bool
+}
+
+// checkUnchanged は実ファイルの stat が走査時点から変わっていないことを確認する。
+func (src BlobSource) checkUnchanged() error {
+	info, err := os.Stat(src.Path)
+	if err != nil {
+		return err
+	}
+	if info.Size() != src.Size || !info.ModTime().Equal(src.ModTime) {
+		return fmt.Errorf("セーブファイルがハッシュ計算後に変更されました: %s", src.Path)
+	}
+	return nil
+}
+
 func blobKey(gameID, kind, hash string) string {
 	return fmt.Sprintf("games/%s/%s/%s", gameID, kind, hash)
 }
 
 func contentTypeForKind(kind string) string {
 	switch kind {
-	case BlobKindCommit, BlobKindTree, BlobKindMeta:
+	case BlobKindCommit, BlobKindTree, BlobKindMeta, BlobKindManifest:
 		return "application/json"
 	default:
 		return "application/octet-stream"
@@ -96,7 +128,8 @@ func blobExists(ctx context.Context, client *s3.Client, bucket, gameID, kind, ha
 }
 
 // PutBlob はブロブをS3にアップロードする。既に存在する場合はスキップする。
-func PutBlob(ctx context.Context, client *s3.Client, bucket, gameID, kind, hash string, data []byte) error {
+// compress が true なら縮む場合に限り gzip で送る（encodeBlob 参照）。
+func PutBlob(ctx context.Context, client *s3.Client, bucket, gameID, kind, hash string, data []byte, compress bool) error {
 	if blobHashBytes(data) != hash {
 		return fmt.Errorf("blob hash mismatch: %s/%s", kind, hash)
 	}
@@ -107,12 +140,12 @@ func PutBlob(ctx context.Context, client *s3.Client, bucket, gameID, kind, hash
 	if exists {
 		return nil
 	}
-	return UploadBytes(ctx, client, bucket, blobKey(gameID, kind, hash), data, contentTypeForKind(kind))
+	return uploadBlobBytes(ctx, client, bucket, blobKey(gameID, kind, hash), data, contentTypeForKind(kind), compress)
 }
 
 // GetBlob はS3からブロブを取得する。
 func GetBlob(ctx context.Context, client *s3.Client, bucket, gameID, kind, hash string) ([]byte, error) {
-	data, err := DownloadObject(ctx, client, bucket, blobKey(gameID, kind, hash))
+	data, err := readBlobObject(ctx, client, bucket, blobKey(gameID, kind, hash))
 	if err != nil {
 		return nil, err
 	}
@@ -122,10 +155,29 @@ func GetBlob(ctx context.Context, client *s3.Client, bucket, gameID, kind, hash
 	return data, nil
 }
 
+// GetBlobCached は GetBlob と同じだが、不変ブロブ（commit / tree / meta）は cache を先に引き、
+// 無ければ取得してから cache に入れる。cache が nil なら GetBlob と同じ。
+func GetBlobCached(ctx context.Context, client *s3.Client, bucket, gameID, kind, hash string, cache *BlobCache) ([]byte, error) {
+	if data, ok := cache.Get(kind, hash); ok {
+		return data, nil
+	}
+	data, err := GetBlob(ctx, client, bucket, gameID, kind, hash)
+	if err != nil {
+		return nil, err
+	}
+	cache.Put(kind, hash, data)
+	return data, nil
+}
+
 // ListBlobHashes はゲームの既存セーブファイルブロブのハッシュを一括取得する。
 // objects/ プレフィックスのみを対象とする。
 func ListBlobHashes(ctx context.Context, client *s3.Client, bucket, gameID string) (map[string]struct{}, error) {
-	prefix := fmt.Sprintf("games/%s/%s/", gameID, BlobKindObject)
+	return listBlobHashes(ctx, client, bucket, gameID, BlobKindObject)
+}
+
+// listBlobHashes は games/<gameID>/<kind>/ 配下の既存ハッシュを一括取得する。
+func listBlobHashes(ctx context.Context, client *s3.Client, bucket, gameID, kind string) (map[string]struct{}, error) {
+	prefix := fmt.Sprintf("games/%s/%s/", gameID, kind)
 	existing := make(map[string]struct{})
 	input := &s3.ListObjectsV2Input{
 		Bucket: &bucket,
@@ -147,52 +199,146 @@ func ListBlobHashes(ctx context.Context, client *s3.Client, bucket, gameID strin
 	return existing, nil
 }
 
-// PutBlobs はセーブファイルブロブを一括アップロードする（objects/ 固定）。
-// ListObjectsV2 でリモートの既存ハッシュを一括取得し、不足分のみ並列アップロードする。
+// PutBlobs はセーブファイルブロブを一括アップロードする（objects/、Chunked は manifests/ + chunks/）。
+// index（リモートに存在が分かっているハッシュ集合）に載っているブロブは送らず、不足分のみ並列アップロードする。
+// index が nil、または必要な kind が未列挙なら ListObjectsV2 で全件列挙して補う。
+// 列挙せずに控えを信用した kind では、大きなブロブ（blobIndexVerifyMinSize 以上）と manifest だけ
+// 送る前に HeadObject で存在を確かめる。戻り値は index に列挙結果とアップロード分を加えたもの（index 自体も更新される）。
+// blobs は hash → ローカル実体。各ファイルはワーカーが取り出した時点で初めて開き、
+// ディスクから逐次読みで送るため、ピークメモリはセーブフォルダ全体ではなく並列度で決まる。
+// Chunked のブロブは通常分の完了後に1ファイルずつ putChunkedBlob で送る
+// （ファイル内のチャンクを並列化するため、ファイル間まで並列にすると同時接続数が掛け算になる）。
+// compress の扱いは PutBlob と同じ。
+// journal（nil 可）には揃ったブロブを1件ずつ記録し、マルチパートの送信途中も残すので、中断後の再試行で続きから送れる。
 // onProgress は (アップロード済み件数, 総件数) を受け取るコールバック。nil 可。
+// ctx に WithPhaseHook があれば list_blobs / upload_blobs の2段階を知らせる。
 func PutBlobs(
 	ctx context.Context,
 	client *s3.Client,
 	bucket, gameID string,
-	blobs map[string][]byte,
+	blobs map[string]BlobSource,
 	concurrency int,
+	compress bool,
+	index BlobIndex,
+	journal TransferJournal,
 	onProgress func(uploaded, total int),
-) error {
+) (BlobIndex, error) {
 	total := len(blobs)
 	if total == 0 {
-		return nil
+		return index, nil
+	}
+	journal = journalOrNop(journal)
+	if index == nil {
+		index = make(BlobIndex)
+	}
+	// 列挙と存在確認（list_blobs）と送信（upload_blobs）を段階として計時できるようにする
+	listCtx, endList := StartPhase(ctx, "list_blobs")
+	list := func(kind string) (map[string]struct{}, error) {
+		return listBlobHashes(listCtx, client, bucket, gameID, kind)
 	}
 
-	existing, err := ListBlobHashes(ctx, client, bucket, gameID)
+	objectsListed, err := index.ensureListed(list, BlobKindObject)
 	if err != nil {
-		return err
+		endList(err)
+		return nil, err
 	}
-
-	type task struct {
-		hash string
-		data []byte
+	tasks := make([]blobTask, 0, total)
+	var chunkedTasks []blobTask
+	for hash, source := range blobs {
+		if source.Chunked {
+			chunkedTasks = append(chunkedTasks, blobTask{hash: hash, source: source})
+		} else if !index.has(BlobKindObject, hash) {
+			verify := !objectsListed && source.Size >= blobIndexVerifyMinSize
+			tasks = append(tasks, blobTask{hash: hash, source: source, verify: verify})
+		}
 	}
-	tasks := make([]task, 0, total)
-	for hash, data := range blobs {
-		if blobHashBytes(data) != hash {
-			return fmt.Errorf("blob hash mismatch: %s/%s", BlobKindObject, hash)
+	if len(chunkedTasks) > 0 {
+		manifestsListed, err := index.ensureListed(list, BlobKindManifest)
+		if err != nil {
+			endList(err)
+			return nil, err
 		}
-		if _, ok := existing[hash]; !ok {
-			tasks = append(tasks, task{hash: hash, data: data})
+		pending := chunkedTasks[:0]
+		for _, t := range chunkedTasks {
+			if index.has(BlobKindManifest, t.hash) {
+				continue
+			}
+			if !manifestsListed {
+				exists, err := blobExists(listCtx, client, bucket, gameID, BlobKindManifest, t.hash)
+				if err != nil {
+					endList(err)
+					return nil, err
+				}
+				if exists {
+					index.add(BlobKindManifest, t.hash)
+					continue
+				}
+			}
+			pending = append(pending, t)
+		}
+		chunkedTasks = pending
+		if len(chunkedTasks) > 0 {
+			if _, err := index.ensureListed(list, BlobKindChunk); err != nil {
+				endList(err)
+				return nil, err
+			}
 		}
 	}
+	endList(nil)
+	ctx, endUpload := StartPhase(ctx, "upload_blobs")
+	index, err = putPendingBlobs(ctx, client, bucket, gameID, tasks, chunkedTasks, total, concurrency, compress, index, journal, onProgress)
+	endUpload(err)
+	return index, err
+}
 
-	alreadyDone := total - len(tasks)
+// putPendingBlobs は PutBlobs の送信段階。列挙で残った tasks / chunkedTasks を送り、index に加える。
+func putPendingBlobs(ctx context.Context, client *s3.Client, bucket, gameID string, tasks, chunkedTasks []blobTask, total, concurrency int, compress bool, index BlobIndex, journal TransferJournal, onProgress func(uploaded, total int)) (BlobIndex, error) {
+	alreadyDone := total - len(tasks) - len(chunkedTasks)
 	if onProgress != nil {
 		onProgress(alreadyDone, total)
 	}
-	if len(tasks) == 0 {
-		return nil
-	}
-
 	if concurrency <= 0 {
 		concurrency = defaultUploadConcurrency
 	}
+	uploaded := alreadyDone
+	if len(tasks) > 0 {
+		if err := putBlobSources(ctx, client, bucket, gameID, tasks, concurrency, compress, journal, func(hash string) {
+			journal.BlobUploaded(BlobKindObject, hash)
+			uploaded++
+			if onProgress != nil {
+				onProgress(uploaded, total)
+			}
+		}); err != nil {
+			return nil, err
+		}
+		for _, t := range tasks {
+			index.add(BlobKindObject, t.hash)
+		}
+	}
+	for _, t := range chunkedTasks {
+		if err := putChunkedBlob(ctx, client, bucket, gameID, t.hash, t.source, index[BlobKindChunk], concurrency, compress, journal); err != nil {
+			return nil, err
+		}
+		index.add(BlobKindManifest, t.hash)
+		journal.BlobUploaded(BlobKindManifest, t.hash)
+		uploaded++
+		if onProgress != nil {
+			onProgress(uploaded, total)
+		}
+	}
+	return index, nil
+}
+
+// blobTask は PutBlobs のアップロード対象1件。
+type blobTask struct {
+	hash   string
+	source BlobSource
+	verify bool // 送る前に HeadObject で存在を確かめる
+}
+
+// putBlobSources は単一ブロブ形式のタスクを最大 concurrency 本で並列アップロードする。
+// onUploaded は1件完了ごとに直列化して呼ばれる。
+func putBlobSources(ctx context.Context, client *s3.Client, bucket, gameID string, tasks []blobTask, concurrency int, compress bool, journal TransferJournal, onUploaded func(hash string)) error {
 	workerCount := concurrency
 	if workerCount > len(tasks) {
 		workerCount = len(tasks)
@@ -201,7 +347,7 @@ func PutBlobs(
 	ctx, cancel := context.WithCancel(ctx)
 	defer cancel()
 
-	taskCh := make(chan task, len(tasks))
+	taskCh := make(chan blobTask, len(tasks))
 	for _, t := range tasks {
 		taskCh <- t
 	}
@@ -211,7 +357,6 @@ func PutBlobs(
 	var errOnce sync.Once
 	var firstErr error
 	var mu sync.Mutex
-	uploaded := alreadyDone
 
 	for i := 0; i < workerCount; i++ {
 		wg.Add(1)
@@ -221,66 +366,209 @@ func PutBlobs(
 				if ctx.Err() != nil {
 					return
 				}
-				putErr := UploadBytes(ctx, client, bucket, blobKey(gameID, BlobKindObject, t.hash), t.data, contentTypeForKind(BlobKindObject))
-				if putErr != nil {
+				if putErr := putBlobTask(ctx, client, bucket, gameID, t, compress, journal); putErr != nil {
 					errOnce.Do(func() {
 						firstErr = putErr
 						cancel()
 					})
 					return
 				}
-				if onProgress != nil {
-					mu.Lock()
-					uploaded++
-					onProgress(uploaded, total)
-					mu.Unlock()
-				}
+				mu.Lock()
+				onUploaded(t.hash)
+				mu.Unlock()
 			}
 		}()
 	}
-
 	wg.Wait()
 	return firstErr
 }
 
-// DownloadBlobs はセーブファイルブロブを並列ダウンロードしてローカルに保存する（objects/ 固定）。
+// putBlobTask は t.verify なら存在確認を挟んでから putBlobSource で送る。
+func putBlobTask(ctx context.Context, client *s3.Client, bucket, gameID string, t blobTask, compress bool, journal TransferJournal) error {
+	if t.verify {
+		exists, err := blobExists(ctx, client, bucket, gameID, BlobKindObject, t.hash)
+		if err != nil {
+			return err
+		}
+		if exists {
+			return nil
+		}
+	}
+	return putBlobSource(ctx, client, bucket, gameID, t.hash, t.source, compress, journal)
+}
+
+// putBlobSource は1ファイルを objects/<hash> へストリーミングアップロードする。
+// 送信前後で stat を確認し、途中で書き換わっていたら失敗させる。送ったオブジェクトは消さない
+// （同じハッシュの正しいブロブを別端末や以前の Push が置いていて、既存のコミットが参照しているかもしれない）。
+// 失敗した Push は HEAD を進めないため、どのコミットからも参照されず GC で回収される。
+// 圧縮対象（compress かつ maxCompressibleBlobSize 以下）はメモリに読み込んでハッシュを直接照合してから送る。
+func putBlobSource(ctx context.Context, client *s3.Client, bucket, gameID, hash string, source BlobSource, compress bool, journal TransferJournal) error {
+	if err := source.checkUnchanged(); err != nil {
+		return err
+	}
+	key := blobKey(gameID, BlobKindObject, hash)
+	if compress && source.Size <= maxCompressibleBlobSize {
+		data, err := os.ReadFile(source.Path)
+		if err != nil {
+			return err
+		}
+		if blobHashBytes(data) != hash {
+			return fmt.Errorf("セーブファイルがハッシュ計算後に変更されました: %s", source.Path)
+		}
+		return uploadBlobBytes(ctx, client, bucket, key, data, contentTypeForKind(BlobKindObject), true)
+	}
+	if err := UploadFile(ctx, client, bucket, key, source.Path, source.Size, contentTypeForKind(BlobKindObject), journal); err != nil {
+		return err
+	}
+	return source.checkUnchanged()
+}
+
+// downloadTempPrefix / downloadTempSuffix はダウンロード途中の一時ファイル名。
+// 対象ファイルと同じディレクトリに作り rename で置き換える（同一ボリューム内なので原子的）。
+const (
+	downloadTempPrefix = ".cloudlaunch-dl-"
+	downloadTempSuffix = ".tmp"
+)
+
+// IsDownloadTempFile は name がダウンロード途中の一時ファイル名かを返す。
+// プロセスが強制終了されると一時ファイルが残りうるため、セーブフォルダ走査で除外するのに使う。
+func IsDownloadTempFile(name string) bool {
+	return strings.HasPrefix(name, downloadTempPrefix) && strings.HasSuffix(name, downloadTempSuffix)
+}
+
+// replaceFileAtomic は targetPath と同じディレクトリに一時ファイルを作って fill に書かせ、
+// fill が成功した場合のみ fsync して targetPath へ rename する。fill の失敗・キャンセル時は
+// 一時ファイルを消し、既存の targetPath には一切触れない（中断された Pull が書きかけのセーブを残さない）。
+// 内容の検証は fill の責務。
+func replaceFileAtomic(targetPath string, fill func(tmp *os.File) error) (err error) {
+	tmp, err := os.CreateTemp(filepath.Dir(targetPath), downloadTempPrefix+"*"+downloadTempSuffix)
+	if err != nil {
+		return err
+	}
+	tmpPath := tmp.Name()
+	defer func() {
+		if err != nil {
+			_ = tmp.Close()
+			_ = os.Remove(tmpPath)
+		}
+	}()
+
+	if err = fill(tmp); err != nil {
+		return err
+	}
+	// rename 後に電源断で空ファイルになるのを避けるため、置き換え前に内容を確定させる
+	if err = tmp.Sync(); err != nil {
+		return err
+	}
+	if err = tmp.Close(); err != nil {
+		return err
+	}
+	return os.Rename(tmpPath, targetPath)
+}
+
+// writeFileAtomic は body を一時ファイルへ書きつつ SHA-256 を計算し、hash と一致した場合のみ
+// targetPath を置き換える。
+func writeFileAtomic(targetPath string, body io.Reader, hash string) error {
+	return replaceFileAtomic(targetPath, func(tmp *os.File) error {
+		hasher := sha256.New()
+		if _, err := io.Copy(io.MultiWriter(tmp, hasher), body); err != nil {
+			return err
+		}
+		if got := hex.EncodeToString(hasher.Sum(nil)); got != hash {
+			return fmt.Errorf("blob hash mismatch: %s/%s", BlobKindObject, hash)
+		}
+		return nil
+	})
+}
+
+// getBlobToFile は objects/<hash> をメモリに載せずに targetPath へストリーミング保存する。
+// 圧縮されたブロブは展開しながら書き込む（ハッシュは展開後の内容で検証する）。
+func getBlobToFile(ctx context.Context, client *s3.Client, bucket, gameID, hash, targetPath string) (err error) {
+	body, err := openBlobObject(ctx, client, bucket, blobKey(gameID, BlobKindObject, hash))
+	if err != nil {
+		return err
+	}
+	defer func() {
+		if closeErr := body.Close(); closeErr != nil && err == nil {
+			err = closeErr
+		}
+	}()
+	return writeFileAtomic(targetPath, body, hash)
+}
+
+// copyFileAtomic はダウンロード済みの srcPath を targetPath へ複製する（同一内容の別スロット用）。
+// ハードリンクにしないのは、ゲームがどちらかをその場書き換えした際にもう一方まで変わってしまうため。
+func copyFileAtomic(srcPath, targetPath, hash string) (err error) {
+	src, err := os.Open(srcPath)
+	if err != nil {
+		return err
+	}
+	defer func() { _ = src.Close() }()
+	return writeFileAtomic(targetPath, src, hash)
+}
+
+// DownloadBlobs はセーブファイルブロブを並列ダウンロードしてローカルに保存する。
 // blobs は relPath → hash のマップ。saveDir 配下の relPath に書き込む。
-// onProgress は (ダウンロード済み件数, 総件数) を受け取るコールバック。nil 可。
+// chunked に含まれるハッシュはチャンク分割形式として restoreChunkedFile で復元する
+// （通常分の完了後に1ファイルずつ。ファイル内のチャンク取得を concurrency 本で並列化する）。
+// 同一ハッシュは1回だけ GET し、残りの relPath へはローカルで複製する（同一内容のスロット分の egress を省く）。
+// 各ファイルは一時ファイルへストリーミングしながらハッシュ検証し、一致したものだけ rename で置き換える。
+// journal（nil 可）には書き終えたファイルを1件ずつ記録する（再試行時にローカル側の再ハッシュを省くため）。
+// onProgress は (保存済みファイル件数, 総ファイル件数) を受け取るコールバック。nil 可。
 func DownloadBlobs(
 	ctx context.Context,
 	client *s3.Client,
 	bucket, gameID, saveDir string,
 	blobs map[string]string,
+	chunked map[string]struct{},
 	concurrency int,
+	journal TransferJournal,
 	onProgress func(downloaded, total int),
 ) error {
 	if len(blobs) == 0 {
 		return nil
 	}
+	journal = journalOrNop(journal)
 
 	if concurrency <= 0 {
 		concurrency = defaultUploadConcurrency
 	}
 
-	type task struct {
-		relPath string
-		hash    string
-	}
-	tasks := make([]task, 0, len(blobs))
+	// 書き込み先は先にすべて検証し、不正なパスが1件でもあれば何もダウンロードしない。
+	targets := make(map[string][]string)
 	for relPath, hash := range blobs {
-		tasks = append(tasks, task{relPath: relPath, hash: hash})
+		targetPath, err := ResolveSafeRelativePath(saveDir, relPath)
+		if err != nil {
+			return err
+		}
+		targets[hash] = append(targets[hash], targetPath)
 	}
 
-	total := len(tasks)
+	type task struct {
+		hash  string
+		paths []string
+	}
+	tasks := make([]task, 0, len(targets))
+	var chunkedTasks []task
+	for hash, paths := range targets {
+		sort.Strings(paths)
+		if _, ok := chunked[hash]; ok {
+			chunkedTasks = append(chunkedTasks, task{hash: hash, paths: paths})
+		} else {
+			tasks = append(tasks, task{hash: hash, paths: paths})
+		}
+	}
+
+	total := len(blobs)
 	workerCount := concurrency
-	if workerCount > total {
-		workerCount = total
+	if workerCount > len(tasks) {
+		workerCount = len(tasks)
 	}
 
 	ctx, cancel := context.WithCancel(ctx)
 	defer cancel()
 
-	taskCh := make(chan task, total)
+	taskCh := make(chan task, len(tasks))
 	for _, t := range tasks {
 		taskCh <- t
 	}
@@ -300,34 +588,58 @@ func DownloadBlobs(
 				if ctx.Err() != nil {
 					return
 				}
-				data, err := GetBlob(ctx, client, bucket, gameID, BlobKindObject, t.hash)
-				if err != nil {
-					errOnce.Do(func() { firstErr = err; cancel() })
-					return
-				}
-				targetPath, err := ResolveSafeRelativePath(saveDir, t.relPath)
-				if err != nil {
-					errOnce.Do(func() { firstErr = err; cancel() })
-					return
-				}
-				if err := os.MkdirAll(filepath.Dir(targetPath), 0o700); err != nil {
-					errOnce.Do(func() { firstErr = err; cancel() })
-					return
-				}
-				if err := os.WriteFile(targetPath, data, 0o600); err != nil {
-					errOnce.Do(func() { firstErr = err; cancel() })
-					return
-				}
-				if onProgress != nil {
-					mu.Lock()
-					downloaded++
-					onProgress(downloaded, total)
-					mu.Unlock()
+				for n, targetPath := range t.paths {
+					if err := os.MkdirAll(filepath.Dir(targetPath), 0o700); err != nil {
+						errOnce.Do(func() { firstErr = err; cancel() })
+						return
+					}
+					var err error
+					if n == 0 {
+						err = getBlobToFile(ctx, client, bucket, gameID, t.hash, targetPath)
+					} else {
+						err = copyFileAtomic(t.paths[0], targetPath, t.hash)
+					}
+					if err != nil {
+						errOnce.Do(func() { firstErr = err; cancel() })
+						return
+					}
+					journal.FileDownloaded(targetPath, t.hash)
+					if onProgress != nil {
+						mu.Lock()
+						downloaded++
+						onProgress(downloaded, total)
+						mu.Unlock()
+					}
 				}
 			}
 		}()
 	}
 
 	wg.Wait()
-	return firstErr
+	if firstErr != nil {
+		return firstErr
+	}
+
+	for _, t := range chunkedTasks {
+		for n, targetPath := range t.paths {
+			if err := os.MkdirAll(filepath.Dir(targetPath), 0o700); err != nil {
+				return err
+			}
+			var err error
+			if n == 0 {
+				err = restoreChunkedFile(ctx, client, bucket, gameID, t.hash, targetPath, concurrency)
+			} else {
+				err = copyFileAtomic(t.paths[0], targetPath, t.hash)
+			}
+			if err != nil {
+				return err
+			}
+			journal.FileDownloaded(targetPath, t.hash)
+			if onProgress != nil {
+				downloaded++
+				onProgress(downloaded, total)
+			}
+		}
+	}
+	return nil
 }
@@ -1,7 +1,12 @@
 package storage
 
 import (
+	"bytes"
+	"context"
+	"math/rand"
+	"os"
 	"path/filepath"
+	"strings"
 	"testing"
 )
 
@@ -48,3 +53,208 @@ func TestResolveSafeRelativePathRejectsEscapingPath(t *testing.T) {
 		}
 	}
 }
+
+func TestBlobSourceCheckUnchangedDetectsModification(t *testing.T) {
+	t.Parallel()
+	filePath := filepath.Join(t.TempDir(), "slot.sav")
+	if err := os.WriteFile(filePath, []byte("before"), 0o600); err != nil {
+		t.Fatal(err)
+	}
+	info, err := os.Stat(filePath)
+	if err != nil {
+		t.Fatal(err)
+	}
+	source := BlobSource{Path: filePath, Size: info.Size(), ModTime: info.ModTime()}
+	if err := source.checkUnchanged(); err != nil {
+		t.Fatalf("checkUnchanged on untouched file: %v", err)
+	}
+
+	if err := os.WriteFile(filePath, []byte("after, longer"), 0o600); err != nil {
+		t.Fatal(err)
+	}
+	if err := source.checkUnchanged(); err == nil {
+		t.Fatal("checkUnchanged should fail after the file was rewritten")
+	}
+}
+
+func TestWriteFileAtomicReplacesOnlyOnHashMatch(t *testing.T) {
+	t.Parallel()
+
+	dir := t.TempDir()
+	target := filepath.Join(dir, "slot.sav")
+	if err := os.WriteFile(target, []byte("old"), 0o600); err != nil {
+		t.Fatal(err)
+	}
+
+	// ハッシュ不一致: 既存ファイルはそのまま、一時ファイルも残らない
+	if err := writeFileAtomic(target, strings.NewReader("corrupted"), blobHashBytes([]byte("new"))); err == nil {
+		t.Fatal("expected hash mismatch error")
+	}
+	if got, _ := os.ReadFile(target); !bytes.Equal(got, []byte("old")) {
+		t.Fatalf("target must be untouched on mismatch, got %q", got)
+	}
+	entries, err := os.ReadDir(dir)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if len(entries) != 1 {
+		t.Fatalf("temp file left behind: %d entries", len(entries))
+	}
+
+	if err := writeFileAtomic(target, strings.NewReader("new"), blobHashBytes([]byte("new"))); err != nil {
+		t.Fatalf("writeFileAtomic: %v", err)
+	}
+	if got, _ := os.ReadFile(target); !bytes.Equal(got, []byte("new")) {
+		t.Fatalf("target = %q, want %q", got, "new")
+	}
+
+	// 同一内容の別パスへの複製（ハードリンクではなく独立したファイル）
+	dup := filepath.Join(dir, "dup.sav")
+	if err := copyFileAtomic(target, dup, blobHashBytes([]byte("new"))); err != nil {
+		t.Fatalf("copyFileAtomic: %v", err)
+	}
+	if err := os.WriteFile(target, []byte("changed"), 0o600); err != nil {
+		t.Fatal(err)
+	}
+	if got, _ := os.ReadFile(dup); !bytes.Equal(got, []byte("new")) {
+		t.Fatalf("copy must not alias the source, got %q", got)
+	}
+}
+
+func TestIsDownloadTempFile(t *testing.T) {
+	t.Parallel()
+
+	if !IsDownloadTempFile(downloadTempPrefix + "123" + downloadTempSuffix) {
+		t.Fatal("temp file name not recognized")
+	}
+	for _, name := range []string{"slot.sav", "save.tmp", ".cloudlaunch-dl-", "x" + downloadTempPrefix + "1" + downloadTempSuffix} {
+		if IsDownloadTempFile(name) {
+			t.Fatalf("%q must not be treated as a temp file", name)
+		}
+	}
+}
+
+// writeBlobSource は data を dir/name に書き、PutBlobs に渡す BlobSource とハッシュを返す。
+// チャンク分割かどうかはサービス層（isChunkedSaveFile）と同じくサイズだけで決める。
+func writeBlobSource(t *testing.T, dir, name string, data []byte) (string, BlobSource) {
+	t.Helper()
+	filePath := filepath.Join(dir, name)
+	if err := os.WriteFile(filePath, data, 0o600); err != nil {
+		t.Fatal(err)
+	}
+	info, err := os.Stat(filePath)
+	if err != nil {
+		t.Fatal(err)
+	}
+	return blobHashBytes(data), BlobSource{Path: filePath, Size: info.Size(), ModTime: info.ModTime(), Chunked: info.Size() >= ChunkedFileThreshold}
+}
+
+// TestPutBlobsAndDownloadBlobsRoundTripChunkedFiles は、チャンク分割の閾値をまたぐ3種の大きさ
+// （単発 PutObject / マルチパート / チャンク分割）のセーブを PutBlobs で送り DownloadBlobs で戻せること、
+// 一部だけ書き換えた次の版では変わったチャンクだけを送り、復元結果が元のバイト列と一致することを確認する。
+func TestPutBlobsAndDownloadBlobsRoundTripChunkedFiles(t *testing.T) {
+	if testing.Short() {
+		t.Skip("uploads files above the chunking threshold")
+	}
+	t.Parallel()
+
+	random := rand.New(rand.NewSource(5))
+	small := make([]byte, 4<<10)
+	medium := make([]byte, multipartThreshold+1)
+	large := make([]byte, ChunkedFileThreshold+(1<<20))
+	for _, data := range [][]byte{small, medium, large} {
+		random.Read(data)
+	}
+	fake, client := newFakeS3Client(t)
+	ctx := context.Background()
+	const gameID = "game"
+
+	push := func(files map[string][]byte) (map[string]BlobSource, map[string]string) {
+		t.Helper()
+		dir := t.TempDir()
+		sources := map[string]BlobSource{}
+		relPaths := map[string]string{}
+		for name, data := range files {
+			hash, source := writeBlobSource(t, dir, name, data)
+			sources[hash] = source
+			relPaths[name] = hash
+		}
+		// 控え無しで送り、既存ブロブの判定を ListObjectsV2 に任せる
+		if _, err := PutBlobs(ctx, client, fakeS3Bucket, gameID, sources, 4, false, nil, nil, nil); err != nil {
+			t.Fatalf("PutBlobs: %v", err)
+		}
+		return sources, relPaths
+	}
+	pull := func(saveDir string, files map[string][]byte, relPaths map[string]string, sources map[string]BlobSource) {
+		t.Helper()
+		chunked := map[string]struct{}{}
+		for hash, source := range sources {
+			if source.Chunked {
+				chunked[hash] = struct{}{}
+			}
+		}
+		if err := DownloadBlobs(ctx, client, fakeS3Bucket, gameID, saveDir, relPaths, chunked, 4, nil, nil); err != nil {
+			t.Fatalf("DownloadBlobs: %v", err)
+		}
+		for name, want := range files {
+			got, err := os.ReadFile(filepath.Join(saveDir, name))
+			if err != nil {
+				t.Fatal(err)
+			}
+			if !bytes.Equal(got, want) {
+				t.Fatalf("%s: restored bytes differ from the pushed file", name)
+			}
+		}
+	}
+
+	v1 := map[string][]byte{"small.sav": small, "medium.sav": medium, "large.sav": large}
+	sources1, relPaths1 := push(v1)
+	largeHash := relPaths1["large.sav"]
+	if !sources1[largeHash].Chunked || sources1[relPaths1["medium.sav"]].Chunked {
+		t.Fatal("only the file above ChunkedFileThreshold should be chunked")
+	}
+	if _, ok := fake.object(blobKey(gameID, BlobKindObject, largeHash)); ok {
+		t.Fatal("chunked file must not be stored as a single object")
+	}
+	if _, ok := fake.object(blobKey(gameID, BlobKindManifest, largeHash)); !ok {
+		t.Fatal("chunked file should have a manifest")
+	}
+	if _, ok := fake.object(blobKey(gameID, BlobKindObject, relPaths1["medium.sav"])); !ok {
+		t.Fatal("file below ChunkedFileThreshold should be stored as a single object")
+	}
+	if fake.putCount(blobKey(gameID, BlobKindObject, relPaths1["medium.sav"])) != 0 {
+		t.Fatal("file above multipartThreshold should be sent as a multipart upload")
+	}
+	chunksPrefix := "games/" + gameID + "/" + BlobKindChunk + "/"
+	chunksV1 := fake.keysWithPrefix(chunksPrefix)
+	if chunksV1 < 2 {
+		t.Fatalf("expected the large file to be split into chunks, got %d", chunksV1)
+	}
+	pulledDir := t.TempDir()
+	pull(pulledDir, v1, relPaths1, sources1)
+
+	// 次の版: 大きなファイルの中ほどを書き換えるだけ
+	largeV2 := append([]byte(nil), large...)
+	random.Read(largeV2[len(largeV2)/2 : len(largeV2)/2+4096])
+	v2 := map[string][]byte{"small.sav": small, "medium.sav": medium, "large.sav": largeV2}
+	sources2, relPaths2 := push(v2)
+	added := fake.keysWithPrefix(chunksPrefix) - chunksV1
+	if added < 1 || added > 3 {
+		t.Fatalf("expected only the chunks around the edit to be uploaded, got %d new of %d", added, chunksV1+added)
+	}
+	if fake.putCount(blobKey(gameID, BlobKindObject, relPaths2["small.sav"])) != 1 {
+		t.Fatal("unchanged blobs must not be uploaded again")
+	}
+	fake.mu.Lock()
+	for key, count := range fake.puts {
+		if strings.HasPrefix(key, chunksPrefix) && count != 1 {
+			fake.mu.Unlock()
+			t.Fatalf("chunk %s uploaded %d times", key, count)
+		}
+	}
+	fake.mu.Unlock()
+
+	// 新しい端末への Pull と、前の版を持つ端末への Pull（手元のチャンクを再利用）の両方で一致すること
+	pull(t.TempDir(), v2, relPaths2, sources2)
+	pull(pulledDir, v2, relPaths2, sources2)
+}
@@ -0,0 +1,264 @@
+// チャンク分割形式（manifests/ + chunks/）のセーブファイルブロブの読み書きを提供する。
+package storage
+
+import (
+	"context"
+	"crypto/sha256"
+	"encoding/hex"
+	"encoding/json"
+	"fmt"
+	"io"
+	"os"
+	"sync"
+
+	"github.com/aws/aws-sdk-go-v2/service/s3"
+)
+
+// GetChunkManifest は manifests/<hash> を取得して検証済みの ChunkManifest を返す。
+func GetChunkManifest(ctx context.Context, client *s3.Client, bucket, gameID, hash string) (ChunkManifest, error) {
+	data, err := readBlobObject(ctx, client, bucket, blobKey(gameID, BlobKindManifest, hash))
+	if err != nil {
+		return ChunkManifest{}, err
+	}
+	var manifest ChunkManifest
+	if err := json.Unmarshal(data, &manifest); err != nil {
+		return ChunkManifest{}, err
+	}
+	if err := manifest.validate(); err != nil {
+		return ChunkManifest{}, fmt.Errorf("%w: %s", err, hash)
+	}
+	return manifest, nil
+}
+
+// putChunkedBlob は source を内容定義チャンクに分割し、existingChunks に無いチャンクだけを
+// 最大 concurrency 本で並列アップロードしてから manifests/<hash> を置く。
+// manifest を最後に置くため、manifest が存在すれば参照先チャンクはすべて揃っている。
+// チャンクは分割時に読んだバイト列そのものから送るので chunks/<hash> の内容は常にハッシュと一致する。
+// 走査後にファイルが書き換わっていた場合は全体ハッシュが合わず、manifest を置かずに失敗する
+// （送ったチャンクは正しい content-addressed ブロブとして残るだけで害はない）。
+// メモリ使用量は (concurrency + 1) × chunkMaxSize 程度で、ファイルサイズに依存しない。
+// 成功時は manifest が参照する全チャンクを existingChunks に加える（呼び出し側の BlobIndex を更新するため）。
+// 送り終えたチャンクは1件ずつ journal に記録するので、manifest を置く前に中断しても再試行で送り直さずに済む。
+func putChunkedBlob(
+	ctx context.Context,
+	client *s3.Client,
+	bucket, gameID, hash string,
+	source BlobSource,
+	existingChunks map[string]struct{},
+	concurrency int,
+	compress bool,
+	journal TransferJournal,
+) (err error) {
+	if err := source.checkUnchanged(); err != nil {
+		return err
+	}
+	if concurrency <= 0 {
+		concurrency = defaultUploadConcurrency
+	}
+	file, err := os.Open(source.Path)
+	if err != nil {
+		return err
+	}
+	defer func() { _ = file.Close() }()
+
+	ctx, cancel := context.WithCancel(ctx)
+	defer cancel()
+
+	type chunkUpload struct {
+		hash string
+		data []byte
+	}
+	uploads := make(chan chunkUpload)
+	var wg sync.WaitGroup
+	var errOnce sync.Once
+	var firstErr error
+	for i := 0; i < concurrency; i++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for upload := range uploads {
+				if ctx.Err() != nil {
+					continue
+				}
+				key := blobKey(gameID, BlobKindChunk, upload.hash)
+				if putErr := uploadBlobBytes(ctx, client, bucket, key, upload.data, contentTypeForKind(BlobKindChunk), compress); putErr != nil {
+					errOnce.Do(func() { firstErr = putErr; cancel() })
+					continue
+				}
+				journal.BlobUploaded(BlobKindChunk, upload.hash)
+			}
+		}()
+	}
+
+	manifest := ChunkManifest{}
+	queued := make(map[string]struct{})
+	fullHash, splitErr := splitChunks(file, func(span chunkSpan, data []byte) error {
+		manifest.Chunks = append(manifest.Chunks, ChunkRef{Hash: span.Hash, Size: span.Size})
+		manifest.Size += span.Size
+		if _, ok := existingChunks[span.Hash]; ok {
+			return nil
+		}
+		if _, ok := queued[span.Hash]; ok {
+			return nil
+		}
+		queued[span.Hash] = struct{}{}
+		select {
+		case uploads <- chunkUpload{hash: span.Hash, data: append([]byte(nil), data...)}:
+			return nil
+		case <-ctx.Done():
+			return ctx.Err()
+		}
+	})
+	close(uploads)
+	wg.Wait()
+	if firstErr != nil {
+		return firstErr
+	}
+	if splitErr != nil {
+		return splitErr
+	}
+	if fullHash != hash {
+		return fmt.Errorf("セーブファイルがハッシュ計算後に変更されました: %s", source.Path)
+	}
+
+	manifestBytes, err := json.Marshal(manifest)
+	if err != nil {
+		return err
+	}
+	if err := uploadBlobBytes(ctx, client, bucket, blobKey(gameID, BlobKindManifest, hash), manifestBytes, contentTypeForKind(BlobKindManifest), compress); err != nil {
+		return err
+	}
+	for _, ref := range manifest.Chunks {
+		existingChunks[ref.Hash] = struct{}{}
+	}
+	return nil
+}
+
+// indexLocalChunks は既存のローカルファイルをチャンク分割し、チャンクハッシュ → 位置を返す。
+// ファイルが無い・読めない場合は空を返す（全チャンクをダウンロードするだけ）。
+func indexLocalChunks(path string) map[string]chunkSpan {
+	file, err := os.Open(path)
+	if err != nil {
+		return nil
+	}
+	defer func() { _ = file.Close() }()
+	index := make(map[string]chunkSpan)
+	if _, err := splitChunks(file, func(span chunkSpan, _ []byte) error {
+		index[span.Hash] = span
+		return nil
+	}); err != nil {
+		return nil
+	}
+	return index
+}
+
+// fetchChunkAt は chunks/<ref.Hash> を dst の off 位置へストリーミングで書き込み、サイズとハッシュを検証する。
+func fetchChunkAt(ctx context.Context, client *s3.Client, bucket, gameID string, ref ChunkRef, dst io.WriterAt, off int64) (err error) {
+	body, err := openBlobObject(ctx, client, bucket, blobKey(gameID, BlobKindChunk, ref.Hash))
+	if err != nil {
+		return err
+	}
+	defer func() {
+		if closeErr := body.Close(); closeErr != nil && err == nil {
+			err = closeErr
+		}
+	}()
+	hasher := sha256.New()
+	// 展開後のサイズが manifest を超えても隣のチャンク領域を書き潰さないよう +1 で打ち切る
+	written, err := io.Copy(io.MultiWriter(io.NewOffsetWriter(dst, off), hasher), io.LimitReader(body, ref.Size+1))
+	if err != nil {
+		return err
+	}
+	if written != ref.Size || hex.EncodeToString(hasher.Sum(nil)) != ref.Hash {
+		return fmt.Errorf("blob hash mismatch: %s/%s", BlobKindChunk, ref.Hash)
+	}
+	return nil
+}
+
+// restoreChunkedFile は manifests/<hash> に従って targetPath を組み立てる。
+// 既存の targetPath（前回 Pull した版など）に同じチャンクがあればローカルから複製し、
+// 手元に無いチャンクだけを最大 concurrency 本で並列ダウンロードする。
+// 組み立て後に全体ハッシュを検証してから rename で置き換える。
+func restoreChunkedFile(ctx context.Context, client *s3.Client, bucket, gameID, hash, targetPath string, concurrency int) error {
+	manifest, err := GetChunkManifest(ctx, client, bucket, gameID, hash)
+	if err != nil {
+		return err
+	}
+	local := indexLocalChunks(targetPath)
+
+	if concurrency <= 0 {
+		concurrency = defaultUploadConcurrency
+	}
+	return replaceFileAtomic(targetPath, func(tmp *os.File) error {
+		if err := tmp.Truncate(manifest.Size); err != nil {
+			return err
+		}
+		var localFile *os.File
+		if len(local) > 0 {
+			var openErr error
+			if localFile, openErr = os.Open(targetPath); openErr != nil {
+				local = nil
+			} else {
+				// rename 前に閉じる必要がある（Windows は開いているファイルを置き換えられない）
+				defer func() { _ = localFile.Close() }()
+			}
+		}
+
+		ctx, cancel := context.WithCancel(ctx)
+		defer cancel()
+
+		type chunkJob struct {
+			ref ChunkRef
+			off int64
+		}
+		jobs := make(chan chunkJob, len(manifest.Chunks))
+		var off int64
+		for _, ref := range manifest.Chunks {
+			jobs <- chunkJob{ref: ref, off: off}
+			off += ref.Size
+		}
+		close(jobs)
+
+		var wg sync.WaitGroup
+		var errOnce sync.Once
+		var firstErr error
+		for i := 0; i < concurrency; i++ {
+			wg.Add(1)
+			go func() {
+				defer wg.Done()
+				for job := range jobs {
+					if ctx.Err() != nil {
+						return
+					}
+					var jobErr error
+					if span, ok := local[job.ref.Hash]; ok && span.Size == job.ref.Size {
+						_, jobErr = io.Copy(io.NewOffsetWriter(tmp, job.off), io.NewSectionReader(localFile, span.Offset, span.Size))
+					} else {
+						jobErr = fetchChunkAt(ctx, client, bucket, gameID, job.ref, tmp, job.off)
+					}
+					if jobErr != nil {
+						errOnce.Do(func() { firstErr = jobErr; cancel() })
+						return
+					}
+				}
+			}()
+		}
+		wg.Wait()
+		if firstErr != nil {
+			return firstErr
+		}
+
+		// ローカル複製分は索引作成後に書き換わっている可能性があるため、全体で検証する。
+		if _, err := tmp.Seek(0, io.SeekStart); err != nil {
+			return err
+		}
+		hasher := sha256.New()
+		if _, err := io.Copy(hasher, tmp); err != nil {
+			return err
+		}
+		if hex.EncodeToString(hasher.Sum(nil)) != hash {
+			return fmt.Errorf("blob hash mismatch: %s/%s", BlobKindManifest, hash)
+		}
+		return nil
+	})
+}
@@ -0,0 +1,154 @@
+// 大きなセーブファイル向けの内容定義チャンク分割（Gear ハッシュによる CDC）を提供する。
+package storage
+
+import (
+	"crypto/sha256"
+	"encoding/hex"
+	"errors"
+	"io"
+)
+
+// ChunkedFileThreshold 以上のセーブファイルはチャンク分割形式で保存する。
+// 閾値未満は従来どおり objects/<hash> の単一ブロブ（旧クライアントと同じ形式）。
+// Status でも stat のサイズだけで判定できるよう、設定値ではなく固定値にしている
+// （端末ごとに値が違うと同一内容でも SaveSnapshot が変わり fingerprint がずれる）。
+// 閾値未満の単一ブロブのうち multipartThreshold を超えるものは UploadFile がマルチパートで送る。
+const ChunkedFileThreshold = 64 << 20
+
+// チャンクサイズの下限・平均（2^chunkAvgBits）・上限。
+// 1 セッションで数 MB だけ変わる数百 MB のアーカイブで、変更箇所の前後数チャンクだけが
+// 再アップロードされる粒度にする。値を変えると既存ファイルの境界がすべてずれるので変更しない。
+const (
+	chunkMinSize = 256 << 10
+	chunkAvgBits = 20
+	chunkMaxSize = 4 << 20
+	chunkMask    = 1<<chunkAvgBits - 1
+)
+
+// chunkGear は Gear ローリングハッシュのバイト→乱数テーブル。
+// 境界位置がこの値で決まるため、固定シードの splitmix64 から決定的に生成する。
+var chunkGear = func() [256]uint64 {
+	var table [256]uint64
+	state := uint64(0x436c6f75644c6e63) // "CloudLnc"
+	for i := range table {
+		state += 0x9e3779b97f4a7c15
+		z := state
+		z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9
+		z = (z ^ (z >> 27)) * 0x94d049bb133111eb
+		table[i] = z ^ (z >> 31)
+	}
+	return table
+}()
+
+// ChunkManifest はチャンク分割保存したファイル1件の構成を表し、manifests/<ファイル全体のハッシュ> に置く。
+// Chunks を順に連結するとファイル全体になる。
+type ChunkManifest struct {
+	Size   int64      `json:"size"`
+	Chunks []ChunkRef `json:"chunks"`
+}
+
+// ChunkRef は chunks/<Hash> に置いたチャンク1件を表す。
+type ChunkRef struct {
+	Hash string `json:"hash"`
+	Size int64  `json:"size"`
+}
+
+// validate は manifest の各チャンクが空でなく、合計サイズが Size と一致することを確認する。
+func (m ChunkManifest) validate() error {
+	var total int64
+	for _, c := range m.Chunks {
+		if c.Hash == "" || c.Size <= 0 {
+			return errors.New("チャンクマニフェストが不正です")
+		}
+		total += c.Size
+	}
+	if total != m.Size {
+		return errors.New("チャンクマニフェストのサイズが一致しません")
+	}
+	return nil
+}
+
+// chunkSpan は splitChunks が返すチャンク1件の位置とハッシュ。
+type chunkSpan struct {
+	Offset int64
+	Size   int64
+	Hash   string
+}
+
+// splitChunks は r を内容定義境界で分割し、チャンクごとに emit を呼ぶ。戻り値は r 全体の SHA-256。
+// data は次の emit 呼び出しまでしか有効でない（保持する場合は呼び出し側でコピーする）。
+// 境界は直前の境界からの内容だけで決まるため、ファイル途中への挿入・削除でも
+// 変更箇所から離れたチャンクは同じハッシュのまま残る。
+func splitChunks(r io.Reader, emit func(span chunkSpan, data []byte) error) (string, error) {
+	full := sha256.New()
+	buf := make([]byte, 1<<20)
+	chunk := make([]byte, 0, chunkMaxSize)
+	var rolling uint64
+	var offset int64
+
+	flush := func() error {
+		sum := sha256.Sum256(chunk)
+		span := chunkSpan{Offset: offset, Size: int64(len(chunk)), Hash: hex.EncodeToString(sum[:])}
+		if err := emit(span, chunk); err != nil {
+			return err
+		}
+		offset += span.Size
+		chunk = chunk[:0]
+		rolling = 0
+		return nil
+	}
+
+	for {
+		n, readErr := r.Read(buf)
+		data := buf[:n]
+		full.Write(data)
+		for len(data) > 0 {
+			// 下限に達するまでは境界を探さず一括コピーする（極小チャンクの乱発を防ぐ）。
+			if need := chunkMinSize - len(chunk); need > 0 {
+				if need > len(data) {
+					need = len(data)
+				}
+				chunk = append(chunk, data[:need]...)
+				data = data[need:]
+				continue
+			}
+			cut := -1
+			limit := chunkMaxSize - len(chunk)
+			if limit > len(data) {
+				limit = len(data)
+			}
+			for i := 0; i < limit; i++ {
+				rolling = (rolling << 1) + chunkGear[data[i]]
+				if rolling&chunkMask == 0 {
+					cut = i + 1
+					break
+				}
+			}
+			if cut < 0 {
+				chunk = append(chunk, data[:limit]...)
+				data = data[limit:]
+				if len(chunk) < chunkMaxSize {
+					continue
+				}
+			} else {
+				chunk = append(chunk, data[:cut]...)
+				data = data[cut:]
+			}
+			if err := flush(); err != nil {
+				return "", err
+			}
+		}
+		if readErr == io.EOF {
+			break
+		}
+		if readErr != nil {
+			return "", readErr
+		}
+	}
+	if len(chunk) > 0 {
+		if err := flush(); err != nil {
+			return "", err
+		}
+	}
+	return hex.EncodeToString(full.Sum(nil)), nil
+}
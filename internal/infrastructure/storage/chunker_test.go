@@ -0,0 +1,110 @@
+package storage
+
+import (
+	"bytes"
+	"math/rand"
+	"testing"
+)
+
+func collectChunks(t *testing.T, data []byte) ([]chunkSpan, string) {
+	t.Helper()
+	var spans []chunkSpan
+	var joined []byte
+	full, err := splitChunks(bytes.NewReader(data), func(span chunkSpan, chunk []byte) error {
+		spans = append(spans, span)
+		joined = append(joined, chunk...)
+		return nil
+	})
+	if err != nil {
+		t.Fatalf("splitChunks: %v", err)
+	}
+	if !bytes.Equal(joined, data) {
+		t.Fatal("chunks do not reassemble to the input")
+	}
+	return spans, full
+}
+
+func TestSplitChunksRespectsBoundsAndHashesWhole(t *testing.T) {
+	t.Parallel()
+
+	data := make([]byte, 24<<20)
+	rand.New(rand.NewSource(1)).Read(data)
+	spans, full := collectChunks(t, data)
+
+	if full != blobHashBytes(data) {
+		t.Fatalf("full hash = %s, want %s", full, blobHashBytes(data))
+	}
+	var offset int64
+	for i, span := range spans {
+		if span.Offset != offset {
+			t.Fatalf("chunk %d offset = %d, want %d", i, span.Offset, offset)
+		}
+		if span.Size > chunkMaxSize || (span.Size < chunkMinSize && i != len(spans)-1) {
+			t.Fatalf("chunk %d size %d out of bounds", i, span.Size)
+		}
+		if span.Hash != blobHashBytes(data[span.Offset:span.Offset+span.Size]) {
+			t.Fatalf("chunk %d hash mismatch", i)
+		}
+		offset += span.Size
+	}
+	if len(spans) < 6 {
+		t.Fatalf("expected content-defined cuts, got only %d chunks", len(spans))
+	}
+}
+
+// TestSplitChunksLocalizesInsertion は先頭付近への挿入で後続チャンクの大半が再利用されることを確認する。
+func TestSplitChunksLocalizesInsertion(t *testing.T) {
+	t.Parallel()
+
+	data := make([]byte, 24<<20)
+	rand.New(rand.NewSource(2)).Read(data)
+	edited := append(append(append([]byte{}, data[:1<<20]...), []byte("inserted bytes")...), data[1<<20:]...)
+
+	before, _ := collectChunks(t, data)
+	after, _ := collectChunks(t, edited)
+
+	known := make(map[string]struct{}, len(before))
+	for _, span := range before {
+		known[span.Hash] = struct{}{}
+	}
+	reused := 0
+	for _, span := range after {
+		if _, ok := known[span.Hash]; ok {
+			reused++
+		}
+	}
+	if reused < len(after)-3 {
+		t.Fatalf("only %d of %d chunks reused after a small insertion", reused, len(after))
+	}
+}
+
+func TestSplitChunksSmallAndEmptyInput(t *testing.T) {
+	t.Parallel()
+
+	spans, full := collectChunks(t, []byte("tiny"))
+	if len(spans) != 1 || spans[0].Size != 4 || full != blobHashBytes([]byte("tiny")) {
+		t.Fatalf("unexpected spans for tiny input: %+v", spans)
+	}
+	spans, full = collectChunks(t, nil)
+	if len(spans) != 0 || full != blobHashBytes(nil) {
+		t.Fatalf("unexpected spans for empty input: %+v", spans)
+	}
+}
+
+func TestChunkManifestValidate(t *testing.T) {
+	t.Parallel()
+
+	ok := ChunkManifest{Size: 3, Chunks: []ChunkRef{{Hash: "a", Size: 1}, {Hash: "b", Size: 2}}}
+	if err := ok.validate(); err != nil {
+		t.Fatalf("valid manifest rejected: %v", err)
+	}
+	for _, bad := range []ChunkManifest{
+		{Size: 4, Chunks: ok.Chunks},
+		{Size: 1, Chunks: []ChunkRef{{Hash: "", Size: 1}}},
+		{Size: 0, Chunks: []ChunkRef{{Hash: "a", Size: 0}}},
+	} {
+		if err := bad.validate(); err == nil {
+			t.Fatalf("invalid manifest accepted: %+v", bad)
+		}
+	}
+}
@@ -0,0 +1,102 @@
+// 接続設定ごとに S3 クライアント（と HTTP コネクションプール）を使い回すキャッシュを提供する。
+package storage
+
+import (
+	"context"
+	"net/http"
+	"sync"
+	"time"
+
+	"CloudLaunch_Go/internal/infrastructure/credentials"
+
+	awshttp "github.com/aws/aws-sdk-go-v2/aws/transport/http"
+	"github.com/aws/aws-sdk-go-v2/service/s3"
+)
+
+// minIdleConnsPerHost は並列度が小さい設定でも確保するホスト当たりの待機コネクション数。
+// Push/Pull のワーカーに加えて Status やメモ同期が同じクライアントを同時に使うため、並列度ちょうどでは足りない。
+const minIdleConnsPerHost = 16
+
+// clientKey はクライアントを使い回してよい条件。いずれかが変われば別クライアントを作る。
+type clientKey struct {
+	cfg        S3Config
+	credential credentials.Credential
+}
+
+// clientCache は直近の接続設定に対応するクライアントを 1 つだけ保持する。
+// 既定の認証情報は 1 組しか使わないため、設定が変わったら古いクライアントは捨ててよい。
+type clientCache struct {
+	mu          sync.Mutex
+	key         clientKey
+	concurrency int // client のコネクションプールが想定している並列度
+	client      *s3.Client
+	http        *awshttp.BuildableClient
+}
+
+var sharedClients clientCache
+
+// SharedClient は cfg と認証情報が前回と同じなら同じクライアントを返し、異なれば作り直す。
+// クライアントを使い回すことで keep-alive 接続と TLS セッションが操作をまたいで再利用される。
+// concurrency は同時リクエスト数の目安で、保持中のプールより大きいときだけ作り直す
+// （呼び出し元ごとに値が多少ずれていても、小さい側の呼び出しでプールを縮めて往復させないため）。
+// 返すクライアントのリクエストはすべて SetTransferLimits の上限に従う。
+func SharedClient(ctx context.Context, cfg S3Config, credential credentials.Credential, concurrency int) (*s3.Client, error) {
+	return sharedClients.get(ctx, clientKey{cfg: cfg, credential: credential}, concurrency)
+}
+
+// InvalidateSharedClients はキャッシュ済みクライアントを破棄し、待機中のコネクションを閉じる。
+// 接続設定や認証情報を変更したときに呼ぶ（キーが変われば自動で作り直されるが、古い接続と秘密鍵を早く手放すため）。
+func InvalidateSharedClients() {
+	sharedClients.invalidate()
+}
+
+func (c *clientCache) get(ctx context.Context, key clientKey, concurrency int) (*s3.Client, error) {
+	if concurrency <= 0 {
+		concurrency = defaultUploadConcurrency
+	}
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	if c.client != nil && c.key == key && concurrency <= c.concurrency {
+		return c.client, nil
+	}
+	httpClient := newTunedHTTPClient(concurrency)
+	client, err := newClient(ctx, key.cfg, key.credential, budgetedHTTPClient{inner: httpClient})
+	if err != nil {
+		return nil, err
+	}
+	c.closeLocked()
+	c.key, c.concurrency, c.client, c.http = key, concurrency, client, httpClient
+	return client, nil
+}
+
+func (c *clientCache) invalidate() {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	c.closeLocked()
+}
+
+// closeLocked は保持中のクライアントを手放す。実行中のリクエストはそのまま完了し、待機中の接続だけが閉じられる。
+func (c *clientCache) closeLocked() {
+	if c.http != nil {
+		c.http.CloseIdleConnections()
+	}
+	c.key, c.concurrency, c.client, c.http = clientKey{}, 0, nil, nil
+}
+
+// newTunedHTTPClient は並列度に合わせてホスト当たりの待機コネクション数を広げた HTTP クライアントを返す。
+// SDK 既定（ホスト当たり 10）では並列アップロードのたびに接続を張り直してしまう。
+// HTTP/2 は ALPN で対応エンドポイントとだけ合意されるので、非対応の MinIO 等では HTTP/1.1 のまま動く。
+func newTunedHTTPClient(concurrency int) *awshttp.BuildableClient {
+	idlePerHost := concurrency * 2
+	if idlePerHost < minIdleConnsPerHost {
+		idlePerHost = minIdleConnsPerHost
+	}
+	return awshttp.NewBuildableClient().WithTransportOptions(func(tr *http.Transport) {
+		tr.ForceAttemptHTTP2 = true
+		tr.MaxIdleConnsPerHost = idlePerHost
+		if tr.MaxIdleConns < idlePerHost {
+			tr.MaxIdleConns = idlePerHost
+		}
+		tr.IdleConnTimeout = 90 * time.Second
+	})
+}
@@ -0,0 +1,47 @@
+package storage
+
+import (
+	"context"
+	"testing"
+
+	"CloudLaunch_Go/internal/infrastructure/credentials"
+)
+
+func TestClientCacheReusesUntilKeyOrPoolChanges(t *testing.T) {
+	t.Parallel()
+
+	ctx := context.Background()
+	var cache clientCache
+	key := clientKey{
+		cfg:        S3Config{Endpoint: "localhost:9000", Region: "auto", Bucket: "bucket", UseTLS: false},
+		credential: credentials.Credential{AccessKeyID: "id", SecretAccessKey: "secret"},
+	}
+
+	first, err := cache.get(ctx, key, 6)
+	if err != nil {
+		t.Fatalf("get: %v", err)
+	}
+	if again, _ := cache.get(ctx, key, 6); again != first {
+		t.Fatal("same key should reuse the client")
+	}
+	if smaller, _ := cache.get(ctx, key, 2); smaller != first {
+		t.Fatal("smaller concurrency should reuse the larger pool")
+	}
+
+	larger, _ := cache.get(ctx, key, 32)
+	if larger == first {
+		t.Fatal("larger concurrency should rebuild the client")
+	}
+
+	changed := key
+	changed.cfg.UseTLS = true
+	other, _ := cache.get(ctx, changed, 32)
+	if other == larger {
+		t.Fatal("changed config should rebuild the client")
+	}
+
+	cache.invalidate()
+	if rebuilt, _ := cache.get(ctx, changed, 32); rebuilt == other {
+		t.Fatal("invalidate should drop the cached client")
+	}
+}
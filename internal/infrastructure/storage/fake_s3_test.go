@@ -0,0 +1,236 @@
+package storage
+
+import (
+	"bytes"
+	"context"
+	"crypto/md5"
+	"encoding/hex"
+	"encoding/xml"
+	"fmt"
+	"io"
+	"net/http"
+	"net/http/httptest"
+	"sort"
+	"strconv"
+	"strings"
+	"sync"
+	"testing"
+
+	"CloudLaunch_Go/internal/infrastructure/credentials"
+
+	"github.com/aws/aws-sdk-go-v2/service/s3"
+)
+
+const fakeS3Bucket = "bucket"
+
+// fakeS3 はパス形式の S3 API のうち、単発・マルチパートのアップロード、HEAD / GET / DELETE と
+// ListObjectsV2（ページ分割なし）だけを実装したテスト用サーバ。
+type fakeS3 struct {
+	mu       sync.Mutex
+	objects  map[string][]byte
+	uploads  map[string]*fakeS3Upload
+	nextID   int
+	partPuts map[int32]int  // パート番号ごとの UploadPart の成功回数（全アップロード合計）
+	puts     map[string]int // キーごとの単発 PutObject の回数
+	// failPart が 0 以外なら、そのパート番号の UploadPart を1回だけ失敗させる（再試行されないエラー）。
+	failPart int32
+}
+
+type fakeS3Upload struct {
+	key   string
+	parts map[int32][]byte
+}
+
+// newFakeS3Client は fakeS3 を立ち上げ、それを向いたクライアントを返す。サーバはテスト終了時に止める。
+func newFakeS3Client(t *testing.T) (*fakeS3, *s3.Client) {
+	t.Helper()
+	fake := &fakeS3{objects: map[string][]byte{}, uploads: map[string]*fakeS3Upload{}, partPuts: map[int32]int{}, puts: map[string]int{}}
+	server := httptest.NewServer(fake)
+	t.Cleanup(server.Close)
+	client, err := newClient(context.Background(), S3Config{
+		Endpoint:       server.URL,
+		Region:         "auto",
+		Bucket:         fakeS3Bucket,
+		ForcePathStyle: true,
+	}, credentials.Credential{AccessKeyID: "test", SecretAccessKey: "test"}, nil)
+	if err != nil {
+		t.Fatalf("newClient: %v", err)
+	}
+	return fake, client
+}
+
+func (f *fakeS3) object(key string) ([]byte, bool) {
+	f.mu.Lock()
+	defer f.mu.Unlock()
+	data, ok := f.objects[key]
+	return data, ok
+}
+
+func (f *fakeS3) ServeHTTP(w http.ResponseWriter, r *http.Request) {
+	key := strings.TrimPrefix(r.URL.Path, "/"+fakeS3Bucket+"/")
+	query := r.URL.Query()
+	body, err := io.ReadAll(r.Body)
+	if err != nil {
+		http.Error(w, err.Error(), http.StatusBadRequest)
+		return
+	}
+
+	f.mu.Lock()
+	defer f.mu.Unlock()
+	switch {
+	case r.Method == http.MethodPost && query.Has("uploads"):
+		f.nextID++
+		uploadID := fmt.Sprintf("upload-%d", f.nextID)
+		f.uploads[uploadID] = &fakeS3Upload{key: key, parts: map[int32][]byte{}}
+		writeFakeS3XML(w, fmt.Sprintf("<InitiateMultipartUploadResult><Bucket>%s</Bucket><Key>%s</Key><UploadId>%s</UploadId></InitiateMultipartUploadResult>", fakeS3Bucket, key, uploadID))
+	case query.Get("uploadId") != "":
+		f.serveUpload(w, r, key, query.Get("uploadId"), body)
+	case r.Method == http.MethodGet && query.Get("list-type") == "2":
+		f.serveList(w, query.Get("prefix"))
+	case r.Method == http.MethodPut:
+		f.objects[key] = body
+		f.puts[key]++
+		w.Header().Set("ETag", fakeS3ETag(body))
+	case r.Method == http.MethodHead || r.Method == http.MethodGet:
+		data, ok := f.objects[key]
+		if !ok {
+			writeFakeS3Error(w, http.StatusNotFound, "NoSuchKey")
+			return
+		}
+		w.Header().Set("ETag", fakeS3ETag(data))
+		w.Header().Set("Content-Length", strconv.Itoa(len(data)))
+		if r.Method == http.MethodGet {
+			_, _ = w.Write(data)
+		}
+	case r.Method == http.MethodDelete:
+		delete(f.objects, key)
+		w.WriteHeader(http.StatusNoContent)
+	default:
+		writeFakeS3Error(w, http.StatusNotImplemented, "NotImplemented")
+	}
+}
+
+// serveList は prefix に一致するキーを1ページで返す。f.mu を保持して呼ぶ。
+func (f *fakeS3) serveList(w http.ResponseWriter, prefix string) {
+	keys := make([]string, 0, len(f.objects))
+	for key := range f.objects {
+		if strings.HasPrefix(key, prefix) {
+			keys = append(keys, key)
+		}
+	}
+	sort.Strings(keys)
+	var contents strings.Builder
+	for _, key := range keys {
+		data := f.objects[key]
+		fmt.Fprintf(&contents, "<Contents><Key>%s</Key><Size>%d</Size><ETag>%s</ETag><LastModified>2026-01-01T00:00:00.000Z</LastModified></Contents>", xmlEscape(key), len(data), xmlEscape(fakeS3ETag(data)))
+	}
+	writeFakeS3XML(w, fmt.Sprintf("<ListBucketResult><Name>%s</Name><Prefix>%s</Prefix><KeyCount>%d</KeyCount><MaxKeys>1000</MaxKeys><IsTruncated>false</IsTruncated>%s</ListBucketResult>", fakeS3Bucket, xmlEscape(prefix), len(keys), contents.String()))
+}
+
+// putCount は key への単発 PutObject の回数を返す。
+func (f *fakeS3) putCount(key string) int {
+	f.mu.Lock()
+	defer f.mu.Unlock()
+	return f.puts[key]
+}
+
+// keysWithPrefix は prefix で始まるキーの数を返す。
+func (f *fakeS3) keysWithPrefix(prefix string) int {
+	f.mu.Lock()
+	defer f.mu.Unlock()
+	count := 0
+	for key := range f.objects {
+		if strings.HasPrefix(key, prefix) {
+			count++
+		}
+	}
+	return count
+}
+
+// serveUpload は UploadPart / ListParts / CompleteMultipartUpload / AbortMultipartUpload を扱う。f.mu を保持して呼ぶ。
+func (f *fakeS3) serveUpload(w http.ResponseWriter, r *http.Request, key, uploadID string, body []byte) {
+	upload, ok := f.uploads[uploadID]
+	if !ok || upload.key != key {
+		writeFakeS3Error(w, http.StatusNotFound, "NoSuchUpload")
+		return
+	}
+	switch r.Method {
+	case http.MethodPut:
+		number, err := strconv.Atoi(r.URL.Query().Get("partNumber"))
+		if err != nil {
+			writeFakeS3Error(w, http.StatusBadRequest, "InvalidArgument")
+			return
+		}
+		partNumber := int32(number)
+		if partNumber == f.failPart {
+			f.failPart = 0
+			writeFakeS3Error(w, http.StatusBadRequest, "InvalidRequest")
+			return
+		}
+		upload.parts[partNumber] = body
+		f.partPuts[partNumber]++
+		w.Header().Set("ETag", fakeS3ETag(body))
+	case http.MethodGet:
+		numbers := make([]int, 0, len(upload.parts))
+		for number := range upload.parts {
+			numbers = append(numbers, int(number))
+		}
+		sort.Ints(numbers)
+		var parts strings.Builder
+		for _, number := range numbers {
+			data := upload.parts[int32(number)]
+			fmt.Fprintf(&parts, "<Part><PartNumber>%d</PartNumber><ETag>%s</ETag><Size>%d</Size></Part>", number, xmlEscape(fakeS3ETag(data)), len(data))
+		}
+		writeFakeS3XML(w, fmt.Sprintf("<ListPartsResult><Bucket>%s</Bucket><Key>%s</Key><UploadId>%s</UploadId><IsTruncated>false</IsTruncated>%s</ListPartsResult>", fakeS3Bucket, key, uploadID, parts.String()))
+	case http.MethodPost:
+		var request struct {
+			Parts []struct {
+				PartNumber int32  `xml:"PartNumber"`
+				ETag       string `xml:"ETag"`
+			} `xml:"Part"`
+		}
+		if err := xml.Unmarshal(body, &request); err != nil {
+			writeFakeS3Error(w, http.StatusBadRequest, "MalformedXML")
+			return
+		}
+		var assembled bytes.Buffer
+		for _, part := range request.Parts {
+			data, ok := upload.parts[part.PartNumber]
+			if !ok || fakeS3ETag(data) != part.ETag {
+				writeFakeS3Error(w, http.StatusBadRequest, "InvalidPart")
+				return
+			}
+			assembled.Write(data)
+		}
+		f.objects[key] = assembled.Bytes()
+		delete(f.uploads, uploadID)
+		writeFakeS3XML(w, fmt.Sprintf("<CompleteMultipartUploadResult><Bucket>%s</Bucket><Key>%s</Key><ETag>%s</ETag></CompleteMultipartUploadResult>", fakeS3Bucket, key, xmlEscape(fakeS3ETag(assembled.Bytes()))))
+	case http.MethodDelete:
+		delete(f.uploads, uploadID)
+		w.WriteHeader(http.StatusNoContent)
+	default:
+		writeFakeS3Error(w, http.StatusNotImplemented, "NotImplemented")
+	}
+}
+
+func fakeS3ETag(data []byte) string {
+	sum := md5.Sum(data)
+	return `"` + hex.EncodeToString(sum[:]) + `"`
+}
+
+func xmlEscape(value string) string {
+	var escaped strings.Builder
+	_ = xml.EscapeText(&escaped, []byte(value))
+	return escaped.String()
+}
+
+func writeFakeS3XML(w http.ResponseWriter, body string) {
+	w.Header().Set("Content-Type", "application/xml")
+	_, _ = io.WriteString(w, `<?xml version="1.0" encoding="UTF-8"?>`+body)
+}
+
+func writeFakeS3Error(w http.ResponseWriter, status int, code string) {
+	w.Header().Set("Content-Type", "application/xml")
+	w.WriteHeader(status)
+	_, _ = fmt.Fprintf(w, `<?xml version="1.0" encoding="UTF-8"?><Error><Code>%s</Code><Message>%s</Message></Error>`, code, code)
+}
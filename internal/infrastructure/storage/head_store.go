@@ -1,9 +1,10 @@
-// ゲームごとのリモートHEADの読み書きを提供する。
+// ゲームごとのリモートHEADと、GC 実行中を示すリースの読み書きを提供する。
 package storage
 
 import (
 	"context"
 	"fmt"
+	"io"
 	"strings"
 
 	"github.com/aws/aws-sdk-go-v2/service/s3"
@@ -13,6 +14,10 @@ func headKey(gameID string) string {
 	return fmt.Sprintf("games/%s/HEAD", gameID)
 }
 
+func gcLeaseKey(gameID string) string {
+	return fmt.Sprintf("games/%s/GC-LEASE", gameID)
+}
+
 // WriteHEAD はリモートHEADをS3に書き込む。
 func WriteHEAD(ctx context.Context, client *s3.Client, bucket, gameID, hash string) error {
 	return UploadBytes(ctx, client, bucket, headKey(gameID), []byte(hash), "text/plain")
@@ -29,3 +34,75 @@ func ReadHEAD(ctx context.Context, client *s3.Client, bucket, gameID string) (st
 	}
 	return strings.TrimSpace(string(data)), nil
 }
+
+// ReadHEADWithETag は ReadHEAD と同じ値と、WriteHEADIfMatch に渡す ETag を返す。存在しない場合は ("", "", nil)。
+func ReadHEADWithETag(ctx context.Context, client *s3.Client, bucket, gameID string) (string, string, error) {
+	data, etag, err := ReadObjectWithETag(ctx, client, bucket, headKey(gameID))
+	if err != nil {
+		return "", "", err
+	}
+	return strings.TrimSpace(string(data)), etag, nil
+}
+
+// WriteHEADIfMatch は HEAD の ETag が etag のままの場合だけ hash を書き込む。競合時は ErrPreconditionFailed を返す。
+func WriteHEADIfMatch(ctx context.Context, client *s3.Client, bucket, gameID, hash, etag string) error {
+	return PutObjectIfMatch(ctx, client, bucket, headKey(gameID), []byte(hash), "text/plain", etag)
+}
+
+// ReadGCLease は GC のリース（games/<gameID>/GC-LEASE）の本文と ETag を返す。無ければ (nil, "", nil)。
+func ReadGCLease(ctx context.Context, client *s3.Client, bucket, gameID string) ([]byte, string, error) {
+	return ReadObjectWithETag(ctx, client, bucket, gcLeaseKey(gameID))
+}
+
+// WriteGCLease は GC のリースを書き込む。etag が空でなければ ETag が一致する場合だけ、
+// 空なら未作成の場合だけ書き込み、競合時は ErrPreconditionFailed を返す。
+func WriteGCLease(ctx context.Context, client *s3.Client, bucket, gameID string, data []byte, etag string) error {
+	return PutObjectIfMatch(ctx, client, bucket, gcLeaseKey(gameID), data, "application/json", etag)
+}
+
+// PutGCLease は取得済みの GC のリースを無条件に書き換える（延長・終了の記録）。
+func PutGCLease(ctx context.Context, client *s3.Client, bucket, gameID string, data []byte) error {
+	return UploadBytes(ctx, client, bucket, gcLeaseKey(gameID), data, "application/json")
+}
+
+// ReadHEADCached は ReadHEAD と同じ値を返すが、cache に前回の ETag があれば If-None-Match を付けて読み、
+// 変わっていなければ（304）本文を受け取らずに前回の値を返す。
+func ReadHEADCached(ctx context.Context, client *s3.Client, bucket, gameID string, cache *BlobCache) (hash string, err error) {
+	if cache == nil {
+		return ReadHEAD(ctx, client, bucket, gameID)
+	}
+	key := headKey(gameID)
+	input := &s3.GetObjectInput{
+		Bucket: &bucket,
+		Key:    &key,
+	}
+	previous, cached := cache.cachedHEAD(bucket, gameID)
+	if cached {
+		input.IfNoneMatch = stringPtr(previous.etag)
+	}
+	response, err := client.GetObject(ctx, input)
+	if err != nil {
+		if cached && isNotModifiedError(err) {
+			return previous.hash, nil
+		}
+		cache.ForgetHEAD(bucket, gameID)
+		if IsNotFoundError(err) {
+			return "", nil
+		}
+		return "", err
+	}
+	defer func() {
+		if closeErr := response.Body.Close(); closeErr != nil && err == nil {
+			err = closeErr
+		}
+	}()
+	data, err := io.ReadAll(response.Body)
+	if err != nil {
+		return "", err
+	}
+	hash = strings.TrimSpace(string(data))
+	if response.ETag != nil {
+		cache.rememberHEAD(bucket, gameID, hash, *response.ETag)
+	}
+	return hash, nil
+}
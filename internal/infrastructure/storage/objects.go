@@ -7,15 +7,22 @@ import (
 	"io"
 	"strings"
 
+	"github.com/aws/aws-sdk-go-v2/aws"
 	"github.com/aws/aws-sdk-go-v2/service/s3"
 	s3types "github.com/aws/aws-sdk-go-v2/service/s3/types"
 )
 
-// ObjectInfo はS3オブジェクト情報を表す。
+// ObjectInfo はS3オブジェクト情報を表す。ETag は引用符を除いた値。
 type ObjectInfo struct {
 	Key          string
 	Size         int64
 	LastModified int64
+	ETag         string
+}
+
+// normalizeETag は ETag を囲む引用符を取り除く（一覧と PutObject の応答で表記を揃えるため）。
+func normalizeETag(etag string) string {
+	return strings.Trim(etag, `"`)
 }
 
 // ListObjects は指定プレフィックス配下のオブジェクトを取得する。
@@ -50,6 +57,7 @@ func ListObjects(ctx context.Context, client *s3.Client, bucket string, prefix s
 				Key:          *obj.Key,
 				Size:         size,
 				LastModified: lastModified,
+				ETag:         normalizeETag(aws.ToString(obj.ETag)),
 			})
 		}
 	}
@@ -57,25 +65,59 @@ func ListObjects(ctx context.Context, client *s3.Client, bucket string, prefix s
 	return objects, nil
 }
 
+// ListChildPrefixes は prefix 直下の「ディレクトリ」名（区切り文字 / までの部分）を返す。
+// 配下のオブジェクトを全件列挙せず、CommonPrefixes だけを読むため件数がゲーム数で済む。
+func ListChildPrefixes(ctx context.Context, client *s3.Client, bucket, prefix string) ([]string, error) {
+	delimiter := "/"
+	input := &s3.ListObjectsV2Input{
+		Bucket:    &bucket,
+		Prefix:    &prefix,
+		Delimiter: &delimiter,
+	}
+	var names []string
+	paginator := s3.NewListObjectsV2Paginator(client, input)
+	for paginator.HasMorePages() {
+		page, err := paginator.NextPage(ctx)
+		if err != nil {
+			return nil, err
+		}
+		for _, common := range page.CommonPrefixes {
+			if common.Prefix == nil {
+				continue
+			}
+			name := strings.TrimSuffix(strings.TrimPrefix(*common.Prefix, prefix), "/")
+			if name != "" {
+				names = append(names, name)
+			}
+		}
+	}
+	return names, nil
+}
+
 // DeleteObjectsByPrefix は指定プレフィックス配下のオブジェクトを削除する。
 func DeleteObjectsByPrefix(ctx context.Context, client *s3.Client, bucket string, prefix string) error {
 	objects, err := ListObjects(ctx, client, bucket, prefix)
 	if err != nil {
 		return err
 	}
-	if len(objects) == 0 {
-		return nil
+	keys := make([]string, 0, len(objects))
+	for _, obj := range objects {
+		keys = append(keys, obj.Key)
 	}
+	return DeleteObjectKeys(ctx, client, bucket, keys)
+}
 
+// DeleteObjectKeys は keys のオブジェクトを DeleteObjects の上限（1000 件）ごとにまとめて削除する。
+func DeleteObjectKeys(ctx context.Context, client *s3.Client, bucket string, keys []string) error {
 	const maxBatch = 1000
-	for start := 0; start < len(objects); start += maxBatch {
+	for start := 0; start < len(keys); start += maxBatch {
 		end := start + maxBatch
-		if end > len(objects) {
-			end = len(objects)
+		if end > len(keys) {
+			end = len(keys)
 		}
 		batch := make([]s3types.ObjectIdentifier, 0, end-start)
-		for _, obj := range objects[start:end] {
-			batch = append(batch, s3types.ObjectIdentifier{Key: &obj.Key})
+		for i := range keys[start:end] {
+			batch = append(batch, s3types.ObjectIdentifier{Key: &keys[start+i]})
 		}
 		output, error := client.DeleteObjects(ctx, &s3.DeleteObjectsInput{
 			Bucket: &bucket,
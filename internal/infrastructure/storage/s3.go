@@ -23,17 +23,26 @@ type S3Config struct {
 	UseTLS         bool
 }
 
-// NewClient は S3Config と認証情報からクライアントを生成する。
+// NewClient は S3Config と認証情報から使い捨てのクライアントを生成する。
+// 保存前の認証情報の検証など、キャッシュに残したくない用途向け。通常の操作は SharedClient を使う。
 func NewClient(ctx context.Context, cfg S3Config, credential credentials.Credential) (*s3.Client, error) {
-	awsCfg, error := awsconfig.LoadDefaultConfig(
-		ctx,
+	return newClient(ctx, cfg, credential, nil)
+}
+
+// newClient は httpClient（nil なら SDK 既定）を使うクライアントを生成する。
+func newClient(ctx context.Context, cfg S3Config, credential credentials.Credential, httpClient awsconfig.HTTPClient) (*s3.Client, error) {
+	loadOptions := []func(*awsconfig.LoadOptions) error{
 		awsconfig.WithRegion(cfg.Region),
 		awsconfig.WithCredentialsProvider(awscreds.NewStaticCredentialsProvider(
 			credential.AccessKeyID,
 			credential.SecretAccessKey,
 			"",
 		)),
-	)
+	}
+	if httpClient != nil {
+		loadOptions = append(loadOptions, awsconfig.WithHTTPClient(httpClient))
+	}
+	awsCfg, error := awsconfig.LoadDefaultConfig(ctx, loadOptions...)
 	if error != nil {
 		return nil, error
 	}
@@ -0,0 +1,178 @@
+// 共有クライアント経由の全 S3 リクエストに掛ける同時実行数と帯域の上限（転送予算）を提供する。
+package storage
+
+import (
+	"context"
+	"io"
+	"net/http"
+	"sync"
+	"sync/atomic"
+	"time"
+)
+
+const (
+	// defaultMaxTransferRequests は SetTransferLimits が呼ばれる前の同時リクエスト数の上限。
+	defaultMaxTransferRequests = 16
+	// rateBurst は帯域制限で溜めておける送受信の猶予。短い停止の後に一気に送れる量を抑える。
+	rateBurst = 250 * time.Millisecond
+	// rateChunk は帯域制限時に1回の Read / Write で扱う最大バイト数。待ち時間を細かく刻むため。
+	rateChunk = 32 << 10
+)
+
+// httpDoer は SDK に渡す HTTP クライアントの最小インターフェース（awsconfig.HTTPClient と同じ形）。
+type httpDoer interface {
+	Do(*http.Request) (*http.Response, error)
+}
+
+// transferBudget はある時点の上限設定。SetTransferLimits のたびに作り直し、
+// 実行中のリクエストは取得したときの予算に返却する（切り替え直後だけ一時的に上限を超えうる）。
+type transferBudget struct {
+	slots    chan struct{}
+	upload   *rateLimiter // nil なら無制限
+	download *rateLimiter // nil なら無制限
+}
+
+var currentTransferBudget atomic.Pointer[transferBudget]
+
+func init() {
+	SetTransferLimits(defaultMaxTransferRequests, 0)
+}
+
+// SetTransferLimits は同時に送る S3 リクエスト数の上限と、送信・受信それぞれの帯域上限（バイト/秒、0 以下で無制限）を設定する。
+// Push / Pull のワーカー、一覧のファンアウト、メモやスクリーンショットの同期など、SharedClient を使う全操作で共有される。
+// 各操作の並列度はそのままでも、同時に走ったときの接続数と上り帯域はここで頭打ちになる。
+func SetTransferLimits(maxRequests int, bytesPerSecond int64) {
+	if maxRequests <= 0 {
+		maxRequests = defaultMaxTransferRequests
+	}
+	budget := &transferBudget{slots: make(chan struct{}, maxRequests)}
+	if bytesPerSecond > 0 {
+		budget.upload = newRateLimiter(bytesPerSecond)
+		budget.download = newRateLimiter(bytesPerSecond)
+	}
+	currentTransferBudget.Store(budget)
+}
+
+// budgetedHTTPClient は転送予算の枠を取ってからリクエストを送り、レスポンス本文を閉じたときに枠を返す。
+type budgetedHTTPClient struct {
+	inner httpDoer
+}
+
+func (c budgetedHTTPClient) Do(req *http.Request) (*http.Response, error) {
+	budget := currentTransferBudget.Load()
+	ctx := req.Context()
+	select {
+	case budget.slots <- struct{}{}:
+	case <-ctx.Done():
+		return nil, ctx.Err()
+	}
+	var once sync.Once
+	release := func() { once.Do(func() { <-budget.slots }) }
+	stats := transferStatsFrom(ctx)
+	if stats != nil {
+		stats.addRequest(isRetryAttempt(req.Header.Get("amz-sdk-request")), req.ContentLength)
+	}
+
+	if budget.upload != nil && req.Body != nil && req.Body != http.NoBody {
+		// 呼び出し側の Request を書き換えないよう浅いコピーに差し替える
+		req = req.WithContext(ctx)
+		req.Body = &throttledBody{ReadCloser: req.Body, ctx: ctx, limiter: budget.upload}
+	}
+	resp, err := c.inner.Do(req)
+	if err != nil {
+		release()
+		return nil, err
+	}
+	if resp.Body == nil || resp.Body == http.NoBody {
+		release()
+		return resp, nil
+	}
+	resp.Body = &budgetedBody{throttledBody: throttledBody{ReadCloser: resp.Body, ctx: ctx, limiter: budget.download}, release: release, stats: stats}
+	return resp, nil
+}
+
+// throttledBody は limiter が非 nil なら読んだバイト数だけ帯域の枠を消費する。
+type throttledBody struct {
+	io.ReadCloser
+	ctx     context.Context
+	limiter *rateLimiter
+}
+
+func (b *throttledBody) Read(p []byte) (int, error) {
+	if b.limiter == nil {
+		return b.ReadCloser.Read(p)
+	}
+	if len(p) > rateChunk {
+		p = p[:rateChunk]
+	}
+	n, err := b.ReadCloser.Read(p)
+	if n > 0 {
+		if waitErr := b.limiter.wait(b.ctx, n); waitErr != nil && err == nil {
+			err = waitErr
+		}
+	}
+	return n, err
+}
+
+// budgetedBody はレスポンス本文。読み切るか閉じた時点で同時リクエストの枠を返す。
+// stats（nil 可）には読んだバイト数を加算する。
+type budgetedBody struct {
+	throttledBody
+	release func()
+	stats   *TransferStats
+}
+
+func (b *budgetedBody) Read(p []byte) (int, error) {
+	n, err := b.throttledBody.Read(p)
+	if n > 0 && b.stats != nil {
+		b.stats.addReceived(n)
+	}
+	if err == io.EOF {
+		b.release()
+	}
+	return n, err
+}
+
+func (b *budgetedBody) Close() error {
+	defer b.release()
+	return b.ReadCloser.Close()
+}
+
+// rateLimiter は毎秒 rate バイトに均すトークンバケット。next は「ここまでの消費を均した場合に空く時刻」。
+type rateLimiter struct {
+	rate int64
+
+	mu   sync.Mutex
+	next time.Time
+}
+
+func newRateLimiter(bytesPerSecond int64) *rateLimiter {
+	return &rateLimiter{rate: bytesPerSecond}
+}
+
+// reserve は n バイト分の枠を予約し、待つべき時間を返す。rateBurst より前の空きは繰り越さない。
+func (l *rateLimiter) reserve(now time.Time, n int) time.Duration {
+	l.mu.Lock()
+	defer l.mu.Unlock()
+	start := l.next
+	if floor := now.Add(-rateBurst); start.Before(floor) {
+		start = floor
+	}
+	l.next = start.Add(time.Duration(int64(n) * int64(time.Second) / l.rate))
+	return l.next.Sub(now)
+}
+
+func (l *rateLimiter) wait(ctx context.Context, n int) error {
+	delay := l.reserve(time.Now(), n)
+	if delay <= 0 {
+		return nil
+	}
+	timer := time.NewTimer(delay)
+	defer timer.Stop()
+	select {
+	case <-timer.C:
+		return nil
+	case <-ctx.Done():
+		return ctx.Err()
+	}
+}
@@ -0,0 +1,124 @@
+package storage
+
+import (
+	"context"
+	"io"
+	"net/http"
+	"strings"
+	"sync"
+	"sync/atomic"
+	"testing"
+	"time"
+)
+
+// blockingDoer は release が閉じられるまで応答を返さず、同時に処理中のリクエスト数の最大値を記録する。
+type blockingDoer struct {
+	inFlight atomic.Int32
+	peak     atomic.Int32
+	release  chan struct{}
+}
+
+func (d *blockingDoer) Do(req *http.Request) (*http.Response, error) {
+	current := d.inFlight.Add(1)
+	for {
+		peak := d.peak.Load()
+		if current <= peak || d.peak.CompareAndSwap(peak, current) {
+			break
+		}
+	}
+	<-d.release
+	d.inFlight.Add(-1)
+	return &http.Response{StatusCode: http.StatusOK, Body: io.NopCloser(strings.NewReader("ok"))}, nil
+}
+
+func TestBudgetedHTTPClientCapsConcurrentRequests(t *testing.T) {
+	SetTransferLimits(2, 0)
+	defer SetTransferLimits(defaultMaxTransferRequests, 0)
+
+	doer := &blockingDoer{release: make(chan struct{})}
+	client := budgetedHTTPClient{inner: doer}
+	var wg sync.WaitGroup
+	for i := 0; i < 5; i++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			req, _ := http.NewRequest(http.MethodGet, "http://example.invalid/", nil)
+			resp, err := client.Do(req)
+			if err != nil {
+				t.Errorf("Do: %v", err)
+				return
+			}
+			_, _ = io.ReadAll(resp.Body)
+			_ = resp.Body.Close()
+		}()
+	}
+	time.Sleep(50 * time.Millisecond)
+	if got := doer.inFlight.Load(); got != 2 {
+		t.Fatalf("in-flight requests = %d, want 2", got)
+	}
+	close(doer.release)
+	wg.Wait()
+	if got := doer.peak.Load(); got != 2 {
+		t.Fatalf("peak in-flight requests = %d, want 2", got)
+	}
+	if got := len(currentTransferBudget.Load().slots); got != 0 {
+		t.Fatalf("slots still held after bodies were closed: %d", got)
+	}
+}
+
+func TestRateLimiterPacesBytesAndCapsBurst(t *testing.T) {
+	t.Parallel()
+
+	limiter := newRateLimiter(1000)
+	now := time.Unix(1000, 0)
+	// 初回は rateBurst 分の猶予があるので、その範囲内なら待たない
+	if delay := limiter.reserve(now, 250); delay > 0 {
+		t.Fatalf("first reservation within burst waited %v", delay)
+	}
+	if delay := limiter.reserve(now, 500); delay != 500*time.Millisecond {
+		t.Fatalf("second reservation delay = %v, want 500ms", delay)
+	}
+	// 長く空いても rateBurst より前の空きは繰り越さない
+	later := now.Add(time.Minute)
+	if delay := limiter.reserve(later, 1000); delay != 750*time.Millisecond {
+		t.Fatalf("reservation after idle delay = %v, want 750ms", delay)
+	}
+}
+
+type echoDoer struct{}
+
+func (echoDoer) Do(req *http.Request) (*http.Response, error) {
+	return &http.Response{StatusCode: http.StatusOK, Body: io.NopCloser(strings.NewReader("hello"))}, nil
+}
+
+// TestBudgetedHTTPClientRecordsTransferStats は、ctx の集計先と親の両方にリクエスト数・再試行・転送量が足されることを確認する。
+func TestBudgetedHTTPClientRecordsTransferStats(t *testing.T) {
+	parent := &TransferStats{}
+	child := &TransferStats{}
+	ctx := WithTransferStats(WithTransferStats(context.Background(), parent), child)
+	client := budgetedHTTPClient{inner: echoDoer{}}
+
+	for attempt, header := range []string{"attempt=1; max=3", "attempt=2; max=3"} {
+		req, err := http.NewRequestWithContext(ctx, http.MethodPut, "http://example.invalid/key", strings.NewReader("payload"))
+		if err != nil {
+			t.Fatalf("NewRequest: %v", err)
+		}
+		req.Header.Set("amz-sdk-request", header)
+		resp, err := client.Do(req)
+		if err != nil {
+			t.Fatalf("Do attempt %d: %v", attempt, err)
+		}
+		if _, err := io.ReadAll(resp.Body); err != nil {
+			t.Fatalf("read body: %v", err)
+		}
+		resp.Body.Close()
+	}
+
+	want := TransferCounts{Requests: 2, Retries: 1, BytesSent: 14, BytesReceived: 10}
+	if got := child.Counts(); got != want {
+		t.Fatalf("child counts = %+v, want %+v", got, want)
+	}
+	if got := parent.Counts(); got != want {
+		t.Fatalf("parent counts = %+v, want %+v", got, want)
+	}
+}
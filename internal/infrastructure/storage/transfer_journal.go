@@ -0,0 +1,151 @@
+// 中断した Push / Pull を再開するための転送記録のフックと、未完了マルチパートアップロードの後始末を提供する。
+package storage
+
+import (
+	"context"
+	"crypto/md5"
+	"encoding/hex"
+	"errors"
+	"io"
+	"strings"
+	"time"
+
+	"github.com/aws/aws-sdk-go-v2/aws"
+	"github.com/aws/aws-sdk-go-v2/service/s3"
+	s3types "github.com/aws/aws-sdk-go-v2/service/s3/types"
+	"github.com/aws/smithy-go"
+)
+
+// TransferJournal は転送の進み具合を永続化する記録先。PutBlobs / DownloadBlobs のワーカーから並行に呼ばれるため、
+// 実装は並行安全であること。記録は再開の近道にしか使わないので、書き込みに失敗しても転送自体は続けてよい。
+type TransferJournal interface {
+	// BlobUploaded は kind/hash のブロブがリモートに揃ったこと（送信完了、または既に存在）を記録する。
+	BlobUploaded(kind, hash string)
+	// FileDownloaded は targetPath にハッシュ hash の内容を書き終えたことを記録する。
+	FileDownloaded(targetPath, hash string)
+	// MultipartUploadID は key に対する再開可能なマルチパートアップロード ID を返す（size が異なる・無いなら ""）。
+	MultipartUploadID(key string, size int64) string
+	// MultipartStarted は key のマルチパートアップロードを開始したことを記録する。
+	MultipartStarted(key, uploadID string, size int64)
+	// MultipartFinished は key のマルチパートアップロードが完了・破棄されたことを記録する。
+	MultipartFinished(key string)
+}
+
+// nopTransferJournal は記録しない TransferJournal。中断したマルチパートは従来どおりその場で破棄する。
+type nopTransferJournal struct{}
+
+func (nopTransferJournal) BlobUploaded(string, string)            {}
+func (nopTransferJournal) FileDownloaded(string, string)          {}
+func (nopTransferJournal) MultipartUploadID(string, int64) string { return "" }
+func (nopTransferJournal) MultipartStarted(string, string, int64) {}
+func (nopTransferJournal) MultipartFinished(string)               {}
+
+func journalOrNop(journal TransferJournal) TransferJournal {
+	if journal == nil {
+		return nopTransferJournal{}
+	}
+	return journal
+}
+
+func isResumableJournal(journal TransferJournal) bool {
+	_, nop := journal.(nopTransferJournal)
+	return !nop
+}
+
+// uploadedPart はリモートに残っている1パート。
+type uploadedPart struct {
+	etag string
+	size int64
+}
+
+// listUploadedParts は未完了マルチパートアップロードの送信済みパートを返す（パート番号 → パート）。
+func listUploadedParts(ctx context.Context, client *s3.Client, bucket, key, uploadID string) (map[int32]uploadedPart, error) {
+	parts := make(map[int32]uploadedPart)
+	paginator := s3.NewListPartsPaginator(client, &s3.ListPartsInput{
+		Bucket:   &bucket,
+		Key:      &key,
+		UploadId: &uploadID,
+	})
+	for paginator.HasMorePages() {
+		page, err := paginator.NextPage(ctx)
+		if err != nil {
+			return nil, err
+		}
+		for _, part := range page.Parts {
+			parts[aws.ToInt32(part.PartNumber)] = uploadedPart{etag: aws.ToString(part.ETag), size: aws.ToInt64(part.Size)}
+		}
+	}
+	return parts, nil
+}
+
+// partMatches はリモートのパートが file の [offset, offset+length) と同じ内容かを返す。
+// パートの ETag は（SSE-KMS 等を使わない限り）内容の MD5 なので、ローカルの同じ範囲の MD5 と突き合わせる。
+// 前回の送信中にファイルが書き換わっていた場合に、ハッシュと食い違うオブジェクトを組み立てないための確認。
+// ETag が MD5 形式でないストレージでは再利用せず送り直す。
+func partMatches(file io.ReaderAt, offset, length int64, part uploadedPart) bool {
+	etag := strings.Trim(part.etag, `"`)
+	if part.size != length || len(etag) != md5.Size*2 {
+		return false
+	}
+	sum := md5.New()
+	if _, err := io.Copy(sum, io.NewSectionReader(file, offset, length)); err != nil {
+		return false
+	}
+	return hex.EncodeToString(sum.Sum(nil)) == strings.ToLower(etag)
+}
+
+// AbortMultipartUpload は未完了のマルチパートアップロードを破棄する。既に無い場合もエラーにしない。
+func AbortMultipartUpload(ctx context.Context, client *s3.Client, bucket, key, uploadID string) error {
+	_, err := client.AbortMultipartUpload(ctx, &s3.AbortMultipartUploadInput{
+		Bucket:   &bucket,
+		Key:      &key,
+		UploadId: &uploadID,
+	})
+	if isNoSuchUploadError(err) {
+		return nil
+	}
+	return err
+}
+
+// isNoSuchUploadError はマルチパートアップロードが既に完了・破棄されていることを表すエラーかを判定する。
+func isNoSuchUploadError(err error) bool {
+	if err == nil {
+		return false
+	}
+	var apiErr smithy.APIError
+	if errors.As(err, &apiErr) && apiErr.ErrorCode() == "NoSuchUpload" {
+		return true
+	}
+	var noSuchUpload *s3types.NoSuchUpload
+	return errors.As(err, &noSuchUpload)
+}
+
+// AbortStaleMultipartUploads は prefix 配下で before より前に開始された未完了マルチパートアップロードを破棄し、件数を返す。
+// 中断した Push の再開待ちや強制終了で残った断片は ListObjects に出ないまま課金され続けるため、起動時に掃除する。
+func AbortStaleMultipartUploads(ctx context.Context, client *s3.Client, bucket, prefix string, before time.Time) (int, error) {
+	input := &s3.ListMultipartUploadsInput{
+		Bucket: &bucket,
+		Prefix: &prefix,
+	}
+	aborted := 0
+	for {
+		page, err := client.ListMultipartUploads(ctx, input)
+		if err != nil {
+			return aborted, err
+		}
+		for _, upload := range page.Uploads {
+			if upload.Key == nil || upload.UploadId == nil || upload.Initiated == nil || !upload.Initiated.Before(before) {
+				continue
+			}
+			if err := AbortMultipartUpload(ctx, client, bucket, *upload.Key, *upload.UploadId); err != nil {
+				return aborted, err
+			}
+			aborted++
+		}
+		if !aws.ToBool(page.IsTruncated) {
+			return aborted, nil
+		}
+		input.KeyMarker = page.NextKeyMarker
+		input.UploadIdMarker = page.NextUploadIdMarker
+	}
+}
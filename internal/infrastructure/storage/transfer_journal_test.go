@@ -0,0 +1,135 @@
+package storage
+
+import (
+	"bytes"
+	"context"
+	"crypto/md5"
+	"encoding/hex"
+	"os"
+	"path/filepath"
+	"sync"
+	"testing"
+)
+
+// TestPartMatchesComparesMD5OfRange は、送信済みパートの ETag（MD5）が同じ範囲のローカル内容と一致するときだけ再利用することを確認する。
+func TestPartMatchesComparesMD5OfRange(t *testing.T) {
+	t.Parallel()
+
+	data := []byte("0123456789abcdefghij")
+	sum := md5.Sum(data[5:15])
+	etag := `"` + hex.EncodeToString(sum[:]) + `"`
+	file := bytes.NewReader(data)
+
+	if !partMatches(file, 5, 10, uploadedPart{etag: etag, size: 10}) {
+		t.Fatal("identical range should match")
+	}
+	if partMatches(file, 6, 10, uploadedPart{etag: etag, size: 10}) {
+		t.Fatal("shifted range should not match")
+	}
+	if partMatches(file, 5, 9, uploadedPart{etag: etag, size: 10}) {
+		t.Fatal("size mismatch should not match")
+	}
+	// SSE-KMS 等で MD5 でない ETag は信用しない
+	if partMatches(file, 5, 10, uploadedPart{etag: `"` + hex.EncodeToString(sum[:]) + `-2"`, size: 10}) {
+		t.Fatal("non-MD5 etag should not match")
+	}
+}
+
+// memTransferJournal はマルチパートの開始・完了だけをメモリに控える TransferJournal。
+type memTransferJournal struct {
+	nopTransferJournal
+	mu      sync.Mutex
+	uploads map[string]memMultipart
+}
+
+type memMultipart struct {
+	uploadID string
+	size     int64
+}
+
+func (j *memTransferJournal) MultipartUploadID(key string, size int64) string {
+	j.mu.Lock()
+	defer j.mu.Unlock()
+	if upload, ok := j.uploads[key]; ok && upload.size == size {
+		return upload.uploadID
+	}
+	return ""
+}
+
+func (j *memTransferJournal) MultipartStarted(key, uploadID string, size int64) {
+	j.mu.Lock()
+	defer j.mu.Unlock()
+	if j.uploads == nil {
+		j.uploads = map[string]memMultipart{}
+	}
+	j.uploads[key] = memMultipart{uploadID: uploadID, size: size}
+}
+
+func (j *memTransferJournal) MultipartFinished(key string) {
+	j.mu.Lock()
+	defer j.mu.Unlock()
+	delete(j.uploads, key)
+}
+
+// TestPutBlobSourceResumesMultipartUpload は、チャンク分割されない大きさのセーブファイルが putBlobSource から
+// マルチパートで送られ、途中で失敗しても転送記録から送信済みパートを再利用して続きだけを送ることを確認する。
+func TestPutBlobSourceResumesMultipartUpload(t *testing.T) {
+	if testing.Short() {
+		t.Skip("uploads a multipart-sized file")
+	}
+	t.Parallel()
+
+	size := int64(multipartThreshold + multipartPartSize + 1) // 3 パート
+	if size >= ChunkedFileThreshold {
+		t.Fatalf("test file (%d bytes) would be chunked instead of uploaded as one blob", size)
+	}
+	data := make([]byte, size)
+	for i := range data {
+		data[i] = byte(i * 7)
+	}
+	filePath := filepath.Join(t.TempDir(), "large.sav")
+	if err := os.WriteFile(filePath, data, 0o600); err != nil {
+		t.Fatal(err)
+	}
+	info, err := os.Stat(filePath)
+	if err != nil {
+		t.Fatal(err)
+	}
+	source := BlobSource{Path: filePath, Size: info.Size(), ModTime: info.ModTime()}
+	hash := blobHashBytes(data)
+	key := blobKey("game", BlobKindObject, hash)
+
+	fake, client := newFakeS3Client(t)
+	fake.failPart = 2
+	journal := &memTransferJournal{}
+	ctx := context.Background()
+
+	if err := putBlobSource(ctx, client, fakeS3Bucket, "game", hash, source, false, journal); err == nil {
+		t.Fatal("expected the first upload to fail at part 2")
+	}
+	if journal.MultipartUploadID(key, size) == "" {
+		t.Fatal("interrupted multipart upload must stay in the journal for resuming")
+	}
+	if _, ok := fake.object(key); ok {
+		t.Fatal("object must not exist before the multipart upload completes")
+	}
+
+	if err := putBlobSource(ctx, client, fakeS3Bucket, "game", hash, source, false, journal); err != nil {
+		t.Fatalf("resumed putBlobSource: %v", err)
+	}
+	got, ok := fake.object(key)
+	if !ok || !bytes.Equal(got, data) {
+		t.Fatalf("uploaded object does not match the file (found=%v, %d bytes)", ok, len(got))
+	}
+	fake.mu.Lock()
+	defer fake.mu.Unlock()
+	if fake.partPuts[1] != 1 || fake.partPuts[2] != 1 || fake.partPuts[3] != 1 {
+		t.Fatalf("each part should be uploaded once, got %v", fake.partPuts)
+	}
+	if len(fake.uploads) != 0 {
+		t.Fatalf("completed upload left %d pending uploads", len(fake.uploads))
+	}
+	if journal.MultipartUploadID(key, size) != "" {
+		t.Fatal("completed multipart upload must be removed from the journal")
+	}
+}
@@ -0,0 +1,98 @@
+// ctx に載せた集計先へ S3 リクエストの回数・再試行・転送量を記録し、ストレージ内部の段階を計時できるようにする。
+package storage
+
+import (
+	"context"
+	"strings"
+	"sync/atomic"
+)
+
+// TransferCounts は TransferStats のある時点の値。
+type TransferCounts struct {
+	Requests      int64 `json:"requests"`      // 送った HTTP リクエスト数（再試行を含む）
+	Retries       int64 `json:"retries"`       // そのうち SDK の再試行だった数
+	BytesSent     int64 `json:"bytesSent"`     // リクエスト本文のバイト数
+	BytesReceived int64 `json:"bytesReceived"` // 読んだレスポンス本文のバイト数
+}
+
+// TransferStats は SharedClient 経由のリクエストを集計する。WithTransferStats で ctx に載せると、
+// その ctx で送ったリクエストが自身と、同じ ctx に先に載っていた集計先（親）の両方に加算される。
+// 複数のワーカーから同時に加算されてよい。
+type TransferStats struct {
+	parent        *TransferStats
+	requests      atomic.Int64
+	retries       atomic.Int64
+	bytesSent     atomic.Int64
+	bytesReceived atomic.Int64
+}
+
+type transferStatsKey struct{}
+
+// WithTransferStats は stats を集計先にした ctx を返す。ctx に既に集計先があれば stats の親になる。
+// stats は1つの ctx にだけ載せること（親は最初に載せたときに決まる）。
+func WithTransferStats(ctx context.Context, stats *TransferStats) context.Context {
+	stats.parent = transferStatsFrom(ctx)
+	return context.WithValue(ctx, transferStatsKey{}, stats)
+}
+
+// Counts は現在の集計値を返す。
+func (s *TransferStats) Counts() TransferCounts {
+	return TransferCounts{
+		Requests:      s.requests.Load(),
+		Retries:       s.retries.Load(),
+		BytesSent:     s.bytesSent.Load(),
+		BytesReceived: s.bytesReceived.Load(),
+	}
+}
+
+func transferStatsFrom(ctx context.Context) *TransferStats {
+	stats, _ := ctx.Value(transferStatsKey{}).(*TransferStats)
+	return stats
+}
+
+func (s *TransferStats) addRequest(retry bool, bytesSent int64) {
+	for stats := s; stats != nil; stats = stats.parent {
+		stats.requests.Add(1)
+		if retry {
+			stats.retries.Add(1)
+		}
+		if bytesSent > 0 {
+			stats.bytesSent.Add(bytesSent)
+		}
+	}
+}
+
+func (s *TransferStats) addReceived(n int) {
+	for stats := s; stats != nil; stats = stats.parent {
+		stats.bytesReceived.Add(int64(n))
+	}
+}
+
+// isRetryAttempt は SDK が付ける amz-sdk-request ヘッダ（"attempt=2; max=3" 形式）から再試行かを判定する。
+func isRetryAttempt(header string) bool {
+	for _, field := range strings.Split(header, ";") {
+		if value, ok := strings.CutPrefix(strings.TrimSpace(field), "attempt="); ok {
+			return value != "" && value != "1"
+		}
+	}
+	return false
+}
+
+// PhaseHook はストレージ内部の段階（列挙・送信など）の開始時に呼ばれ、その段階で使う ctx と終了時に呼ぶ関数を返す。
+type PhaseHook func(ctx context.Context, name string) (context.Context, func(err error))
+
+type phaseHookKey struct{}
+
+// WithPhaseHook は PutBlobs などが内部の段階を hook に知らせる ctx を返す。
+func WithPhaseHook(ctx context.Context, hook PhaseHook) context.Context {
+	return context.WithValue(ctx, phaseHookKey{}, hook)
+}
+
+// StartPhase は ctx に PhaseHook があれば段階 name の開始を知らせる。無ければ何もしない。
+func StartPhase(ctx context.Context, name string) (context.Context, func(error)) {
+	hook, _ := ctx.Value(phaseHookKey{}).(PhaseHook)
+	if hook == nil {
+		return ctx, func(error) {}
+	}
+	return hook(ctx, name)
+}
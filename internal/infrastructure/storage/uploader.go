@@ -4,17 +4,41 @@ package storage
 import (
 	"bytes"
 	"context"
+	"fmt"
+	"io"
+	"os"
 	"strings"
 
+	"github.com/aws/aws-sdk-go-v2/aws"
 	"github.com/aws/aws-sdk-go-v2/service/s3"
+	s3types "github.com/aws/aws-sdk-go-v2/service/s3/types"
 )
 
 const (
 	defaultUploadConcurrency = 6
+
+	// multipartThreshold を超えるファイルはマルチパートで送る。単発 PutObject は
+	// 失敗時に全体を送り直すうえ、プロバイダによっては 5GiB の上限に当たる。
+	// セーブファイルは ChunkedFileThreshold 以上がチャンク分割（チャンクは chunkMaxSize 以下の単発 PutObject）になるため、
+	// objects/ の単一ブロブとして送るのは ChunkedFileThreshold 未満だけ。その範囲でも途中再開が効くよう閾値を下げている
+	// （multipartThreshold 以下は単発 PutObject、(multipartThreshold, ChunkedFileThreshold) はマルチパート）。
+	multipartThreshold = 16 << 20
+	// multipartPartSize はパート1つの基準サイズ。ワーカー1本が同時に抱えるのは
+	// 1パート分の SectionReader だけなので、ピークメモリは並列度 × この値で頭打ちになる。
+	multipartPartSize = 16 << 20
+	// maxMultipartParts は S3 仕様のパート数上限。超える巨大ファイルはパートサイズを引き上げる。
+	maxMultipartParts = 10000
 )
 
 // UploadBytes は任意のバイト列をアップロードする。
 func UploadBytes(ctx context.Context, client *s3.Client, bucket string, key string, payload []byte, contentType string) error {
+	_, err := PutBytes(ctx, client, bucket, key, payload, contentType)
+	return err
+}
+
+// PutBytes は UploadBytes と同じくバイト列をアップロードし、書き込んだオブジェクトの ETag（引用符なし）を返す。
+// 呼び出し側は ETag を控えておけば、次回の一覧の ETag と比べるだけで内容が変わったかを判定できる。
+func PutBytes(ctx context.Context, client *s3.Client, bucket string, key string, payload []byte, contentType string) (string, error) {
 	reader := bytes.NewReader(payload)
 	input := &s3.PutObjectInput{
 		Bucket: &bucket,
@@ -24,8 +48,142 @@ func UploadBytes(ctx context.Context, client *s3.Client, bucket string, key stri
 	if strings.TrimSpace(contentType) != "" {
 		input.ContentType = stringPtr(contentType)
 	}
-	_, error := client.PutObject(ctx, input)
-	return error
+	output, error := client.PutObject(ctx, input)
+	if error != nil {
+		return "", error
+	}
+	return normalizeETag(aws.ToString(output.ETag)), nil
+}
+
+// UploadFile はローカルファイルをディスクから逐次読みでアップロードする（全体を RAM に載せない）。
+// size は呼び出し側が走査時に得たサイズで、先頭から size バイトだけを送る。
+// multipartThreshold を超える場合はマルチパートアップロードに切り替え、journal（nil 可）があれば中断後に続きから送る。
+func UploadFile(ctx context.Context, client *s3.Client, bucket string, key string, filePath string, size int64, contentType string, journal TransferJournal) (err error) {
+	file, err := os.Open(filePath)
+	if err != nil {
+		return err
+	}
+	defer func() {
+		if closeErr := file.Close(); closeErr != nil && err == nil {
+			err = closeErr
+		}
+	}()
+
+	if size > multipartThreshold {
+		return uploadMultipart(ctx, client, bucket, key, file, size, contentType, journalOrNop(journal))
+	}
+	// SectionReader は Seek 可能なので、SDK が署名用に payload を読み直しても追加バッファを持たない。
+	input := &s3.PutObjectInput{
+		Bucket:        &bucket,
+		Key:           &key,
+		Body:          io.NewSectionReader(file, 0, size),
+		ContentLength: aws.Int64(size),
+	}
+	if strings.TrimSpace(contentType) != "" {
+		input.ContentType = stringPtr(contentType)
+	}
+	_, err = client.PutObject(ctx, input)
+	return err
+}
+
+// multipartPartSizeFor は size を maxMultipartParts 以内に収めるパートサイズを返す。
+func multipartPartSizeFor(size int64) int64 {
+	partSize := int64(multipartPartSize)
+	if minSize := (size + maxMultipartParts - 1) / maxMultipartParts; minSize > partSize {
+		partSize = minSize
+	}
+	return partSize
+}
+
+// uploadMultipart は file をパート単位で順にアップロードする。
+// journal に同じ key・size の未完了アップロードが記録されていれば、その送信済みパートのうち
+// ローカルと内容が一致するもの（partMatches）を再利用し、残りだけを送る。
+// 途中で失敗した場合、journal が記録できるなら再開用にアップロードを残す（古いものは起動時に
+// AbortStaleMultipartUploads で破棄する）。記録できない場合は AbortMultipartUpload で未完了パートを破棄する
+// （放置するとバケットに課金対象の断片が残り、ListObjects にも出ないため気づけない）。
+func uploadMultipart(ctx context.Context, client *s3.Client, bucket string, key string, file io.ReaderAt, size int64, contentType string, journal TransferJournal) (err error) {
+	uploadID := journal.MultipartUploadID(key, size)
+	var uploaded map[int32]uploadedPart
+	if uploadID != "" {
+		uploaded, err = listUploadedParts(ctx, client, bucket, key, uploadID)
+		if err != nil {
+			if ctx.Err() != nil {
+				return err
+			}
+			// 期限切れで破棄された等。記録を捨てて最初から送る
+			_ = AbortMultipartUpload(ctx, client, bucket, key, uploadID)
+			journal.MultipartFinished(key)
+			uploadID, uploaded = "", nil
+		}
+	}
+	if uploadID == "" {
+		createInput := &s3.CreateMultipartUploadInput{
+			Bucket: &bucket,
+			Key:    &key,
+		}
+		if strings.TrimSpace(contentType) != "" {
+			createInput.ContentType = stringPtr(contentType)
+		}
+		created, createErr := client.CreateMultipartUpload(ctx, createInput)
+		if createErr != nil {
+			return createErr
+		}
+		if created.UploadId == nil {
+			return fmt.Errorf("multipart upload id is empty: %s", key)
+		}
+		uploadID = *created.UploadId
+		journal.MultipartStarted(key, uploadID, size)
+	}
+	defer func() {
+		if err == nil {
+			journal.MultipartFinished(key)
+			return
+		}
+		if isResumableJournal(journal) {
+			return
+		}
+		// ctx がキャンセル済みでも破棄だけは届くよう、切り離した context を使う。
+		_ = AbortMultipartUpload(context.WithoutCancel(ctx), client, bucket, key, uploadID)
+	}()
+
+	partSize := multipartPartSizeFor(size)
+	parts := make([]s3types.CompletedPart, 0, (size+partSize-1)/partSize)
+	for offset, partNumber := int64(0), int32(1); offset < size; offset, partNumber = offset+partSize, partNumber+1 {
+		length := partSize
+		if remaining := size - offset; remaining < length {
+			length = remaining
+		}
+		if part, ok := uploaded[partNumber]; ok && partMatches(file, offset, length, part) {
+			parts = append(parts, s3types.CompletedPart{
+				ETag:       aws.String(part.etag),
+				PartNumber: aws.Int32(partNumber),
+			})
+			continue
+		}
+		output, partErr := client.UploadPart(ctx, &s3.UploadPartInput{
+			Bucket:        &bucket,
+			Key:           &key,
+			UploadId:      &uploadID,
+			PartNumber:    aws.Int32(partNumber),
+			Body:          io.NewSectionReader(file, offset, length),
+			ContentLength: aws.Int64(length),
+		})
+		if partErr != nil {
+			return partErr
+		}
+		parts = append(parts, s3types.CompletedPart{
+			ETag:       output.ETag,
+			PartNumber: aws.Int32(partNumber),
+		})
+	}
+
+	_, err = client.CompleteMultipartUpload(ctx, &s3.CompleteMultipartUploadInput{
+		Bucket:          &bucket,
+		Key:             &key,
+		UploadId:        &uploadID,
+		MultipartUpload: &s3types.CompletedMultipartUpload{Parts: parts},
+	})
+	return err
 }
 
 func stringPtr(value string) *string {
@@ -0,0 +1,34 @@
+package storage
+
+import "testing"
+
+func TestMultipartPartSizeForKeepsPartCountWithinLimit(t *testing.T) {
+	t.Parallel()
+	cases := []int64{
+		multipartThreshold + 1,
+		int64(multipartPartSize) * maxMultipartParts,
+		int64(multipartPartSize)*maxMultipartParts + 1,
+		1 << 40,
+	}
+	for _, size := range cases {
+		partSize := multipartPartSizeFor(size)
+		if partSize < multipartPartSize {
+			t.Fatalf("partSize(%d) = %d, want >= %d", size, partSize, multipartPartSize)
+		}
+		if parts := (size + partSize - 1) / partSize; parts > maxMultipartParts {
+			t.Fatalf("size %d splits into %d parts, want <= %d", size, parts, maxMultipartParts)
+		}
+	}
+}
+
+// TestMultipartThresholdBelowChunkedFileThreshold は、チャンク分割されない単一ブロブにも
+// マルチパートで送る大きさの範囲が残っていることを確認する。
+func TestMultipartThresholdBelowChunkedFileThreshold(t *testing.T) {
+	t.Parallel()
+	if multipartThreshold >= ChunkedFileThreshold {
+		t.Fatalf("multipartThreshold (%d) must be below ChunkedFileThreshold (%d), or multipart uploads are unreachable", multipartThreshold, ChunkedFileThreshold)
+	}
+	if chunkMaxSize > multipartThreshold {
+		t.Fatalf("chunks (max %d) must fit in a single PutObject (threshold %d)", chunkMaxSize, multipartThreshold)
+	}
+}
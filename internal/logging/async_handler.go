@@ -0,0 +1,328 @@
+// レコードをリングバッファへ積み、バックグラウンドでまとめて書き出す非同期の slog.Handler を提供する。
+package logging
+
+import (
+	"bufio"
+	"context"
+	"io"
+	"log/slog"
+	"sync"
+	"sync/atomic"
+	"time"
+)
+
+const (
+	// asyncRingSize はリングバッファのスロット数（2 の冪）。満杯の間に来た debug〜warn のレコードは捨てて数だけ数える。
+	asyncRingSize = 4096
+	// asyncDrainInterval は書き出しの周期。半分以上たまれば待たずに書き出す。
+	asyncDrainInterval = 50 * time.Millisecond
+	// asyncSyncInterval はファイルを fsync する間隔。error 以上と Close では待たずに fsync する。
+	asyncSyncInterval = time.Second
+	// asyncBufferSize は出力先ごとの書き込みバッファ。書き出しのたびに空にする。
+	asyncBufferSize = 64 * 1024
+
+	// debug のレコードはメッセージごとに1秒あたり debugSampleBurst 件まで通し、以降は debugSampleEvery 件に1件だけ通す。
+	debugSampleWindow = time.Second
+	debugSampleBurst  = 20
+	debugSampleEvery  = 100
+	// debugSampleMaxKeys を超える種類のメッセージは数えずに通す（集計用の map を膨らませない）。
+	debugSampleMaxKeys = 1024
+)
+
+// asyncEntry はリングバッファに積む1レコード。handler は WithAttrs / WithGroup 済みの書き出し先。
+type asyncEntry struct {
+	ctx     context.Context
+	handler slog.Handler
+	record  slog.Record
+}
+
+// asyncRing は複数の生産者から積み、書き出し側の1つだけが取り出す固定長のロックフリーなキュー。
+// スロットごとの連番で空き・書き込み済みを判定する（Vyukov の bounded MPMC キュー）。
+type asyncRing struct {
+	slots [asyncRingSize]asyncSlot
+	head  atomic.Uint64 // 次に取り出す位置（取り出し側だけが進める）
+	tail  atomic.Uint64 // 次に積む位置
+}
+
+type asyncSlot struct {
+	seq   atomic.Uint64
+	entry asyncEntry
+}
+
+func newAsyncRing() *asyncRing {
+	ring := &asyncRing{}
+	for i := range ring.slots {
+		ring.slots[i].seq.Store(uint64(i))
+	}
+	return ring
+}
+
+// push は entry を積む。満杯なら false を返す。
+func (ring *asyncRing) push(entry asyncEntry) bool {
+	for {
+		pos := ring.tail.Load()
+		slot := &ring.slots[pos&(asyncRingSize-1)]
+		seq := slot.seq.Load()
+		switch {
+		case seq == pos:
+			if ring.tail.CompareAndSwap(pos, pos+1) {
+				slot.entry = entry
+				slot.seq.Store(pos + 1)
+				return true
+			}
+		case seq < pos:
+			return false
+		}
+	}
+}
+
+// pop は積まれた順に1件取り出す。空、または先頭のスロットをまだ書き込み中なら false を返す。
+// 取り出し側は1つだけ（asyncSink.writeMu の保持者）であること。
+func (ring *asyncRing) pop() (asyncEntry, bool) {
+	pos := ring.head.Load()
+	slot := &ring.slots[pos&(asyncRingSize-1)]
+	if slot.seq.Load() != pos+1 {
+		return asyncEntry{}, false
+	}
+	entry := slot.entry
+	slot.entry = asyncEntry{}
+	slot.seq.Store(pos + asyncRingSize)
+	ring.head.Store(pos + 1)
+	return entry, true
+}
+
+func (ring *asyncRing) len() uint64 {
+	return ring.tail.Load() - ring.head.Load()
+}
+
+// syncWriter は fsync できる出力先（rotatingWriter）。
+type syncWriter interface {
+	Sync() error
+}
+
+// asyncSink は非同期ハンドラ群が共有するキュー・書き込みバッファと、書き出しを行う goroutine。
+type asyncSink struct {
+	ring    *asyncRing
+	sampler debugSampler
+	wake    chan struct{}
+	stop    chan struct{}
+	done    chan struct{}
+	closed  atomic.Bool
+
+	// writeMu はキューからの取り出しと出力先への書き込みを直列化する。
+	writeMu  sync.Mutex
+	buffers  []*bufio.Writer
+	files    []syncWriter
+	dirty    bool // 前回の fsync 以降に書き出したか
+	lastSync time.Time
+	report   slog.Handler // 取りこぼし件数の報告先（ルートのハンドラ）
+
+	dropped atomic.Int64
+	sampled atomic.Int64
+}
+
+func newAsyncSink(files []syncWriter) *asyncSink {
+	return &asyncSink{
+		ring:     newAsyncRing(),
+		wake:     make(chan struct{}, 1),
+		stop:     make(chan struct{}),
+		done:     make(chan struct{}),
+		files:    files,
+		lastSync: time.Now(),
+	}
+}
+
+// buffer は w を書き込みバッファで包む。書き出しのたびに Flush される。
+func (s *asyncSink) buffer(w io.Writer) io.Writer {
+	buffered := bufio.NewWriterSize(w, asyncBufferSize)
+	s.buffers = append(s.buffers, buffered)
+	return buffered
+}
+
+// start は inner を非同期ハンドラで包み、書き出しの goroutine を開始する。
+func (s *asyncSink) start(inner slog.Handler) slog.Handler {
+	s.report = inner
+	go s.run()
+	return &asyncHandler{inner: inner, sink: s}
+}
+
+func (s *asyncSink) run() {
+	defer close(s.done)
+	ticker := time.NewTicker(asyncDrainInterval)
+	defer ticker.Stop()
+	for {
+		select {
+		case <-s.stop:
+			s.writeMu.Lock()
+			s.drainLocked()
+			s.reportLossLocked()
+			s.flushLocked(true)
+			s.writeMu.Unlock()
+			return
+		case <-s.wake:
+		case <-ticker.C:
+		}
+		s.writeMu.Lock()
+		s.drainLocked()
+		s.reportLossLocked()
+		s.flushLocked(time.Since(s.lastSync) >= asyncSyncInterval)
+		s.writeMu.Unlock()
+	}
+}
+
+func (s *asyncSink) signal() {
+	select {
+	case s.wake <- struct{}{}:
+	default:
+	}
+}
+
+// drainLocked はキューに積まれたレコードをすべて書き込みバッファへ書く。
+func (s *asyncSink) drainLocked() {
+	for {
+		entry, ok := s.ring.pop()
+		if !ok {
+			return
+		}
+		// 書き出しに失敗しても呼び出し側へ返す先が無いため、同期版の slog と同じく捨てる。
+		_ = entry.handler.Handle(entry.ctx, entry.record)
+		s.dirty = true
+	}
+}
+
+// flushLocked は書き込みバッファを出力先へ書き出し、fsync が真なら書き出し済みのファイルを fsync する。
+func (s *asyncSink) flushLocked(fsync bool) {
+	for _, buffered := range s.buffers {
+		_ = buffered.Flush()
+	}
+	if !fsync || !s.dirty {
+		return
+	}
+	for _, file := range s.files {
+		_ = file.Sync()
+	}
+	s.dirty = false
+	s.lastSync = time.Now()
+}
+
+// reportLossLocked は前回の報告以降に捨てた・間引いたレコードの件数を1件のログにまとめて書く。
+// キューがあふれた場合は warn、debug の間引きだけなら debug で記録する。
+func (s *asyncSink) reportLossLocked() {
+	dropped := s.dropped.Swap(0)
+	sampled := s.sampled.Swap(0)
+	if dropped == 0 && sampled == 0 {
+		return
+	}
+	level := slog.LevelDebug
+	if dropped > 0 {
+		level = slog.LevelWarn
+	}
+	ctx := context.Background()
+	if !s.report.Enabled(ctx, level) {
+		return
+	}
+	record := slog.NewRecord(time.Now(), level, "非同期ログの一部を記録しませんでした", 0)
+	record.AddAttrs(slog.String("scope", "backend"), slog.Int64("dropped", dropped), slog.Int64("sampled", sampled))
+	_ = s.report.Handle(ctx, record)
+	s.dirty = true
+}
+
+// handleSync はキューに残ったレコードを先に書いてから record を直接書き、バッファを出力先まで書き出す。
+func (s *asyncSink) handleSync(ctx context.Context, handler slog.Handler, record slog.Record, fsync bool) error {
+	s.writeMu.Lock()
+	defer s.writeMu.Unlock()
+	s.drainLocked()
+	err := handler.Handle(ctx, record)
+	s.dirty = true
+	s.flushLocked(fsync)
+	return err
+}
+
+// close はキューに残ったレコードを書き出して fsync し、書き出しの goroutine を止める。
+// 以降のレコードは呼び出し元の goroutine で同期的に書く。
+func (s *asyncSink) close(ctx context.Context) error {
+	if s.closed.Swap(true) {
+		return nil
+	}
+	close(s.stop)
+	select {
+	case <-s.done:
+		return nil
+	case <-ctx.Done():
+		return ctx.Err()
+	}
+}
+
+// asyncHandler は inner への書き込みを asyncSink のキュー経由で行う slog.Handler。
+// error 以上のレコードは、それまでに積まれたレコードと合わせて呼び出し元で書き出し、fsync してから返る。
+type asyncHandler struct {
+	inner slog.Handler
+	sink  *asyncSink
+}
+
+func (h *asyncHandler) Enabled(ctx context.Context, level slog.Level) bool {
+	return h.inner.Enabled(ctx, level)
+}
+
+func (h *asyncHandler) Handle(ctx context.Context, record slog.Record) error {
+	sink := h.sink
+	if record.Level >= slog.LevelError {
+		return sink.handleSync(ctx, h.inner, record, true)
+	}
+	if sink.closed.Load() {
+		return sink.handleSync(ctx, h.inner, record, false)
+	}
+	if record.Level < slog.LevelInfo && !sink.sampler.allow(record.Message, time.Now()) {
+		sink.sampled.Add(1)
+		return nil
+	}
+	// 呼び出し元の ctx は戻った後に取り消されうるため、値だけを引き継ぐ。
+	entry := asyncEntry{ctx: context.WithoutCancel(ctx), handler: h.inner, record: record.Clone()}
+	if !sink.ring.push(entry) {
+		sink.dropped.Add(1)
+		sink.signal()
+		return nil
+	}
+	if sink.ring.len() >= asyncRingSize/2 {
+		sink.signal()
+	}
+	// Close と入れ違いに積んだレコードは書き出しの goroutine が拾わないため、ここで書き出す。
+	if sink.closed.Load() {
+		sink.writeMu.Lock()
+		sink.drainLocked()
+		sink.flushLocked(false)
+		sink.writeMu.Unlock()
+	}
+	return nil
+}
+
+func (h *asyncHandler) WithAttrs(attrs []slog.Attr) slog.Handler {
+	return &asyncHandler{inner: h.inner.WithAttrs(attrs), sink: h.sink}
+}
+
+func (h *asyncHandler) WithGroup(name string) slog.Handler {
+	return &asyncHandler{inner: h.inner.WithGroup(name), sink: h.sink}
+}
+
+// debugSampler は debug のレコードをメッセージごとに数え、1 窓あたりの件数を抑える。ゼロ値のまま使える。
+type debugSampler struct {
+	mu          sync.Mutex
+	windowStart time.Time
+	counts      map[string]int
+}
+
+func (s *debugSampler) allow(message string, now time.Time) bool {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+	if s.counts == nil || now.Sub(s.windowStart) >= debugSampleWindow || now.Before(s.windowStart) {
+		s.counts = make(map[string]int)
+		s.windowStart = now
+	}
+	count, ok := s.counts[message]
+	if !ok && len(s.counts) >= debugSampleMaxKeys {
+		return true
+	}
+	count++
+	s.counts[message] = count
+	return count <= debugSampleBurst || (count-debugSampleBurst)%debugSampleEvery == 0
+}
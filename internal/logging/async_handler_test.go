@@ -0,0 +1,133 @@
+package logging
+
+import (
+	"bytes"
+	"context"
+	"log/slog"
+	"path/filepath"
+	"strings"
+	"sync"
+	"testing"
+)
+
+// newTestAsyncLogger は buf へ JSON で書き出す非同期ロガーを作る。buf は close 後にだけ読むこと。
+func newTestAsyncLogger(buf *bytes.Buffer, level slog.Level) (*slog.Logger, *asyncSink) {
+	sink := newAsyncSink(nil)
+	handler := slog.NewJSONHandler(sink.buffer(buf), &slog.HandlerOptions{Level: level})
+	return slog.New(sink.start(handler)), sink
+}
+
+func TestNewAsyncLoggerFlushesOnErrorAndClose(t *testing.T) {
+	dir := t.TempDir()
+	logger, _, closeLog := NewAsyncLogger(dir, "info")
+	appPath := filepath.Join(dir, logDirName, logFileName)
+	errPath := filepath.Join(dir, logDirName, errorFileName)
+
+	logger.Info("積まれた情報ログ")
+	logger.Error("重大エラー", "k", "v")
+
+	// error は積まれていた info と合わせて、戻った時点でファイルに出ている。
+	appLog := readFile(t, appPath)
+	if !strings.Contains(appLog, "積まれた情報ログ") || !strings.Contains(appLog, "重大エラー") {
+		t.Fatalf("app.log に想定のログがない: %q", appLog)
+	}
+	if errLog := readFile(t, errPath); !strings.Contains(errLog, "重大エラー") || strings.Contains(errLog, "積まれた情報ログ") {
+		t.Fatalf("error.log の内容が想定と違う: %q", errLog)
+	}
+
+	logger.Info("終了直前のログ")
+	if err := closeLog(context.Background()); err != nil {
+		t.Fatalf("close: %v", err)
+	}
+	if appLog := readFile(t, appPath); !strings.Contains(appLog, "終了直前のログ") {
+		t.Fatalf("close 後も app.log に残りのログがない: %q", appLog)
+	}
+
+	// close 後は同期書き込みになる。
+	logger.Info("終了後のログ")
+	if appLog := readFile(t, appPath); !strings.Contains(appLog, "終了後のログ") {
+		t.Fatalf("close 後のログが書かれていない: %q", appLog)
+	}
+	if err := closeLog(context.Background()); err != nil {
+		t.Fatalf("second close: %v", err)
+	}
+}
+
+func TestAsyncHandlerKeepsConcurrentRecords(t *testing.T) {
+	var buf bytes.Buffer
+	logger, sink := newTestAsyncLogger(&buf, slog.LevelInfo)
+
+	const writers, perWriter = 8, 200
+	var wg sync.WaitGroup
+	for w := 0; w < writers; w++ {
+		wg.Add(1)
+		go func(worker int) {
+			defer wg.Done()
+			child := logger.With("worker", worker)
+			for i := 0; i < perWriter; i++ {
+				child.Info("並行ログ", "i", i)
+			}
+		}(w)
+	}
+	wg.Wait()
+	if err := sink.close(context.Background()); err != nil {
+		t.Fatalf("close: %v", err)
+	}
+
+	if got := strings.Count(buf.String(), "並行ログ"); got != writers*perWriter {
+		t.Fatalf("expected %d records, got %d", writers*perWriter, got)
+	}
+	if !strings.Contains(buf.String(), `"worker":7`) {
+		t.Fatalf("WithAttrs の属性が出力されていない")
+	}
+}
+
+func TestAsyncHandlerSamplesRepeatedDebug(t *testing.T) {
+	var buf bytes.Buffer
+	logger, sink := newTestAsyncLogger(&buf, slog.LevelDebug)
+
+	const repeats = debugSampleBurst + 250
+	for i := 0; i < repeats; i++ {
+		logger.Debug("監視ループ")
+		logger.Info("間引かない情報ログ")
+	}
+	logger.Debug("別のメッセージ")
+	if err := sink.close(context.Background()); err != nil {
+		t.Fatalf("close: %v", err)
+	}
+
+	output := buf.String()
+	if got := strings.Count(output, `"msg":"監視ループ"`); got != debugSampleBurst+2 {
+		t.Fatalf("expected %d sampled debug records, got %d", debugSampleBurst+2, got)
+	}
+	if got := strings.Count(output, "間引かない情報ログ"); got != repeats {
+		t.Fatalf("info records must not be sampled: got %d", got)
+	}
+	if !strings.Contains(output, "別のメッセージ") {
+		t.Fatalf("別のメッセージまで間引かれている")
+	}
+	if !strings.Contains(output, `"sampled":`) {
+		t.Fatalf("間引いた件数が記録されていない: %q", output)
+	}
+}
+
+func TestAsyncRingRejectsWhenFull(t *testing.T) {
+	ring := newAsyncRing()
+	for i := 0; i < asyncRingSize; i++ {
+		if !ring.push(asyncEntry{}) {
+			t.Fatalf("push %d failed before the ring was full", i)
+		}
+	}
+	if ring.push(asyncEntry{}) {
+		t.Fatalf("expected push into a full ring to fail")
+	}
+	if _, ok := ring.pop(); !ok {
+		t.Fatalf("expected pop from a full ring to succeed")
+	}
+	if !ring.push(asyncEntry{}) {
+		t.Fatalf("expected push to succeed after pop")
+	}
+	if got := ring.len(); got != asyncRingSize {
+		t.Fatalf("expected len %d, got %d", asyncRingSize, got)
+	}
+}
@@ -27,11 +27,27 @@ const (
 // error 以上を同時出力する。各ファイルはサイズ上限でローテーションする。
 // 戻り値の *slog.LevelVar を書き換えれば実行時にログレベルを変更できる。
 func NewLogger(appDataDir string, level string) (*slog.Logger, *slog.LevelVar) {
+	logger, levelVar, _ := newLogger(appDataDir, level, false)
+	return logger, levelVar
+}
+
+// NewAsyncLogger は NewLogger と同じ出力先へ、呼び出し元を待たせずに書き込む slog.Logger を生成する。
+// レコードはリングバッファに積んでバックグラウンドでまとめて書き出し、ファイルは一定間隔で fsync する。
+// error 以上のレコードは積まれていた分と合わせて書き出し、fsync してから返る。
+// debug のレコードは同じメッセージが続くと間引き、キューがあふれた分と合わせて件数だけ記録する。
+// 戻り値の関数は残りのレコードを書き出して停止する。終了時に必ず呼ぶこと（以降の記録は同期書き込みになる）。
+func NewAsyncLogger(appDataDir string, level string) (*slog.Logger, *slog.LevelVar, func(ctx context.Context) error) {
+	logger, levelVar, sink := newLogger(appDataDir, level, true)
+	return logger, levelVar, sink.close
+}
+
+func newLogger(appDataDir string, level string, async bool) (*slog.Logger, *slog.LevelVar, *asyncSink) {
 	levelVar := &slog.LevelVar{}
 	levelVar.Set(ParseLevel(level))
 
 	var mainWriter io.Writer = os.Stdout
-	var errorHandler slog.Handler
+	var errorWriter io.Writer
+	var files []syncWriter
 
 	logDir, dirErr := ensureLogDir(appDataDir)
 	if dirErr != nil {
@@ -41,10 +57,21 @@ func NewLogger(appDataDir string, level string) (*slog.Logger, *slog.LevelVar) {
 	} else {
 		if appWriter, ok := tryOpenRotatingLog(filepath.Join(logDir, logFileName), "log file"); ok {
 			mainWriter = io.MultiWriter(os.Stdout, appWriter)
+			files = append(files, appWriter)
 		}
 		// error 以上だけを集約する専用ファイル。重大なエラーを探しやすくする。
 		if errWriter, ok := tryOpenRotatingLog(filepath.Join(logDir, errorFileName), "error log file"); ok {
-			errorHandler = slog.NewJSONHandler(errWriter, &slog.HandlerOptions{Level: slog.LevelError, AddSource: true})
+			errorWriter = errWriter
+			files = append(files, errWriter)
+		}
+	}
+
+	var sink *asyncSink
+	if async {
+		sink = newAsyncSink(files)
+		mainWriter = sink.buffer(mainWriter)
+		if errorWriter != nil {
+			errorWriter = sink.buffer(errorWriter)
 		}
 	}
 
@@ -53,10 +80,14 @@ func NewLogger(appDataDir string, level string) (*slog.Logger, *slog.LevelVar) {
 		AddSource: true,
 	})
 	var handler slog.Handler = baseHandler
-	if errorHandler != nil {
+	if errorWriter != nil {
+		errorHandler := slog.NewJSONHandler(errorWriter, &slog.HandlerOptions{Level: slog.LevelError, AddSource: true})
 		handler = &teeErrorHandler{base: baseHandler, errorH: errorHandler}
 	}
-	return slog.New(handler).With("scope", "backend"), levelVar
+	if sink != nil {
+		handler = sink.start(handler)
+	}
+	return slog.New(handler).With("scope", "backend"), levelVar, sink
 }
 
 // ParseLevel は文字列から slog.Level を決定する。
@@ -187,6 +218,16 @@ func (w *rotatingWriter) rotate() error {
 	return w.open()
 }
 
+// Sync は書き込み済みの内容をディスクへ反映する。
+func (w *rotatingWriter) Sync() error {
+	w.mu.Lock()
+	defer w.mu.Unlock()
+	if w.file == nil {
+		return nil
+	}
+	return w.file.Sync()
+}
+
 func (w *rotatingWriter) backupPath(i int) string {
 	if i == 0 {
 		return w.path
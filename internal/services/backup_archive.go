@@ -0,0 +1,434 @@
+// バックアップZIPの書き出し（AppData からの直接書き込み・増分）と、増分バックアップの連鎖の展開を提供する。
+package services
+
+import (
+	"archive/zip"
+	"crypto/rand"
+	"crypto/sha256"
+	"encoding/hex"
+	"encoding/json"
+	"errors"
+	"fmt"
+	"io"
+	"maps"
+	"os"
+	"path/filepath"
+	"runtime"
+	"sort"
+	"strings"
+	"sync"
+	"sync/atomic"
+)
+
+const (
+	BackupKindFull        = "full"
+	BackupKindIncremental = "incremental"
+
+	backupManifestName   = "_manifest.json"
+	currentBackupVersion = 2
+	// maxExtractWorkers は復元時に ZIP を並列で展開するワーカー数の上限。ディスクへの書き込みが詰まらない程度に抑える。
+	maxExtractWorkers = 8
+)
+
+// BackupFileEntry はバックアップ時点の AppData 内ファイル1件の控え。
+// ModTime は stat の値で、Size と ModTime が前回と同じファイルは読み直さず前回のハッシュを引き継ぐ。
+// DB はスナップショットを格納するため ModTime を持たず、毎回ハッシュを比べる。
+type BackupFileEntry struct {
+	Hash    string `json:"hash"`
+	Size    int64  `json:"size"`
+	ModTime int64  `json:"modTime,omitempty"`
+}
+
+// backupChainLink は増分バックアップの連鎖の1つ（ZIP のパスとそのマニフェスト）。
+type backupChainLink struct {
+	path     string
+	manifest *BackupManifest
+}
+
+// backupArchiveWriter は AppData のファイルを ZIP に書き込みながら SHA-256 を計算し、files に記録する。
+// previous があればハッシュが同じファイルは ZIP に格納せず files への記録だけにする。
+type backupArchiveWriter struct {
+	zip      *zip.Writer
+	previous map[string]BackupFileEntry
+	files    map[string]BackupFileEntry
+	stored   int
+}
+
+// writeStreamingBackup は appDataDir のファイルと DB スナップショットを outputPath の ZIP に直接書き出し、
+// ZIP に格納したファイル数を返す。ステージングへのコピーを挟まないため、AppData の読み出しは1回で済む。
+// 稼働中の DB 本体と -wal / -shm / -journal は読まず、代わりに snapshotPath を relDBPath の名前で格納する。
+// 出力先が AppData の中にあっても書き出し中の ZIP 自身は対象にしない。
+// previous が nil ならフルバックアップ、そうでなければ previous.Files と内容が異なるファイルだけを格納する。
+// マニフェストは全ファイルのハッシュが揃ってから最後のエントリとして書く。
+func writeStreamingBackup(outputPath string, appDataDir string, relDBPath string, snapshotPath string, previous *BackupManifest, manifest *BackupManifest) (int, error) {
+	file, err := os.OpenFile(outputPath, os.O_CREATE|os.O_TRUNC|os.O_WRONLY, 0o600)
+	if err != nil {
+		return 0, err
+	}
+	archive := &backupArchiveWriter{zip: zip.NewWriter(file), files: make(map[string]BackupFileEntry)}
+	if previous != nil {
+		archive.previous = previous.Files
+	}
+
+	writeErr := archive.addAppData(appDataDir, relDBPath, snapshotPath, outputPath)
+	if writeErr == nil {
+		manifest.Files = archive.files
+		writeErr = writeBackupManifest(archive.zip, manifest)
+	}
+	closeErr := archive.zip.Close()
+	fileErr := file.Close()
+	return archive.stored, errors.Join(writeErr, closeErr, fileErr)
+}
+
+func (archive *backupArchiveWriter) addAppData(appDataDir string, relDBPath string, snapshotPath string, outputPath string) error {
+	dbName := filepath.ToSlash(relDBPath)
+	skipped := map[string]bool{
+		backupManifestName:  true,
+		dbName:              true,
+		dbName + "-wal":     true,
+		dbName + "-shm":     true,
+		dbName + "-journal": true,
+	}
+	outputAbs, err := filepath.Abs(outputPath)
+	if err != nil {
+		return err
+	}
+
+	err = filepath.WalkDir(appDataDir, func(path string, d os.DirEntry, walkErr error) error {
+		if walkErr != nil {
+			return walkErr
+		}
+		if d.IsDir() {
+			return nil
+		}
+		relPath, err := filepath.Rel(appDataDir, path)
+		if err != nil {
+			return err
+		}
+		name := filepath.ToSlash(relPath)
+		if skipped[name] {
+			return nil
+		}
+		if abs, err := filepath.Abs(path); err == nil && abs == outputAbs {
+			return nil
+		}
+		info, err := d.Info()
+		if err != nil {
+			return err
+		}
+		return archive.addFile(name, path, info, true)
+	})
+	if err != nil {
+		return err
+	}
+
+	info, err := os.Stat(snapshotPath)
+	if err != nil {
+		return err
+	}
+	return archive.addFile(dbName, snapshotPath, info, false)
+}
+
+// addFile は sourcePath を name として記録し、前回から変わっていれば ZIP に格納する。
+// trustModTime が false のファイル（DB スナップショット）は stat では判定できないため、先にハッシュを比べる。
+func (archive *backupArchiveWriter) addFile(name string, sourcePath string, info os.FileInfo, trustModTime bool) error {
+	entry := BackupFileEntry{Size: info.Size()}
+	if trustModTime {
+		entry.ModTime = info.ModTime().UnixNano()
+	}
+	if previous, ok := archive.previous[name]; ok {
+		if trustModTime && previous.ModTime == entry.ModTime && previous.Size == entry.Size {
+			entry.Hash = previous.Hash
+			archive.files[name] = entry
+			return nil
+		}
+		if !trustModTime {
+			hash, err := hashFileContent(sourcePath)
+			if err != nil {
+				return err
+			}
+			if hash == previous.Hash {
+				entry.Hash = hash
+				archive.files[name] = entry
+				return nil
+			}
+		}
+	}
+
+	header, err := zip.FileInfoHeader(info)
+	if err != nil {
+		return err
+	}
+	header.Name = name
+	header.Method = zip.Deflate
+	dest, err := archive.zip.CreateHeader(header)
+	if err != nil {
+		return err
+	}
+	// 書き込み中に伸びるファイル（ログなど）もあるため、サイズは stat ではなく実際に書いた量を記録する
+	sum := sha256.New()
+	source, err := os.Open(sourcePath)
+	if err != nil {
+		return err
+	}
+	size, copyErr := io.Copy(io.MultiWriter(dest, sum), source)
+	closeErr := source.Close()
+	if err := errors.Join(copyErr, closeErr); err != nil {
+		return err
+	}
+	entry.Size = size
+	entry.Hash = hex.EncodeToString(sum.Sum(nil))
+	archive.files[name] = entry
+	archive.stored++
+	return nil
+}
+
+func writeBackupManifest(writer *zip.Writer, manifest *BackupManifest) error {
+	manifestBytes, err := json.MarshalIndent(manifest, "", "  ")
+	if err != nil {
+		return err
+	}
+	return writeZipBytes(writer, backupManifestName, manifestBytes)
+}
+
+func hashFileContent(path string) (string, error) {
+	sum := sha256.New()
+	if err := copyFileContent(path, sum); err != nil {
+		return "", err
+	}
+	return hex.EncodeToString(sum.Sum(nil)), nil
+}
+
+// newBackupID は増分バックアップが基準を取り違えていないか確かめるための識別子を生成する。
+func newBackupID() string {
+	var raw [12]byte
+	_, _ = rand.Read(raw[:])
+	return hex.EncodeToString(raw[:])
+}
+
+// nextBackupPath は outputDir に既存のファイルと重ならない stem.zip（重なれば stem_1.zip ...）のパスを返す。
+// 同じ秒に作った増分バックアップが互いを上書きして連鎖が切れないようにするため。
+func nextBackupPath(outputDir string, stem string) string {
+	candidate := filepath.Join(outputDir, stem+".zip")
+	for index := 1; ; index++ {
+		if _, err := os.Stat(candidate); os.IsNotExist(err) {
+			return candidate
+		}
+		candidate = filepath.Join(outputDir, fmt.Sprintf("%s_%d.zip", stem, index))
+	}
+}
+
+// readArchiveManifest は ZIP を展開せずにマニフェストだけを読む。
+func readArchiveManifest(zipPath string) (*BackupManifest, error) {
+	reader, err := zip.OpenReader(zipPath)
+	if err != nil {
+		return nil, err
+	}
+	defer func() {
+		_ = reader.Close()
+	}()
+	for _, file := range reader.File {
+		if file.Name != backupManifestName {
+			continue
+		}
+		src, err := file.Open()
+		if err != nil {
+			return nil, err
+		}
+		data, readErr := io.ReadAll(src)
+		closeErr := src.Close()
+		if err := errors.Join(readErr, closeErr); err != nil {
+			return nil, err
+		}
+		return parseBackupManifest(data)
+	}
+	return nil, errors.New("backup manifest not found")
+}
+
+// extractBackup は backupPath を destRoot に展開する。フルバックアップ（と旧形式）はそのまま展開する。
+// 増分バックアップは同じフォルダから基準のバックアップをフルバックアップまで辿り、最新のマニフェストにある
+// 各ファイルを、そのハッシュの内容を格納している一番新しいバックアップから取り出す。
+// 途中で消したファイルは最新のマニフェストに無いため展開されない。
+func extractBackup(backupPath string, destRoot string) error {
+	manifest, err := readArchiveManifest(backupPath)
+	if err != nil {
+		return err
+	}
+	if manifest.Kind != BackupKindIncremental {
+		return UnzipToDirectory(backupPath, destRoot)
+	}
+
+	chain, err := resolveBackupChain(backupPath, manifest)
+	if err != nil {
+		return err
+	}
+	pending := maps.Clone(manifest.Files)
+	for _, link := range chain {
+		if len(pending) == 0 {
+			break
+		}
+		if err := extractChainLink(link, pending, destRoot); err != nil {
+			return err
+		}
+	}
+	if len(pending) > 0 {
+		missing := make([]string, 0, len(pending))
+		for name := range pending {
+			missing = append(missing, name)
+		}
+		sort.Strings(missing)
+		return fmt.Errorf("backup chain is missing %d files (e.g. %s)", len(missing), missing[0])
+	}
+
+	manifestBytes, err := json.MarshalIndent(manifest, "", "  ")
+	if err != nil {
+		return err
+	}
+	return os.WriteFile(filepath.Join(destRoot, backupManifestName), manifestBytes, 0o600)
+}
+
+// resolveBackupChain は増分バックアップから基準を辿り、新しい順に並べた連鎖を返す。
+// 基準は増分と同じフォルダにある前提で、ファイル名と BackupID の両方が一致しなければ取り違えとみなす。
+func resolveBackupChain(backupPath string, manifest *BackupManifest) ([]backupChainLink, error) {
+	chain := []backupChainLink{{path: backupPath, manifest: manifest}}
+	seen := map[string]bool{manifest.BackupID: true}
+	for current := manifest; current.Kind == BackupKindIncremental; {
+		if current.BaseBackup == "" || current.BaseBackupID == "" {
+			return nil, errors.New("incremental backup has no base backup")
+		}
+		basePath := filepath.Join(filepath.Dir(backupPath), filepath.Base(current.BaseBackup))
+		base, err := readArchiveManifest(basePath)
+		if err != nil {
+			return nil, fmt.Errorf("base backup %s: %w", current.BaseBackup, err)
+		}
+		if base.BackupID != current.BaseBackupID {
+			return nil, fmt.Errorf("base backup %s does not match the incremental backup", current.BaseBackup)
+		}
+		if seen[base.BackupID] {
+			return nil, errors.New("backup chain is circular")
+		}
+		seen[base.BackupID] = true
+		chain = append(chain, backupChainLink{path: basePath, manifest: base})
+		current = base
+	}
+	return chain, nil
+}
+
+// extractChainLink は連鎖の1つから、pending のうちハッシュが一致するファイルを展開して pending から外す。
+func extractChainLink(link backupChainLink, pending map[string]BackupFileEntry, destRoot string) error {
+	reader, err := zip.OpenReader(link.path)
+	if err != nil {
+		return err
+	}
+	defer func() {
+		_ = reader.Close()
+	}()
+	selected := make([]*zip.File, 0, len(pending))
+	for _, file := range reader.File {
+		want, ok := pending[file.Name]
+		if !ok {
+			continue
+		}
+		if recorded, ok := link.manifest.Files[file.Name]; !ok || recorded.Hash != want.Hash {
+			continue
+		}
+		selected = append(selected, file)
+	}
+	if err := extractZipFiles(selected, destRoot); err != nil {
+		return err
+	}
+	for _, file := range selected {
+		delete(pending, file.Name)
+	}
+	return nil
+}
+
+// extractZipFiles は files を destRoot 配下に並列で展開する。展開先のパスは書き込む前にすべて検証し、
+// 1つでも destRoot の外を指すエントリがあれば何も書かずに失敗する。
+// Deflate の展開は CPU を使い、zip.File.Open は並行に呼べるため、CPU 数（上限 maxExtractWorkers）のワーカーで展開する。
+func extractZipFiles(files []*zip.File, destRoot string) error {
+	targets := make([]string, len(files))
+	for index, file := range files {
+		target, err := zipEntryPath(file, destRoot)
+		if err != nil {
+			return err
+		}
+		targets[index] = target
+		if target != "" && file.FileInfo().IsDir() {
+			if err := os.MkdirAll(target, 0o700); err != nil {
+				return err
+			}
+		}
+	}
+
+	workers := min(runtime.NumCPU(), maxExtractWorkers)
+	jobs := make(chan int)
+	var failed atomic.Bool
+	var mu sync.Mutex
+	var firstErr error
+	var wg sync.WaitGroup
+	for range workers {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for index := range jobs {
+				if err := writeZipEntry(files[index], targets[index]); err != nil {
+					mu.Lock()
+					if firstErr == nil {
+						firstErr = err
+					}
+					mu.Unlock()
+					failed.Store(true)
+				}
+			}
+		}()
+	}
+	for index, file := range files {
+		if failed.Load() {
+			break
+		}
+		if targets[index] == "" || file.FileInfo().IsDir() {
+			continue
+		}
+		jobs <- index
+	}
+	close(jobs)
+	wg.Wait()
+	return firstErr
+}
+
+// zipEntryPath は ZIP エントリの展開先を返す。名前が空のエントリは "" を返し、destRoot の外を指すエントリは拒否する。
+func zipEntryPath(file *zip.File, destRoot string) (string, error) {
+	cleanName := filepath.Clean(file.Name)
+	if cleanName == "." || cleanName == "" {
+		return "", nil
+	}
+	destPath := filepath.Join(destRoot, cleanName)
+	if !strings.HasPrefix(destPath, filepath.Clean(destRoot)+string(os.PathSeparator)) {
+		return "", errors.New("invalid backup archive path")
+	}
+	return destPath, nil
+}
+
+func writeZipEntry(file *zip.File, destPath string) error {
+	if err := os.MkdirAll(filepath.Dir(destPath), 0o700); err != nil {
+		return err
+	}
+	src, err := file.Open()
+	if err != nil {
+		return err
+	}
+	defer func() {
+		_ = src.Close()
+	}()
+
+	dst, err := os.OpenFile(destPath, os.O_CREATE|os.O_TRUNC|os.O_WRONLY, 0o600)
+	if err != nil {
+		return err
+	}
+	if _, err := io.Copy(dst, src); err != nil {
+		_ = dst.Close()
+		return err
+	}
+	return dst.Close()
+}
@@ -0,0 +1,165 @@
+package services
+
+import (
+	"fmt"
+	"math/rand"
+	"os"
+	"path/filepath"
+	"strconv"
+	"sync"
+	"testing"
+	"time"
+)
+
+// benchLargeFileMBEnv は大きいセーブファイルの合成サイズ（MiB）を変える環境変数。
+// 既定は CI でも回せる大きさにしてあり、数 GB のセーブを測るときは 2048 などを指定する。
+const benchLargeFileMBEnv = "CLOUDLAUNCH_BENCH_LARGE_MB"
+
+const (
+	benchSmallFileCount = 10000
+	benchSmallFileSize  = 1 << 10
+	benchDeepBranches   = 64
+	benchDeepDepth      = 32
+	benchLargeFileCount = 3
+	benchLargeFileMB    = 96
+)
+
+// benchSaveFixture は合成したセーブフォルダ。
+type benchSaveFixture struct {
+	dir     string
+	relPath []string // スラッシュ区切りの相対パス（生成順）
+	bytes   int64
+}
+
+var benchFixtures struct {
+	mu   sync.Mutex
+	root string
+	dirs map[string]*benchSaveFixture
+}
+
+// TestMain は合成したセーブフォルダをベンチマーク間で使い回し、終了時にまとめて消す。
+func TestMain(m *testing.M) {
+	code := m.Run()
+	benchFixtures.mu.Lock()
+	if benchFixtures.root != "" {
+		_ = os.RemoveAll(benchFixtures.root)
+	}
+	benchFixtures.mu.Unlock()
+	os.Exit(code)
+}
+
+// benchSaveFolder は name の合成セーブフォルダを返す。初回だけ generate で作り、以後は同じものを返す。
+// 呼び出し側はフォルダを書き換えないこと（書き換えるベンチマークはコピーを使う）。
+func benchSaveFolder(b *testing.B, name string, generate func(dir string) (*benchSaveFixture, error)) *benchSaveFixture {
+	b.Helper()
+	benchFixtures.mu.Lock()
+	defer benchFixtures.mu.Unlock()
+	if fixture, ok := benchFixtures.dirs[name]; ok {
+		return fixture
+	}
+	if benchFixtures.root == "" {
+		root, err := os.MkdirTemp("", "cloudlaunch-bench-")
+		if err != nil {
+			b.Fatalf("MkdirTemp: %v", err)
+		}
+		benchFixtures.root = root
+		benchFixtures.dirs = make(map[string]*benchSaveFixture)
+	}
+	fixture, err := generate(filepath.Join(benchFixtures.root, name))
+	if err != nil {
+		b.Fatalf("generate %s: %v", name, err)
+	}
+	benchFixtures.dirs[name] = fixture
+	return fixture
+}
+
+// benchSmallFiles は 100 フォルダに分けた 1 KiB のファイル 10k 件（設定ファイルやスロット分割のセーブ）。
+func benchSmallFiles(b *testing.B) *benchSaveFixture {
+	return benchSaveFolder(b, "small", func(dir string) (*benchSaveFixture, error) {
+		relPaths := make([]string, 0, benchSmallFileCount)
+		for i := range benchSmallFileCount {
+			relPaths = append(relPaths, fmt.Sprintf("slot%03d/save%05d.dat", i%100, i))
+		}
+		return writeBenchFiles(dir, relPaths, func(int) int64 { return benchSmallFileSize })
+	})
+}
+
+// benchDeepTree は 64 本のディレクトリを 32 段ずつ掘り、各段に 2 ファイルずつ置いたツリー（4096 件）。
+func benchDeepTree(b *testing.B) *benchSaveFixture {
+	return benchSaveFolder(b, "deep", func(dir string) (*benchSaveFixture, error) {
+		relPaths := make([]string, 0, benchDeepBranches*benchDeepDepth*2)
+		for branch := range benchDeepBranches {
+			prefix := fmt.Sprintf("b%02d", branch)
+			for depth := range benchDeepDepth {
+				prefix += "/d" + strconv.Itoa(depth)
+				relPaths = append(relPaths, prefix+"/a.sav", prefix+"/b.sav")
+			}
+		}
+		return writeBenchFiles(dir, relPaths, func(int) int64 { return 256 })
+	})
+}
+
+// benchLargeFiles は大きいファイル 3 件（既定 96 MiB ずつ。チャンク分割の閾値を超える）。
+func benchLargeFiles(b *testing.B) *benchSaveFixture {
+	sizeMB := int64(benchLargeFileMB)
+	if value, err := strconv.ParseInt(os.Getenv(benchLargeFileMBEnv), 10, 64); err == nil && value > 0 {
+		sizeMB = value
+	}
+	return benchSaveFolder(b, "large-"+strconv.FormatInt(sizeMB, 10), func(dir string) (*benchSaveFixture, error) {
+		relPaths := make([]string, 0, benchLargeFileCount)
+		for i := range benchLargeFileCount {
+			relPaths = append(relPaths, fmt.Sprintf("world%d.bin", i))
+		}
+		return writeBenchFiles(dir, relPaths, func(int) int64 { return sizeMB << 20 })
+	})
+}
+
+// writeBenchFiles は relPaths のファイルを size(i) バイトずつ乱数で埋める（ファイル間・ファイル内とも重複排除が効かないように）。
+// mtime は1時間前にそろえる（書き込み直後のファイルはハッシュキャッシュが信用しないため）。
+func writeBenchFiles(dir string, relPaths []string, size func(i int) int64) (*benchSaveFixture, error) {
+	fixture := &benchSaveFixture{dir: dir, relPath: relPaths}
+	modTime := time.Now().Add(-time.Hour)
+	block := make([]byte, 1<<20)
+	random := rand.New(rand.NewSource(1))
+	for i, relPath := range relPaths {
+		path := filepath.Join(dir, filepath.FromSlash(relPath))
+		if err := os.MkdirAll(filepath.Dir(path), 0o700); err != nil {
+			return nil, err
+		}
+		file, err := os.Create(path)
+		if err != nil {
+			return nil, err
+		}
+		remaining := size(i)
+		fixture.bytes += remaining
+		for remaining > 0 && err == nil {
+			chunk := block[:min(int64(len(block)), remaining)]
+			_, _ = random.Read(chunk)
+			var n int
+			n, err = file.Write(chunk)
+			remaining -= int64(n)
+		}
+		if closeErr := file.Close(); err == nil {
+			err = closeErr
+		}
+		if err != nil {
+			return nil, err
+		}
+		if err := os.Chtimes(path, modTime, modTime); err != nil {
+			return nil, err
+		}
+	}
+	return fixture, nil
+}
+
+// benchSaveShape はセーブフォルダを受け取るベンチマークで回す形状。
+type benchSaveShape struct {
+	name    string
+	fixture func(b *testing.B) *benchSaveFixture
+}
+
+var benchSaveShapes = []benchSaveShape{
+	{"small10k", benchSmallFiles},
+	{"deep", benchDeepTree},
+	{"large", benchLargeFiles},
+}
@@ -0,0 +1,79 @@
+// ディスクキャッシュのディレクトリの掃除を提供する。
+package services
+
+import (
+	"errors"
+	"os"
+	"path/filepath"
+	"sort"
+	"strings"
+	"time"
+)
+
+// cacheTempMaxAge より古い一時ファイル（.tmp-*）は書き込みの途中で終了した残りとみなして消す。
+const cacheTempMaxAge = time.Hour
+
+// pruneCacheDir は dir 直下のキャッシュファイルを掃除し、消したファイル数を返す。
+// keep（nil 可）がファイル名と更新時刻を見て false を返すファイルと古い一時ファイルを消し、残りの合計が maxBytes を超えていれば
+// 更新時刻の古い順に消す。maxBytes <= 0 なら大きさでは消さない。
+func pruneCacheDir(dir string, maxBytes int64, keep func(name string, modTime time.Time) bool) (int, error) {
+	entries, err := os.ReadDir(dir)
+	if err != nil {
+		if os.IsNotExist(err) {
+			return 0, nil
+		}
+		return 0, err
+	}
+	type cacheFile struct {
+		name    string
+		size    int64
+		modTime time.Time
+	}
+	var errs []error
+	removed := 0
+	remove := func(name string) {
+		if err := os.Remove(filepath.Join(dir, name)); err != nil && !os.IsNotExist(err) {
+			errs = append(errs, err)
+			return
+		}
+		removed++
+	}
+
+	now := time.Now()
+	files := make([]cacheFile, 0, len(entries))
+	var total int64
+	for _, entry := range entries {
+		if !entry.Type().IsRegular() {
+			continue
+		}
+		info, err := entry.Info()
+		if err != nil {
+			continue
+		}
+		name := entry.Name()
+		if strings.HasPrefix(name, ".tmp-") {
+			if now.Sub(info.ModTime()) > cacheTempMaxAge {
+				remove(name)
+			}
+			continue
+		}
+		if keep != nil && !keep(name, info.ModTime()) {
+			remove(name)
+			continue
+		}
+		files = append(files, cacheFile{name: name, size: info.Size(), modTime: info.ModTime()})
+		total += info.Size()
+	}
+
+	if maxBytes > 0 && total > maxBytes {
+		sort.Slice(files, func(i, j int) bool { return files[i].modTime.Before(files[j].modTime) })
+		for _, file := range files {
+			if total <= maxBytes {
+				break
+			}
+			remove(file.name)
+			total -= file.size
+		}
+	}
+	return removed, errors.Join(errs...)
+}
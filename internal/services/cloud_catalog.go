@@ -0,0 +1,289 @@
+// バケット直下のクラウドカタログ（全ゲームの一覧用キャッシュ）の読み書きと一覧への適用を提供する。
+package services
+
+import (
+	"context"
+	"encoding/json"
+	"errors"
+	"time"
+
+	"CloudLaunch_Go/internal/domain"
+	"CloudLaunch_Go/internal/infrastructure/storage"
+)
+
+const (
+	// cloudCatalogKey はカタログのオブジェクトキー。games/ の外に置き、ゲーム単位の削除や列挙に巻き込まない。
+	cloudCatalogKey = "cloudlaunch-catalog.json"
+	// cloudCatalogVersion を上げると旧形式のカタログは「無い」扱いになり、一覧時に作り直される。
+	cloudCatalogVersion = 1
+	// cloudCatalogMaxAttempts は条件付き書き込みが競合したときの読み直し回数の上限。
+	cloudCatalogMaxAttempts = 5
+	// cloudCatalogEntryMaxAge より前に確かめた項目は、一覧時に HEAD を読み直して確かめ直す。
+	// Push のカタログ更新は失敗しても同期を成功扱いにするため、取りこぼした項目が古いまま残り続けないようにする。
+	cloudCatalogEntryMaxAge = time.Hour
+)
+
+// cloudCatalog は全ゲームの一覧表示に必要な情報をまとめたもの。
+// ゲームごとの HEAD → commit → game.json の逐次 GET を、一覧時は 1 GET に置き換えるためのキャッシュで、
+// 正はあくまで各ゲームの HEAD。欠けたエントリと古いエントリは一覧時に個別取得して補う。
+type cloudCatalog struct {
+	Version int                          `json:"version"`
+	Games   map[string]cloudCatalogEntry `json:"games"`
+}
+
+// cloudCatalogEntry は1ゲーム分のカタログ項目。Head はこの項目を書いた時点のリモート HEAD、
+// CheckedAt は Head がリモートと一致することを最後に確かめた時刻（この項目を持たない旧カタログの項目はゼロ値で、古い扱い）。
+type cloudCatalogEntry struct {
+	Head         domain.BlobHash `json:"head"`
+	CheckedAt    time.Time       `json:"checkedAt"`
+	Title        string          `json:"title"`
+	LastModified time.Time       `json:"lastModified"`
+	FileCount    int64           `json:"fileCount"`
+	TotalSize    int64           `json:"totalSize"`
+	Game         *CloudGameInfo  `json:"game,omitempty"` // game.json を読めなかった場合は nil（カタログには保存しない）
+
+	gameID string // カタログ上はマップのキー。loadCloudCatalogEntries の戻り値でだけ埋める
+}
+
+// readCloudCatalog はカタログと ETag を返す。無い・壊れている・版が違う場合は catalog を nil で返す
+// （etag は返すので、そのまま上書きできる）。
+func (s *ContentSyncService) readCloudCatalog(ctx context.Context, bstore contentBlobStore) (*cloudCatalog, string, error) {
+	data, etag, err := bstore.readCatalog(ctx)
+	if err != nil || data == nil {
+		return nil, etag, err
+	}
+	var catalog cloudCatalog
+	if err := json.Unmarshal(data, &catalog); err != nil || catalog.Version != cloudCatalogVersion {
+		s.logger.Warn("クラウドカタログを読めないため作り直します", "error", err, "version", catalog.Version)
+		return nil, etag, nil
+	}
+	if catalog.Games == nil {
+		catalog.Games = make(map[string]cloudCatalogEntry)
+	}
+	return &catalog, etag, nil
+}
+
+// updateCloudCatalog はカタログを読み、mutate で書き換えて ETag 一致を条件に書き戻す。
+// 他端末と競合したら読み直してやり直す。mutate が false を返したら書き込まない。
+// カタログはキャッシュなので失敗しても同期自体は成功扱いにし、古い項目を残さないようカタログを消しておく
+// （次回の一覧で全ゲームを個別取得して作り直す）。
+func (s *ContentSyncService) updateCloudCatalog(ctx context.Context, bstore contentBlobStore, mutate func(catalog *cloudCatalog) bool) {
+	err := s.tryUpdateCloudCatalog(ctx, bstore, mutate)
+	if err == nil {
+		return
+	}
+	s.logger.Warn("クラウドカタログの更新に失敗（カタログを破棄）", "error", err)
+	if delErr := bstore.deleteCatalog(ctx); delErr != nil {
+		s.logger.Warn("クラウドカタログの破棄に失敗", "error", delErr)
+	}
+}
+
+func (s *ContentSyncService) tryUpdateCloudCatalog(ctx context.Context, bstore contentBlobStore, mutate func(catalog *cloudCatalog) bool) error {
+	for attempt := 0; attempt < cloudCatalogMaxAttempts; attempt++ {
+		catalog, etag, err := s.readCloudCatalog(ctx, bstore)
+		if err != nil {
+			return err
+		}
+		if catalog == nil {
+			catalog = &cloudCatalog{Version: cloudCatalogVersion, Games: make(map[string]cloudCatalogEntry)}
+		}
+		if !mutate(catalog) {
+			return nil
+		}
+		data, err := json.Marshal(catalog)
+		if err != nil {
+			return err
+		}
+		err = bstore.writeCatalog(ctx, data, etag)
+		if !errors.Is(err, storage.ErrPreconditionFailed) {
+			return err
+		}
+	}
+	return errors.New("クラウドカタログの更新が競合し続けました")
+}
+
+// newCloudCatalogEntry はコミットと game.json からカタログ項目を作る。
+// game.json を解析できなければ Game を nil にし、Title は gameID で代用する（一覧が空欄にならないよう）。
+func newCloudCatalogEntry(gameID string, head domain.BlobHash, meta domain.MetaSnapshot, gameJSON []byte) (cloudCatalogEntry, error) {
+	entry := cloudCatalogEntry{
+		Head:         head,
+		CheckedAt:    time.Now().UTC(),
+		Title:        gameID,
+		LastModified: meta.CreatedAt,
+		FileCount:    meta.FileCount,
+		TotalSize:    meta.TotalSize,
+	}
+	var cg cloudGame
+	if err := json.Unmarshal(gameJSON, &cg); err != nil {
+		return entry, err
+	}
+	info := cg.info()
+	entry.Game = &info
+	if cg.Title != "" {
+		entry.Title = cg.Title
+	}
+	return entry, nil
+}
+
+// loadCloudCatalogEntry は HEAD → commit → game.json を読んで1ゲーム分の項目を作る。
+// HEAD 未設定やコミットの取得・解析失敗時は（必要なら警告ログを出して）nil を返す。
+func (s *ContentSyncService) loadCloudCatalogEntry(ctx context.Context, bstore contentBlobStore, gameID string) *cloudCatalogEntry {
+	head, err := bstore.readHEAD(ctx, gameID)
+	if err != nil || head == "" {
+		return nil
+	}
+	metaBytes, err := bstore.getBlob(ctx, gameID, storage.BlobKindCommit, head)
+	if err != nil {
+		s.logger.Warn("コミットブロブ取得失敗", "gameId", gameID, "error", err)
+		return nil
+	}
+	var meta domain.MetaSnapshot
+	if err := json.Unmarshal(metaBytes, &meta); err != nil {
+		s.logger.Warn("コミットブロブ解析失敗", "gameId", gameID, "error", err)
+		return nil
+	}
+	gameJSONBytes, err := bstore.getBlob(ctx, gameID, storage.BlobKindMeta, meta.GameJSON)
+	if err != nil {
+		s.logger.Warn("game.json取得失敗", "gameId", gameID, "error", err)
+	}
+	entry, err := newCloudCatalogEntry(gameID, domain.BlobHash(head), meta, gameJSONBytes)
+	if err != nil && gameJSONBytes != nil {
+		s.logger.Warn("game.json解析失敗", "gameId", gameID, "error", err)
+	}
+	return &entry
+}
+
+// revalidateCloudCatalogEntry は古くなった項目 cached を確かめ直す。HEAD が変わっていなければ CheckedAt だけ進め
+// （HEAD の GET 1 回）、変わっていれば loadCloudCatalogEntry で作り直す。読めなければ nil を返す。
+func (s *ContentSyncService) revalidateCloudCatalogEntry(ctx context.Context, bstore contentBlobStore, gameID string, cached cloudCatalogEntry) *cloudCatalogEntry {
+	head, err := bstore.readHEAD(ctx, gameID)
+	if err != nil || head == "" {
+		return nil
+	}
+	if domain.BlobHash(head) == cached.Head {
+		cached.CheckedAt = time.Now().UTC()
+		return &cached
+	}
+	return s.loadCloudCatalogEntry(ctx, bstore, gameID)
+}
+
+// putCloudCatalogEntry は Push で HEAD を書き換えたゲームの項目を差し替える。
+func (s *ContentSyncService) putCloudCatalogEntry(ctx context.Context, bstore contentBlobStore, gameID string, head domain.BlobHash, meta metaBuildResult) {
+	entry, err := newCloudCatalogEntry(gameID, head, meta.Snapshot, meta.GameJSON)
+	if err != nil {
+		s.logger.Warn("game.json解析失敗（カタログ更新をスキップ）", "gameId", gameID, "error", err)
+		return
+	}
+	s.updateCloudCatalog(ctx, bstore, func(catalog *cloudCatalog) bool {
+		catalog.Games[gameID] = entry
+		return true
+	})
+}
+
+// removeCloudCatalogEntry は DeleteFromCloud したゲームの項目を外す。
+func (s *ContentSyncService) removeCloudCatalogEntry(ctx context.Context, bstore contentBlobStore, gameID string) {
+	s.updateCloudCatalog(ctx, bstore, func(catalog *cloudCatalog) bool {
+		if _, ok := catalog.Games[gameID]; !ok {
+			return false
+		}
+		delete(catalog.Games, gameID)
+		return true
+	})
+}
+
+// loadCloudCatalogEntries は listGameIDs の順にカタログ項目を返す（データの無いゲームは含まない）。
+// 列挙は CommonPrefixes だけの安価な 1 リクエストで、カタログの欠け・消えたゲームの検出に使う。
+// カタログにあるゲームはそのまま使い、無いゲームは個別取得、cloudCatalogEntryMaxAge より古い項目は
+// revalidateCloudCatalogEntry で確かめ直す（どちらも最大 concurrency 並列）。確かめ直せなかった項目は古いまま使う。
+// 個別取得・確かめ直した分やリモートから消えたゲームがあれば、カタログを修復しておく。
+func (s *ContentSyncService) loadCloudCatalogEntries(ctx context.Context, bstore contentBlobStore, concurrency int) ([]cloudCatalogEntry, error) {
+	gameIDs, err := bstore.listGameIDs(ctx)
+	if err != nil {
+		return nil, err
+	}
+	catalog, _, err := s.readCloudCatalog(ctx, bstore)
+	if err != nil {
+		// 読めなくても一覧は個別取得で出せる
+		s.logger.Warn("クラウドカタログ取得失敗（個別取得で続行）", "error", err)
+		catalog = nil
+	}
+	cached := map[string]cloudCatalogEntry{}
+	if catalog != nil {
+		cached = catalog.Games
+	}
+
+	listed := make(map[string]struct{}, len(gameIDs))
+	staleBefore := time.Now().Add(-cloudCatalogEntryMaxAge)
+	var refetch []string
+	for _, id := range gameIDs {
+		listed[id] = struct{}{}
+		if entry, ok := cached[id]; !ok || entry.CheckedAt.Before(staleBefore) {
+			refetch = append(refetch, id)
+		}
+	}
+	type fetched struct {
+		id    string
+		entry cloudCatalogEntry
+	}
+	found := fanOutGames(refetch, concurrency, func(id string) *fetched {
+		var entry *cloudCatalogEntry
+		if prev, ok := cached[id]; ok {
+			entry = s.revalidateCloudCatalogEntry(ctx, bstore, id, prev)
+		} else {
+			entry = s.loadCloudCatalogEntry(ctx, bstore, id)
+		}
+		if entry == nil {
+			return nil
+		}
+		return &fetched{id: id, entry: *entry}
+	})
+	fetchedByID := make(map[string]cloudCatalogEntry, len(found))
+	for _, f := range found {
+		fetchedByID[f.id] = f.entry
+	}
+	vanished := make(map[string]domain.BlobHash)
+	for id, entry := range cached {
+		if _, ok := listed[id]; !ok {
+			vanished[id] = entry.Head
+		}
+	}
+
+	if catalog == nil || len(fetchedByID) > 0 || len(vanished) > 0 {
+		s.updateCloudCatalog(ctx, bstore, func(latest *cloudCatalog) bool {
+			changed := false
+			for id, entry := range fetchedByID {
+				if entry.Game == nil {
+					continue
+				}
+				// 読み込み後に Push した端末の項目のほうが新しいので上書きしない
+				current, inLatest := latest.Games[id]
+				prev, inCached := cached[id]
+				if !inLatest && !inCached ||
+					inLatest && inCached && current.Head == prev.Head && current.CheckedAt.Equal(prev.CheckedAt) {
+					latest.Games[id] = entry
+					changed = true
+				}
+			}
+			for id, head := range vanished {
+				if entry, ok := latest.Games[id]; ok && entry.Head == head {
+					delete(latest.Games, id)
+					changed = true
+				}
+			}
+			return changed
+		})
+	}
+
+	entries := make([]cloudCatalogEntry, 0, len(gameIDs))
+	for _, id := range gameIDs {
+		entry, ok := fetchedByID[id]
+		if !ok {
+			entry, ok = cached[id]
+		}
+		if ok {
+			entry.gameID = id
+			entries = append(entries, entry)
+		}
+	}
+	return entries, nil
+}
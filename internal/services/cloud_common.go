@@ -27,30 +27,43 @@ func resolveS3Config(base config.Config, credential *credentials.Credential) sto
 // cloudObjectStore は MemoCloudService が依存するストレージ操作を抽象化する。
 type cloudObjectStore interface {
 	ListObjects(ctx context.Context, cfg storage.S3Config, credential credentials.Credential, prefix string) ([]storage.ObjectInfo, error)
-	UploadBytes(ctx context.Context, cfg storage.S3Config, credential credentials.Credential, key string, payload []byte, contentType string) error
+	ListChildPrefixes(ctx context.Context, cfg storage.S3Config, credential credentials.Credential, prefix string) ([]string, error)
+	// UploadBytes は書き込んだオブジェクトの ETag を返す。
+	UploadBytes(ctx context.Context, cfg storage.S3Config, credential credentials.Credential, key string, payload []byte, contentType string) (string, error)
 	DownloadObject(ctx context.Context, cfg storage.S3Config, credential credentials.Credential, key string) ([]byte, error)
 }
 
-type storageCloudObjectStore struct{}
+// storageCloudObjectStore は storage パッケージの共有クライアントで cloudObjectStore を実装する。
+type storageCloudObjectStore struct {
+	concurrency int // 共有クライアントのコネクションプールの目安
+}
 
-func (storageCloudObjectStore) ListObjects(ctx context.Context, cfg storage.S3Config, credential credentials.Credential, prefix string) ([]storage.ObjectInfo, error) {
-	client, err := storage.NewClient(ctx, cfg, credential)
+func (o storageCloudObjectStore) ListObjects(ctx context.Context, cfg storage.S3Config, credential credentials.Credential, prefix string) ([]storage.ObjectInfo, error) {
+	client, err := storage.SharedClient(ctx, cfg, credential, o.concurrency)
 	if err != nil {
 		return nil, err
 	}
 	return storage.ListObjects(ctx, client, cfg.Bucket, prefix)
 }
 
-func (storageCloudObjectStore) UploadBytes(ctx context.Context, cfg storage.S3Config, credential credentials.Credential, key string, payload []byte, contentType string) error {
-	client, err := storage.NewClient(ctx, cfg, credential)
+func (o storageCloudObjectStore) ListChildPrefixes(ctx context.Context, cfg storage.S3Config, credential credentials.Credential, prefix string) ([]string, error) {
+	client, err := storage.SharedClient(ctx, cfg, credential, o.concurrency)
+	if err != nil {
+		return nil, err
+	}
+	return storage.ListChildPrefixes(ctx, client, cfg.Bucket, prefix)
+}
+
+func (o storageCloudObjectStore) UploadBytes(ctx context.Context, cfg storage.S3Config, credential credentials.Credential, key string, payload []byte, contentType string) (string, error) {
+	client, err := storage.SharedClient(ctx, cfg, credential, o.concurrency)
 	if err != nil {
-		return err
+		return "", err
 	}
-	return storage.UploadBytes(ctx, client, cfg.Bucket, key, payload, contentType)
+	return storage.PutBytes(ctx, client, cfg.Bucket, key, payload, contentType)
 }
 
-func (storageCloudObjectStore) DownloadObject(ctx context.Context, cfg storage.S3Config, credential credentials.Credential, key string) ([]byte, error) {
-	client, err := storage.NewClient(ctx, cfg, credential)
+func (o storageCloudObjectStore) DownloadObject(ctx context.Context, cfg storage.S3Config, credential credentials.Credential, key string) ([]byte, error) {
+	client, err := storage.SharedClient(ctx, cfg, credential, o.concurrency)
 	if err != nil {
 		return nil, err
 	}
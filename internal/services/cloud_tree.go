@@ -0,0 +1,214 @@
+// クラウドの論理セーブツリーをディレクトリ1階層ずつ返す索引と、そのキャッシュを提供する。
+package services
+
+import (
+	"context"
+	"encoding/base64"
+	"errors"
+	"fmt"
+	"sort"
+	"strings"
+	"sync"
+	"time"
+)
+
+const (
+	// cloudDirectoryPageLimit は ListCloudDirectory の limit 未指定時の件数、cloudDirectoryPageMaxLimit は上限。
+	cloudDirectoryPageLimit    = 200
+	cloudDirectoryPageMaxLimit = 1000
+	// cloudTreeCacheGames は索引を保持するゲーム数の上限。超えたら最も長く使っていないゲームから捨てる。
+	cloudTreeCacheGames = 16
+)
+
+// ErrCloudDirectoryNotFound は ListCloudDirectory の dirPath がクラウドのセーブツリーに無いことを表す。
+var ErrCloudDirectoryNotFound = errors.New("クラウドにディレクトリが見つかりません")
+
+// CloudDirectoryEntry はクラウド論理ツリーの1要素（ファイルまたはディレクトリ）。
+type CloudDirectoryEntry struct {
+	Name        string `json:"name"`
+	RelPath     string `json:"relPath"` // ゲーム直下からのスラッシュ区切りパス
+	IsDirectory bool   `json:"isDirectory"`
+	Size        int64  `json:"size"`      // ディレクトリは配下の合計
+	FileCount   int64  `json:"fileCount"` // ディレクトリは配下のファイル数、ファイルは 1
+}
+
+// CloudDirectoryPage はクラウド論理ツリーの1ディレクトリ分の1ページ。NextCursor が空なら最後のページ。
+type CloudDirectoryPage struct {
+	GameID       string                `json:"gameId"`
+	Title        string                `json:"title"`
+	Entries      []CloudDirectoryEntry `json:"entries"`
+	NextCursor   string                `json:"nextCursor"`
+	LastModified time.Time             `json:"lastModified"`
+}
+
+// cloudTreeIndex は1ゲームの論理ビューをディレクトリごとに名前順で並べたもの。キーはディレクトリの相対パス（ルートは ""）。
+type cloudTreeIndex struct {
+	children map[string][]CloudDirectoryEntry
+}
+
+// buildCloudTreeIndex は論理ビューのファイル一覧から各ディレクトリ直下の要素とディレクトリごとの合計を作る。
+// 空のパス要素は buildGameDirectoryNode と同じく読み飛ばす。同じ名前のファイルとディレクトリがあればディレクトリとして扱う。
+func buildCloudTreeIndex(view CloudGameView) *cloudTreeIndex {
+	type dirTotals struct{ size, count int64 }
+	totals := map[string]*dirTotals{"": {}}
+	names := map[string]map[string]bool{"": {}} // 親ディレクトリ → 子の名前 → ディレクトリか
+	fileSizes := make(map[string]int64, len(view.Files))
+	for _, file := range view.Files {
+		segments := strings.FieldsFunc(file.RelPath, func(r rune) bool { return r == '/' })
+		parent := ""
+		for idx, segment := range segments {
+			totals[parent].size += file.Size
+			totals[parent].count++
+			relPath := segment
+			if parent != "" {
+				relPath = parent + "/" + segment
+			}
+			isDirectory := idx < len(segments)-1
+			names[parent][segment] = names[parent][segment] || isDirectory
+			if !isDirectory {
+				fileSizes[relPath] = file.Size
+				break
+			}
+			if _, ok := totals[relPath]; !ok {
+				totals[relPath] = &dirTotals{}
+				names[relPath] = map[string]bool{}
+			}
+			parent = relPath
+		}
+	}
+
+	index := &cloudTreeIndex{children: make(map[string][]CloudDirectoryEntry, len(names))}
+	for parent, childNames := range names {
+		entries := make([]CloudDirectoryEntry, 0, len(childNames))
+		for name, isDirectory := range childNames {
+			relPath := name
+			if parent != "" {
+				relPath = parent + "/" + name
+			}
+			entry := CloudDirectoryEntry{Name: name, RelPath: relPath, IsDirectory: isDirectory, Size: fileSizes[relPath], FileCount: 1}
+			if isDirectory {
+				entry.Size, entry.FileCount = totals[relPath].size, totals[relPath].count
+			}
+			entries = append(entries, entry)
+		}
+		sort.Slice(entries, func(i, j int) bool { return entries[i].Name < entries[j].Name })
+		index.children[parent] = entries
+	}
+	return index
+}
+
+// page は dirPath 直下の要素を cursor（前ページ最後の要素の名前を符号化したもの）の次から最大 limit 件返す。
+func (index *cloudTreeIndex) page(dirPath, cursor string, limit int) ([]CloudDirectoryEntry, string, error) {
+	entries, ok := index.children[dirPath]
+	if !ok {
+		return nil, "", ErrCloudDirectoryNotFound
+	}
+	start := 0
+	if cursor != "" {
+		after, err := base64.RawURLEncoding.DecodeString(cursor)
+		if err != nil {
+			return nil, "", fmt.Errorf("invalid cursor: %w", err)
+		}
+		start = sort.Search(len(entries), func(i int) bool { return entries[i].Name > string(after) })
+	}
+	end := min(start+limit, len(entries))
+	next := ""
+	if end < len(entries) {
+		next = base64.RawURLEncoding.EncodeToString([]byte(entries[end-1].Name))
+	}
+	return entries[start:end], next, nil
+}
+
+// cloudTreeCache はゲームごとに最新のセーブツリー1つ分の索引を持つ。セーブツリーのハッシュが変われば作り直す。
+// ゼロ値のまま使える。
+type cloudTreeCache struct {
+	mu    sync.Mutex
+	games map[string]*cloudTreeCacheEntry
+}
+
+type cloudTreeCacheEntry struct {
+	savesHash string
+	index     *cloudTreeIndex
+	usedAt    time.Time
+}
+
+func (cache *cloudTreeCache) get(gameID, savesHash string) *cloudTreeIndex {
+	cache.mu.Lock()
+	defer cache.mu.Unlock()
+	entry, ok := cache.games[gameID]
+	if !ok || entry.savesHash != savesHash {
+		return nil
+	}
+	entry.usedAt = time.Now()
+	return entry.index
+}
+
+func (cache *cloudTreeCache) put(gameID, savesHash string, index *cloudTreeIndex) {
+	cache.mu.Lock()
+	defer cache.mu.Unlock()
+	if cache.games == nil {
+		cache.games = make(map[string]*cloudTreeCacheEntry)
+	}
+	if _, ok := cache.games[gameID]; !ok && len(cache.games) >= cloudTreeCacheGames {
+		oldestID := ""
+		var oldest time.Time
+		for id, entry := range cache.games {
+			if oldestID == "" || entry.usedAt.Before(oldest) {
+				oldestID, oldest = id, entry.usedAt
+			}
+		}
+		delete(cache.games, oldestID)
+	}
+	cache.games[gameID] = &cloudTreeCacheEntry{savesHash: savesHash, index: index, usedAt: time.Now()}
+}
+
+// ListCloudDirectory は gameID のクラウド論理ツリーのうち dirPath（ゲーム直下からのスラッシュ区切り、"" はゲーム直下）の
+// 直下の要素を名前順に最大 limit 件返す（0 以下は既定件数）。続きは戻り値の NextCursor を cursor に渡して取得する。
+// 索引はゲームごとにセーブツリーのハッシュで保持し、HEAD が別のセーブツリーを指すまで objects の列挙をやり直さない
+// （呼び出しごとの取得は HEAD とコミットのみで、いずれも BlobCache が効く）。
+// HEAD 未設定やコミット解析失敗時は (nil, nil)、dirPath が無ければ ErrCloudDirectoryNotFound を返す。
+// 優先度の既定は Background で、UI から呼ぶ場合は WithSyncPriority で Interactive を指定する。
+func (s *ContentSyncService) ListCloudDirectory(ctx context.Context, gameID, dirPath, cursor string, limit int) (_ *CloudDirectoryPage, err error) {
+	ctx, release, err := s.admit(ctx, SyncPriorityBackground)
+	if err != nil {
+		return nil, err
+	}
+	defer release()
+	ctx, span := s.metrics.startSpan(ctx, "cloud_directory")
+	defer func() { span.end(err) }()
+	if limit <= 0 {
+		limit = cloudDirectoryPageLimit
+	}
+	limit = min(limit, cloudDirectoryPageMaxLimit)
+	dirPath = strings.Trim(dirPath, "/")
+
+	bstore, err := s.newBlobStore(ctx)
+	if err != nil {
+		return nil, err
+	}
+	meta, title, err := s.loadCloudCommit(ctx, bstore, gameID)
+	if err != nil || meta == nil {
+		return nil, err
+	}
+	index := s.cloudTrees.get(gameID, meta.Saves)
+	if index == nil {
+		view, verr := s.cloudGameViewFromCommit(ctx, bstore, gameID, meta, title)
+		if verr != nil || view == nil {
+			return nil, verr
+		}
+		index = buildCloudTreeIndex(*view)
+		s.cloudTrees.put(gameID, meta.Saves, index)
+	}
+	entries, next, err := index.page(dirPath, cursor, limit)
+	if err != nil {
+		return nil, err
+	}
+	span.addObjects(int64(len(entries)))
+	return &CloudDirectoryPage{
+		GameID:       gameID,
+		Title:        title,
+		Entries:      entries,
+		NextCursor:   next,
+		LastModified: meta.CreatedAt,
+	}, nil
+}
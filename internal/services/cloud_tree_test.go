@@ -0,0 +1,123 @@
+package services
+
+import (
+	"context"
+	"errors"
+	"os"
+	"path/filepath"
+	"testing"
+)
+
+func writeCloudTreeSaves(t *testing.T, saveDir string, files map[string]string) {
+	t.Helper()
+	for relPath, content := range files {
+		path := filepath.Join(saveDir, filepath.FromSlash(relPath))
+		if err := os.MkdirAll(filepath.Dir(path), 0o700); err != nil {
+			t.Fatal(err)
+		}
+		if err := os.WriteFile(path, []byte(content), 0o600); err != nil {
+			t.Fatal(err)
+		}
+	}
+}
+
+func cloudEntryNames(entries []CloudDirectoryEntry) []string {
+	names := make([]string, 0, len(entries))
+	for _, entry := range entries {
+		names = append(names, entry.Name)
+	}
+	return names
+}
+
+// TestContentSyncServiceListCloudDirectoryPagesOneLevel は、1階層分だけを名前順・カーソル付きで返し、
+// ディレクトリには配下の合計サイズとファイル数が入ることを確認する。
+func TestContentSyncServiceListCloudDirectoryPagesOneLevel(t *testing.T) {
+	t.Parallel()
+
+	saveDir := t.TempDir()
+	writeCloudTreeSaves(t, saveDir, map[string]string{
+		"a.sav":            "aaa",
+		"slot1/x.dat":      "xxxxx",
+		"slot1/deep/y.dat": "yyyyyyy",
+		"slot2/z.dat":      "zzzzzzzzzzz",
+	})
+	game := baseGame(saveDir)
+	bstore := newFakeBlobStore()
+	setupRemoteState(t, bstore, game.ID, game, nil, saveDir)
+	svc := newTestService(newFakeRepo(&game, nil), bstore)
+	ctx := context.Background()
+
+	first, err := svc.ListCloudDirectory(ctx, game.ID, "", "", 2)
+	if err != nil {
+		t.Fatalf("ListCloudDirectory: %v", err)
+	}
+	if got := cloudEntryNames(first.Entries); len(got) != 2 || got[0] != "a.sav" || got[1] != "slot1" {
+		t.Fatalf("unexpected first page: %v", got)
+	}
+	if first.Title != game.Title || first.NextCursor == "" {
+		t.Fatalf("unexpected page metadata: %+v", first)
+	}
+	slot1 := first.Entries[1]
+	if !slot1.IsDirectory || slot1.RelPath != "slot1" || slot1.Size != 12 || slot1.FileCount != 2 {
+		t.Fatalf("unexpected directory entry: %+v", slot1)
+	}
+
+	second, err := svc.ListCloudDirectory(ctx, game.ID, "", first.NextCursor, 2)
+	if err != nil {
+		t.Fatalf("ListCloudDirectory next: %v", err)
+	}
+	if got := cloudEntryNames(second.Entries); len(got) != 1 || got[0] != "slot2" || second.NextCursor != "" {
+		t.Fatalf("unexpected second page: %v (next %q)", got, second.NextCursor)
+	}
+
+	nested, err := svc.ListCloudDirectory(ctx, game.ID, "slot1", "", 0)
+	if err != nil {
+		t.Fatalf("ListCloudDirectory slot1: %v", err)
+	}
+	if got := cloudEntryNames(nested.Entries); len(got) != 2 || got[0] != "deep" || got[1] != "x.dat" {
+		t.Fatalf("unexpected nested page: %v", got)
+	}
+	if file := nested.Entries[1]; file.IsDirectory || file.RelPath != "slot1/x.dat" || file.Size != 5 {
+		t.Fatalf("unexpected file entry: %+v", file)
+	}
+
+	if _, err := svc.ListCloudDirectory(ctx, game.ID, "missing", "", 0); !errors.Is(err, ErrCloudDirectoryNotFound) {
+		t.Fatalf("expected ErrCloudDirectoryNotFound, got %v", err)
+	}
+}
+
+// TestContentSyncServiceListCloudDirectoryCachesBySaveTree は、同じセーブツリーの間は objects を列挙し直さず、
+// HEAD が別のセーブツリーを指したら作り直すことを確認する。
+func TestContentSyncServiceListCloudDirectoryCachesBySaveTree(t *testing.T) {
+	t.Parallel()
+
+	saveDir := t.TempDir()
+	writeCloudTreeSaves(t, saveDir, map[string]string{"slot1/x.dat": "x"})
+	game := baseGame(saveDir)
+	bstore := newFakeBlobStore()
+	setupRemoteState(t, bstore, game.ID, game, nil, saveDir)
+	svc := newTestService(newFakeRepo(&game, nil), bstore)
+	ctx := context.Background()
+
+	for _, dirPath := range []string{"", "slot1", ""} {
+		if _, err := svc.ListCloudDirectory(ctx, game.ID, dirPath, "", 0); err != nil {
+			t.Fatalf("ListCloudDirectory %q: %v", dirPath, err)
+		}
+	}
+	if bstore.objectListings != 1 {
+		t.Fatalf("expected objects to be listed once, got %d", bstore.objectListings)
+	}
+
+	writeCloudTreeSaves(t, saveDir, map[string]string{"slot2/y.dat": "yy"})
+	setupRemoteState(t, bstore, game.ID, game, nil, saveDir)
+	page, err := svc.ListCloudDirectory(ctx, game.ID, "", "", 0)
+	if err != nil {
+		t.Fatalf("ListCloudDirectory after push: %v", err)
+	}
+	if got := cloudEntryNames(page.Entries); len(got) != 2 || got[1] != "slot2" {
+		t.Fatalf("expected rebuilt tree, got %v", got)
+	}
+	if bstore.objectListings != 2 {
+		t.Fatalf("expected objects to be listed again, got %d", bstore.objectListings)
+	}
+}
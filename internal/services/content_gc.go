@@ -0,0 +1,622 @@
+// クラウド上の参照されなくなったブロブを mark-and-sweep で削除する GC を提供する。
+package services
+
+import (
+	"context"
+	"encoding/json"
+	"errors"
+	"fmt"
+	"sort"
+	"strings"
+	"time"
+
+	"CloudLaunch_Go/internal/domain"
+	"CloudLaunch_Go/internal/infrastructure/storage"
+)
+
+const (
+	// gcSampleKeys は GCReport に載せる削除対象キーの最大件数。
+	gcSampleKeys = 20
+	// gcDeleteBatch は HEAD を読み直してから続けて削除するキーの数。
+	gcDeleteBatch = 1000
+	// gcLeaseTTL は GC のリースの有効期間。削除の途中で残りが半分を切ったら延長する。
+	// 期限切れのリース（強制終了した GC の残り）は Push も次の GC も無視する。
+	gcLeaseTTL = 30 * time.Minute
+)
+
+var (
+	// ErrGCInProgress は別の GC がリースを持っている間に Push / GC を始めようとしたことを表す。
+	ErrGCInProgress = errors.New("クラウドの整理（GC）中のため中止しました。しばらくしてからやり直してください")
+	// ErrGCOverlapped は Push の途中で GC が始まったため、HEAD を書き換えずに中止したことを表す。
+	ErrGCOverlapped = errors.New("同期中にクラウドの整理（GC）が行われたため中止しました。もう一度同期してください")
+)
+
+// gcLease は GC 中のゲームに置く印（games/<gameID>/GC-LEASE）。有効な間、Push は HEAD を書き換えない。
+// 終了時も消さずに Finished を立てて書き換える。Push は開始時と HEAD 書き換え前の ETag を比べるため、
+// 消してしまうと Push の途中で始まって終わった GC を見逃す。
+type gcLease struct {
+	DeviceName string    `json:"deviceName"`
+	StartedAt  time.Time `json:"startedAt"`
+	ExpiresAt  time.Time `json:"expiresAt"`
+	Finished   bool      `json:"finished"`
+}
+
+func (lease gcLease) active(now time.Time) bool {
+	return !lease.Finished && now.Before(lease.ExpiresAt)
+}
+
+// gcKinds は GC の対象にするブロブ種別。HEAD など種別の無いキーには触れない。
+var gcKinds = map[string]struct{}{
+	storage.BlobKindCommit:   {},
+	storage.BlobKindTree:     {},
+	storage.BlobKindMeta:     {},
+	storage.BlobKindObject:   {},
+	storage.BlobKindManifest: {},
+	storage.BlobKindChunk:    {},
+}
+
+// GCOptions は GC の保持条件。0 以下の値は設定（CLOUDLAUNCH_GC_*）の既定値を使う。
+// HEAD のコミットは KeepCommits に関わらず常に残す。
+type GCOptions struct {
+	KeepCommits int  `json:"keepCommits"`
+	KeepDays    int  `json:"keepDays"`
+	DryRun      bool `json:"dryRun"`
+}
+
+// GCReport はゲーム1件分の GC 結果。DryRun のときは Deleted* が「削除される予定」の件数・サイズになる。
+type GCReport struct {
+	GameID       string `json:"gameId"`
+	DryRun       bool   `json:"dryRun"`
+	Head         string `json:"head"`
+	Commits      int    `json:"commits"`
+	KeptCommits  int    `json:"keptCommits"`
+	ScannedBlobs int    `json:"scannedBlobs"`
+	DeletedBlobs int    `json:"deletedBlobs"`
+	DeletedBytes int64  `json:"deletedBytes"`
+	// GraceBlobs は未参照だが猶予期間内に置かれたため残したブロブ数（実行中・中断中の Push の分）。
+	GraceBlobs int      `json:"graceBlobs"`
+	SampleKeys []string `json:"sampleKeys,omitempty"`
+}
+
+// gcBlob は列挙した1ブロブ。
+type gcBlob struct {
+	key      string
+	kind     string
+	hash     string
+	size     int64
+	modified time.Time
+}
+
+// CollectGarbage は gameID のリモートから、保持するコミットのどれからも参照されないブロブを削除する。
+//
+// 保持するのは HEAD と、作成時刻が新しい順に KeepCommits 件、および KeepDays 日以内のコミット。
+// コミットに親の参照は無いため、履歴は commits/ の列挙と各コミットの作成時刻で辿る（強制 Push で
+// HEAD から外れたコミットも同じ条件で扱う）。保持するコミットから tree / meta / objects / manifests /
+// chunks を mark し、それ以外を DeleteObjects でまとめて sweep する。
+//
+// 未参照でも GCGraceHours 以内に置かれたブロブは残す。別端末で実行中の Push はコミットより先に
+// ブロブを置くため、これが無いと HEAD を書く前のブロブを消して欠けたコミットを公開させてしまう。
+// 削除の間は GC のリースを置き、Push はリースが有効な間・途中でリースが書き換わったときに HEAD を書き換えない
+// （重複排除で送らなかった、これから消えるブロブを参照するコミットを公開させないため）。リースを見ない旧版の
+// Push に備えて、HEAD は条件付きで付け替え、削除のバッチごとに読み直して進んでいればそのコミットの参照先を残す。
+// また、消したブロブを各端末のリモートブロブ控えや転送記録が「ある」と信じ続けないよう、
+// 削除する前に HEAD の内容を作成時刻だけ変えたコミットに付け替える（控え・記録は HEAD 一致が条件のため
+// 全端末で無効になり、実行中の Push も HEAD 書き換え前の再確認で中断する）。DryRun では何も書き換えない。
+func (s *ContentSyncService) CollectGarbage(ctx context.Context, gameID string, opts GCOptions) (GCReport, error) {
+	if s.offline.Load() {
+		return GCReport{}, ErrOffline
+	}
+	defer s.lockGame(gameID)()
+	ctx, release, err := s.admit(ctx, SyncPriorityBackground)
+	if err != nil {
+		return GCReport{}, err
+	}
+	defer release()
+	bstore, err := s.newBlobStore(ctx)
+	if err != nil {
+		return GCReport{}, err
+	}
+	return s.collectGarbage(ctx, bstore, gameID, opts)
+}
+
+// CollectAllGarbage はリモートの全ゲームに CollectGarbage を順に適用する。
+// 1件の失敗で止めず、失敗したゲームはログに残して結果から外す。
+// 実行枠はゲームごとに CollectGarbage が取り直す（全体で握ると、ゲームのロックを持って枠を待つ Push と
+// 逆順になってデッドロックし、掃除の間ずっと他の同期を待たせるため）。
+func (s *ContentSyncService) CollectAllGarbage(ctx context.Context, opts GCOptions) ([]GCReport, error) {
+	if s.offline.Load() {
+		return nil, ErrOffline
+	}
+	gameIDs, err := s.listRemoteGameIDs(ctx)
+	if err != nil {
+		return nil, err
+	}
+	reports := make([]GCReport, 0, len(gameIDs))
+	for _, gameID := range gameIDs {
+		if err := ctx.Err(); err != nil {
+			return reports, err
+		}
+		report, err := s.CollectGarbage(ctx, gameID, opts)
+		if err != nil {
+			s.logger.Warn("GC に失敗", "gameId", gameID, "error", err)
+			continue
+		}
+		reports = append(reports, report)
+	}
+	return reports, nil
+}
+
+func (s *ContentSyncService) collectGarbage(ctx context.Context, bstore contentBlobStore, gameID string, opts GCOptions) (GCReport, error) {
+	if opts.KeepCommits <= 0 {
+		opts.KeepCommits = s.config.GCKeepCommits
+	}
+	if opts.KeepDays <= 0 {
+		opts.KeepDays = s.config.GCKeepDays
+	}
+	report := GCReport{GameID: gameID, DryRun: opts.DryRun}
+
+	head, err := bstore.readHEAD(ctx, gameID)
+	if err != nil {
+		return report, err
+	}
+	if head == "" {
+		// 初回 Push の途中や削除途中かもしれないので、HEAD の無いゲームには触れない
+		return report, nil
+	}
+	report.Head = head
+
+	blobs, err := listGCBlobs(ctx, bstore, gameID)
+	if err != nil {
+		return report, err
+	}
+	report.ScannedBlobs = len(blobs)
+
+	commits, err := s.gcReadCommits(ctx, bstore, gameID, blobs)
+	if err != nil {
+		return report, err
+	}
+	headMeta, ok := commits[head]
+	if !ok {
+		return report, fmt.Errorf("HEAD のコミットがリモートにありません: %s", head)
+	}
+	report.Commits = len(commits)
+	kept := selectKeptCommits(commits, head, opts.KeepCommits, time.Now().AddDate(0, 0, -opts.KeepDays))
+	report.KeptCommits = len(kept)
+
+	marked, headGameJSON, err := s.gcMark(ctx, bstore, gameID, kept, commits, head, blobs)
+	if err != nil {
+		return report, err
+	}
+
+	graceStart := time.Now().Add(-time.Duration(s.config.GCGraceHours) * time.Hour)
+	var sweep []gcBlob
+	for _, blob := range blobs {
+		if _, ok := marked[blob.kind][blob.hash]; ok {
+			continue
+		}
+		if blob.modified.After(graceStart) {
+			report.GraceBlobs++
+			continue
+		}
+		sweep = append(sweep, blob)
+	}
+	keys := make([]string, 0, len(sweep))
+	for _, blob := range sweep {
+		keys = append(keys, blob.key)
+		report.DeletedBlobs++
+		report.DeletedBytes += blob.size
+	}
+	sort.Strings(keys)
+	if len(keys) > gcSampleKeys {
+		report.SampleKeys = append([]string(nil), keys[:gcSampleKeys]...)
+	} else {
+		report.SampleKeys = keys
+	}
+	if opts.DryRun || len(keys) == 0 {
+		return report, nil
+	}
+
+	lease, err := s.gcAcquireLease(ctx, bstore, gameID)
+	if err != nil {
+		return report, err
+	}
+	defer s.gcReleaseLease(ctx, bstore, gameID, lease)
+	newHead, err := s.gcRewriteHead(ctx, bstore, gameID, head, headMeta, headGameJSON)
+	if err != nil {
+		return report, err
+	}
+	report.Head = newHead
+	deleted, err := s.gcSweep(ctx, bstore, gameID, newHead, sweep, blobs, &lease)
+	report.DeletedBlobs, report.DeletedBytes = len(deleted), 0
+	for _, blob := range deleted {
+		report.DeletedBytes += blob.size
+	}
+	if len(deleted) > 0 {
+		s.gcStoreRemoteBlobIndex(ctx, gameID, newHead, blobs, deleted)
+	}
+	if err != nil {
+		return report, err
+	}
+	s.logger.Info("クラウドの未参照ブロブを削除しました",
+		"gameId", gameID, "deleted", report.DeletedBlobs, "bytes", report.DeletedBytes,
+		"keptCommits", report.KeptCommits, "grace", report.GraceBlobs)
+	return report, nil
+}
+
+// listRemoteGameIDs は実行枠を取ってリモートのゲーム ID を列挙し、枠をすぐ返す。
+func (s *ContentSyncService) listRemoteGameIDs(ctx context.Context) ([]string, error) {
+	ctx, release, err := s.admit(ctx, SyncPriorityBackground)
+	if err != nil {
+		return nil, err
+	}
+	defer release()
+	bstore, err := s.newBlobStore(ctx)
+	if err != nil {
+		return nil, err
+	}
+	return bstore.listGameIDs(ctx)
+}
+
+// listGCBlobs は games/<gameID>/ 配下の GC 対象ブロブを列挙する。
+func listGCBlobs(ctx context.Context, bstore contentBlobStore, gameID string) ([]gcBlob, error) {
+	prefix := fmt.Sprintf("games/%s/", gameID)
+	objects, err := bstore.listObjects(ctx, prefix)
+	if err != nil {
+		return nil, err
+	}
+	blobs := make([]gcBlob, 0, len(objects))
+	for _, obj := range objects {
+		kind, hash, ok := strings.Cut(strings.TrimPrefix(obj.Key, prefix), "/")
+		if !ok || hash == "" || strings.Contains(hash, "/") {
+			continue
+		}
+		if _, ok := gcKinds[kind]; !ok {
+			continue
+		}
+		blobs = append(blobs, gcBlob{
+			key:      obj.Key,
+			kind:     kind,
+			hash:     hash,
+			size:     obj.Size,
+			modified: time.UnixMilli(obj.LastModified),
+		})
+	}
+	return blobs, nil
+}
+
+// gcReadCommits は列挙したコミットをすべて読む。読めないコミットがあれば参照先を mark できないため中止する。
+func (s *ContentSyncService) gcReadCommits(ctx context.Context, bstore contentBlobStore, gameID string, blobs []gcBlob) (map[string]domain.MetaSnapshot, error) {
+	commits := make(map[string]domain.MetaSnapshot)
+	for _, blob := range blobs {
+		if blob.kind != storage.BlobKindCommit {
+			continue
+		}
+		data, err := bstore.getBlob(ctx, gameID, storage.BlobKindCommit, blob.hash)
+		if err != nil {
+			return nil, fmt.Errorf("コミットの取得に失敗（GC を中止）: %s: %w", blob.hash, err)
+		}
+		var meta domain.MetaSnapshot
+		if err := json.Unmarshal(data, &meta); err != nil {
+			return nil, fmt.Errorf("コミットの解析に失敗（GC を中止）: %s: %w", blob.hash, err)
+		}
+		commits[blob.hash] = meta
+	}
+	return commits, nil
+}
+
+// selectKeptCommits は HEAD・新しい順に keep 件・since 以降に作られたコミットの集合を返す。
+func selectKeptCommits(commits map[string]domain.MetaSnapshot, head string, keep int, since time.Time) map[string]struct{} {
+	hashes := make([]string, 0, len(commits))
+	for hash := range commits {
+		hashes = append(hashes, hash)
+	}
+	sort.Slice(hashes, func(i, j int) bool {
+		a, b := commits[hashes[i]].CreatedAt, commits[hashes[j]].CreatedAt
+		if !a.Equal(b) {
+			return a.After(b)
+		}
+		return hashes[i] < hashes[j]
+	})
+	kept := map[string]struct{}{head: {}}
+	for i, hash := range hashes {
+		if i < keep || !commits[hash].CreatedAt.Before(since) {
+			kept[hash] = struct{}{}
+		}
+	}
+	return kept
+}
+
+// gcMark は保持するコミットから辿れるブロブを kind → ハッシュ集合で返す。HEAD の game.json も返す（付け替え用）。
+// セーブファイルは単一ブロブ形式とチャンク形式のどちらで置かれたかをコミットごとに区別せず、両方を mark する
+// （閾値の変更で形式が変わっても、参照中の実体を消さないため）。
+func (s *ContentSyncService) gcMark(ctx context.Context, bstore contentBlobStore, gameID string, kept map[string]struct{}, commits map[string]domain.MetaSnapshot, head string, blobs []gcBlob) (map[string]map[string]struct{}, []byte, error) {
+	marked := make(map[string]map[string]struct{}, len(gcKinds))
+	for kind := range gcKinds {
+		marked[kind] = make(map[string]struct{})
+	}
+	var headGameJSON []byte
+	for hash := range kept {
+		meta := commits[hash]
+		marked[storage.BlobKindCommit][hash] = struct{}{}
+		marked[storage.BlobKindMeta][meta.GameJSON] = struct{}{}
+		marked[storage.BlobKindMeta][meta.SessionsJSON] = struct{}{}
+		marked[storage.BlobKindTree][meta.Saves] = struct{}{}
+
+		gameJSON, err := bstore.getBlob(ctx, gameID, storage.BlobKindMeta, meta.GameJSON)
+		if err != nil {
+			return nil, nil, fmt.Errorf("game.json の取得に失敗（GC を中止）: %s: %w", meta.GameJSON, err)
+		}
+		var cg cloudGame
+		if err := json.Unmarshal(gameJSON, &cg); err != nil {
+			return nil, nil, fmt.Errorf("game.json の解析に失敗（GC を中止）: %s: %w", meta.GameJSON, err)
+		}
+		if cg.ImageHash != "" {
+			marked[storage.BlobKindObject][cg.ImageHash] = struct{}{}
+		}
+		if hash == head {
+			headGameJSON = gameJSON
+		}
+
+		treeJSON, err := bstore.getBlob(ctx, gameID, storage.BlobKindTree, meta.Saves)
+		if err != nil {
+			return nil, nil, fmt.Errorf("セーブツリーの取得に失敗（GC を中止）: %s: %w", meta.Saves, err)
+		}
+		var snap domain.SaveSnapshot
+		if err := json.Unmarshal(treeJSON, &snap); err != nil {
+			return nil, nil, fmt.Errorf("セーブツリーの解析に失敗（GC を中止）: %s: %w", meta.Saves, err)
+		}
+		for _, fileHash := range snap.Files {
+			marked[storage.BlobKindObject][fileHash] = struct{}{}
+			marked[storage.BlobKindManifest][fileHash] = struct{}{}
+		}
+	}
+
+	// 参照中で実在する manifest から、そのチャンクを mark する
+	for _, blob := range blobs {
+		if blob.kind != storage.BlobKindManifest {
+			continue
+		}
+		if _, ok := marked[storage.BlobKindManifest][blob.hash]; !ok {
+			continue
+		}
+		manifest, err := bstore.getChunkManifest(ctx, gameID, blob.hash)
+		if err != nil {
+			return nil, nil, fmt.Errorf("manifest の取得に失敗（GC を中止）: %s: %w", blob.hash, err)
+		}
+		for _, chunk := range manifest.Chunks {
+			marked[storage.BlobKindChunk][chunk.Hash] = struct{}{}
+		}
+	}
+	return marked, headGameJSON, nil
+}
+
+// gcRewriteHead は HEAD のコミットを作成時刻・端末名だけ変えて置き直し、HEAD を付け替える。
+// 同期状態の判定（contentFingerprint）は作成時刻・端末名を含まないため、各端末の状態は変わらない。
+// 付け替えの直前に HEAD を ETag ごと読み直し、GC 開始時の head から進んでいれば中止する（If-Match を無視するストアでも、
+// 印付けの間に公開されたコミットを古い内容で上書きしない）。書き込みは読み直した ETag を条件にする。
+func (s *ContentSyncService) gcRewriteHead(ctx context.Context, bstore contentBlobStore, gameID, head string, headMeta domain.MetaSnapshot, headGameJSON []byte) (string, error) {
+	deviceName, err := s.getOrInitDeviceName(ctx)
+	if err != nil {
+		return "", err
+	}
+	meta := headMeta
+	meta.DeviceName = deviceName
+	meta.CreatedAt = time.Now().UTC()
+	metaBytes, err := json.Marshal(meta)
+	if err != nil {
+		return "", err
+	}
+	newHead := hashBytes(metaBytes)
+	current, headETag, err := bstore.readHEADWithETag(ctx, gameID)
+	if err != nil {
+		return "", err
+	}
+	if current != head {
+		return "", fmt.Errorf("GC 中にリモートが更新されたため中止しました: %s", current)
+	}
+	if err := bstore.putBlob(ctx, gameID, storage.BlobKindCommit, newHead, metaBytes); err != nil {
+		return "", err
+	}
+	if err := bstore.writeHEADIfMatch(ctx, gameID, newHead, headETag); err != nil {
+		if errors.Is(err, storage.ErrPreconditionFailed) {
+			return "", fmt.Errorf("GC 中にリモートが更新されたため中止しました: %s", head)
+		}
+		return "", err
+	}
+	s.putCloudCatalogEntry(ctx, bstore, gameID, newHead, metaBuildResult{Snapshot: meta, SnapshotBytes: metaBytes, GameJSON: headGameJSON})
+	return newHead, nil
+}
+
+// gcSweep は sweep を gcDeleteBatch 件ずつ削除し、実際に削除したブロブを返す。各バッチの前に HEAD を読み直し、
+// head から進んでいれば（リースを見ない端末の Push など）そのコミットから辿れるブロブを以降の削除対象から外す。
+// 最後のバッチの後にも読み直し、削除済みのブロブを新しい HEAD が参照していればエラーとして記録する。
+func (s *ContentSyncService) gcSweep(ctx context.Context, bstore contentBlobStore, gameID, head string, sweep, blobs []gcBlob, lease *gcLease) ([]gcBlob, error) {
+	var deleted []gcBlob
+	remaining := sweep
+	for len(remaining) > 0 {
+		current, err := bstore.readHEAD(ctx, gameID)
+		if err != nil {
+			return deleted, err
+		}
+		if current != head {
+			s.logger.Warn("GC 中に HEAD が更新されたため、新しいコミットの参照先を削除対象から外します", "gameId", gameID, "head", current)
+			remaining, err = s.gcSpareReferenced(ctx, bstore, gameID, current, remaining, blobs)
+			if err != nil {
+				return deleted, err
+			}
+			head = current
+			continue
+		}
+		if err := s.gcExtendLease(ctx, bstore, gameID, lease); err != nil {
+			return deleted, err
+		}
+		batch := remaining[:min(gcDeleteBatch, len(remaining))]
+		keys := make([]string, 0, len(batch))
+		for _, blob := range batch {
+			keys = append(keys, blob.key)
+		}
+		if err := bstore.deleteObjects(ctx, keys); err != nil {
+			return deleted, err
+		}
+		deleted = append(deleted, batch...)
+		remaining = remaining[len(batch):]
+	}
+
+	current, err := bstore.readHEAD(ctx, gameID)
+	if err != nil || current == head || len(deleted) == 0 {
+		return deleted, nil
+	}
+	spared, err := s.gcSpareReferenced(ctx, bstore, gameID, current, deleted, blobs)
+	if err != nil {
+		s.logger.Warn("GC 後の HEAD の確認に失敗", "gameId", gameID, "head", current, "error", err)
+	} else if missing := len(deleted) - len(spared); missing > 0 {
+		s.logger.Error("GC と同時に公開されたコミットが削除済みのブロブを参照しています（該当ファイルのある端末から Push し直してください）",
+			"gameId", gameID, "head", current, "missing", missing)
+	}
+	return deleted, nil
+}
+
+// gcSpareReferenced は candidates のうち、コミット commitHash から辿れるブロブを除いたものを返す。
+// commitHash が空（HEAD が消された）なら candidates をそのまま返す。
+func (s *ContentSyncService) gcSpareReferenced(ctx context.Context, bstore contentBlobStore, gameID, commitHash string, candidates, blobs []gcBlob) ([]gcBlob, error) {
+	if commitHash == "" {
+		return candidates, nil
+	}
+	data, err := bstore.getBlob(ctx, gameID, storage.BlobKindCommit, commitHash)
+	if err != nil {
+		return nil, fmt.Errorf("コミットの取得に失敗（GC を中止）: %s: %w", commitHash, err)
+	}
+	var meta domain.MetaSnapshot
+	if err := json.Unmarshal(data, &meta); err != nil {
+		return nil, fmt.Errorf("コミットの解析に失敗（GC を中止）: %s: %w", commitHash, err)
+	}
+	commits := map[string]domain.MetaSnapshot{commitHash: meta}
+	marked, _, err := s.gcMark(ctx, bstore, gameID, map[string]struct{}{commitHash: {}}, commits, commitHash, blobs)
+	if err != nil {
+		return nil, err
+	}
+	kept := candidates[:0:0]
+	for _, blob := range candidates {
+		if _, ok := marked[blob.kind][blob.hash]; !ok {
+			kept = append(kept, blob)
+		}
+	}
+	return kept, nil
+}
+
+// gcAcquireLease は gameID に GC のリースを置く。他の端末の有効なリースがあれば ErrGCInProgress を返す。
+func (s *ContentSyncService) gcAcquireLease(ctx context.Context, bstore contentBlobStore, gameID string) (gcLease, error) {
+	data, etag, err := bstore.readGCLease(ctx, gameID)
+	if err != nil {
+		return gcLease{}, err
+	}
+	now := time.Now().UTC()
+	if data != nil {
+		var current gcLease
+		if json.Unmarshal(data, &current) == nil && current.active(now) {
+			return gcLease{}, ErrGCInProgress
+		}
+	}
+	deviceName, err := s.getOrInitDeviceName(ctx)
+	if err != nil {
+		return gcLease{}, err
+	}
+	lease := gcLease{DeviceName: deviceName, StartedAt: now, ExpiresAt: now.Add(gcLeaseTTL)}
+	leaseBytes, err := json.Marshal(lease)
+	if err != nil {
+		return gcLease{}, err
+	}
+	if err := bstore.writeGCLease(ctx, gameID, leaseBytes, etag); err != nil {
+		if errors.Is(err, storage.ErrPreconditionFailed) {
+			return gcLease{}, ErrGCInProgress
+		}
+		return gcLease{}, err
+	}
+	return lease, nil
+}
+
+// gcExtendLease は lease の残りが半分を切っていれば期限を延ばして書き直す。
+func (s *ContentSyncService) gcExtendLease(ctx context.Context, bstore contentBlobStore, gameID string, lease *gcLease) error {
+	now := time.Now().UTC()
+	if lease.ExpiresAt.Sub(now) > gcLeaseTTL/2 {
+		return nil
+	}
+	extended := *lease
+	extended.ExpiresAt = now.Add(gcLeaseTTL)
+	leaseBytes, err := json.Marshal(extended)
+	if err != nil {
+		return err
+	}
+	if err := bstore.putGCLease(ctx, gameID, leaseBytes); err != nil {
+		return err
+	}
+	*lease = extended
+	return nil
+}
+
+// gcReleaseLease は lease を終了済みとして書き直す。失敗しても期限切れで無効になるためログのみ。
+func (s *ContentSyncService) gcReleaseLease(ctx context.Context, bstore contentBlobStore, gameID string, lease gcLease) {
+	lease.Finished = true
+	leaseBytes, err := json.Marshal(lease)
+	if err == nil {
+		// GC がキャンセルされても終了の記録は届くよう、切り離した context を使う
+		err = bstore.putGCLease(context.WithoutCancel(ctx), gameID, leaseBytes)
+	}
+	if err != nil {
+		s.logger.Warn("GC のリースの解放に失敗（期限切れで無効になります）", "gameId", gameID, "error", err)
+	}
+}
+
+// checkGCLease は gameID の GC のリースを読み、有効なリースがあれば ErrGCInProgress を返す。
+// 戻り値はリースの ETag（無ければ ""）で、Push は開始時と HEAD 書き換え前の値を比べて途中で GC が始まっていないことを確かめる。
+func (s *ContentSyncService) checkGCLease(ctx context.Context, bstore contentBlobStore, gameID string) (string, error) {
+	data, etag, err := bstore.readGCLease(ctx, gameID)
+	if err != nil {
+		return "", err
+	}
+	if data == nil {
+		return "", nil
+	}
+	var lease gcLease
+	if err := json.Unmarshal(data, &lease); err != nil {
+		s.logger.Warn("GC のリースを解析できないため無視します", "gameId", gameID, "error", err)
+		return etag, nil
+	}
+	if lease.active(time.Now()) {
+		return "", ErrGCInProgress
+	}
+	return etag, nil
+}
+
+// gcStoreRemoteBlobIndex は GC 直後の列挙結果（削除分を除く）でリモートブロブ控えを置き換え、
+// 削除したブロブを指しうる Push の転送記録を捨てる。失敗しても次回 Push の全件列挙で回復するためログのみ。
+func (s *ContentSyncService) gcStoreRemoteBlobIndex(ctx context.Context, gameID, head string, blobs, deleted []gcBlob) {
+	gone := make(map[string]struct{}, len(deleted))
+	for _, blob := range deleted {
+		gone[blob.key] = struct{}{}
+	}
+	index := domain.RemoteBlobIndex{
+		Head:     head,
+		ListedAt: time.Now().UnixNano(),
+		Hashes: map[string]map[domain.BlobHash]struct{}{
+			storage.BlobKindObject:   {},
+			storage.BlobKindManifest: {},
+			storage.BlobKindChunk:    {},
+		},
+	}
+	for _, blob := range blobs {
+		hashes, ok := index.Hashes[blob.kind]
+		if !ok {
+			continue
+		}
+		if _, ok := gone[blob.key]; !ok {
+			hashes[blob.hash] = struct{}{}
+		}
+	}
+	if err := s.repository.SaveRemoteBlobIndex(ctx, gameID, index, true); err != nil {
+		s.logger.Warn("リモートブロブ控えの保存に失敗", "gameId", gameID, "error", err)
+	}
+	if err := s.repository.ClearTransferJournal(ctx, gameID, transferPush); err != nil {
+		s.logger.Warn("転送記録のクリアに失敗", "gameId", gameID, "error", err)
+	}
+}
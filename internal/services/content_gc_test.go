@@ -0,0 +1,227 @@
+package services
+
+import (
+	"context"
+	"encoding/json"
+	"errors"
+	"os"
+	"path/filepath"
+	"testing"
+	"time"
+
+	"CloudLaunch_Go/internal/domain"
+	"CloudLaunch_Go/internal/infrastructure/storage"
+)
+
+// seedGCCommit は a.sav の内容が saveData のコミットを createdAt 時点に作られたものとしてリモートに置き、HEAD にする。
+// 新しく置いたブロブの書き込み時刻も createdAt にする。
+func seedGCCommit(t *testing.T, bstore *fakeBlobStore, game domain.Game, saveData string, createdAt time.Time) string {
+	t.Helper()
+	ctx := context.Background()
+	saveHash := hashBytes([]byte(saveData))
+	snapJSON, _ := json.Marshal(domain.SaveSnapshot{Files: map[string]string{"a.sav": saveHash}})
+	savesHash := hashBytes(snapJSON)
+	meta, err := buildMetaSnapshot(game, nil, "", savesHash, "old-device", 1, int64(len(saveData)))
+	if err != nil {
+		t.Fatalf("buildMetaSnapshot: %v", err)
+	}
+	snapshot := meta.Snapshot
+	snapshot.CreatedAt = createdAt
+	commitJSON, _ := json.Marshal(snapshot)
+	commitHash := hashBytes(commitJSON)
+
+	for _, blob := range []struct {
+		kind, hash string
+		data       []byte
+	}{
+		{storage.BlobKindObject, saveHash, []byte(saveData)},
+		{storage.BlobKindTree, savesHash, snapJSON},
+		{storage.BlobKindMeta, snapshot.GameJSON, meta.GameJSON},
+		{storage.BlobKindMeta, snapshot.SessionsJSON, meta.SessionsJSON},
+		{storage.BlobKindCommit, commitHash, commitJSON},
+	} {
+		key := bstore.blobKey(game.ID, blob.kind, blob.hash)
+		_, existed := bstore.blobs[key]
+		if err := bstore.putBlob(ctx, game.ID, blob.kind, blob.hash, blob.data); err != nil {
+			t.Fatalf("putBlob: %v", err)
+		}
+		if !existed {
+			bstore.written[key] = createdAt
+		}
+	}
+	if err := bstore.writeHEAD(ctx, game.ID, commitHash); err != nil {
+		t.Fatalf("writeHEAD: %v", err)
+	}
+	return commitHash
+}
+
+// TestContentSyncServiceCollectGarbageSweepsUnreferencedBlobs は、保持条件から外れたコミットとその参照先だけが消え、
+// 猶予期間内の未参照ブロブは残ること、DryRun は報告だけで何も変えないこと、
+// 実際に消したときは HEAD を付け替えて古い控えと転送記録が使われないようにすることを確認する。
+func TestContentSyncServiceCollectGarbageSweepsUnreferencedBlobs(t *testing.T) {
+	t.Parallel()
+
+	game := baseGame(t.TempDir())
+	repo := newFakeRepo(&game, nil)
+	bstore := newFakeBlobStore()
+	svc := newTestService(repo, bstore)
+	svc.config.GCKeepDays = 30
+	svc.config.GCGraceHours = 24
+	ctx := context.Background()
+
+	now := time.Now()
+	old := seedGCCommit(t, bstore, game, "old", now.AddDate(0, 0, -60))
+	seedGCCommit(t, bstore, game, "mid", now.AddDate(0, 0, -50))
+	head := seedGCCommit(t, bstore, game, "new", now.AddDate(0, 0, -40))
+	// 実行中の別端末の Push が置いたばかりのブロブ（まだどのコミットからも参照されない）
+	stray := hashBytes([]byte("in flight"))
+	if err := bstore.putBlob(ctx, game.ID, storage.BlobKindObject, stray, []byte("in flight")); err != nil {
+		t.Fatal(err)
+	}
+	repo.remoteIndex = &domain.RemoteBlobIndex{Head: head, ListedAt: now.UnixNano(), Hashes: map[string]map[string]struct{}{
+		storage.BlobKindObject: {hashBytes([]byte("old")): {}},
+	}}
+	blobsBefore := len(bstore.blobs)
+
+	report, err := svc.CollectGarbage(ctx, game.ID, GCOptions{KeepCommits: 2, DryRun: true})
+	if err != nil {
+		t.Fatalf("CollectGarbage(dry run): %v", err)
+	}
+	// 消えるのは最古のコミット・そのツリー・そのセーブ実体の3件（game.json / sessions.json は共有）
+	if report.Commits != 3 || report.KeptCommits != 2 || report.DeletedBlobs != 3 || report.GraceBlobs != 1 {
+		t.Fatalf("unexpected dry run report: %+v", report)
+	}
+	if len(bstore.blobs) != blobsBefore || bstore.heads[game.ID] != head {
+		t.Fatal("dry run must not change the remote")
+	}
+
+	report, err = svc.CollectGarbage(ctx, game.ID, GCOptions{KeepCommits: 2})
+	if err != nil {
+		t.Fatalf("CollectGarbage: %v", err)
+	}
+	if report.DeletedBlobs != 3 || len(bstore.blobs) != blobsBefore-3+1 {
+		t.Fatalf("expected 3 blobs deleted and a rewritten commit added: report=%+v blobs=%d", report, len(bstore.blobs))
+	}
+	for _, gone := range []string{
+		bstore.blobKey(game.ID, storage.BlobKindCommit, old),
+		bstore.blobKey(game.ID, storage.BlobKindObject, hashBytes([]byte("old"))),
+	} {
+		if _, ok := bstore.blobs[gone]; ok {
+			t.Fatalf("%s should be deleted", gone)
+		}
+	}
+	for _, kept := range []string{
+		bstore.blobKey(game.ID, storage.BlobKindObject, hashBytes([]byte("mid"))),
+		bstore.blobKey(game.ID, storage.BlobKindObject, stray),
+	} {
+		if _, ok := bstore.blobs[kept]; !ok {
+			t.Fatalf("%s should be kept", kept)
+		}
+	}
+
+	newHead := bstore.heads[game.ID]
+	if newHead == head || report.Head != newHead {
+		t.Fatalf("HEAD should move to the rewritten commit: old=%s new=%s report=%s", head, newHead, report.Head)
+	}
+	var rewritten domain.MetaSnapshot
+	if err := json.Unmarshal(bstore.blobs[bstore.blobKey(game.ID, storage.BlobKindCommit, newHead)], &rewritten); err != nil {
+		t.Fatalf("rewritten commit: %v", err)
+	}
+	var headMeta domain.MetaSnapshot
+	_ = json.Unmarshal(bstore.blobs[bstore.blobKey(game.ID, storage.BlobKindCommit, head)], &headMeta)
+	if contentFingerprint(rewritten) != contentFingerprint(headMeta) {
+		t.Fatal("rewritten commit must keep the same content")
+	}
+	if repo.remoteIndex.Head != newHead {
+		t.Fatalf("remote index should follow the new HEAD, got %+v", repo.remoteIndex)
+	}
+	if _, ok := repo.remoteIndex.Hashes[storage.BlobKindObject][hashBytes([]byte("old"))]; ok {
+		t.Fatal("deleted blob must be dropped from the remote index")
+	}
+}
+
+// TestContentSyncServicePushRespectsGCLease は、有効な GC のリースがある間の Push は HEAD を書き換えずに中止し、
+// Push の途中で GC が始まって終わった（リースが書き換わった）場合も中止して、やり直せば通ることを確認する。
+func TestContentSyncServicePushRespectsGCLease(t *testing.T) {
+	t.Parallel()
+
+	saveDir := t.TempDir()
+	if err := os.WriteFile(filepath.Join(saveDir, "save.dat"), []byte("data"), 0o600); err != nil {
+		t.Fatal(err)
+	}
+	game := baseGame(saveDir)
+	repo := newFakeRepo(&game, nil)
+	bstore := newFakeBlobStore()
+	svc := newTestService(repo, bstore)
+	ctx := context.Background()
+
+	now := time.Now().UTC()
+	active, _ := json.Marshal(gcLease{DeviceName: "other", StartedAt: now, ExpiresAt: now.Add(gcLeaseTTL)})
+	if err := bstore.putGCLease(ctx, game.ID, active); err != nil {
+		t.Fatal(err)
+	}
+	if err := svc.Push(ctx, game.ID, nil); !errors.Is(err, ErrGCInProgress) {
+		t.Fatalf("Push during GC should fail with ErrGCInProgress, got %v", err)
+	}
+	if head, _ := bstore.readHEAD(ctx, game.ID); head != "" {
+		t.Fatalf("HEAD must not be written during GC, got %q", head)
+	}
+
+	finished, _ := json.Marshal(gcLease{DeviceName: "other", StartedAt: now, ExpiresAt: now.Add(gcLeaseTTL), Finished: true})
+	if err := bstore.putGCLease(ctx, game.ID, finished); err != nil {
+		t.Fatal(err)
+	}
+	// アップロード中に別端末の GC が始まって終わった状況を模す
+	bstore.onPutBlobs = func() {
+		_ = bstore.putGCLease(ctx, game.ID, finished)
+	}
+	if err := svc.Push(ctx, game.ID, nil); !errors.Is(err, ErrGCOverlapped) {
+		t.Fatalf("Push overlapping a GC should fail with ErrGCOverlapped, got %v", err)
+	}
+	if head, _ := bstore.readHEAD(ctx, game.ID); head != "" {
+		t.Fatalf("HEAD must not be written after an overlapping GC, got %q", head)
+	}
+
+	bstore.onPutBlobs = nil
+	if err := svc.Push(ctx, game.ID, nil); err != nil {
+		t.Fatalf("Push after GC finished: %v", err)
+	}
+	if head, _ := bstore.readHEAD(ctx, game.ID); head == "" {
+		t.Fatal("expected HEAD to be written once GC finished")
+	}
+}
+
+// TestContentSyncServiceCollectGarbageKeepsHeadPushedDuringMark は、印付けの間に別端末が HEAD を進めた場合、
+// If-Match を無視するストアでも GC が HEAD を古いコミットの置き直しで上書きせず、何も消さずに中止することを確認する。
+func TestContentSyncServiceCollectGarbageKeepsHeadPushedDuringMark(t *testing.T) {
+	t.Parallel()
+
+	game := baseGame(t.TempDir())
+	repo := newFakeRepo(&game, nil)
+	bstore := newFakeBlobStore()
+	bstore.ignoreIfMatch = true
+	svc := newTestService(repo, bstore)
+	svc.config.GCKeepDays = 30
+	svc.config.GCGraceHours = 24
+	ctx := context.Background()
+
+	now := time.Now()
+	seedGCCommit(t, bstore, game, "old", now.AddDate(0, 0, -60))
+	seedGCCommit(t, bstore, game, "mid", now.AddDate(0, 0, -50))
+	seedGCCommit(t, bstore, game, "new", now.AddDate(0, 0, -40))
+	var pushed string
+	bstore.onListObjects = func() {
+		pushed = seedGCCommit(t, bstore, game, "pushed", now)
+	}
+	blobsBefore := len(bstore.blobs)
+
+	if _, err := svc.CollectGarbage(ctx, game.ID, GCOptions{KeepCommits: 2}); err == nil {
+		t.Fatal("GC should abort when HEAD moved while marking")
+	}
+	if head := bstore.heads[game.ID]; head != pushed {
+		t.Fatalf("HEAD pushed during GC must be kept, got %s want %s", head, pushed)
+	}
+	if len(bstore.blobs) < blobsBefore {
+		t.Fatalf("aborted GC must not delete blobs: before=%d after=%d", blobsBefore, len(bstore.blobs))
+	}
+}
@@ -5,15 +5,19 @@ import (
 	"crypto/sha256"
 	"encoding/hex"
 	"encoding/json"
+	"errors"
 	"fmt"
 	"io"
 	"os"
 	"path"
 	"path/filepath"
+	"runtime"
 	"sort"
+	"sync"
 	"time"
 
 	"CloudLaunch_Go/internal/domain"
+	"CloudLaunch_Go/internal/infrastructure/storage"
 	"CloudLaunch_Go/internal/util"
 )
 
@@ -63,13 +67,14 @@ func validateSaveDir(saveDir string) error {
 }
 
 // walkSaveFiles は saveDir 配下の通常ファイルを走査し、各ファイルについて
-// 絶対パスとスラッシュ区切りの相対パスで fn を呼ぶ。
+// 絶対パス・スラッシュ区切りの相対パス・走査時点の FileInfo で fn を呼ぶ。
 // シンボリックリンクとディレクトリはスキップする（リンク先実体の漏洩・誤上書きを防ぐ）。
+// ダウンロード途中の一時ファイル（storage.IsDownloadTempFile）も同期対象外として除く。
 //
 // saveDir 自体がディレクトリへのシンボリックリンクである場合は、filepath.Walk が
 // 内部で Lstat を使うため root がスキップされ全件無視される。これを避けるため、
 // 走査前に root だけ EvalSymlinks で解決する。配下のシンボリックリンクはスキップ対象。
-func walkSaveFiles(saveDir string, fn func(absPath, relPath string) error) error {
+func walkSaveFiles(saveDir string, fn func(absPath, relPath string, info os.FileInfo) error) error {
 	root, err := filepath.EvalSymlinks(saveDir)
 	if err != nil {
 		return err
@@ -84,56 +89,175 @@ func walkSaveFiles(saveDir string, fn func(absPath, relPath string) error) error
 		if info.IsDir() {
 			return nil
 		}
+		if storage.IsDownloadTempFile(info.Name()) {
+			return nil // 強制終了された Pull の書きかけ一時ファイル
+		}
 		rel, rerr := filepath.Rel(root, walkPath)
 		if rerr != nil {
 			return rerr
 		}
-		return fn(walkPath, filepath.ToSlash(rel))
+		return fn(walkPath, filepath.ToSlash(rel), info)
+	})
+}
+
+// hashedSaveFile は hashSaveFiles が1ファイルのハッシュ確定ごとに渡す結果。
+type hashedSaveFile struct {
+	AbsPath string
+	RelPath string
+	Info    os.FileInfo
+	Hash    domain.BlobHash
+}
+
+// hashSaveFiles は saveDir の走査を1 goroutine で行い、ハッシュ計算を最大 workers 本のプールに任せる。
+// workers <= 0 は論理 CPU 数、1 は走査と同じ goroutine で逐次計算する。
+// fn の呼び出しは直列化されるが順序は不定（呼び出し側はパスをキーにしたマップへ集約する前提）。
+// いずれかのファイルで失敗した時点で走査を打ち切り、最初のエラーを返す。
+func hashSaveFiles(saveDir string, cache *saveHashCache, workers int, fn func(hashedSaveFile)) error {
+	if workers <= 0 {
+		workers = runtime.NumCPU()
+	}
+	if workers == 1 {
+		return walkSaveFiles(saveDir, func(absPath, relPath string, info os.FileInfo) error {
+			hash, err := cache.hash(absPath, relPath, info)
+			if err != nil {
+				return err
+			}
+			fn(hashedSaveFile{AbsPath: absPath, RelPath: relPath, Info: info, Hash: hash})
+			return nil
+		})
+	}
+
+	type hashJob struct {
+		absPath string
+		relPath string
+		info    os.FileInfo
+	}
+	jobs := make(chan hashJob, workers*2)
+	stop := make(chan struct{})
+	errAborted := errors.New("hash aborted")
+	var (
+		mu       sync.Mutex
+		firstErr error
+		stopOnce sync.Once
+		wg       sync.WaitGroup
+	)
+	fail := func(err error) {
+		mu.Lock()
+		if firstErr == nil {
+			firstErr = err
+		}
+		mu.Unlock()
+		stopOnce.Do(func() { close(stop) })
+	}
+	for i := 0; i < workers; i++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for job := range jobs {
+				select {
+				case <-stop:
+					continue // 失敗後は残りのジョブを読み捨てるだけ
+				default:
+				}
+				hash, err := cache.hash(job.absPath, job.relPath, job.info)
+				if err != nil {
+					fail(err)
+					continue
+				}
+				mu.Lock()
+				fn(hashedSaveFile{AbsPath: job.absPath, RelPath: job.relPath, Info: job.info, Hash: hash})
+				mu.Unlock()
+			}
+		}()
+	}
+
+	walkErr := walkSaveFiles(saveDir, func(absPath, relPath string, info os.FileInfo) error {
+		select {
+		case jobs <- hashJob{absPath: absPath, relPath: relPath, info: info}:
+			return nil
+		case <-stop:
+			return errAborted
+		}
 	})
+	close(jobs)
+	wg.Wait()
+	if firstErr != nil {
+		return firstErr
+	}
+	return walkErr
 }
 
 // buildSaveTree はセーブディレクトリを走査し、パス→ハッシュのみの SaveSnapshot を返す
 // （ブロブ本体を RAM に保持しない）。状態確認や差分判定など、アップロード本体が不要な箇所に使う。
-func buildSaveTree(saveDir string) (domain.SaveSnapshot, error) {
+// cache が nil でなければ stat が一致するファイルの再ハッシュを省く（nil なら全件ハッシュ）。
+// workers はハッシュ計算の並列数（hashSaveFiles 参照）。並列数によらず結果は同一。
+func buildSaveTree(saveDir string, cache *saveHashCache, workers int) (domain.SaveSnapshot, error) {
 	if err := validateSaveDir(saveDir); err != nil {
 		return domain.SaveSnapshot{}, err
 	}
 	files := make(map[string]domain.BlobHash)
-	err := walkSaveFiles(saveDir, func(absPath, relPath string) error {
-		hash, herr := hashFileStream(absPath)
-		if herr != nil {
-			return herr
+	var chunked []string
+	err := hashSaveFiles(saveDir, cache, workers, func(f hashedSaveFile) {
+		files[f.RelPath] = f.Hash
+		if isChunkedSaveFile(f.Info) {
+			chunked = append(chunked, f.RelPath)
 		}
-		files[relPath] = hash
-		return nil
 	})
 	if err != nil {
 		return domain.SaveSnapshot{}, err
 	}
-	return domain.SaveSnapshot{Files: files}, nil
+	sort.Strings(chunked)
+	return domain.SaveSnapshot{Files: files, Chunked: chunked}, nil
 }
 
-// buildSaveSnapshot はセーブディレクトリを走査し SaveSnapshot とブロブマップを返す。
-// saveFolderPath が未設定またはディレクトリが存在しない場合はエラー。
-func buildSaveSnapshot(saveDir string) (domain.SaveSnapshot, map[domain.BlobHash][]byte, error) {
+// buildSaveSnapshot はセーブディレクトリを走査し SaveSnapshot と hash → ローカル実体のマップを返す。
+// 内容はハッシュ計算のために逐次読みするだけで保持しない。アップロード時に PutBlobs の
+// ワーカーが実体を開き直す（数 GB のセーブフォルダでも RAM を消費しない）。
+// 同一内容のファイルが複数ある場合は相対パスが辞書順で最小のものを代表にする
+// （並列ハッシュの完了順に左右されないように）。
+// saveFolderPath が未設定またはディレクトリが存在しない場合はエラー。cache / workers の扱いは buildSaveTree と同じ。
+func buildSaveSnapshot(saveDir string, cache *saveHashCache, workers int) (domain.SaveSnapshot, map[domain.BlobHash]storage.BlobSource, error) {
 	if err := validateSaveDir(saveDir); err != nil {
 		return domain.SaveSnapshot{}, nil, err
 	}
 	files := make(map[string]domain.BlobHash)
-	blobs := make(map[domain.BlobHash][]byte)
-	err := walkSaveFiles(saveDir, func(absPath, relPath string) error {
-		hash, data, herr := hashFile(absPath)
-		if herr != nil {
-			return herr
+	var chunked []string
+	sources := make(map[domain.BlobHash]storage.BlobSource)
+	sourceRel := make(map[domain.BlobHash]string)
+	err := hashSaveFiles(saveDir, cache, workers, func(f hashedSaveFile) {
+		files[f.RelPath] = f.Hash
+		isChunked := isChunkedSaveFile(f.Info)
+		if isChunked {
+			chunked = append(chunked, f.RelPath)
 		}
-		files[relPath] = hash
-		blobs[hash] = data
-		return nil
+		if prev, ok := sourceRel[f.Hash]; ok && prev < f.RelPath {
+			return
+		}
+		sourceRel[f.Hash] = f.RelPath
+		sources[f.Hash] = storage.BlobSource{Path: f.AbsPath, Size: f.Info.Size(), ModTime: f.Info.ModTime(), Chunked: isChunked}
 	})
 	if err != nil {
 		return domain.SaveSnapshot{}, nil, err
 	}
-	return domain.SaveSnapshot{Files: files}, blobs, nil
+	sort.Strings(chunked)
+	return domain.SaveSnapshot{Files: files, Chunked: chunked}, sources, nil
+}
+
+// isChunkedSaveFile はファイルをチャンク分割形式で保存するかをサイズだけで判定する。
+// Status（buildSaveTree）と Push（buildSaveSnapshot）で同じ判定を使い、SaveSnapshot を一致させる。
+func isChunkedSaveFile(info os.FileInfo) bool {
+	return info.Size() >= storage.ChunkedFileThreshold
+}
+
+// chunkedHashes は SaveSnapshot のうちチャンク分割形式で保存されたファイルのハッシュ集合を返す。
+func chunkedHashes(snap domain.SaveSnapshot) map[string]struct{} {
+	set := make(map[string]struct{}, len(snap.Chunked))
+	for _, relPath := range snap.Chunked {
+		if hash, ok := snap.Files[relPath]; ok {
+			set[hash] = struct{}{}
+		}
+	}
+	return set
 }
 
 // planDeletions は saveDir 配下でリモートスナップショットに存在しないファイルを洗い出し、
@@ -146,7 +270,7 @@ func buildSaveSnapshot(saveDir string) (domain.SaveSnapshot, map[domain.BlobHash
 //
 // いずれも相対パス（スラッシュ区切り）を昇順で返す。この関数はファイルを削除しない。
 func planDeletions(saveDir string, snapshot domain.SaveSnapshot, baseTree map[string]struct{}) (tracked, untracked []string, err error) {
-	walkErr := walkSaveFiles(saveDir, func(_, relPath string) error {
+	walkErr := walkSaveFiles(saveDir, func(_, relPath string, _ os.FileInfo) error {
 		if _, ok := snapshot.Files[relPath]; ok {
 			return nil // 新スナップショットに含まれる → 残す
 		}
@@ -267,6 +391,23 @@ type cloudGame struct {
 	UpdatedAt      time.Time         `json:"updatedAt"`
 }
 
+// info は API 公開型に変換する。
+func (cg cloudGame) info() CloudGameInfo {
+	return CloudGameInfo{
+		ID:             cg.ID,
+		Title:          cg.Title,
+		Publisher:      cg.Publisher,
+		ImageHash:      cg.ImageHash,
+		PlayStatus:     cg.PlayStatus,
+		TotalPlayTime:  cg.TotalPlayTime,
+		LastPlayed:     cg.LastPlayed,
+		ClearedAt:      cg.ClearedAt,
+		CurrentRouteID: cg.CurrentRouteID,
+		CreatedAt:      cg.CreatedAt,
+		UpdatedAt:      cg.UpdatedAt,
+	}
+}
+
 // cloudSession は sessions.json のクラウド保存フォーマット。
 type cloudSession struct {
 	ID          string    `json:"id"`
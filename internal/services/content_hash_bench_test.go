@@ -0,0 +1,94 @@
+package services
+
+import (
+	"testing"
+
+	"CloudLaunch_Go/internal/domain"
+)
+
+// warmSaveHashCache は fixture を1回走査して記録したエントリを返す（前回同期済みの状態）。
+func warmSaveHashCache(b *testing.B, fixture *benchSaveFixture) map[string]domain.SaveHashCacheEntry {
+	b.Helper()
+	cache := newSaveHashCache(nil, false)
+	if _, err := buildSaveTree(fixture.dir, cache, 0); err != nil {
+		b.Fatalf("buildSaveTree: %v", err)
+	}
+	upserts, _ := cache.changes(true)
+	if len(upserts) != len(fixture.relPath) {
+		b.Fatalf("expected %d cache entries, got %d", len(fixture.relPath), len(upserts))
+	}
+	return upserts
+}
+
+// BenchmarkBuildSaveTreeShapes は状態確認の走査を、キャッシュ無し（全件ハッシュ）と
+// 前回同期済み（stat 一致で再ハッシュを省く）で測る。cold の MB/s がハッシュ計算の処理量になる。
+func BenchmarkBuildSaveTreeShapes(b *testing.B) {
+	for _, shape := range benchSaveShapes {
+		b.Run(shape.name+"/cold", func(b *testing.B) {
+			fixture := shape.fixture(b)
+			b.SetBytes(fixture.bytes)
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				if _, err := buildSaveTree(fixture.dir, nil, 0); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+		b.Run(shape.name+"/warm", func(b *testing.B) {
+			fixture := shape.fixture(b)
+			cached := warmSaveHashCache(b, fixture)
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				if _, err := buildSaveTree(fixture.dir, newSaveHashCache(cached, false), 0); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
+
+// BenchmarkBuildSaveSnapshot は Push の走査（ハッシュに加えてアップロード元の控えを作る）を測る。
+func BenchmarkBuildSaveSnapshot(b *testing.B) {
+	for _, shape := range benchSaveShapes {
+		b.Run(shape.name+"/warm", func(b *testing.B) {
+			fixture := shape.fixture(b)
+			cached := warmSaveHashCache(b, fixture)
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				if _, _, err := buildSaveSnapshot(fixture.dir, newSaveHashCache(cached, false), 0); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
+
+// BenchmarkPlanDeletions はリモートに半分だけ残り、消えた残りの半分が前回同期済み（tracked）と
+// 未同期（untracked）に分かれる状態で削除計画を測る。
+func BenchmarkPlanDeletions(b *testing.B) {
+	for _, shape := range benchSaveShapes {
+		b.Run(shape.name, func(b *testing.B) {
+			fixture := shape.fixture(b)
+			snapshot := domain.SaveSnapshot{Files: make(map[string]domain.BlobHash, len(fixture.relPath))}
+			baseTree := make(map[string]struct{}, len(fixture.relPath))
+			for i, relPath := range fixture.relPath {
+				switch i % 4 {
+				case 0, 1:
+					snapshot.Files[relPath] = ""
+				case 2:
+					baseTree[relPath] = struct{}{}
+				}
+			}
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				if _, _, err := planDeletions(fixture.dir, snapshot, baseTree); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
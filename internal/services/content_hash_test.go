@@ -2,6 +2,7 @@ package services
 
 import (
 	"encoding/json"
+	"fmt"
 	"os"
 	"path/filepath"
 	"runtime"
@@ -39,7 +40,7 @@ func TestHashBytesDifferentInputProducesDifferentHash(t *testing.T) {
 func TestBuildSaveSnapshotReturnsErrorForMissingDir(t *testing.T) {
 	t.Parallel()
 
-	_, _, err := buildSaveSnapshot("/nonexistent/path/that/does/not/exist")
+	_, _, err := buildSaveSnapshot("/nonexistent/path/that/does/not/exist", nil, 0)
 	if err == nil {
 		t.Fatal("expected error for missing directory")
 	}
@@ -48,7 +49,7 @@ func TestBuildSaveSnapshotReturnsErrorForMissingDir(t *testing.T) {
 func TestBuildSaveSnapshotReturnsErrorForEmptyPath(t *testing.T) {
 	t.Parallel()
 
-	_, _, err := buildSaveSnapshot("")
+	_, _, err := buildSaveSnapshot("", nil, 0)
 	if err == nil {
 		t.Fatal("expected error for empty path")
 	}
@@ -63,7 +64,7 @@ func TestBuildSaveSnapshotReturnsErrorForFile(t *testing.T) {
 	}
 	_ = f.Close()
 
-	_, _, err = buildSaveSnapshot(f.Name())
+	_, _, err = buildSaveSnapshot(f.Name(), nil, 0)
 	if err == nil {
 		t.Fatal("expected error when path is a file, not directory")
 	}
@@ -80,7 +81,7 @@ func TestBuildSaveSnapshotWalksFiles(t *testing.T) {
 		t.Fatal(err)
 	}
 
-	snap, blobs, err := buildSaveSnapshot(dir)
+	snap, blobs, err := buildSaveSnapshot(dir, nil, 0)
 	if err != nil {
 		t.Fatalf("unexpected error: %v", err)
 	}
@@ -91,15 +92,22 @@ func TestBuildSaveSnapshotWalksFiles(t *testing.T) {
 		t.Fatalf("expected 2 blobs, got %d", len(blobs))
 	}
 
-	// ハッシュと blobs が一致しているか確認
+	// ハッシュと blobs の実体が一致しているか確認
 	for relPath, hash := range snap.Files {
-		data, ok := blobs[hash]
+		source, ok := blobs[hash]
 		if !ok {
 			t.Fatalf("blob missing for %s (hash %s)", relPath, hash)
 		}
+		data, err := os.ReadFile(source.Path)
+		if err != nil {
+			t.Fatalf("blob source unreadable for %s: %v", relPath, err)
+		}
 		if hashBytes(data) != hash {
 			t.Fatalf("blob content does not match hash for %s", relPath)
 		}
+		if source.Size != int64(len(data)) {
+			t.Fatalf("blob size = %d, want %d for %s", source.Size, len(data), relPath)
+		}
 	}
 }
 
@@ -111,11 +119,11 @@ func TestBuildSaveSnapshotIsDeteministic(t *testing.T) {
 		t.Fatal(err)
 	}
 
-	snap1, _, err := buildSaveSnapshot(dir)
+	snap1, _, err := buildSaveSnapshot(dir, nil, 0)
 	if err != nil {
 		t.Fatal(err)
 	}
-	snap2, _, err := buildSaveSnapshot(dir)
+	snap2, _, err := buildSaveSnapshot(dir, nil, 0)
 	if err != nil {
 		t.Fatal(err)
 	}
@@ -411,11 +419,11 @@ func TestBuildSaveTreeMatchesSnapshot(t *testing.T) {
 		t.Fatal(err)
 	}
 
-	tree, err := buildSaveTree(dir)
+	tree, err := buildSaveTree(dir, nil, 0)
 	if err != nil {
 		t.Fatalf("buildSaveTree: %v", err)
 	}
-	snap, _, err := buildSaveSnapshot(dir)
+	snap, _, err := buildSaveSnapshot(dir, nil, 0)
 	if err != nil {
 		t.Fatalf("buildSaveSnapshot: %v", err)
 	}
@@ -429,10 +437,111 @@ func TestBuildSaveTreeMatchesSnapshot(t *testing.T) {
 	}
 }
 
+// TestBuildSaveSnapshotParallelMatchesSequential は並列ハッシュでもスナップショットと
+// 重複内容の代表ファイルが逐次版と一致する（fingerprint が並列数に依存しない）ことを確認する。
+func TestBuildSaveSnapshotParallelMatchesSequential(t *testing.T) {
+	t.Parallel()
+	dir := t.TempDir()
+	for i := 0; i < 40; i++ {
+		sub := filepath.Join(dir, fmt.Sprintf("d%d", i%4))
+		if err := os.MkdirAll(sub, 0o700); err != nil {
+			t.Fatal(err)
+		}
+		// i%5 で内容を重複させ、代表ファイルの選び方も検証する
+		if err := os.WriteFile(filepath.Join(sub, fmt.Sprintf("f%02d.sav", i)), []byte(fmt.Sprintf("content-%d", i%5)), 0o600); err != nil {
+			t.Fatal(err)
+		}
+	}
+
+	seqSnap, seqBlobs, err := buildSaveSnapshot(dir, nil, 1)
+	if err != nil {
+		t.Fatalf("sequential: %v", err)
+	}
+	seqJSON, _ := json.Marshal(seqSnap)
+	for _, workers := range []int{0, 2, 8} {
+		snap, blobs, err := buildSaveSnapshot(dir, nil, workers)
+		if err != nil {
+			t.Fatalf("workers=%d: %v", workers, err)
+		}
+		got, _ := json.Marshal(snap)
+		if string(got) != string(seqJSON) {
+			t.Fatalf("workers=%d: snapshot differs from sequential", workers)
+		}
+		if len(blobs) != len(seqBlobs) {
+			t.Fatalf("workers=%d: blobs = %d, want %d", workers, len(blobs), len(seqBlobs))
+		}
+		for hash, src := range seqBlobs {
+			if blobs[hash].Path != src.Path {
+				t.Fatalf("workers=%d: representative for %s = %s, want %s", workers, hash, blobs[hash].Path, src.Path)
+			}
+		}
+	}
+}
+
+// TestHashSaveFilesPropagatesError はワーカー側のハッシュ失敗が呼び出し元へ返ることを確認する。
+func TestHashSaveFilesPropagatesError(t *testing.T) {
+	if runtime.GOOS == "windows" {
+		t.Skip("パーミッションでの読み取り拒否は POSIX 前提")
+	}
+	if os.Geteuid() == 0 {
+		t.Skip("root ではパーミッションによる読み取り拒否が効かない")
+	}
+	t.Parallel()
+	dir := t.TempDir()
+	for i := 0; i < 8; i++ {
+		if err := os.WriteFile(filepath.Join(dir, fmt.Sprintf("f%d.sav", i)), []byte("x"), 0o600); err != nil {
+			t.Fatal(err)
+		}
+	}
+	if err := os.WriteFile(filepath.Join(dir, "locked.sav"), []byte("x"), 0o000); err != nil {
+		t.Fatal(err)
+	}
+	if _, err := buildSaveTree(dir, nil, 4); err == nil {
+		t.Fatal("expected error for unreadable file")
+	}
+}
+
+// BenchmarkBuildSaveTree は逐次ハッシュ（workers=1）と CPU 数ぶんの並列ハッシュを比較する。
+//
+//	go test ./internal/services -run '^$' -bench BuildSaveTree
+func BenchmarkBuildSaveTree(b *testing.B) {
+	const (
+		fileCount = 64
+		fileSize  = 1 << 20
+	)
+	dir := b.TempDir()
+	data := make([]byte, fileSize)
+	for i := 0; i < fileCount; i++ {
+		for j := range data {
+			data[j] = byte(i + j)
+		}
+		if err := os.WriteFile(filepath.Join(dir, fmt.Sprintf("f%03d.sav", i)), data, 0o600); err != nil {
+			b.Fatal(err)
+		}
+	}
+
+	for _, bc := range []struct {
+		name    string
+		workers int
+	}{
+		{"sequential", 1},
+		{"parallel", 0},
+	} {
+		b.Run(bc.name, func(b *testing.B) {
+			b.SetBytes(fileCount * fileSize)
+			for i := 0; i < b.N; i++ {
+				if _, err := buildSaveTree(dir, nil, bc.workers); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
+
 // TestBuildSaveTreeRejectsMissingDir は存在しないディレクトリでエラーを返すことを確認する。
 func TestBuildSaveTreeRejectsMissingDir(t *testing.T) {
 	t.Parallel()
-	if _, err := buildSaveTree(filepath.Join(t.TempDir(), "nope")); err == nil {
+	if _, err := buildSaveTree(filepath.Join(t.TempDir(), "nope"), nil, 0); err == nil {
 		t.Fatal("expected error for missing dir")
 	}
 }
@@ -461,7 +570,7 @@ func TestBuildSaveTreeIgnoresSymlinks(t *testing.T) {
 		t.Skipf("symlink を作成できない環境: %v", err)
 	}
 
-	tree, err := buildSaveTree(saveDir)
+	tree, err := buildSaveTree(saveDir, nil, 0)
 	if err != nil {
 		t.Fatalf("buildSaveTree: %v", err)
 	}
@@ -473,7 +582,7 @@ func TestBuildSaveTreeIgnoresSymlinks(t *testing.T) {
 	}
 
 	// buildSaveSnapshot 側も同様にリンクを無視すること
-	snap, blobs, err := buildSaveSnapshot(saveDir)
+	snap, blobs, err := buildSaveSnapshot(saveDir, nil, 0)
 	if err != nil {
 		t.Fatalf("buildSaveSnapshot: %v", err)
 	}
@@ -481,7 +590,11 @@ func TestBuildSaveTreeIgnoresSymlinks(t *testing.T) {
 		t.Fatal("buildSaveSnapshot も symlink を含めてはならない")
 	}
 	// リンク先の機密内容が blob 化されていないこと
-	for _, data := range blobs {
+	for _, source := range blobs {
+		data, err := os.ReadFile(source.Path)
+		if err != nil {
+			t.Fatalf("blob source unreadable: %v", err)
+		}
 		if string(data) == "TOP SECRET" {
 			t.Fatal("リンク先の機密内容が blob 化されている（情報漏洩）")
 		}
@@ -515,7 +628,7 @@ func TestBuildSaveTreeFollowsSymlinkedRoot(t *testing.T) {
 		t.Skipf("symlink を作成できない環境: %v", err)
 	}
 
-	tree, err := buildSaveTree(linkPath)
+	tree, err := buildSaveTree(linkPath, nil, 0)
 	if err != nil {
 		t.Fatalf("buildSaveTree: %v", err)
 	}
@@ -526,7 +639,7 @@ func TestBuildSaveTreeFollowsSymlinkedRoot(t *testing.T) {
 		t.Fatal("symlink root 配下のサブディレクトリ内ファイルが抜けている")
 	}
 
-	snap, blobs, err := buildSaveSnapshot(linkPath)
+	snap, blobs, err := buildSaveSnapshot(linkPath, nil, 0)
 	if err != nil {
 		t.Fatalf("buildSaveSnapshot: %v", err)
 	}
@@ -0,0 +1,83 @@
+package services
+
+import (
+	"context"
+	"io"
+	"log/slog"
+	"os"
+	"testing"
+)
+
+// newBenchSyncService は fixture をセーブフォルダにしたゲーム1件と、メモリ上のブロブストアで同期サービスを作る。
+// ストレージ層の実通信を除いた Push / Pull（走査・ハッシュ・putBlobs / downloadBlobs の呼び出し・DB 反映）を測る。
+func newBenchSyncService(saveDir string, bstore *fakeBlobStore) (*ContentSyncService, *fakeContentSyncRepository) {
+	game := baseGame(saveDir)
+	repo := newFakeRepo(&game, nil)
+	svc := newTestService(repo, bstore)
+	svc.logger = slog.New(slog.NewTextHandler(io.Discard, nil))
+	return svc, repo
+}
+
+// BenchmarkContentSyncPush は初回 Push（全ブロブを送る）と、変更の無い再 Push
+// （ハッシュキャッシュとリモートの控えが効き、送るブロブが無い）を測る。
+func BenchmarkContentSyncPush(b *testing.B) {
+	ctx := context.Background()
+	for _, shape := range benchSaveShapes {
+		b.Run(shape.name+"/first", func(b *testing.B) {
+			fixture := shape.fixture(b)
+			b.SetBytes(fixture.bytes)
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				svc, repo := newBenchSyncService(fixture.dir, newFakeBlobStore())
+				if err := svc.Push(ctx, repo.game.ID, nil); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+		b.Run(shape.name+"/unchanged", func(b *testing.B) {
+			fixture := shape.fixture(b)
+			svc, repo := newBenchSyncService(fixture.dir, newFakeBlobStore())
+			if err := svc.Push(ctx, repo.game.ID, nil); err != nil {
+				b.Fatal(err)
+			}
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				if err := svc.Push(ctx, repo.game.ID, nil); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
+
+// BenchmarkContentSyncPull は fixture を Push したリモートから、空のセーブフォルダ（新しい端末）へ Pull する。
+func BenchmarkContentSyncPull(b *testing.B) {
+	ctx := context.Background()
+	for _, shape := range benchSaveShapes {
+		b.Run(shape.name+"/fresh", func(b *testing.B) {
+			fixture := shape.fixture(b)
+			bstore := newFakeBlobStore()
+			source, repo := newBenchSyncService(fixture.dir, bstore)
+			if err := source.Push(ctx, repo.game.ID, nil); err != nil {
+				b.Fatal(err)
+			}
+			target := b.TempDir()
+			b.SetBytes(fixture.bytes)
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				b.StopTimer()
+				if err := os.RemoveAll(target); err != nil {
+					b.Fatal(err)
+				}
+				svc, repo := newBenchSyncService(target, bstore)
+				b.StartTimer()
+				if _, err := svc.Pull(ctx, repo.game.ID, nil, false); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
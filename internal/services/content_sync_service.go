@@ -36,57 +36,105 @@ type ProgressFunc func(current, total int)
 type contentBlobStore interface {
 	readHEAD(ctx context.Context, gameID string) (string, error)
 	writeHEAD(ctx context.Context, gameID, hash string) error
+	// readHEADWithETag / writeHEADIfMatch は GC の HEAD 付け替え用。ETag が読んだときのままなら書き込み、競合時は storage.ErrPreconditionFailed。
+	readHEADWithETag(ctx context.Context, gameID string) (string, string, error)
+	writeHEADIfMatch(ctx context.Context, gameID, hash, etag string) error
+	// readGCLease は GC のリースの本文と ETag を返す（無ければ (nil, "", nil)）。writeGCLease は ETag が etag のままなら
+	// （etag が空なら未作成の場合のみ）書き込み、putGCLease は取得済みのリースを無条件に書き換える。
+	readGCLease(ctx context.Context, gameID string) ([]byte, string, error)
+	writeGCLease(ctx context.Context, gameID string, data []byte, etag string) error
+	putGCLease(ctx context.Context, gameID string, data []byte) error
 	getBlob(ctx context.Context, gameID, kind, hash string) ([]byte, error)
 	putBlob(ctx context.Context, gameID, kind, hash string, data []byte) error
-	putBlobs(ctx context.Context, gameID string, blobs map[string][]byte, concurrency int, onProgress func(int, int)) error
-	downloadBlobs(ctx context.Context, gameID, saveDir string, blobs map[string]string, concurrency int, onProgress func(int, int)) error
+	putBlobs(ctx context.Context, gameID string, blobs map[string]storage.BlobSource, concurrency int, index storage.BlobIndex, journal storage.TransferJournal, onProgress func(int, int)) (storage.BlobIndex, error)
+	downloadBlobs(ctx context.Context, gameID, saveDir string, blobs map[string]string, chunked map[string]struct{}, concurrency int, journal storage.TransferJournal, onProgress func(int, int)) error
 	deleteByPrefix(ctx context.Context, prefix string) error
+	// listObjects / deleteObjects は GC 用。prefix 配下をサイズ・更新時刻付きで列挙し、キーを指定して一括削除する。
+	listObjects(ctx context.Context, prefix string) ([]storage.ObjectInfo, error)
+	deleteObjects(ctx context.Context, keys []string) error
+	// getChunkManifest は manifests/<hash> を読む（キーはファイル全体のハッシュなので getBlob の検証が通らない）。
+	getChunkManifest(ctx context.Context, gameID, hash string) (storage.ChunkManifest, error)
 	listGameIDs(ctx context.Context) ([]string, error)
+	// readCatalog はクラウドカタログの本文と ETag を返す。無ければ (nil, "", nil)。
+	readCatalog(ctx context.Context) ([]byte, string, error)
+	// writeCatalog は ETag が etag のままなら書き込む（etag が空なら未作成の場合のみ）。競合時は storage.ErrPreconditionFailed。
+	writeCatalog(ctx context.Context, data []byte, etag string) error
+	deleteCatalog(ctx context.Context) error
 }
 
 type s3BlobStore struct {
-	client *s3.Client
-	bucket string
+	client   *s3.Client
+	bucket   string
+	compress bool               // 書き込み時に gzip を試みるか（読み込みは常にメタデータで自動判定）
+	cache    *storage.BlobCache // commit / tree / meta のローカルキャッシュと HEAD の ETag 控え（nil 可）
 }
 
 func (b *s3BlobStore) readHEAD(ctx context.Context, gameID string) (string, error) {
-	return storage.ReadHEAD(ctx, b.client, b.bucket, gameID)
+	return storage.ReadHEADCached(ctx, b.client, b.bucket, gameID, b.cache)
 }
 func (b *s3BlobStore) writeHEAD(ctx context.Context, gameID, hash string) error {
+	b.cache.ForgetHEAD(b.bucket, gameID)
 	return storage.WriteHEAD(ctx, b.client, b.bucket, gameID, hash)
 }
+func (b *s3BlobStore) readHEADWithETag(ctx context.Context, gameID string) (string, string, error) {
+	return storage.ReadHEADWithETag(ctx, b.client, b.bucket, gameID)
+}
+func (b *s3BlobStore) writeHEADIfMatch(ctx context.Context, gameID, hash, etag string) error {
+	b.cache.ForgetHEAD(b.bucket, gameID)
+	return storage.WriteHEADIfMatch(ctx, b.client, b.bucket, gameID, hash, etag)
+}
+func (b *s3BlobStore) readGCLease(ctx context.Context, gameID string) ([]byte, string, error) {
+	return storage.ReadGCLease(ctx, b.client, b.bucket, gameID)
+}
+func (b *s3BlobStore) writeGCLease(ctx context.Context, gameID string, data []byte, etag string) error {
+	return storage.WriteGCLease(ctx, b.client, b.bucket, gameID, data, etag)
+}
+func (b *s3BlobStore) putGCLease(ctx context.Context, gameID string, data []byte) error {
+	return storage.PutGCLease(ctx, b.client, b.bucket, gameID, data)
+}
 func (b *s3BlobStore) getBlob(ctx context.Context, gameID, kind, hash string) ([]byte, error) {
-	return storage.GetBlob(ctx, b.client, b.bucket, gameID, kind, hash)
+	return storage.GetBlobCached(ctx, b.client, b.bucket, gameID, kind, hash, b.cache)
 }
 func (b *s3BlobStore) putBlob(ctx context.Context, gameID, kind, hash string, data []byte) error {
-	return storage.PutBlob(ctx, b.client, b.bucket, gameID, kind, hash, data)
+	if err := storage.PutBlob(ctx, b.client, b.bucket, gameID, kind, hash, data, b.compress); err != nil {
+		return err
+	}
+	// 自分で書いたコミットは次回 Status で読むため、アップロード済みの内容をそのまま入れておく
+	b.cache.Put(kind, hash, data)
+	return nil
 }
-func (b *s3BlobStore) putBlobs(ctx context.Context, gameID string, blobs map[string][]byte, concurrency int, onProgress func(int, int)) error {
-	return storage.PutBlobs(ctx, b.client, b.bucket, gameID, blobs, concurrency, onProgress)
+func (b *s3BlobStore) putBlobs(ctx context.Context, gameID string, blobs map[string]storage.BlobSource, concurrency int, index storage.BlobIndex, journal storage.TransferJournal, onProgress func(int, int)) (storage.BlobIndex, error) {
+	return storage.PutBlobs(ctx, b.client, b.bucket, gameID, blobs, concurrency, b.compress, index, journal, onProgress)
 }
-func (b *s3BlobStore) downloadBlobs(ctx context.Context, gameID, saveDir string, blobs map[string]string, concurrency int, onProgress func(int, int)) error {
-	return storage.DownloadBlobs(ctx, b.client, b.bucket, gameID, saveDir, blobs, concurrency, onProgress)
+func (b *s3BlobStore) downloadBlobs(ctx context.Context, gameID, saveDir string, blobs map[string]string, chunked map[string]struct{}, concurrency int, journal storage.TransferJournal, onProgress func(int, int)) error {
+	return storage.DownloadBlobs(ctx, b.client, b.bucket, gameID, saveDir, blobs, chunked, concurrency, journal, onProgress)
 }
 func (b *s3BlobStore) deleteByPrefix(ctx context.Context, prefix string) error {
 	return storage.DeleteObjectsByPrefix(ctx, b.client, b.bucket, prefix)
 }
+func (b *s3BlobStore) listObjects(ctx context.Context, prefix string) ([]storage.ObjectInfo, error) {
+	return storage.ListObjects(ctx, b.client, b.bucket, prefix)
+}
+func (b *s3BlobStore) deleteObjects(ctx context.Context, keys []string) error {
+	return storage.DeleteObjectKeys(ctx, b.client, b.bucket, keys)
+}
+func (b *s3BlobStore) getChunkManifest(ctx context.Context, gameID, hash string) (storage.ChunkManifest, error) {
+	return storage.GetChunkManifest(ctx, b.client, b.bucket, gameID, hash)
+}
+
+// listGameIDs は games/ 直下のゲームディレクトリ名を返す。ブロブを全件列挙しないよう CommonPrefixes だけを読むため、
+// HEAD の無いディレクトリ（削除途中など）も含まれる。呼び出し側は readHEAD が "" のゲームをデータ無しとして扱う。
 func (b *s3BlobStore) listGameIDs(ctx context.Context) ([]string, error) {
-	objects, err := storage.ListObjects(ctx, b.client, b.bucket, "games/")
-	if err != nil {
-		return nil, err
-	}
-	seen := make(map[string]struct{})
-	var ids []string
-	for _, obj := range objects {
-		parts := strings.Split(obj.Key, "/")
-		if len(parts) == 3 && parts[0] == "games" && parts[2] == "HEAD" {
-			if _, ok := seen[parts[1]]; !ok {
-				seen[parts[1]] = struct{}{}
-				ids = append(ids, parts[1])
-			}
-		}
-	}
-	return ids, nil
+	return storage.ListChildPrefixes(ctx, b.client, b.bucket, "games/")
+}
+func (b *s3BlobStore) readCatalog(ctx context.Context) ([]byte, string, error) {
+	return storage.ReadObjectWithETag(ctx, b.client, b.bucket, cloudCatalogKey)
+}
+func (b *s3BlobStore) writeCatalog(ctx context.Context, data []byte, etag string) error {
+	return storage.PutObjectIfMatch(ctx, b.client, b.bucket, cloudCatalogKey, data, "application/json", etag)
+}
+func (b *s3BlobStore) deleteCatalog(ctx context.Context) error {
+	return storage.DeleteObject(ctx, b.client, b.bucket, cloudCatalogKey)
 }
 
 // ContentSyncService はコンテンツアドレッシングによるゲームデータ同期を提供する。
@@ -96,8 +144,35 @@ type ContentSyncService struct {
 	repository   ContentSyncRepository
 	logger       *slog.Logger
 	newBlobStore func(ctx context.Context) (contentBlobStore, error)
-	gameLocks    sync.Map // gameID → *sync.Mutex（同一ゲームの Push/Pull/ResolveConflict/DeleteFromCloud を直列化）
+	blobCache    *storage.BlobCache // 不変ブロブのディスクキャッシュ。s3BlobStore 間で共有する
+	gameLocks    sync.Map           // gameID → *sync.Mutex（同一ゲームの Push/Pull/ResolveConflict/DeleteFromCloud を直列化）
 	offline      atomic.Bool
+	scheduler    *SyncScheduler // 全ゲーム共通の同期ジョブ枠（nil なら制限なし）
+	metrics      *PerfMetrics   // 段階ごとの計測（nil なら計測しない）
+	cloudTrees   cloudTreeCache // ゲームごとのクラウド論理ツリーの索引（ListCloudDirectory 用）
+	// onGamesChanged は Pull がゲーム情報（実行ファイルパス等）をローカルに反映した後に呼ぶ（nil 可）。
+	onGamesChanged func()
+}
+
+// SetGamesChangedHook は Pull でゲーム情報を書き換えた後に呼ぶ関数を設定する（GameService と同じ用途）。
+func (s *ContentSyncService) SetGamesChangedHook(hook func()) {
+	s.onGamesChanged = hook
+}
+
+// SetScheduler は Push / Pull / 一覧などの実行枠を配分するスケジューラを設定する（App が持つ1つを共有する）。
+func (s *ContentSyncService) SetScheduler(scheduler *SyncScheduler) {
+	s.scheduler = scheduler
+}
+
+// SetPerfMetrics は Push / Pull / Status / 一覧の段階ごとの計測先を設定する（App が持つ1つを共有する）。
+func (s *ContentSyncService) SetPerfMetrics(metrics *PerfMetrics) {
+	s.metrics = metrics
+}
+
+// admit はスケジューラの実行枠を待つ。ctx に WithSyncPriority の指定があればそれを、無ければ fallback を優先度にする。
+// 戻り値の ctx で処理を続け、終わったら解放関数を呼ぶこと。
+func (s *ContentSyncService) admit(ctx context.Context, fallback SyncPriority) (context.Context, func(), error) {
+	return s.scheduler.Acquire(ctx, syncPriorityFrom(ctx, fallback))
 }
 
 // SetOfflineMode はオフラインモードの ON/OFF を切り替える。
@@ -132,6 +207,18 @@ func (s *ContentSyncService) SetS3UseTLS(enabled bool) {
 	s.config.S3UseTLS = enabled
 }
 
+// SetS3Compression はブロブを gzip 圧縮してアップロードするかを更新する。
+// 圧縮済みブロブは旧バージョンのクライアントでは読めないため既定は無効。
+func (s *ContentSyncService) SetS3Compression(enabled bool) {
+	s.config.S3Compression = enabled
+}
+
+// SetSaveHashParanoid はハッシュキャッシュを信用せず毎回全ファイルを再ハッシュするかを更新する。
+// mtime を保ったまま内容を書き換えるツールを使う環境向けの逃げ道。
+func (s *ContentSyncService) SetSaveHashParanoid(enabled bool) {
+	s.config.SaveHashParanoid = enabled
+}
+
 // NewContentSyncService は ContentSyncService を生成する。
 func NewContentSyncService(cfg config.Config, store credentials.Store, repo ContentSyncRepository, logger *slog.Logger) *ContentSyncService {
 	svc := &ContentSyncService{
@@ -139,13 +226,14 @@ func NewContentSyncService(cfg config.Config, store credentials.Store, repo Cont
 		store:      store,
 		repository: repo,
 		logger:     logger,
+		blobCache:  storage.NewBlobCache(filepath.Join(cfg.AppDataDir, "cache", "blobs"), int64(cfg.BlobCacheMaxMB)<<20),
 	}
 	svc.newBlobStore = func(ctx context.Context) (contentBlobStore, error) {
 		client, s3cfg, err := svc.newClient(ctx)
 		if err != nil {
 			return nil, err
 		}
-		return &s3BlobStore{client: client, bucket: s3cfg.Bucket}, nil
+		return &s3BlobStore{client: client, bucket: s3cfg.Bucket, compress: svc.config.S3Compression, cache: svc.blobCache}, nil
 	}
 	return svc
 }
@@ -153,6 +241,7 @@ func NewContentSyncService(cfg config.Config, store credentials.Store, repo Cont
 // lockGame は gameID 単位の排他ロックを取得し、解放関数を返す。
 // 同一ゲームに対する Push/Pull/ResolveConflict/DeleteFromCloud を直列化し、
 // ローカルファイル操作とリモート HEAD 操作が交錯しないようにする。
+// 実行枠（admit）はロックを取ってから得る。ロック待ちのジョブが他のゲームに回せる枠を塞がないようにするため。
 // 使い方: defer s.lockGame(gameID)()
 func (s *ContentSyncService) lockGame(gameID string) func() {
 	m, _ := s.gameLocks.LoadOrStore(gameID, &sync.Mutex{})
@@ -170,7 +259,7 @@ func (s *ContentSyncService) newClient(ctx context.Context) (*s3.Client, storage
 		return nil, storage.S3Config{}, fmt.Errorf("認証情報が見つかりません")
 	}
 	cfg := resolveS3Config(s.config, credential)
-	client, err := storage.NewClient(ctx, cfg, *credential)
+	client, err := storage.SharedClient(ctx, cfg, *credential, s.config.S3UploadConcurrency)
 	if err != nil {
 		return nil, storage.S3Config{}, fmt.Errorf("S3クライアント作成に失敗: %w", err)
 	}
@@ -209,6 +298,41 @@ func (s *ContentSyncService) getOrInitDeviceName(ctx context.Context) (string, e
 	return hostname, nil
 }
 
+// loadSaveHashCache はゲームのハッシュキャッシュを DB から読み込む。
+// 読み込みに失敗しても同期は止めず、空キャッシュ（全件再ハッシュ）で続行する。
+func (s *ContentSyncService) loadSaveHashCache(ctx context.Context, gameID string) *saveHashCache {
+	entries, err := s.repository.GetSaveHashCache(ctx, gameID)
+	if err != nil {
+		s.logger.Warn("ハッシュキャッシュの読み込みに失敗（全件再ハッシュします）", "gameId", gameID, "error", err)
+		entries = nil
+	}
+	return newSaveHashCache(entries, s.config.SaveHashParanoid)
+}
+
+// storeSaveHashCache は走査で得た差分をキャッシュへ書き戻す。失敗は次回の再ハッシュで吸収されるためログのみ。
+func (s *ContentSyncService) storeSaveHashCache(ctx context.Context, gameID string, cache *saveHashCache, prune bool) {
+	upserts, deletes := cache.changes(prune)
+	if err := s.repository.UpdateSaveHashCache(ctx, gameID, upserts, deletes); err != nil {
+		s.logger.Warn("ハッシュキャッシュの保存に失敗", "gameId", gameID, "error", err)
+	}
+}
+
+// LocalSaveHash はセーブフォルダの SaveSnapshot のハッシュ（MetaSnapshot の SavesJSON と同じ値）を返す。
+// ハッシュキャッシュを使い HashConcurrency 本で並列に計算し、走査結果をキャッシュへ書き戻す。
+func (s *ContentSyncService) LocalSaveHash(ctx context.Context, gameID, saveFolderPath string) (string, error) {
+	cache := s.loadSaveHashCache(ctx, gameID)
+	saveSnap, err := buildSaveTree(saveFolderPath, cache, s.config.HashConcurrency)
+	if err != nil {
+		return "", err
+	}
+	s.storeSaveHashCache(ctx, gameID, cache, true)
+	saveSnapJSON, err := json.Marshal(saveSnap)
+	if err != nil {
+		return "", err
+	}
+	return hashBytes(saveSnapJSON), nil
+}
+
 // buildLocalMeta はゲームの現在のローカル状態から MetaSnapshot を構築する。
 func (s *ContentSyncService) buildLocalMeta(ctx context.Context, game domain.Game, saveFolderPath string) (metaBuildResult, error) {
 	sessions, err := s.repository.ListPlaySessionsByGame(ctx, game.ID)
@@ -229,15 +353,10 @@ func (s *ContentSyncService) buildLocalMeta(ctx context.Context, game domain.Gam
 			s.logger.Warn("画像のハッシュ計算に失敗（imageHash を空として扱う）", "gameId", game.ID, "path", *game.ImagePath, "error", herr)
 		}
 	}
-	saveSnap, err := buildSaveTree(saveFolderPath)
+	savesHash, err := s.LocalSaveHash(ctx, game.ID, saveFolderPath)
 	if err != nil {
 		return metaBuildResult{}, err
 	}
-	saveSnapJSON, err := json.Marshal(saveSnap)
-	if err != nil {
-		return metaBuildResult{}, err
-	}
-	savesHash := hashBytes(saveSnapJSON)
 	// Status 経路は contentFingerprint しか参照しないため、サマリ表示用キャッシュは
 	// 埋めない（0 を渡す）。実値は Push 時の pushBuildLocalMeta 側で書き込む。
 	return buildMetaSnapshot(game, sessions, imageHash, savesHash, deviceName, 0, 0)
@@ -249,7 +368,71 @@ func (s *ContentSyncService) Status(ctx context.Context, gameID string) (domain.
 	if err != nil {
 		return domain.SyncStatusDetail{}, err
 	}
+	return s.status(ctx, bstore, gameID)
+}
+
+// GameSyncStatus は StatusMany の1ゲーム分の結果。Error が空でないときは Detail を使わない。
+type GameSyncStatus struct {
+	GameID string                  `json:"gameId"`
+	Detail domain.SyncStatusDetail `json:"detail"`
+	Error  string                  `json:"error,omitempty"`
+}
 
+// StatusMany は複数ゲームの同期状態をまとめて判定し、gameIDs の順（重複・空文字は除く）で返す。
+// ブロブストア（クライアントと認証情報の解決）は1回だけ作り、ゲームごとの HEAD 読み込みとローカル走査を
+// S3UploadConcurrency 並列で行う。commit はディスクキャッシュ、HEAD は ETag の条件付き GET、
+// セーブフォルダはハッシュキャッシュで変更分だけを読むので、変化の無いゲームはほぼ HEAD 1 回で済む。
+// onResult（nil 可）は各ゲームの判定が終わるたびに完了順で呼ばれる（同時には呼ばれない）。
+// 個別ゲームの失敗は GameSyncStatus.Error に入れて続行し、全体のエラーはストアを作れない場合などに限る。
+func (s *ContentSyncService) StatusMany(ctx context.Context, gameIDs []string, onResult func(GameSyncStatus)) (_ []GameSyncStatus, err error) {
+	ids := make([]string, 0, len(gameIDs))
+	seen := make(map[string]struct{}, len(gameIDs))
+	for _, id := range gameIDs {
+		id = strings.TrimSpace(id)
+		if _, dup := seen[id]; id == "" || dup {
+			continue
+		}
+		seen[id] = struct{}{}
+		ids = append(ids, id)
+	}
+	if len(ids) == 0 {
+		return []GameSyncStatus{}, nil
+	}
+	// 一覧のバッジ表示用なのでユーザー操作の Pull / Push より後に回す
+	ctx, release, err := s.admit(ctx, SyncPriorityBackground)
+	if err != nil {
+		return nil, err
+	}
+	defer release()
+	ctx, span := s.metrics.startSpan(ctx, "status_many")
+	span.addObjects(int64(len(ids)))
+	defer func() { span.end(err) }()
+	bstore, err := s.newBlobStore(ctx)
+	if err != nil {
+		return nil, err
+	}
+
+	var notifyMu sync.Mutex
+	return fanOutGames(ids, s.config.S3UploadConcurrency, func(id string) *GameSyncStatus {
+		item := GameSyncStatus{GameID: id}
+		if detail, err := s.status(ctx, bstore, id); err != nil {
+			item.Error = err.Error()
+		} else {
+			item.Detail = detail
+		}
+		if onResult != nil {
+			notifyMu.Lock()
+			onResult(item)
+			notifyMu.Unlock()
+		}
+		return &item
+	}), nil
+}
+
+// status は bstore を使って gameID の同期状態を判定する（Status / StatusMany の共通部分）。
+func (s *ContentSyncService) status(ctx context.Context, bstore contentBlobStore, gameID string) (_ domain.SyncStatusDetail, err error) {
+	ctx, span := s.metrics.startSpan(ctx, "status")
+	defer func() { span.end(err) }()
 	remoteHead, err := bstore.readHEAD(ctx, gameID)
 	if err != nil {
 		return domain.SyncStatusDetail{}, err
@@ -278,7 +461,9 @@ func (s *ContentSyncService) Status(ctx context.Context, gameID string) (domain.
 		return domain.SyncStatusDetail{}, fmt.Errorf("セーブフォルダのパスが未設定です")
 	}
 
-	localMeta, err := s.buildLocalMeta(ctx, *game, *game.SaveFolderPath)
+	scanCtx, scanSpan := s.metrics.startSpan(ctx, "status.local_scan")
+	localMeta, err := s.buildLocalMeta(scanCtx, *game, *game.SaveFolderPath)
+	scanSpan.end(err)
 	if err != nil {
 		return domain.SyncStatusDetail{}, err
 	}
@@ -329,10 +514,18 @@ func (s *ContentSyncService) Push(ctx context.Context, gameID string, onProgress
 		return ErrOffline
 	}
 	defer s.lockGame(gameID)()
+	ctx, release, err := s.admit(ctx, SyncPriorityInteractive)
+	if err != nil {
+		return err
+	}
+	defer release()
 	return s.push(ctx, gameID, onProgress, false)
 }
 
-func (s *ContentSyncService) push(ctx context.Context, gameID string, onProgress ProgressFunc, force bool) error {
+// 全体を push、各段階を push.<段階名> として計測する。
+func (s *ContentSyncService) push(ctx context.Context, gameID string, onProgress ProgressFunc, force bool) (err error) {
+	ctx, span := s.metrics.startSpan(ctx, "push")
+	defer func() { span.end(err) }()
 	bstore, err := s.newBlobStore(ctx)
 	if err != nil {
 		return err
@@ -349,22 +542,108 @@ func (s *ContentSyncService) push(ctx context.Context, gameID string, onProgress
 		return fmt.Errorf("セーブフォルダのパスが未設定です")
 	}
 	// !force のとき、push 開始時点のリモート HEAD を控える（writeHEAD 直前の再確認に使う）。
-	expectedHead, err := s.pushCheckRemoteHead(ctx, bstore, gameID, game, force)
+	checkCtx, checkSpan := s.metrics.startSpan(ctx, "push.check_head")
+	expectedHead, err := s.pushCheckRemoteHead(checkCtx, bstore, gameID, game, force)
+	var gcLeaseETag string
+	if err == nil {
+		// GC はリースを置いてから HEAD を付け替えるため、HEAD より後に読めば付け替え後の HEAD にはリースが必ず見える
+		gcLeaseETag, err = s.checkGCLease(checkCtx, bstore, gameID)
+	}
+	checkSpan.end(err)
 	if err != nil {
 		return err
 	}
 
-	meta, saveSnapJSON, savesHash, saveBlobs, imageHash, imageData, err := s.pushBuildLocalMeta(ctx, gameID, game)
+	buildCtx, buildSpan := s.metrics.startSpan(ctx, "push.build_snapshot")
+	meta, saveSnapJSON, savesHash, saveBlobs, imageHash, imageData, err := s.pushBuildLocalMeta(buildCtx, gameID, game)
+	buildSpan.addObjects(meta.Snapshot.FileCount)
+	buildSpan.addBytes(meta.Snapshot.TotalSize)
+	buildSpan.end(err)
 	if err != nil {
 		return err
 	}
 	metaHash := hashBytes(meta.SnapshotBytes)
 
-	if err := s.pushUploadBlobs(ctx, bstore, gameID, onProgress, meta, saveSnapJSON, savesHash, saveBlobs, imageHash, imageData, metaHash); err != nil {
+	// force 時は push 開始時点のリモート HEAD を確認しないため、控えの有効性も判定できない（全件列挙する）。
+	var known *domain.RemoteBlobIndex
+	if !force {
+		known = s.loadRemoteBlobIndex(ctx, gameID, expectedHead)
+	}
+	// 同じリモート HEAD に対する前回の Push が途中で止まっていれば、その完了分と送りかけのマルチパートを引き継ぐ。
+	journal := s.openTransferJournal(ctx, gameID, transferPush, expectedHead, "")
+	succeeded := false
+	defer func() { journal.finish(succeeded) }()
+	uploadCtx, uploadSpan := s.metrics.startSpan(ctx, "push.upload")
+	uploadSpan.addObjects(int64(len(saveBlobs)))
+	index, err := s.pushUploadBlobs(uploadCtx, bstore, gameID, onProgress, meta, saveSnapJSON, savesHash, saveBlobs, imageHash, imageData, metaHash, known, journal)
+	uploadSpan.end(err)
+	if err != nil {
 		return err
 	}
 
-	return s.pushFinalizeHead(ctx, bstore, gameID, force, expectedHead, metaHash, meta, saveSnapJSON)
+	finalizeCtx, finalizeSpan := s.metrics.startSpan(ctx, "push.finalize_head")
+	err = s.pushFinalizeHead(finalizeCtx, bstore, gameID, force, expectedHead, gcLeaseETag, metaHash, meta, saveSnapJSON)
+	finalizeSpan.end(err)
+	if err != nil {
+		return err
+	}
+	succeeded = true
+	s.storeRemoteBlobIndex(ctx, gameID, metaHash, known, index)
+	s.putCloudCatalogEntry(ctx, bstore, gameID, metaHash, meta)
+	return nil
+}
+
+// loadRemoteBlobIndex は Push の重複判定に使ってよいリモート存在済みブロブの控えを返す。
+// 控えを最後に更新した Push が書いた HEAD がいまのリモート HEAD と一致し、最後の全件列挙から
+// RemoteIndexMaxAgeHours 以内のときだけ返す。一致しなければ他端末の Push や DeleteFromCloud を
+// 挟んだ可能性があり、消えたブロブを「ある」と信じると欠けたツリーを公開してしまうため nil（全件列挙）にする。
+func (s *ContentSyncService) loadRemoteBlobIndex(ctx context.Context, gameID, remoteHead string) *domain.RemoteBlobIndex {
+	if remoteHead == "" {
+		return nil
+	}
+	known, err := s.repository.GetRemoteBlobIndex(ctx, gameID)
+	if err != nil {
+		s.logger.Warn("リモートブロブ控えの読み込みに失敗（全件列挙で続行）", "gameId", gameID, "error", err)
+		return nil
+	}
+	if known == nil || known.Head != remoteHead {
+		return nil
+	}
+	maxAge := time.Duration(s.config.RemoteIndexMaxAgeHours) * time.Hour
+	if time.Since(time.Unix(0, known.ListedAt)) > maxAge {
+		return nil
+	}
+	return known
+}
+
+// storeRemoteBlobIndex は Push 成功後の控えを保存する。known が nil（今回全件列挙した）なら丸ごと置き換え、
+// そうでなければ増分だけを追記する。失敗しても次回の全件列挙で回復するためログのみ。
+func (s *ContentSyncService) storeRemoteBlobIndex(ctx context.Context, gameID, head string, known *domain.RemoteBlobIndex, index storage.BlobIndex) {
+	if index == nil {
+		return
+	}
+	update := domain.RemoteBlobIndex{Head: head, Hashes: index}
+	replace := known == nil
+	if replace {
+		update.ListedAt = time.Now().UnixNano()
+	} else {
+		update.ListedAt = known.ListedAt
+		update.Hashes = make(map[string]map[domain.BlobHash]struct{})
+		for kind, hashes := range index {
+			for hash := range hashes {
+				if _, ok := known.Hashes[kind][hash]; ok {
+					continue
+				}
+				if update.Hashes[kind] == nil {
+					update.Hashes[kind] = make(map[domain.BlobHash]struct{})
+				}
+				update.Hashes[kind][hash] = struct{}{}
+			}
+		}
+	}
+	if err := s.repository.SaveRemoteBlobIndex(ctx, gameID, update, replace); err != nil {
+		s.logger.Warn("リモートブロブ控えの保存に失敗", "gameId", gameID, "error", err)
+	}
 }
 
 // pushCheckRemoteHead は !force のとき push 開始時点のリモート HEAD を確認し、
@@ -408,7 +687,7 @@ func (s *ContentSyncService) pushCheckRemoteHead(ctx context.Context, bstore con
 
 // pushBuildLocalMeta はゲームの現在のローカル状態から push 用の MetaSnapshot と
 // アップロード対象（セーブスナップショット・差分ブロブ・画像）を構築する。
-func (s *ContentSyncService) pushBuildLocalMeta(ctx context.Context, gameID string, game *domain.Game) (metaBuildResult, []byte, domain.BlobHash, map[string][]byte, domain.BlobHash, []byte, error) {
+func (s *ContentSyncService) pushBuildLocalMeta(ctx context.Context, gameID string, game *domain.Game) (metaBuildResult, []byte, domain.BlobHash, map[string]storage.BlobSource, domain.BlobHash, []byte, error) {
 	sessions, err := s.repository.ListPlaySessionsByGame(ctx, gameID)
 	if err != nil {
 		return metaBuildResult{}, nil, "", nil, "", nil, err
@@ -418,10 +697,12 @@ func (s *ContentSyncService) pushBuildLocalMeta(ctx context.Context, gameID stri
 		return metaBuildResult{}, nil, "", nil, "", nil, err
 	}
 
-	saveSnap, saveBlobs, err := buildSaveSnapshot(*game.SaveFolderPath)
+	cache := s.loadSaveHashCache(ctx, gameID)
+	saveSnap, saveBlobs, err := buildSaveSnapshot(*game.SaveFolderPath, cache, s.config.HashConcurrency)
 	if err != nil {
 		return metaBuildResult{}, nil, "", nil, "", nil, err
 	}
+	s.storeSaveHashCache(ctx, gameID, cache, true)
 	saveSnapJSON, err := json.Marshal(saveSnap)
 	if err != nil {
 		return metaBuildResult{}, nil, "", nil, "", nil, err
@@ -448,7 +729,7 @@ func (s *ContentSyncService) pushBuildLocalMeta(ctx context.Context, gameID stri
 	fileCount := int64(len(saveSnap.Files))
 	var totalSize int64
 	for _, h := range saveSnap.Files {
-		totalSize += int64(len(saveBlobs[h]))
+		totalSize += saveBlobs[h].Size
 	}
 	meta, err := buildMetaSnapshot(*game, sessions, imageHash, savesHash, deviceName, fileCount, totalSize)
 	if err != nil {
@@ -459,34 +740,67 @@ func (s *ContentSyncService) pushBuildLocalMeta(ctx context.Context, gameID stri
 
 // pushUploadBlobs はセーブブロブ・セーブスナップショット・画像・game.json・sessions.json・
 // コミットブロブを HEAD 書き換え前にアップロードする。
-func (s *ContentSyncService) pushUploadBlobs(ctx context.Context, bstore contentBlobStore, gameID string, onProgress ProgressFunc, meta metaBuildResult, saveSnapJSON []byte, savesHash domain.BlobHash, saveBlobs map[string][]byte, imageHash domain.BlobHash, imageData []byte, metaHash domain.BlobHash) error {
+// known はセーブブロブの重複判定に使う控え（nil なら全件列挙）で、戻り値は更新後の存在済み集合。
+// journal は前回の中断分の引き継ぎと今回の完了分の記録に使う。
+func (s *ContentSyncService) pushUploadBlobs(ctx context.Context, bstore contentBlobStore, gameID string, onProgress ProgressFunc, meta metaBuildResult, saveSnapJSON []byte, savesHash domain.BlobHash, saveBlobs map[string]storage.BlobSource, imageHash domain.BlobHash, imageData []byte, metaHash domain.BlobHash, known *domain.RemoteBlobIndex, journal *transferJournal) (storage.BlobIndex, error) {
+	// PutBlobs は渡した集合を書き換えるため、保存時の増分計算用に known 側は複製を渡す。
+	var index storage.BlobIndex
+	if known != nil {
+		index = make(storage.BlobIndex, len(known.Hashes))
+		for kind, hashes := range known.Hashes {
+			index[kind] = make(map[string]struct{}, len(hashes))
+			for hash := range hashes {
+				index[kind][hash] = struct{}{}
+			}
+		}
+		// 前回の中断分は控えに無いがリモートにはある。known には足さないので、Push 成功後に増分として控えへ保存される。
+		// known が nil のときは全件列挙で見つかるため足す必要は無い。
+		for kind, hashes := range journal.resumedBlobs() {
+			if index[kind] == nil {
+				continue // 控えで未列挙の kind は PutBlobs に列挙させる
+			}
+			for hash := range hashes {
+				index[kind][hash] = struct{}{}
+			}
+		}
+	}
 	// HEAD より先にブロブを置く。途中失敗しても古い HEAD のままなので、中途半端なコミットを公開しない。
-	if err := bstore.putBlobs(ctx, gameID, saveBlobs, s.config.S3UploadConcurrency, onProgress); err != nil {
-		return err
+	index, err := bstore.putBlobs(ctx, gameID, saveBlobs, s.config.S3UploadConcurrency, index, journal, onProgress)
+	if err != nil {
+		return nil, err
 	}
 
 	if err := bstore.putBlob(ctx, gameID, storage.BlobKindTree, savesHash, saveSnapJSON); err != nil {
-		return err
+		return nil, err
 	}
 	if imageHash != "" && imageData != nil {
 		if err := bstore.putBlob(ctx, gameID, storage.BlobKindObject, imageHash, imageData); err != nil {
-			return err
+			return nil, err
 		}
 	}
 	if err := bstore.putBlob(ctx, gameID, storage.BlobKindMeta, meta.Snapshot.GameJSON, meta.GameJSON); err != nil {
-		return err
+		return nil, err
 	}
 	if err := bstore.putBlob(ctx, gameID, storage.BlobKindMeta, meta.Snapshot.SessionsJSON, meta.SessionsJSON); err != nil {
-		return err
+		return nil, err
 	}
 	if err := bstore.putBlob(ctx, gameID, storage.BlobKindCommit, metaHash, meta.SnapshotBytes); err != nil {
-		return err
+		return nil, err
 	}
-	return nil
+	return index, nil
 }
 
 // pushFinalizeHead は HEAD 書き換え直前の再確認・HEAD 書き換え・ローカル同期基準の更新を行う。
-func (s *ContentSyncService) pushFinalizeHead(ctx context.Context, bstore contentBlobStore, gameID string, force bool, expectedHead string, metaHash domain.BlobHash, meta metaBuildResult, saveSnapJSON []byte) error {
+// gcLeaseETag は push 開始時に読んだ GC のリースの ETag で、変わっていれば（途中で GC が始まれば）force でも中断する
+// （重複排除で送らなかったブロブが GC で消され、欠けたコミットを公開しうるため）。
+func (s *ContentSyncService) pushFinalizeHead(ctx context.Context, bstore contentBlobStore, gameID string, force bool, expectedHead, gcLeaseETag string, metaHash domain.BlobHash, meta metaBuildResult, saveSnapJSON []byte) error {
+	currentLeaseETag, err := s.checkGCLease(ctx, bstore, gameID)
+	if err != nil {
+		return err
+	}
+	if currentLeaseETag != gcLeaseETag {
+		return ErrGCOverlapped
+	}
 	// HEAD 書き換え直前に再度リモート HEAD を確認し、push 開始時から変化していれば中断する。
 	// S3 に CAS が無いため完全な排他はできないが、アップロード中に別デバイスが push した場合の
 	// ロストアップデートの窓を大幅に縮小する（force 時はユーザーが上書きを選択済みのため省略）。
@@ -517,6 +831,11 @@ func (s *ContentSyncService) Pull(ctx context.Context, gameID string, onProgress
 		return domain.PullResult{}, ErrOffline
 	}
 	defer s.lockGame(gameID)()
+	ctx, release, err := s.admit(ctx, SyncPriorityInteractive)
+	if err != nil {
+		return domain.PullResult{}, err
+	}
+	defer release()
 	return s.pull(ctx, gameID, onProgress, deleteUntracked)
 }
 
@@ -526,58 +845,22 @@ func (s *ContentSyncService) Pull(ctx context.Context, gameID string, onProgress
 // （untracked）を削除する必要があると分かった時点で、ローカルに一切変更を加えずに
 // PullResult{Applied:false, UntrackedDeletes:...} を返す。呼び出し側でユーザーに
 // 確認を取り、承認後に deleteUntracked=true で再実行する。
-func (s *ContentSyncService) pull(ctx context.Context, gameID string, onProgress ProgressFunc, deleteUntracked bool) (domain.PullResult, error) {
+//
+// 全体を pull、各段階を pull.<段階名> として計測する。
+func (s *ContentSyncService) pull(ctx context.Context, gameID string, onProgress ProgressFunc, deleteUntracked bool) (_ domain.PullResult, err error) {
+	ctx, span := s.metrics.startSpan(ctx, "pull")
+	defer func() { span.end(err) }()
 	bstore, err := s.newBlobStore(ctx)
 	if err != nil {
 		return domain.PullResult{}, err
 	}
 
-	remoteHead, err := bstore.readHEAD(ctx, gameID)
-	if err != nil {
-		return domain.PullResult{}, err
-	}
-	if remoteHead == "" {
-		return domain.PullResult{}, fmt.Errorf("リモートにデータがありません")
-	}
-
-	metaBytes, err := bstore.getBlob(ctx, gameID, storage.BlobKindCommit, remoteHead)
-	if err != nil {
-		return domain.PullResult{}, err
-	}
-	var meta domain.MetaSnapshot
-	if err := json.Unmarshal(metaBytes, &meta); err != nil {
-		return domain.PullResult{}, err
-	}
-
-	saveSnapBytes, err := bstore.getBlob(ctx, gameID, storage.BlobKindTree, meta.Saves)
-	if err != nil {
-		return domain.PullResult{}, err
-	}
-	var saveSnap domain.SaveSnapshot
-	if err := json.Unmarshal(saveSnapBytes, &saveSnap); err != nil {
-		return domain.PullResult{}, err
-	}
-
-	gameJSONBytes, err := bstore.getBlob(ctx, gameID, storage.BlobKindMeta, meta.GameJSON)
-	if err != nil {
-		return domain.PullResult{}, err
-	}
-	var cloudG cloudGame
-	if err := json.Unmarshal(gameJSONBytes, &cloudG); err != nil {
-		return domain.PullResult{}, err
-	}
-	if cloudG.ID != gameID {
-		return domain.PullResult{}, fmt.Errorf("リモートのゲームIDが一致しません: %s", cloudG.ID)
-	}
-
-	sessionsJSONBytes, err := bstore.getBlob(ctx, gameID, storage.BlobKindMeta, meta.SessionsJSON)
+	fetchCtx, fetchSpan := s.metrics.startSpan(ctx, "pull.fetch_meta")
+	remote, err := s.pullFetchRemote(fetchCtx, bstore, gameID)
+	fetchSpan.end(err)
 	if err != nil {
 		return domain.PullResult{}, err
 	}
-	var cloudSessions []cloudSession
-	if err := json.Unmarshal(sessionsJSONBytes, &cloudSessions); err != nil {
-		return domain.PullResult{}, err
-	}
 
 	// exe/save/image はマシン固有。クラウド game.json で上書きしないよう先に取る。
 	localGame, err := s.repository.GetGameByID(ctx, gameID)
@@ -596,7 +879,9 @@ func (s *ContentSyncService) pull(ctx context.Context, gameID string, onProgress
 	// ── 削除計画を先に立て、未追跡ファイルの削除が必要なら変更前に確認へ回す ──
 	// ローカルに副作用を与える前（画像・セーブのダウンロード前）に判定することで、
 	// 「確認待ち」を返したときはディスクが一切変更されていないことを保証する。
-	trackedDeletes, untrackedDeletes, err := s.pullPlanDeletions(ctx, gameID, saveFolderPath, saveSnap)
+	planCtx, planSpan := s.metrics.startSpan(ctx, "pull.plan_deletions")
+	trackedDeletes, untrackedDeletes, err := s.pullPlanDeletions(planCtx, gameID, saveFolderPath, remote.saveSnap)
+	planSpan.end(err)
 	if err != nil {
 		return domain.PullResult{}, err
 	}
@@ -605,16 +890,86 @@ func (s *ContentSyncService) pull(ctx context.Context, gameID string, onProgress
 		return domain.PullResult{Applied: false, UntrackedDeletes: untrackedDeletes}, nil
 	}
 
-	imagePath, err = s.pullDownloadImage(ctx, bstore, gameID, cloudG, imagePath)
+	imageCtx, imageSpan := s.metrics.startSpan(ctx, "pull.download_image")
+	imagePath, err = s.pullDownloadImage(imageCtx, bstore, gameID, remote.game, imagePath)
+	imageSpan.end(err)
 	if err != nil {
 		return domain.PullResult{}, err
 	}
 
-	if err := s.pullDownloadSaves(ctx, bstore, gameID, onProgress, saveFolderPath, saveSnap, trackedDeletes, untrackedDeletes); err != nil {
+	savesCtx, savesSpan := s.metrics.startSpan(ctx, "pull.download_saves")
+	savesSpan.addObjects(int64(len(remote.saveSnap.Files)))
+	err = s.pullDownloadSaves(savesCtx, bstore, gameID, remote.head, onProgress, saveFolderPath, remote.saveSnap, trackedDeletes, untrackedDeletes)
+	savesSpan.end(err)
+	if err != nil {
 		return domain.PullResult{}, err
 	}
 
-	return s.pullApplyToDB(ctx, gameID, cloudG, cloudSessions, imagePath, exePath, saveFolderPath, localGame, meta, saveSnapBytes)
+	applyCtx, applySpan := s.metrics.startSpan(ctx, "pull.apply_db")
+	result, err := s.pullApplyToDB(applyCtx, gameID, remote.game, remote.sessions, imagePath, exePath, saveFolderPath, localGame, remote.meta, remote.saveSnapBytes)
+	applySpan.end(err)
+	return result, err
+}
+
+// pullRemoteState は Pull が最初に読むリモートの commit・セーブツリー・game.json・sessions.json。
+type pullRemoteState struct {
+	head          string
+	meta          domain.MetaSnapshot
+	saveSnap      domain.SaveSnapshot
+	saveSnapBytes []byte
+	game          cloudGame
+	sessions      []cloudSession
+}
+
+// pullFetchRemote はリモート HEAD から commit をたどり、Pull に必要なメタデータ一式を読む。ローカルには何も書かない。
+func (s *ContentSyncService) pullFetchRemote(ctx context.Context, bstore contentBlobStore, gameID string) (pullRemoteState, error) {
+	remoteHead, err := bstore.readHEAD(ctx, gameID)
+	if err != nil {
+		return pullRemoteState{}, err
+	}
+	if remoteHead == "" {
+		return pullRemoteState{}, fmt.Errorf("リモートにデータがありません")
+	}
+
+	metaBytes, err := bstore.getBlob(ctx, gameID, storage.BlobKindCommit, remoteHead)
+	if err != nil {
+		return pullRemoteState{}, err
+	}
+	var meta domain.MetaSnapshot
+	if err := json.Unmarshal(metaBytes, &meta); err != nil {
+		return pullRemoteState{}, err
+	}
+
+	saveSnapBytes, err := bstore.getBlob(ctx, gameID, storage.BlobKindTree, meta.Saves)
+	if err != nil {
+		return pullRemoteState{}, err
+	}
+	var saveSnap domain.SaveSnapshot
+	if err := json.Unmarshal(saveSnapBytes, &saveSnap); err != nil {
+		return pullRemoteState{}, err
+	}
+
+	gameJSONBytes, err := bstore.getBlob(ctx, gameID, storage.BlobKindMeta, meta.GameJSON)
+	if err != nil {
+		return pullRemoteState{}, err
+	}
+	var cloudG cloudGame
+	if err := json.Unmarshal(gameJSONBytes, &cloudG); err != nil {
+		return pullRemoteState{}, err
+	}
+	if cloudG.ID != gameID {
+		return pullRemoteState{}, fmt.Errorf("リモートのゲームIDが一致しません: %s", cloudG.ID)
+	}
+
+	sessionsJSONBytes, err := bstore.getBlob(ctx, gameID, storage.BlobKindMeta, meta.SessionsJSON)
+	if err != nil {
+		return pullRemoteState{}, err
+	}
+	var cloudSessions []cloudSession
+	if err := json.Unmarshal(sessionsJSONBytes, &cloudSessions); err != nil {
+		return pullRemoteState{}, err
+	}
+	return pullRemoteState{head: remoteHead, meta: meta, saveSnap: saveSnap, saveSnapBytes: saveSnapBytes, game: cloudG, sessions: cloudSessions}, nil
 }
 
 // pullPlanDeletions はリモートのセーブスナップショットとローカルの base tree を突き合わせ、
@@ -675,7 +1030,8 @@ func (s *ContentSyncService) pullDownloadImage(ctx context.Context, bstore conte
 }
 
 // pullDownloadSaves はセーブファイルの差分を並列ダウンロードし、計画済みの削除を適用する。
-func (s *ContentSyncService) pullDownloadSaves(ctx context.Context, bstore contentBlobStore, gameID string, onProgress ProgressFunc, saveFolderPath *string, saveSnap domain.SaveSnapshot, trackedDeletes, untrackedDeletes []string) error {
+// 同じ remoteHead に対する前回の Pull が途中で止まっていれば、書き込み済みで stat の変わっていないファイルは読み直さない。
+func (s *ContentSyncService) pullDownloadSaves(ctx context.Context, bstore contentBlobStore, gameID, remoteHead string, onProgress ProgressFunc, saveFolderPath *string, saveSnap domain.SaveSnapshot, trackedDeletes, untrackedDeletes []string) (err error) {
 	if saveFolderPath != nil && *saveFolderPath != "" {
 		saveDir := *saveFolderPath
 		total := len(saveSnap.Files)
@@ -684,17 +1040,33 @@ func (s *ContentSyncService) pullDownloadSaves(ctx context.Context, bstore conte
 			return err
 		}
 
+		journal := s.openTransferJournal(ctx, gameID, transferPull, remoteHead, saveDir)
+		defer func() { journal.finish(err == nil) }()
+		// 前回書き込んだばかりのファイルは racy でハッシュキャッシュに載っていないため、転送記録の stat で照合する
+		resumed := journal.resumedFiles()
+		cache := s.loadSaveHashCache(ctx, gameID)
 		needsDownload := make(map[string]string, total)
 		for relPath, hash := range saveSnap.Files {
 			targetPath, err := storage.ResolveSafeRelativePath(saveDir, relPath)
 			if err != nil {
 				return err
 			}
-			localHash, err := hashFileStream(targetPath)
+			info, err := os.Stat(targetPath)
+			if err != nil || !info.Mode().IsRegular() {
+				needsDownload[relPath] = hash
+				continue
+			}
+			if !s.config.SaveHashParanoid && trustsFile(resumed, relPath, hash, info) {
+				continue
+			}
+			localHash, err := cache.hash(targetPath, relPath, info)
 			if err != nil || localHash != hash {
 				needsDownload[relPath] = hash
 			}
 		}
+		// 一部のパスしか見ていないため prune しない。ダウンロードした実体は mtime が新しく
+		// racy 扱いになるので、次回の Status / Push の走査で記録される。
+		s.storeSaveHashCache(ctx, gameID, cache, false)
 
 		var wrappedProgress func(int, int)
 		if onProgress != nil {
@@ -704,7 +1076,7 @@ func (s *ContentSyncService) pullDownloadSaves(ctx context.Context, bstore conte
 				onProgress(alreadyDone+downloaded, total)
 			}
 		}
-		if err := bstore.downloadBlobs(ctx, gameID, saveDir, needsDownload, s.config.S3UploadConcurrency, wrappedProgress); err != nil {
+		if err := bstore.downloadBlobs(ctx, gameID, saveDir, needsDownload, chunkedHashes(saveSnap), s.config.S3UploadConcurrency, journal, wrappedProgress); err != nil {
 			return err
 		}
 
@@ -768,6 +1140,9 @@ func (s *ContentSyncService) pullApplyToDB(ctx context.Context, gameID string, c
 	if err := s.repository.ApplyPullResult(ctx, updatedGame, sessions, contentFingerprint(meta), string(saveSnapBytes)); err != nil {
 		return domain.PullResult{}, err
 	}
+	if s.onGamesChanged != nil {
+		s.onGamesChanged()
+	}
 	return domain.PullResult{Applied: true}, nil
 }
 
@@ -779,6 +1154,11 @@ func (s *ContentSyncService) ResolveConflict(ctx context.Context, gameID string,
 		return domain.PullResult{}, ErrOffline
 	}
 	defer s.lockGame(gameID)()
+	ctx, release, err := s.admit(ctx, SyncPriorityInteractive)
+	if err != nil {
+		return domain.PullResult{}, err
+	}
+	defer release()
 	if useLocal {
 		if err := s.push(ctx, gameID, nil, true); err != nil {
 			return domain.PullResult{}, err
@@ -795,6 +1175,11 @@ func (s *ContentSyncService) DeleteFromCloud(ctx context.Context, gameID string)
 		return ErrOffline
 	}
 	defer s.lockGame(gameID)()
+	ctx, release, err := s.admit(ctx, SyncPriorityInteractive)
+	if err != nil {
+		return err
+	}
+	defer release()
 	bstore, err := s.newBlobStore(ctx)
 	if err != nil {
 		return err
@@ -812,6 +1197,14 @@ func (s *ContentSyncService) DeleteFromCloud(ctx context.Context, gameID string)
 	if err := s.repository.SetLocalSaveTree(ctx, gameID, ""); err != nil {
 		s.logger.Warn("localSaveTree のクリアに失敗", "gameId", gameID, "error", err)
 	}
+	if err := s.repository.ClearRemoteBlobIndex(ctx, gameID); err != nil {
+		s.logger.Warn("リモートブロブ控えのクリアに失敗", "gameId", gameID, "error", err)
+	}
+	// 中断中の Push の完了分は削除したブロブを指すため、再開に使われないよう捨てる
+	if err := s.repository.ClearTransferJournal(ctx, gameID, transferPush); err != nil {
+		s.logger.Warn("転送記録のクリアに失敗", "gameId", gameID, "error", err)
+	}
+	s.removeCloudCatalogEntry(ctx, bstore, gameID)
 	return nil
 }
 
@@ -848,23 +1241,33 @@ func fanOutGames[T any](gameIDs []string, concurrency int, fn func(gameID string
 }
 
 // LoadCloudMetadata はクラウド上の全ゲームのメタ情報を返す。
-// ゲームごとの取得（readHEAD + commit + game.json）を S3UploadConcurrency 並列で実行する。
-// 取得・解析に失敗したゲームは警告ログを出してスキップする。結果は gameIDs の順序を保つ。
+// クラウドカタログにあるゲームはカタログから返し、無いゲームだけ個別取得（readHEAD + commit + game.json）を
+// S3UploadConcurrency 並列で実行する。取得・解析に失敗したゲームは警告ログを出してスキップする。
+// 結果は listGameIDs の順序を保つ。
 func (s *ContentSyncService) LoadCloudMetadata(ctx context.Context) ([]CloudGameInfo, error) {
+	ctx, release, err := s.admit(ctx, SyncPriorityBackground)
+	if err != nil {
+		return nil, err
+	}
+	defer release()
 	bstore, err := s.newBlobStore(ctx)
 	if err != nil {
 		return nil, err
 	}
-	gameIDs, err := bstore.listGameIDs(ctx)
+	entries, err := s.loadCloudCatalogEntries(ctx, bstore, s.config.S3UploadConcurrency)
 	if err != nil {
 		return nil, err
 	}
-	if len(gameIDs) == 0 {
+	if len(entries) == 0 {
 		return nil, nil
 	}
-	return fanOutGames(gameIDs, s.config.S3UploadConcurrency, func(id string) *CloudGameInfo {
-		return s.loadCloudGameInfo(ctx, bstore, id)
-	}), nil
+	infos := make([]CloudGameInfo, 0, len(entries))
+	for _, entry := range entries {
+		if entry.Game != nil {
+			infos = append(infos, *entry.Game)
+		}
+	}
+	return infos, nil
 }
 
 // CloudLogicalFile はクラウド上の論理セーブファイル1件を表す。
@@ -889,7 +1292,7 @@ func (s *ContentSyncService) GetCloudGameView(ctx context.Context, gameID string
 	if err != nil {
 		return nil, err
 	}
-	bstore := &s3BlobStore{client: client, bucket: cfg.Bucket}
+	bstore := &s3BlobStore{client: client, bucket: cfg.Bucket, cache: s.blobCache}
 	return s.buildCloudGameView(ctx, bstore, gameID)
 }
 
@@ -931,8 +1334,7 @@ func (s *ContentSyncService) loadCloudCommit(ctx context.Context, bstore content
 }
 
 // buildCloudGameView は与えられた blob store を使って1ゲームの論理ビューを復元する。
-// サイズ解決のため bstore は内部に S3 クライアントとバケットを保持している必要がある。
-func (s *ContentSyncService) buildCloudGameView(ctx context.Context, bstore *s3BlobStore, gameID string) (*CloudGameView, error) {
+func (s *ContentSyncService) buildCloudGameView(ctx context.Context, bstore contentBlobStore, gameID string) (*CloudGameView, error) {
 	meta, title, err := s.loadCloudCommit(ctx, bstore, gameID)
 	if err != nil {
 		return nil, err
@@ -940,7 +1342,12 @@ func (s *ContentSyncService) buildCloudGameView(ctx context.Context, bstore *s3B
 	if meta == nil {
 		return nil, nil
 	}
+	return s.cloudGameViewFromCommit(ctx, bstore, gameID, meta, title)
+}
 
+// cloudGameViewFromCommit は読み込み済みのコミットからセーブツリーを読み、objects の列挙でサイズを解決した論理ビューを返す。
+// セーブツリーの解析に失敗した場合は (nil, nil) を返す。
+func (s *ContentSyncService) cloudGameViewFromCommit(ctx context.Context, bstore contentBlobStore, gameID string, meta *domain.MetaSnapshot, title string) (*CloudGameView, error) {
 	var saveSnap domain.SaveSnapshot
 	if meta.Saves != "" {
 		saveSnapBytes, terr := bstore.getBlob(ctx, gameID, storage.BlobKindTree, meta.Saves)
@@ -957,7 +1364,7 @@ func (s *ContentSyncService) buildCloudGameView(ctx context.Context, bstore *s3B
 	sizeMap := make(map[string]int64)
 	if len(saveSnap.Files) > 0 {
 		prefix := fmt.Sprintf("games/%s/%s/", gameID, storage.BlobKindObject)
-		objects, oerr := storage.ListObjects(ctx, bstore.client, bstore.bucket, prefix)
+		objects, oerr := bstore.listObjects(ctx, prefix)
 		if oerr != nil {
 			return nil, oerr
 		}
@@ -969,6 +1376,18 @@ func (s *ContentSyncService) buildCloudGameView(ctx context.Context, bstore *s3B
 			sizeMap[hash] = obj.Size
 		}
 	}
+	// チャンク分割形式のファイルは objects/ に実体が無いため、manifest の論理サイズを使う（大きいファイルのみで件数は少ない）。
+	for hash := range chunkedHashes(saveSnap) {
+		if _, ok := sizeMap[hash]; ok {
+			continue
+		}
+		manifest, merr := bstore.getChunkManifest(ctx, gameID, hash)
+		if merr != nil {
+			s.logger.Warn("チャンクマニフェスト取得失敗（サイズ 0 として表示）", "gameId", gameID, "hash", hash, "error", merr)
+			continue
+		}
+		sizeMap[hash] = manifest.Size
+	}
 
 	files := make([]CloudLogicalFile, 0, len(saveSnap.Files))
 	var totalSize int64
@@ -991,11 +1410,16 @@ func (s *ContentSyncService) buildCloudGameView(ctx context.Context, bstore *s3B
 // ListCloudGameViews は全ゲームの論理ビューを返す（Title 昇順）。
 // 個別ゲームの取得に失敗した場合は警告ログを出してスキップする。
 func (s *ContentSyncService) ListCloudGameViews(ctx context.Context) ([]CloudGameView, error) {
+	ctx, release, err := s.admit(ctx, SyncPriorityBackground)
+	if err != nil {
+		return nil, err
+	}
+	defer release()
 	client, cfg, err := s.newClient(ctx)
 	if err != nil {
 		return nil, err
 	}
-	bstore := &s3BlobStore{client: client, bucket: cfg.Bucket}
+	bstore := &s3BlobStore{client: client, bucket: cfg.Bucket, cache: s.blobCache}
 
 	gameIDs, err := bstore.listGameIDs(ctx)
 	if err != nil {
@@ -1028,91 +1452,39 @@ type CloudGameSummary struct {
 	TotalSize    int64     `json:"totalSize"`
 }
 
-// buildCloudGameSummary は HEAD→commit→game.json のみを読み取り、軽量サマリを復元する。
-// buildCloudGameView と異なりセーブツリーの解析・objects の列挙は行わないため高速。
-func (s *ContentSyncService) buildCloudGameSummary(ctx context.Context, bstore *s3BlobStore, gameID string) (*CloudGameSummary, error) {
-	meta, title, err := s.loadCloudCommit(ctx, bstore, gameID)
+// ListCloudGameSummaries は全ゲームの軽量サマリ（Title 昇順）を返す。
+// クラウドカタログがあれば 1 GET で済み、カタログに無いゲームだけ HEAD→commit→game.json を個別に読む。
+// 各ゲームのファイル一覧は GetCloudGameView で個別に遅延取得する。
+// 優先度の既定は Background で、画面を開いたときなど UI から呼ぶ場合は WithSyncPriority で Interactive を指定する。
+func (s *ContentSyncService) ListCloudGameSummaries(ctx context.Context) (_ []CloudGameSummary, err error) {
+	ctx, release, err := s.admit(ctx, SyncPriorityBackground)
 	if err != nil {
 		return nil, err
 	}
-	if meta == nil {
-		return nil, nil
-	}
-	return &CloudGameSummary{
-		GameID:       gameID,
-		Title:        title,
-		LastModified: meta.CreatedAt,
-		FileCount:    meta.FileCount,
-		TotalSize:    meta.TotalSize,
-	}, nil
-}
-
-// ListCloudGameSummaries は全ゲームの軽量サマリ（Title 昇順）を返す。
-// ファイル数・サイズは含まず、各ゲームの詳細は GetCloudGameView で個別に遅延取得する。
-func (s *ContentSyncService) ListCloudGameSummaries(ctx context.Context) ([]CloudGameSummary, error) {
-	client, cfg, err := s.newClient(ctx)
+	defer release()
+	ctx, span := s.metrics.startSpan(ctx, "cloud_summaries")
+	defer func() { span.end(err) }()
+	bstore, err := s.newBlobStore(ctx)
 	if err != nil {
 		return nil, err
 	}
-	bstore := &s3BlobStore{client: client, bucket: cfg.Bucket}
 
-	gameIDs, err := bstore.listGameIDs(ctx)
+	// 接続数は共有クライアントの転送予算で頭打ちになるため、並列度は Push / Pull と揃える
+	entries, err := s.loadCloudCatalogEntries(ctx, bstore, s.config.S3UploadConcurrency)
 	if err != nil {
 		return nil, err
 	}
-
-	// ゲーム数が多いと並列しすぎて接続を食い潰すため、一覧用は控えめな並列度にする。
-	const maxConcurrency = 8
-	summaries := fanOutGames(gameIDs, maxConcurrency, func(id string) *CloudGameSummary {
-		summary, verr := s.buildCloudGameSummary(ctx, bstore, id)
-		if verr != nil {
-			s.logger.Warn("クラウドサマリ復元失敗（スキップ）", "gameId", id, "error", verr)
-			return nil
-		}
-		return summary
-	})
+	span.addObjects(int64(len(entries)))
+	summaries := make([]CloudGameSummary, 0, len(entries))
+	for _, entry := range entries {
+		summaries = append(summaries, CloudGameSummary{
+			GameID:       entry.gameID,
+			Title:        entry.Title,
+			LastModified: entry.LastModified,
+			FileCount:    entry.FileCount,
+			TotalSize:    entry.TotalSize,
+		})
+	}
 	sort.Slice(summaries, func(i, j int) bool { return summaries[i].Title < summaries[j].Title })
 	return summaries, nil
 }
-
-// loadCloudGameInfo は1ゲームのクラウドメタ情報を取得する。
-// HEAD 未設定や取得・解析失敗時は（必要なら警告ログを出して）nil を返す。
-func (s *ContentSyncService) loadCloudGameInfo(ctx context.Context, bstore contentBlobStore, gameID string) *CloudGameInfo {
-	head, err := bstore.readHEAD(ctx, gameID)
-	if err != nil || head == "" {
-		return nil
-	}
-	metaBytes, err := bstore.getBlob(ctx, gameID, storage.BlobKindCommit, head)
-	if err != nil {
-		s.logger.Warn("コミットブロブ取得失敗", "gameId", gameID, "error", err)
-		return nil
-	}
-	var meta domain.MetaSnapshot
-	if err := json.Unmarshal(metaBytes, &meta); err != nil {
-		s.logger.Warn("コミットブロブ解析失敗", "gameId", gameID, "error", err)
-		return nil
-	}
-	gameJSONBytes, err := bstore.getBlob(ctx, gameID, storage.BlobKindMeta, meta.GameJSON)
-	if err != nil {
-		s.logger.Warn("game.json取得失敗", "gameId", gameID, "error", err)
-		return nil
-	}
-	var cg cloudGame
-	if err := json.Unmarshal(gameJSONBytes, &cg); err != nil {
-		s.logger.Warn("game.json解析失敗", "gameId", gameID, "error", err)
-		return nil
-	}
-	return &CloudGameInfo{
-		ID:             cg.ID,
-		Title:          cg.Title,
-		Publisher:      cg.Publisher,
-		ImageHash:      cg.ImageHash,
-		PlayStatus:     cg.PlayStatus,
-		TotalPlayTime:  cg.TotalPlayTime,
-		LastPlayed:     cg.LastPlayed,
-		ClearedAt:      cg.ClearedAt,
-		CurrentRouteID: cg.CurrentRouteID,
-		CreatedAt:      cg.CreatedAt,
-		UpdatedAt:      cg.UpdatedAt,
-	}
-}
@@ -7,6 +7,8 @@ import (
 	"log/slog"
 	"os"
 	"path/filepath"
+	"strconv"
+	"strings"
 	"sync"
 	"sync/atomic"
 	"testing"
@@ -26,6 +28,13 @@ type fakeContentSyncRepository struct {
 	sessions []domain.PlaySession
 	settings map[string]string
 	saveTree string
+	// hashCache は relPath → エントリ（ゲーム1件分のみ扱うため gameID は区別しない）
+	hashCache map[string]domain.SaveHashCacheEntry
+	// remoteIndex はリモートブロブの控え（nil は控え無し）
+	remoteIndex *domain.RemoteBlobIndex
+	// journals は direction → 転送記録、multipart はキー → 未完了マルチパートアップロード
+	journals  map[string]*domain.TransferJournal
+	multipart map[string]domain.MultipartUpload
 
 	// 記録された呼び出し
 	localSyncHeadSet string
@@ -133,6 +142,154 @@ func (r *fakeContentSyncRepository) UpsertSetting(_ context.Context, key, value
 	return nil
 }
 
+func (r *fakeContentSyncRepository) GetSaveHashCache(_ context.Context, _ string) (map[string]domain.SaveHashCacheEntry, error) {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	out := make(map[string]domain.SaveHashCacheEntry, len(r.hashCache))
+	for relPath, entry := range r.hashCache {
+		out[relPath] = entry
+	}
+	return out, nil
+}
+
+func (r *fakeContentSyncRepository) UpdateSaveHashCache(_ context.Context, _ string, upserts map[string]domain.SaveHashCacheEntry, deletes []string) error {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	if r.hashCache == nil {
+		r.hashCache = make(map[string]domain.SaveHashCacheEntry)
+	}
+	for relPath, entry := range upserts {
+		r.hashCache[relPath] = entry
+	}
+	for _, relPath := range deletes {
+		delete(r.hashCache, relPath)
+	}
+	return nil
+}
+
+func (r *fakeContentSyncRepository) GetRemoteBlobIndex(_ context.Context, _ string) (*domain.RemoteBlobIndex, error) {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	if r.remoteIndex == nil {
+		return nil, nil
+	}
+	out := domain.RemoteBlobIndex{Head: r.remoteIndex.Head, ListedAt: r.remoteIndex.ListedAt, Hashes: make(map[string]map[string]struct{})}
+	for kind, hashes := range r.remoteIndex.Hashes {
+		out.Hashes[kind] = make(map[string]struct{}, len(hashes))
+		for hash := range hashes {
+			out.Hashes[kind][hash] = struct{}{}
+		}
+	}
+	return &out, nil
+}
+
+func (r *fakeContentSyncRepository) SaveRemoteBlobIndex(_ context.Context, _ string, index domain.RemoteBlobIndex, replace bool) error {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	if replace || r.remoteIndex == nil {
+		r.remoteIndex = &domain.RemoteBlobIndex{Hashes: make(map[string]map[string]struct{})}
+	}
+	r.remoteIndex.Head = index.Head
+	r.remoteIndex.ListedAt = index.ListedAt
+	for kind, hashes := range index.Hashes {
+		for hash := range hashes {
+			if r.remoteIndex.Hashes[kind] == nil {
+				r.remoteIndex.Hashes[kind] = make(map[string]struct{})
+			}
+			r.remoteIndex.Hashes[kind][hash] = struct{}{}
+		}
+	}
+	return nil
+}
+
+func (r *fakeContentSyncRepository) ClearRemoteBlobIndex(_ context.Context, _ string) error {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	r.remoteIndex = nil
+	return nil
+}
+
+func (r *fakeContentSyncRepository) GetTransferJournal(_ context.Context, _ string, direction string) (*domain.TransferJournal, error) {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	journal, ok := r.journals[direction]
+	if !ok {
+		return nil, nil
+	}
+	out := *journal
+	out.Entries = append([]domain.TransferJournalEntry(nil), journal.Entries...)
+	return &out, nil
+}
+
+func (r *fakeContentSyncRepository) StartTransferJournal(_ context.Context, _ string, direction, head string, startedAt int64) error {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	if r.journals == nil {
+		r.journals = make(map[string]*domain.TransferJournal)
+	}
+	if journal, ok := r.journals[direction]; ok && journal.Head == head {
+		return nil
+	}
+	r.journals[direction] = &domain.TransferJournal{Direction: direction, Head: head, StartedAt: startedAt}
+	return nil
+}
+
+func (r *fakeContentSyncRepository) AppendTransferJournal(_ context.Context, _ string, direction string, entries []domain.TransferJournalEntry) error {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	journal, ok := r.journals[direction]
+	if !ok {
+		return fmt.Errorf("transfer journal not started: %s", direction)
+	}
+	journal.Entries = append(journal.Entries, entries...)
+	return nil
+}
+
+func (r *fakeContentSyncRepository) ClearTransferJournal(_ context.Context, _ string, direction string) error {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	delete(r.journals, direction)
+	return nil
+}
+
+func (r *fakeContentSyncRepository) ListMultipartUploads(_ context.Context, _ string) ([]domain.MultipartUpload, error) {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	out := make([]domain.MultipartUpload, 0, len(r.multipart))
+	for _, upload := range r.multipart {
+		out = append(out, upload)
+	}
+	return out, nil
+}
+
+func (r *fakeContentSyncRepository) SaveMultipartUpload(_ context.Context, upload domain.MultipartUpload) error {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	if r.multipart == nil {
+		r.multipart = make(map[string]domain.MultipartUpload)
+	}
+	r.multipart[upload.Key] = upload
+	return nil
+}
+
+func (r *fakeContentSyncRepository) DeleteMultipartUpload(_ context.Context, key string) error {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	delete(r.multipart, key)
+	return nil
+}
+
+func (r *fakeContentSyncRepository) DeleteMultipartUploadsBefore(_ context.Context, before int64) error {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+	for key, upload := range r.multipart {
+		if upload.CreatedAt < before {
+			delete(r.multipart, key)
+		}
+	}
+	return nil
+}
+
 // ─── fakeBlobStore ───────────────────────────────────────────────────────────
 
 type fakeBlobStore struct {
@@ -140,20 +297,45 @@ type fakeBlobStore struct {
 
 	blobs map[string][]byte // キー: "gameID/hash"
 	heads map[string]string // gameID → metaHash
+	// written はブロブを書き込んだ時刻（キーは blobs と同じ）。GC の猶予期間のテストで古くする。
+	written map[string]time.Time
 
 	// 記録された呼び出し
 	downloadedBlobs []map[string]string // 各呼び出しの blobs 引数
+	listedObjects   int                 // putBlobs が objects/ を全件列挙した回数
+	uploadedObjects []string            // putBlobs が実際に書き込んだハッシュ
 	deletedPrefixes []string
+	blobReads       int // getBlob の呼び出し回数（一覧がゲームごとに個別取得したかの確認用）
+	objectListings  int // listObjects の呼び出し回数
+
+	// クラウドカタログ。catalogETag は書き込みごとに進め、catalogConflicts 回だけ書き込みを競合扱いにする。
+	catalog          []byte
+	catalogETag      int
+	catalogConflicts int
+	catalogWrites    int
+
+	// GC のリース。gcLeaseETags はゲームごとに書き込みのたびに進める。
+	gcLeases     map[string][]byte
+	gcLeaseETags map[string]int
 
 	// onPutBlobs は putBlobs 呼び出し時に1回呼ばれるフック。
 	// テストでアップロード中の HEAD 変更（別デバイスの並行 push）を模すのに使う。nil 可。
 	onPutBlobs func()
+	// onListObjects は listObjects の一覧を作った後に1回呼ばれるフック。GC の印付け中の Push を模すのに使う。nil 可。
+	onListObjects func()
+	// ignoreIfMatch なら writeHEADIfMatch は条件を見ずに書き込む（条件付き書き込みに対応しないストアの模擬）。
+	ignoreIfMatch bool
+	// failPutBlobsAfter が正なら、putBlobs はその件数を書き込んだ時点で失敗する（通信断の模擬）。
+	failPutBlobsAfter int
 }
 
 func newFakeBlobStore() *fakeBlobStore {
 	return &fakeBlobStore{
-		blobs: make(map[string][]byte),
-		heads: make(map[string]string),
+		blobs:        make(map[string][]byte),
+		heads:        make(map[string]string),
+		written:      make(map[string]time.Time),
+		gcLeases:     make(map[string][]byte),
+		gcLeaseETags: make(map[string]int),
 	}
 }
 
@@ -174,9 +356,61 @@ func (f *fakeBlobStore) writeHEAD(_ context.Context, gameID, hash string) error
 	return nil
 }
 
+// readHEADWithETag は HEAD の値そのものを ETag として返す（S3 の ETag も内容のハッシュのため、同じ値なら同じ ETag）。
+func (f *fakeBlobStore) readHEADWithETag(_ context.Context, gameID string) (string, string, error) {
+	f.mu.Lock()
+	defer f.mu.Unlock()
+	head := f.heads[gameID]
+	return head, head, nil
+}
+
+func (f *fakeBlobStore) writeHEADIfMatch(_ context.Context, gameID, hash, etag string) error {
+	f.mu.Lock()
+	defer f.mu.Unlock()
+	if !f.ignoreIfMatch && f.heads[gameID] != etag {
+		return storage.ErrPreconditionFailed
+	}
+	f.heads[gameID] = hash
+	return nil
+}
+
+func (f *fakeBlobStore) readGCLease(_ context.Context, gameID string) ([]byte, string, error) {
+	f.mu.Lock()
+	defer f.mu.Unlock()
+	data, ok := f.gcLeases[gameID]
+	if !ok {
+		return nil, "", nil
+	}
+	return data, strconv.Itoa(f.gcLeaseETags[gameID]), nil
+}
+
+func (f *fakeBlobStore) writeGCLease(_ context.Context, gameID string, data []byte, etag string) error {
+	f.mu.Lock()
+	defer f.mu.Unlock()
+	current := ""
+	if _, ok := f.gcLeases[gameID]; ok {
+		current = strconv.Itoa(f.gcLeaseETags[gameID])
+	}
+	if etag != current {
+		return storage.ErrPreconditionFailed
+	}
+	f.gcLeases[gameID] = data
+	f.gcLeaseETags[gameID]++
+	return nil
+}
+
+func (f *fakeBlobStore) putGCLease(_ context.Context, gameID string, data []byte) error {
+	f.mu.Lock()
+	defer f.mu.Unlock()
+	f.gcLeases[gameID] = data
+	f.gcLeaseETags[gameID]++
+	return nil
+}
+
 func (f *fakeBlobStore) getBlob(_ context.Context, gameID, kind, hash string) ([]byte, error) {
 	f.mu.Lock()
 	defer f.mu.Unlock()
+	f.blobReads++
 	data, ok := f.blobs[f.blobKey(gameID, kind, hash)]
 	if !ok {
 		return nil, fmt.Errorf("blob not found: %s/%s/%s", gameID, kind, hash)
@@ -187,29 +421,69 @@ func (f *fakeBlobStore) getBlob(_ context.Context, gameID, kind, hash string) ([
 func (f *fakeBlobStore) putBlob(_ context.Context, gameID, kind, hash string, data []byte) error {
 	f.mu.Lock()
 	defer f.mu.Unlock()
-	f.blobs[f.blobKey(gameID, kind, hash)] = data
+	key := f.blobKey(gameID, kind, hash)
+	if _, ok := f.blobs[key]; ok {
+		return nil // storage.PutBlob と同じく既存のブロブは書き直さない
+	}
+	f.blobs[key] = data
+	f.written[key] = time.Now()
 	return nil
 }
 
-func (f *fakeBlobStore) putBlobs(_ context.Context, gameID string, blobs map[string][]byte, _ int, onProgress func(int, int)) error {
+// putBlobs は storage.PutBlobs と同じく、index の objects が未列挙なら全件列挙してから不足分だけ書き込む。
+func (f *fakeBlobStore) putBlobs(_ context.Context, gameID string, blobs map[string]storage.BlobSource, _ int, index storage.BlobIndex, journal storage.TransferJournal, onProgress func(int, int)) (storage.BlobIndex, error) {
 	if f.onPutBlobs != nil {
 		f.onPutBlobs()
 	}
 	f.mu.Lock()
 	defer f.mu.Unlock()
 	total := len(blobs)
+	if total == 0 {
+		return index, nil
+	}
+	if index == nil {
+		index = make(storage.BlobIndex)
+	}
+	if index[storage.BlobKindObject] == nil {
+		f.listedObjects++
+		listed := make(map[string]struct{})
+		prefix := gameID + "/" + storage.BlobKindObject + "/"
+		for key := range f.blobs {
+			if len(key) > len(prefix) && key[:len(prefix)] == prefix {
+				listed[key[len(prefix):]] = struct{}{}
+			}
+		}
+		index[storage.BlobKindObject] = listed
+	}
 	done := 0
-	for hash, data := range blobs {
-		f.blobs[f.blobKey(gameID, storage.BlobKindObject, hash)] = data
+	written := 0
+	for hash, source := range blobs {
+		if _, ok := index[storage.BlobKindObject][hash]; !ok {
+			if f.failPutBlobsAfter > 0 && written == f.failPutBlobsAfter {
+				return nil, fmt.Errorf("connection reset")
+			}
+			data, err := os.ReadFile(source.Path)
+			if err != nil {
+				return nil, err
+			}
+			f.blobs[f.blobKey(gameID, storage.BlobKindObject, hash)] = data
+			f.written[f.blobKey(gameID, storage.BlobKindObject, hash)] = time.Now()
+			f.uploadedObjects = append(f.uploadedObjects, hash)
+			index[storage.BlobKindObject][hash] = struct{}{}
+			written++
+		}
+		if journal != nil {
+			journal.BlobUploaded(storage.BlobKindObject, hash)
+		}
 		done++
 		if onProgress != nil {
 			onProgress(done, total)
 		}
 	}
-	return nil
+	return index, nil
 }
 
-func (f *fakeBlobStore) downloadBlobs(_ context.Context, gameID, saveDir string, blobs map[string]string, _ int, onProgress func(int, int)) error {
+func (f *fakeBlobStore) downloadBlobs(_ context.Context, gameID, saveDir string, blobs map[string]string, _ map[string]struct{}, _ int, journal storage.TransferJournal, onProgress func(int, int)) error {
 	// 呼び出しを記録する
 	snapshot := make(map[string]string, len(blobs))
 	for k, v := range blobs {
@@ -238,6 +512,9 @@ func (f *fakeBlobStore) downloadBlobs(_ context.Context, gameID, saveDir string,
 		if err := os.WriteFile(targetPath, data, 0o600); err != nil {
 			return err
 		}
+		if journal != nil {
+			journal.FileDownloaded(targetPath, hash)
+		}
 		done++
 		if onProgress != nil {
 			onProgress(done, total)
@@ -253,6 +530,51 @@ func (f *fakeBlobStore) deleteByPrefix(_ context.Context, prefix string) error {
 	return nil
 }
 
+// listObjects は blobs のキーを S3 と同じ games/<id>/<kind>/<hash> 形式で返す。
+func (f *fakeBlobStore) listObjects(_ context.Context, prefix string) ([]storage.ObjectInfo, error) {
+	f.mu.Lock()
+	hook := f.onListObjects
+	f.onListObjects = nil
+	defer func() {
+		if hook != nil {
+			hook()
+		}
+	}()
+	defer f.mu.Unlock()
+	f.objectListings++
+	var objects []storage.ObjectInfo
+	for key, data := range f.blobs {
+		fullKey := "games/" + key
+		if !strings.HasPrefix(fullKey, prefix) {
+			continue
+		}
+		objects = append(objects, storage.ObjectInfo{Key: fullKey, Size: int64(len(data)), LastModified: f.written[key].UnixMilli()})
+	}
+	return objects, nil
+}
+
+func (f *fakeBlobStore) deleteObjects(_ context.Context, keys []string) error {
+	f.mu.Lock()
+	defer f.mu.Unlock()
+	for _, key := range keys {
+		delete(f.blobs, strings.TrimPrefix(key, "games/"))
+		delete(f.written, strings.TrimPrefix(key, "games/"))
+	}
+	return nil
+}
+
+func (f *fakeBlobStore) getChunkManifest(_ context.Context, gameID, hash string) (storage.ChunkManifest, error) {
+	f.mu.Lock()
+	defer f.mu.Unlock()
+	var manifest storage.ChunkManifest
+	data, ok := f.blobs[f.blobKey(gameID, storage.BlobKindManifest, hash)]
+	if !ok {
+		return manifest, fmt.Errorf("manifest not found: %s/%s", gameID, hash)
+	}
+	err := json.Unmarshal(data, &manifest)
+	return manifest, err
+}
+
 func (f *fakeBlobStore) listGameIDs(_ context.Context) ([]string, error) {
 	f.mu.Lock()
 	defer f.mu.Unlock()
@@ -263,6 +585,45 @@ func (f *fakeBlobStore) listGameIDs(_ context.Context) ([]string, error) {
 	return ids, nil
 }
 
+func (f *fakeBlobStore) readCatalog(_ context.Context) ([]byte, string, error) {
+	f.mu.Lock()
+	defer f.mu.Unlock()
+	if f.catalog == nil {
+		return nil, "", nil
+	}
+	return f.catalog, strconv.Itoa(f.catalogETag), nil
+}
+
+// writeCatalog は PutObjectIfMatch と同じく、読んだ時点から更新されていれば ErrPreconditionFailed を返す。
+func (f *fakeBlobStore) writeCatalog(_ context.Context, data []byte, etag string) error {
+	f.mu.Lock()
+	defer f.mu.Unlock()
+	current := ""
+	if f.catalog != nil {
+		current = strconv.Itoa(f.catalogETag)
+	}
+	if f.catalogConflicts > 0 {
+		// 他端末が先に書いたことにする
+		f.catalogConflicts--
+		f.catalogETag++
+		return storage.ErrPreconditionFailed
+	}
+	if etag != current {
+		return storage.ErrPreconditionFailed
+	}
+	f.catalog = data
+	f.catalogETag++
+	f.catalogWrites++
+	return nil
+}
+
+func (f *fakeBlobStore) deleteCatalog(_ context.Context) error {
+	f.mu.Lock()
+	defer f.mu.Unlock()
+	f.catalog = nil
+	return nil
+}
+
 // ─── helpers ─────────────────────────────────────────────────────────────────
 
 func newTestService(repo *fakeContentSyncRepository, bstore *fakeBlobStore) *ContentSyncService {
@@ -292,14 +653,18 @@ func setupRemoteState(
 	t.Helper()
 	ctx := context.Background()
 
-	saveSnap, saveBlobs, err := buildSaveSnapshot(saveDir)
+	saveSnap, saveBlobs, err := buildSaveSnapshot(saveDir, nil, 0)
 	if err != nil {
 		t.Fatalf("buildSaveSnapshot: %v", err)
 	}
 	saveSnapJSON, _ := json.Marshal(saveSnap)
 	savesHash := hashBytes(saveSnapJSON)
 
-	for h, data := range saveBlobs {
+	for h, source := range saveBlobs {
+		data, err := os.ReadFile(source.Path)
+		if err != nil {
+			t.Fatalf("ReadFile: %v", err)
+		}
 		if err := bstore.putBlob(ctx, gameID, storage.BlobKindObject, h, data); err != nil {
 			t.Fatalf("putBlob: %v", err)
 		}
@@ -384,6 +749,122 @@ func TestContentSyncServicePushUploadsDataAndSetsHead(t *testing.T) {
 
 // TestContentSyncServicePushAbortsWhenRemoteHeadChangesMidUpload は、アップロード中に
 // 別デバイスがリモート HEAD を進めた場合、push が writeHEAD せず中断することを確認する。
+// TestContentSyncServicePushReusesRemoteBlobIndex は連続 Push で objects/ の全件列挙を省き差分だけを送り、
+// 他端末の Push などでリモート HEAD が控えとずれたら全件列挙に戻ることを確認する。
+func TestContentSyncServicePushReusesRemoteBlobIndex(t *testing.T) {
+	t.Parallel()
+
+	saveDir := t.TempDir()
+	if err := os.WriteFile(filepath.Join(saveDir, "a.sav"), []byte("slot a"), 0o600); err != nil {
+		t.Fatal(err)
+	}
+	game := baseGame(saveDir)
+	repo := newFakeRepo(&game, nil)
+	bstore := newFakeBlobStore()
+	svc := newTestService(repo, bstore)
+	svc.config.RemoteIndexMaxAgeHours = 24
+	ctx := context.Background()
+
+	if err := svc.Push(ctx, game.ID, nil); err != nil {
+		t.Fatalf("first Push: %v", err)
+	}
+	if bstore.listedObjects != 1 || repo.remoteIndex == nil || repo.remoteIndex.Head != bstore.heads[game.ID] {
+		t.Fatalf("first push should list and record the index: listed=%d index=%+v", bstore.listedObjects, repo.remoteIndex)
+	}
+
+	if err := os.WriteFile(filepath.Join(saveDir, "b.sav"), []byte("slot b"), 0o600); err != nil {
+		t.Fatal(err)
+	}
+	bstore.uploadedObjects = nil
+	if err := svc.Push(ctx, game.ID, nil); err != nil {
+		t.Fatalf("second Push: %v", err)
+	}
+	if bstore.listedObjects != 1 {
+		t.Fatalf("second push should trust the index, listed=%d", bstore.listedObjects)
+	}
+	if want := hashBytes([]byte("slot b")); len(bstore.uploadedObjects) != 1 || bstore.uploadedObjects[0] != want {
+		t.Fatalf("expected only the new blob uploaded, got %v", bstore.uploadedObjects)
+	}
+	if _, ok := repo.remoteIndex.Hashes[storage.BlobKindObject][hashBytes([]byte("slot b"))]; !ok || repo.remoteIndex.Head != bstore.heads[game.ID] {
+		t.Fatalf("index should include the new blob and head: %+v", repo.remoteIndex)
+	}
+
+	// 控えの HEAD がリモートとずれている（他端末の Push 等）場合は信用しない
+	repo.remoteIndex.Head = "someone-else"
+	if err := os.WriteFile(filepath.Join(saveDir, "c.sav"), []byte("slot c"), 0o600); err != nil {
+		t.Fatal(err)
+	}
+	if err := svc.Push(ctx, game.ID, nil); err != nil {
+		t.Fatalf("third Push: %v", err)
+	}
+	if bstore.listedObjects != 2 {
+		t.Fatalf("mismatched head should force a listing, listed=%d", bstore.listedObjects)
+	}
+}
+
+// TestContentSyncServicePushResumesFromTransferJournal は、通信断で失敗した Push の完了分が転送記録に残り、
+// 再試行では全件列挙も再送もせずに残りだけを送ること、成功後に記録が消えることを確認する。
+func TestContentSyncServicePushResumesFromTransferJournal(t *testing.T) {
+	t.Parallel()
+
+	saveDir := t.TempDir()
+	if err := os.WriteFile(filepath.Join(saveDir, "a.sav"), []byte("slot a"), 0o600); err != nil {
+		t.Fatal(err)
+	}
+	game := baseGame(saveDir)
+	repo := newFakeRepo(&game, nil)
+	bstore := newFakeBlobStore()
+	svc := newTestService(repo, bstore)
+	svc.config.RemoteIndexMaxAgeHours = 24
+	ctx := context.Background()
+
+	if err := svc.Push(ctx, game.ID, nil); err != nil {
+		t.Fatalf("first Push: %v", err)
+	}
+	for _, name := range []string{"b.sav", "c.sav", "d.sav"} {
+		if err := os.WriteFile(filepath.Join(saveDir, name), []byte("slot "+name), 0o600); err != nil {
+			t.Fatal(err)
+		}
+	}
+
+	bstore.uploadedObjects = nil
+	bstore.failPutBlobsAfter = 1
+	if err := svc.Push(ctx, game.ID, nil); err == nil {
+		t.Fatal("interrupted Push should fail")
+	}
+	if len(bstore.uploadedObjects) != 1 {
+		t.Fatalf("expected one blob before the failure, got %v", bstore.uploadedObjects)
+	}
+	sent := bstore.uploadedObjects[0]
+	if journal := repo.journals[transferPush]; journal == nil || len(journal.Entries) == 0 {
+		t.Fatalf("failed push should leave a journal, got %+v", journal)
+	}
+
+	// 記録の完了分は控え（known）に無いが、再試行では再送しない
+	bstore.uploadedObjects = nil
+	bstore.failPutBlobsAfter = 0
+	if err := svc.Push(ctx, game.ID, nil); err != nil {
+		t.Fatalf("retried Push: %v", err)
+	}
+	if bstore.listedObjects != 1 {
+		t.Fatalf("retry should not list objects, listed=%d", bstore.listedObjects)
+	}
+	if len(bstore.uploadedObjects) != 2 {
+		t.Fatalf("retry should send only the remaining blobs, got %v", bstore.uploadedObjects)
+	}
+	for _, hash := range bstore.uploadedObjects {
+		if hash == sent {
+			t.Fatalf("blob %s was sent twice", hash)
+		}
+	}
+	if _, ok := repo.remoteIndex.Hashes[storage.BlobKindObject][sent]; !ok {
+		t.Fatalf("journaled blob should be saved into the index: %+v", repo.remoteIndex)
+	}
+	if journal := repo.journals[transferPush]; journal != nil {
+		t.Fatalf("successful push should clear the journal, got %+v", journal)
+	}
+}
+
 func TestContentSyncServicePushAbortsWhenRemoteHeadChangesMidUpload(t *testing.T) {
 	t.Parallel()
 
@@ -444,6 +925,38 @@ func TestContentSyncServicePushSetsProgressCallback(t *testing.T) {
 	}
 }
 
+// TestContentSyncServicePushRecordsPhaseMetrics は、Push の全体と各段階が計測され、
+// セーブスナップショットの段階にファイル数と総バイト数が載ることを確認する。
+func TestContentSyncServicePushRecordsPhaseMetrics(t *testing.T) {
+	t.Parallel()
+
+	saveDir := t.TempDir()
+	if err := os.WriteFile(filepath.Join(saveDir, "save.dat"), []byte("game data"), 0o600); err != nil {
+		t.Fatal(err)
+	}
+	game := baseGame(saveDir)
+	svc := newTestService(newFakeRepo(&game, nil), newFakeBlobStore())
+	metrics := NewPerfMetrics(nil)
+	svc.SetPerfMetrics(metrics)
+
+	if err := svc.Push(context.Background(), game.ID, nil); err != nil {
+		t.Fatalf("Push: %v", err)
+	}
+
+	phases := make(map[string]PerfPhaseMetrics)
+	for _, phase := range metrics.Snapshot() {
+		phases[phase.Name] = phase
+	}
+	for _, name := range []string{"push", "push.check_head", "push.build_snapshot", "push.upload", "push.finalize_head"} {
+		if phases[name].Count != 1 || phases[name].Errors != 0 {
+			t.Fatalf("expected one successful %s span, got %+v (all: %+v)", name, phases[name], phases)
+		}
+	}
+	if build := phases["push.build_snapshot"]; build.Objects != 1 || build.Bytes != int64(len("game data")) {
+		t.Fatalf("unexpected snapshot phase values: %+v", build)
+	}
+}
+
 func TestContentSyncServicePushReturnsErrorWhenGameNotFound(t *testing.T) {
 	t.Parallel()
 
@@ -719,11 +1232,15 @@ func TestContentSyncServicePullRejectsMismatchedRemoteGameID(t *testing.T) {
 	game := baseGame(saveDir)
 	bstore := newFakeBlobStore()
 
-	saveSnap, saveBlobs, err := buildSaveSnapshot(saveDir)
+	saveSnap, saveBlobs, err := buildSaveSnapshot(saveDir, nil, 0)
 	if err != nil {
 		t.Fatal(err)
 	}
-	for hash, data := range saveBlobs {
+	for hash, source := range saveBlobs {
+		data, err := os.ReadFile(source.Path)
+		if err != nil {
+			t.Fatal(err)
+		}
 		if err := bstore.putBlob(context.Background(), game.ID, storage.BlobKindObject, hash, data); err != nil {
 			t.Fatal(err)
 		}
@@ -895,7 +1412,7 @@ func TestContentSyncServiceStatusReturnsPullNeeded(t *testing.T) {
 	sessions := []domain.PlaySession{}
 
 	// ローカルの状態を fingerprint として LocalSyncHead に設定
-	localSaveSnap, _, err := buildSaveSnapshot(saveDir)
+	localSaveSnap, _, err := buildSaveSnapshot(saveDir, nil, 0)
 	if err != nil {
 		t.Fatal(err)
 	}
@@ -945,7 +1462,7 @@ func TestContentSyncServiceStatusReturnsConflict(t *testing.T) {
 
 	// 基準: 空のフォルダ状態として LocalSyncHead を設定
 	emptyDir := t.TempDir()
-	baseSaveSnap, _, err := buildSaveSnapshot(emptyDir)
+	baseSaveSnap, _, err := buildSaveSnapshot(emptyDir, nil, 0)
 	if err != nil {
 		t.Fatal(err)
 	}
@@ -1196,6 +1713,52 @@ func TestContentSyncServiceStatusReturnsPullNeededWhenLocalSyncHeadUnset(t *test
 	}
 }
 
+// TestContentSyncServiceStatusManySharesStoreAndReportsEachGame は、StatusMany が
+// ブロブストアを1回だけ作り、重複を除いた入力順で結果を返し、各ゲームの完了を通知することを確認する。
+func TestContentSyncServiceStatusManySharesStoreAndReportsEachGame(t *testing.T) {
+	t.Parallel()
+
+	saveDir := t.TempDir()
+	if err := os.WriteFile(filepath.Join(saveDir, "save.dat"), []byte("data"), 0o600); err != nil {
+		t.Fatal(err)
+	}
+	game := baseGame(saveDir)
+	bstore := newFakeBlobStore()
+	remoteMeta := setupRemoteState(t, bstore, game.ID, game, nil, saveDir)
+	fp := contentFingerprint(remoteMeta)
+	game.LocalSyncHead = &fp
+
+	svc := newTestService(newFakeRepo(&game, nil), bstore)
+	var storesBuilt atomic.Int32
+	svc.newBlobStore = func(_ context.Context) (contentBlobStore, error) {
+		storesBuilt.Add(1)
+		return bstore, nil
+	}
+
+	var notified []string
+	results, err := svc.StatusMany(context.Background(), []string{game.ID, "never-pushed", " ", game.ID}, func(item GameSyncStatus) {
+		notified = append(notified, item.GameID)
+	})
+	if err != nil {
+		t.Fatalf("StatusMany: %v", err)
+	}
+	if got := storesBuilt.Load(); got != 1 {
+		t.Errorf("blob store built %d times, want 1", got)
+	}
+	if len(results) != 2 || results[0].GameID != game.ID || results[1].GameID != "never-pushed" {
+		t.Fatalf("results = %+v, want [%s never-pushed]", results, game.ID)
+	}
+	if results[0].Error != "" || results[0].Detail.Status != domain.SyncStatusInSync {
+		t.Errorf("first = %+v, want in_sync", results[0])
+	}
+	if results[1].Error != "" || results[1].Detail.Status != domain.SyncStatusNeverSynced {
+		t.Errorf("second = %+v, want never_synced", results[1])
+	}
+	if len(notified) != 2 {
+		t.Errorf("onResult called %d times, want 2", len(notified))
+	}
+}
+
 // TestContentSyncServicePullThenAddSaveThenPushSucceeds は PC-A push → PC-B pull →
 // PC-B がセーブを追加 → PC-B が push できることを確認する。
 func TestContentSyncServicePullThenAddSaveThenPushSucceeds(t *testing.T) {
@@ -1297,6 +1860,157 @@ func TestLoadCloudMetadataReturnsAllGamesAndSkipsBroken(t *testing.T) {
 	}
 }
 
+// TestCloudCatalogServesListsAfterPushAndDelete は、Push がクラウドカタログを更新し、
+// 一覧がカタログだけで（ゲームごとの commit/game.json 取得なしで）返り、DeleteFromCloud で項目が外れることを確認する。
+func TestCloudCatalogServesListsAfterPushAndDelete(t *testing.T) {
+	t.Parallel()
+
+	saveDir := t.TempDir()
+	if err := os.WriteFile(filepath.Join(saveDir, "save.dat"), []byte("game data"), 0o600); err != nil {
+		t.Fatal(err)
+	}
+	game := baseGame(saveDir)
+	repo := newFakeRepo(&game, nil)
+	bstore := newFakeBlobStore()
+	svc := newTestService(repo, bstore)
+	ctx := context.Background()
+
+	if err := svc.Push(ctx, game.ID, nil); err != nil {
+		t.Fatalf("Push: %v", err)
+	}
+	if bstore.catalogWrites != 1 {
+		t.Fatalf("push should write the catalog once, writes=%d", bstore.catalogWrites)
+	}
+
+	bstore.blobReads = 0
+	summaries, err := svc.ListCloudGameSummaries(ctx)
+	if err != nil {
+		t.Fatalf("ListCloudGameSummaries: %v", err)
+	}
+	if len(summaries) != 1 || summaries[0].GameID != game.ID || summaries[0].Title != game.Title || summaries[0].FileCount != 1 {
+		t.Fatalf("unexpected summaries: %+v", summaries)
+	}
+	infos, err := svc.LoadCloudMetadata(ctx)
+	if err != nil {
+		t.Fatalf("LoadCloudMetadata: %v", err)
+	}
+	if len(infos) != 1 || infos[0].ID != game.ID || infos[0].Publisher != game.Publisher {
+		t.Fatalf("unexpected infos: %+v", infos)
+	}
+	if bstore.blobReads != 0 {
+		t.Fatalf("lists should be served from the catalog, blob reads=%d", bstore.blobReads)
+	}
+
+	if err := svc.DeleteFromCloud(ctx, game.ID); err != nil {
+		t.Fatalf("DeleteFromCloud: %v", err)
+	}
+	catalog, _, err := svc.readCloudCatalog(ctx, bstore)
+	if err != nil || catalog == nil {
+		t.Fatalf("readCloudCatalog: %v %v", catalog, err)
+	}
+	if _, ok := catalog.Games[game.ID]; ok {
+		t.Fatal("deleted game should be removed from the catalog")
+	}
+}
+
+// TestCloudCatalogRebuildsMissingEntriesAndRetriesConflicts は、カタログに無いゲームだけを個別取得して
+// カタログを修復し、条件付き書き込みが競合したら読み直して書き直すことを確認する。
+func TestCloudCatalogRebuildsMissingEntriesAndRetriesConflicts(t *testing.T) {
+	t.Parallel()
+
+	bstore := newFakeBlobStore()
+	ctx := context.Background()
+	for _, id := range []string{"game-a", "game-b"} {
+		saveDir := t.TempDir()
+		g := baseGame(saveDir)
+		g.ID = id
+		g.Title = "Title " + id
+		setupRemoteState(t, bstore, id, g, nil, saveDir)
+	}
+	svc := newTestService(newFakeRepo(nil, nil), bstore)
+	bstore.catalogConflicts = 2
+
+	summaries, err := svc.ListCloudGameSummaries(ctx)
+	if err != nil {
+		t.Fatalf("ListCloudGameSummaries: %v", err)
+	}
+	if len(summaries) != 2 || summaries[0].Title != "Title game-a" || summaries[1].Title != "Title game-b" {
+		t.Fatalf("fallback should list every game: %+v", summaries)
+	}
+	if bstore.catalogWrites != 1 || bstore.catalogConflicts != 0 {
+		t.Fatalf("catalog should be written after retrying conflicts: writes=%d", bstore.catalogWrites)
+	}
+
+	bstore.blobReads = 0
+	if _, err := svc.ListCloudGameSummaries(ctx); err != nil {
+		t.Fatalf("second ListCloudGameSummaries: %v", err)
+	}
+	if bstore.blobReads != 0 || bstore.catalogWrites != 1 {
+		t.Fatalf("repaired catalog should serve the list: reads=%d writes=%d", bstore.blobReads, bstore.catalogWrites)
+	}
+}
+
+// TestCloudCatalogRevalidatesStaleEntries は、cloudCatalogEntryMaxAge より古い項目は一覧時に HEAD を読み直し、
+// カタログ更新を取りこぼした Push（HEAD だけ進んだゲーム）は作り直し、HEAD が同じゲームは確かめた時刻だけ進めることを確認する。
+func TestCloudCatalogRevalidatesStaleEntries(t *testing.T) {
+	t.Parallel()
+
+	bstore := newFakeBlobStore()
+	ctx := context.Background()
+	games := map[string]domain.Game{}
+	for _, id := range []string{"game-a", "game-b"} {
+		saveDir := t.TempDir()
+		g := baseGame(saveDir)
+		g.ID = id
+		g.Title = "Title " + id
+		setupRemoteState(t, bstore, id, g, nil, saveDir)
+		games[id] = g
+	}
+	svc := newTestService(newFakeRepo(nil, nil), bstore)
+	if _, err := svc.ListCloudGameSummaries(ctx); err != nil {
+		t.Fatalf("ListCloudGameSummaries: %v", err)
+	}
+
+	// カタログを更新できなかった Push を模して game-a の HEAD だけ進め、全項目を古くする
+	renamed := games["game-a"]
+	renamed.Title = "Renamed"
+	setupRemoteState(t, bstore, renamed.ID, renamed, nil, *renamed.SaveFolderPath)
+	catalog, etag, err := svc.readCloudCatalog(ctx, bstore)
+	if err != nil || catalog == nil {
+		t.Fatalf("readCloudCatalog: %v %v", catalog, err)
+	}
+	for id, entry := range catalog.Games {
+		entry.CheckedAt = time.Now().Add(-2 * cloudCatalogEntryMaxAge)
+		catalog.Games[id] = entry
+	}
+	data, _ := json.Marshal(catalog)
+	if err := bstore.writeCatalog(ctx, data, etag); err != nil {
+		t.Fatal(err)
+	}
+
+	bstore.blobReads = 0
+	summaries, err := svc.ListCloudGameSummaries(ctx)
+	if err != nil {
+		t.Fatalf("ListCloudGameSummaries: %v", err)
+	}
+	if len(summaries) != 2 || summaries[0].Title != "Renamed" || summaries[1].Title != "Title game-b" {
+		t.Fatalf("stale entries should be revalidated: %+v", summaries)
+	}
+	// commit と game.json を読み直すのは HEAD が変わった game-a だけ
+	if bstore.blobReads != 2 {
+		t.Fatalf("only the moved game should be refetched, blob reads=%d", bstore.blobReads)
+	}
+
+	bstore.blobReads = 0
+	summaries, err = svc.ListCloudGameSummaries(ctx)
+	if err != nil {
+		t.Fatalf("third ListCloudGameSummaries: %v", err)
+	}
+	if summaries[0].Title != "Renamed" || bstore.blobReads != 0 {
+		t.Fatalf("revalidated catalog should serve the list: %+v reads=%d", summaries, bstore.blobReads)
+	}
+}
+
 // TestContentSyncServicePullRequiresConfirmationForUntracked は、base tree に無い
 // ローカル固有ファイル（untracked）を削除する必要があるとき、Pull が変更を加えずに
 // 確認待ち（Applied=false）を返すことを確認する。
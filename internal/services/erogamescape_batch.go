@@ -0,0 +1,61 @@
+// 批評空間からの複数ゲームの一括取り込みを提供する。
+package services
+
+import (
+	"context"
+	"strings"
+	"sync"
+
+	"CloudLaunch_Go/internal/domain"
+)
+
+// defaultErogameScapeWorkers は一括取り込みの並列数の既定値。
+const defaultErogameScapeWorkers = 4
+
+// FetchManyFromErogameScape は複数の批評空間 URL からゲーム情報を取得し、入力と同じ順で結果を返す。
+// ワーカーが並行に取得するが、サイトへのリクエストは erogameScapeClient の送信間隔で全体として絞られるため、
+// 並列化で速くなるのはキャッシュ済みのページと画像のデコード・縮小。1件の失敗は他の取得に影響しない。
+// 同じ URL が複数含まれる場合は1回だけ取得する。
+func (service *ErogameScapeService) FetchManyFromErogameScape(ctx context.Context, gamePageURLs []string) []domain.GameImportResult {
+	results := make([]domain.GameImportResult, len(gamePageURLs))
+	firstIndex := make(map[string]int, len(gamePageURLs))
+	jobs := make(chan int)
+	workers := service.workers
+	if workers <= 0 {
+		workers = defaultErogameScapeWorkers
+	}
+
+	var wg sync.WaitGroup
+	for range workers {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			for index := range jobs {
+				imported, err := service.FetchFromErogameScape(ctx, results[index].URL)
+				if err != nil {
+					results[index].Error = err.Error()
+					continue
+				}
+				results[index].Import = &imported
+			}
+		}()
+	}
+	for index, rawURL := range gamePageURLs {
+		results[index].URL = strings.TrimSpace(rawURL)
+		if _, seen := firstIndex[results[index].URL]; seen {
+			continue
+		}
+		firstIndex[results[index].URL] = index
+		jobs <- index
+	}
+	close(jobs)
+	wg.Wait()
+
+	for index := range results {
+		if first := firstIndex[results[index].URL]; first != index {
+			results[index].Import = results[first].Import
+			results[index].Error = results[first].Error
+		}
+	}
+	return results
+}
@@ -0,0 +1,214 @@
+// 批評空間への HTTP リクエストのディスクキャッシュと送信間隔の制御を提供する。
+package services
+
+import (
+	"bytes"
+	"context"
+	"crypto/sha256"
+	"encoding/hex"
+	"encoding/json"
+	"io"
+	"log/slog"
+	"net/http"
+	"os"
+	"path/filepath"
+	"sync"
+	"sync/atomic"
+	"time"
+)
+
+// erogameScapePruneEvery 回の保存ごとにキャッシュを maxBytes に収める（初回の保存でも行う）。
+const erogameScapePruneEvery = 32
+
+// erogameScapeCacheEntry はキャッシュしたレスポンス1件のメタデータ。
+type erogameScapeCacheEntry struct {
+	URL          string    `json:"url"`
+	ContentType  string    `json:"contentType,omitempty"`
+	ETag         string    `json:"etag,omitempty"`
+	LastModified string    `json:"lastModified,omitempty"`
+	FetchedAt    time.Time `json:"fetchedAt"`
+}
+
+// erogameScapeResponse は取得した（またはキャッシュから読んだ）レスポンス本文。
+type erogameScapeResponse struct {
+	Body        []byte
+	ContentType string
+}
+
+// httpStatusError は 2xx 以外の応答を表す。
+type httpStatusError struct {
+	StatusCode int
+	Status     string
+}
+
+func (e httpStatusError) Error() string {
+	return e.Status
+}
+
+// erogameScapeClient は批評空間への GET をディスクキャッシュと最小送信間隔つきで行う。
+// TTL 内のキャッシュはリクエストせずに返し、期限切れは ETag / Last-Modified の条件付きリクエストで
+// 再検証する（304 なら本文を再利用）。通信自体に失敗した場合は期限切れでもキャッシュを返す。
+// 送信は並行に呼ばれても全体で interval 以上空ける（一括取り込みでサイトのレート制限に当たらないため）。
+// cacheDir が空ならキャッシュしない。キャッシュの合計が maxBytes（0 以下なら上限なし）を超えたら、
+// 取得・再検証した時刻の古いものから消す。
+type erogameScapeClient struct {
+	httpClient *http.Client
+	cacheDir   string
+	maxBytes   int64
+	interval   time.Duration
+	logger     *slog.Logger
+
+	mu     sync.Mutex
+	next   time.Time
+	stores atomic.Int64
+}
+
+// get は rawURL を ttl のキャッシュつきで取得する。
+func (c *erogameScapeClient) get(ctx context.Context, rawURL string, ttl time.Duration) (erogameScapeResponse, error) {
+	path := c.cachePath(rawURL)
+	entry, body, cached := c.load(path)
+	if cached && time.Since(entry.FetchedAt) < ttl {
+		return erogameScapeResponse{Body: body, ContentType: entry.ContentType}, nil
+	}
+
+	request, err := http.NewRequestWithContext(ctx, http.MethodGet, rawURL, nil)
+	if err != nil {
+		return erogameScapeResponse{}, err
+	}
+	request.Header.Set("User-Agent", "CloudLaunch/1.0")
+	if cached {
+		if entry.ETag != "" {
+			request.Header.Set("If-None-Match", entry.ETag)
+		}
+		if entry.LastModified != "" {
+			request.Header.Set("If-Modified-Since", entry.LastModified)
+		}
+	}
+	if err := c.wait(ctx); err != nil {
+		return erogameScapeResponse{}, err
+	}
+	response, err := c.httpClient.Do(request)
+	if err != nil {
+		if cached && ctx.Err() == nil {
+			c.logger.Warn("批評空間への接続に失敗したため期限切れのキャッシュを使用します", "url", rawURL, "error", err)
+			return erogameScapeResponse{Body: body, ContentType: entry.ContentType}, nil
+		}
+		return erogameScapeResponse{}, err
+	}
+	defer func() {
+		if closeErr := response.Body.Close(); closeErr != nil {
+			c.logger.Warn("批評空間レスポンスのクローズに失敗", "error", closeErr)
+		}
+	}()
+
+	if cached && response.StatusCode == http.StatusNotModified {
+		entry.FetchedAt = time.Now()
+		c.store(path, entry, body)
+		return erogameScapeResponse{Body: body, ContentType: entry.ContentType}, nil
+	}
+	if response.StatusCode < http.StatusOK || response.StatusCode >= http.StatusMultipleChoices {
+		return erogameScapeResponse{}, httpStatusError{StatusCode: response.StatusCode, Status: response.Status}
+	}
+	body, err = io.ReadAll(response.Body)
+	if err != nil {
+		return erogameScapeResponse{}, err
+	}
+	entry = erogameScapeCacheEntry{
+		URL:          rawURL,
+		ContentType:  response.Header.Get("Content-Type"),
+		ETag:         response.Header.Get("ETag"),
+		LastModified: response.Header.Get("Last-Modified"),
+		FetchedAt:    time.Now(),
+	}
+	c.store(path, entry, body)
+	return erogameScapeResponse{Body: body, ContentType: entry.ContentType}, nil
+}
+
+// wait は前回の送信から interval が経つまで待ち、次の送信枠を予約する。
+func (c *erogameScapeClient) wait(ctx context.Context) error {
+	if c.interval <= 0 {
+		return nil
+	}
+	c.mu.Lock()
+	start := time.Now()
+	if c.next.After(start) {
+		start = c.next
+	}
+	c.next = start.Add(c.interval)
+	c.mu.Unlock()
+
+	delay := time.Until(start)
+	if delay <= 0 {
+		return nil
+	}
+	timer := time.NewTimer(delay)
+	defer timer.Stop()
+	select {
+	case <-ctx.Done():
+		return ctx.Err()
+	case <-timer.C:
+		return nil
+	}
+}
+
+func (c *erogameScapeClient) cachePath(rawURL string) string {
+	if c.cacheDir == "" {
+		return ""
+	}
+	sum := sha256.Sum256([]byte(rawURL))
+	return filepath.Join(c.cacheDir, hex.EncodeToString(sum[:]))
+}
+
+// load はキャッシュファイル（1行目がメタデータの JSON、以降が本文）を読む。
+// URL が一致しない・壊れているファイルは無いものとして扱う。
+func (c *erogameScapeClient) load(path string) (erogameScapeCacheEntry, []byte, bool) {
+	if path == "" {
+		return erogameScapeCacheEntry{}, nil, false
+	}
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return erogameScapeCacheEntry{}, nil, false
+	}
+	header, body, ok := bytes.Cut(data, []byte("\n"))
+	if !ok {
+		return erogameScapeCacheEntry{}, nil, false
+	}
+	var entry erogameScapeCacheEntry
+	if err := json.Unmarshal(header, &entry); err != nil || entry.URL == "" {
+		return erogameScapeCacheEntry{}, nil, false
+	}
+	return entry, body, true
+}
+
+// store はキャッシュファイルを書き込む。書きかけを load が読まないよう、一時ファイルに書いてから置き換える。
+// 書き込みに失敗しても次回取得し直すだけなので、警告だけ出して続ける。
+func (c *erogameScapeClient) store(path string, entry erogameScapeCacheEntry, body []byte) {
+	if path == "" {
+		return
+	}
+	header, err := json.Marshal(entry)
+	if err != nil {
+		return
+	}
+	if err := os.MkdirAll(filepath.Dir(path), 0o700); err != nil {
+		c.logger.Warn("批評空間キャッシュの保存に失敗", "error", err)
+		return
+	}
+	tmp, err := os.CreateTemp(filepath.Dir(path), ".tmp-*")
+	if err != nil {
+		c.logger.Warn("批評空間キャッシュの保存に失敗", "error", err)
+		return
+	}
+	_, writeErr := tmp.Write(append(append(header, '\n'), body...))
+	closeErr := tmp.Close()
+	if writeErr != nil || closeErr != nil || os.Rename(tmp.Name(), path) != nil {
+		_ = os.Remove(tmp.Name())
+		c.logger.Warn("批評空間キャッシュの保存に失敗", "url", entry.URL)
+		return
+	}
+	if c.maxBytes > 0 && c.stores.Add(1)%erogameScapePruneEvery == 1 {
+		if _, err := pruneCacheDir(c.cacheDir, c.maxBytes, nil); err != nil {
+			c.logger.Warn("批評空間キャッシュの整理に失敗", "error", err)
+		}
+	}
+}
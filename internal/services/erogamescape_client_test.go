@@ -0,0 +1,200 @@
+package services
+
+import (
+	"bytes"
+	"context"
+	"fmt"
+	"image"
+	"image/png"
+	"io"
+	"log/slog"
+	"net/http"
+	"net/http/httptest"
+	"os"
+	"strings"
+	"sync"
+	"testing"
+	"time"
+
+	"CloudLaunch_Go/internal/config"
+)
+
+// TestErogameScapeClientCachesAndRevalidates は、TTL 内はリクエストせずにキャッシュを返し、
+// 期限切れは条件付きリクエストの 304 で本文を再利用することを確認する。
+func TestErogameScapeClientCachesAndRevalidates(t *testing.T) {
+	t.Parallel()
+
+	var mu sync.Mutex
+	requests, conditional := 0, 0
+	server := httptest.NewServer(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		mu.Lock()
+		defer mu.Unlock()
+		requests++
+		if r.Header.Get("If-None-Match") == `"v1"` {
+			conditional++
+			w.WriteHeader(http.StatusNotModified)
+			return
+		}
+		w.Header().Set("ETag", `"v1"`)
+		w.Header().Set("Content-Type", "text/html")
+		_, _ = io.WriteString(w, "<html>page</html>")
+	}))
+	defer server.Close()
+
+	client := &erogameScapeClient{
+		httpClient: server.Client(),
+		cacheDir:   t.TempDir(),
+		logger:     slog.New(slog.NewTextHandler(io.Discard, nil)),
+	}
+	ctx := context.Background()
+	for range 2 {
+		response, err := client.get(ctx, server.URL+"/page", time.Hour)
+		if err != nil || string(response.Body) != "<html>page</html>" || response.ContentType != "text/html" {
+			t.Fatalf("unexpected response %q (%q), err=%v", response.Body, response.ContentType, err)
+		}
+	}
+	if requests != 1 {
+		t.Fatalf("expected a single request within TTL, got %d", requests)
+	}
+
+	response, err := client.get(ctx, server.URL+"/page", 0)
+	if err != nil || string(response.Body) != "<html>page</html>" {
+		t.Fatalf("expected revalidated body, got %q, err=%v", response.Body, err)
+	}
+	if requests != 2 || conditional != 1 {
+		t.Fatalf("expected one conditional revalidation, got requests=%d conditional=%d", requests, conditional)
+	}
+}
+
+// TestErogameScapeServiceFetchManyKeepsOrderAndIsolatesFailures は、一括取得が入力順に結果を返し、
+// 失敗したページが他に影響せず、取り込み直しはキャッシュだけで済むことを確認する。
+func TestErogameScapeServiceFetchManyKeepsOrderAndIsolatesFailures(t *testing.T) {
+	t.Parallel()
+
+	var imagePNG bytes.Buffer
+	if err := png.Encode(&imagePNG, image.NewRGBA(image.Rect(0, 0, 40, 20))); err != nil {
+		t.Fatalf("png.Encode: %v", err)
+	}
+	var mu sync.Mutex
+	requests := 0
+	server := httptest.NewServer(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		mu.Lock()
+		requests++
+		mu.Unlock()
+		switch r.URL.Path {
+		case "/cover.png":
+			w.Header().Set("Content-Type", "image/png")
+			_, _ = w.Write(imagePNG.Bytes())
+		case "/game.php":
+			if r.URL.Query().Get("game") == "404" {
+				http.NotFound(w, r)
+				return
+			}
+			_, _ = fmt.Fprintf(w, `<html><body>
+<div id="game_title"><a>Game %[1]s</a></div>
+<table><tr id="brand"><td><a>Brand</a></td></tr></table>
+<div id="main_image"><img src="/cover.png"></div>
+</body></html>`, r.URL.Query().Get("game"))
+		default:
+			http.NotFound(w, r)
+		}
+	}))
+	defer server.Close()
+
+	service := NewErogameScapeService(config.Config{AppDataDir: t.TempDir(), ErogameScapeCacheHours: 1, ErogameScapeWorkers: 2}, slog.New(slog.NewTextHandler(io.Discard, nil)))
+	service.client.httpClient = server.Client()
+
+	urls := []string{
+		server.URL + "/game.php?game=1",
+		server.URL + "/game.php?game=404",
+		server.URL + "/game.php?game=2",
+		server.URL + "/game.php?game=1",
+	}
+	results := service.FetchManyFromErogameScape(context.Background(), urls)
+	if len(results) != len(urls) {
+		t.Fatalf("expected %d results, got %d", len(urls), len(results))
+	}
+	for index, want := range []string{"Game 1", "", "Game 2", "Game 1"} {
+		got := results[index]
+		if got.URL != urls[index] {
+			t.Fatalf("result %d out of order: %q", index, got.URL)
+		}
+		if want == "" {
+			if got.Import != nil || got.Error == "" {
+				t.Fatalf("expected failure for %q, got %#v", got.URL, got)
+			}
+			continue
+		}
+		if got.Import == nil || got.Import.Title != want || got.Import.ImagePath == "" {
+			t.Fatalf("unexpected result %d: %#v", index, got)
+		}
+	}
+
+	mu.Lock()
+	firstRun := requests
+	mu.Unlock()
+	again := service.FetchManyFromErogameScape(context.Background(), urls[:1])
+	if again[0].Import == nil || again[0].Import.Title != "Game 1" {
+		t.Fatalf("unexpected re-import result: %#v", again[0])
+	}
+	mu.Lock()
+	defer mu.Unlock()
+	if requests != firstRun {
+		t.Fatalf("expected re-import to be served from cache, got %d extra requests", requests-firstRun)
+	}
+}
+
+// TestErogameScapeClientPrunesCacheToMaxBytes は、キャッシュが maxBytes を超えたら取得の古いものから消え、
+// 直近に取得したレスポンスは残ることを確認する。
+func TestErogameScapeClientPrunesCacheToMaxBytes(t *testing.T) {
+	t.Parallel()
+
+	body := strings.Repeat("x", 1024)
+	server := httptest.NewServer(http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		_, _ = io.WriteString(w, body)
+	}))
+	defer server.Close()
+
+	cacheDir := t.TempDir()
+	client := &erogameScapeClient{
+		httpClient: server.Client(),
+		cacheDir:   cacheDir,
+		maxBytes:   8 << 10,
+		logger:     slog.New(slog.NewTextHandler(io.Discard, nil)),
+	}
+	ctx := context.Background()
+	var last string
+	for i := range erogameScapePruneEvery + 1 {
+		last = fmt.Sprintf("%s/page/%d", server.URL, i)
+		if _, err := client.get(ctx, last, time.Hour); err != nil {
+			t.Fatalf("get: %v", err)
+		}
+		// 更新時刻で古い順を決めるため、ファイルシステムの時刻の粒度より間を空ける
+		old := time.Now().Add(time.Duration(i-erogameScapePruneEvery-1) * time.Minute)
+		if i < erogameScapePruneEvery {
+			_ = os.Chtimes(client.cachePath(last), old, old)
+		}
+	}
+
+	entries, err := os.ReadDir(cacheDir)
+	if err != nil {
+		t.Fatal(err)
+	}
+	var total int64
+	for _, entry := range entries {
+		info, err := entry.Info()
+		if err != nil {
+			t.Fatal(err)
+		}
+		total += info.Size()
+	}
+	if total > client.maxBytes {
+		t.Fatalf("cache holds %d bytes, over the %d byte cap", total, client.maxBytes)
+	}
+	if _, _, ok := client.load(client.cachePath(last)); !ok {
+		t.Fatal("the most recent response should stay cached")
+	}
+	if _, _, ok := client.load(client.cachePath(server.URL + "/page/0")); ok {
+		t.Fatal("the oldest response should be pruned")
+	}
+}
@@ -33,13 +33,18 @@ import (
 
 const erogameScapeShortEdgePx = 200
 
+// erogameScapeImageTTLFactor はページの TTL に対する画像の TTL の倍率（画像はほぼ差し替わらないため長く持つ）。
+const erogameScapeImageTTLFactor = 30
+
 var erogameScapeGameIDRegex = regexp.MustCompile(`game=(\d+)`)
 
 // ErogameScapeService は批評空間から情報を取得する。
 type ErogameScapeService struct {
 	appDataDir string
 	logger     *slog.Logger
-	httpClient *http.Client
+	client     *erogameScapeClient
+	pageTTL    time.Duration
+	workers    int
 }
 
 // NewErogameScapeService は ErogameScapeService を生成する。
@@ -47,7 +52,15 @@ func NewErogameScapeService(cfg config.Config, logger *slog.Logger) *ErogameScap
 	return &ErogameScapeService{
 		appDataDir: cfg.AppDataDir,
 		logger:     logger,
-		httpClient: &http.Client{Timeout: 15 * time.Second},
+		client: &erogameScapeClient{
+			httpClient: &http.Client{Timeout: 15 * time.Second},
+			cacheDir:   filepath.Join(cfg.AppDataDir, "cache", "erogamescape"),
+			maxBytes:   int64(cfg.ErogameScapeCacheMaxMB) << 20,
+			interval:   time.Duration(cfg.ErogameScapeIntervalMs) * time.Millisecond,
+			logger:     logger,
+		},
+		pageTTL: time.Duration(cfg.ErogameScapeCacheHours) * time.Hour,
+		workers: cfg.ErogameScapeWorkers,
 	}
 }
 
@@ -132,66 +145,30 @@ func (service *ErogameScapeService) fetchHTML(ctx context.Context, gamePageURL s
 }
 
 func (service *ErogameScapeService) fetchHTMLOnce(ctx context.Context, gamePageURL string) (string, error) {
-	request, error := http.NewRequestWithContext(ctx, http.MethodGet, gamePageURL, nil)
+	response, error := service.client.get(ctx, gamePageURL, service.pageTTL)
 	if error != nil {
-		return "", FetchError{URL: gamePageURL, Err: error}
-	}
-	request.Header.Set("User-Agent", "CloudLaunch/1.0")
-
-	response, error := service.httpClient.Do(request)
-	if error != nil {
-		return "", FetchError{URL: gamePageURL, Err: error}
-	}
-	defer func() {
-		if closeErr := response.Body.Close(); closeErr != nil {
-			service.logger.Warn("批評空間HTMLレスポンスのクローズに失敗", "error", closeErr)
+		var statusErr httpStatusError
+		if errors.As(error, &statusErr) {
+			return "", FetchError{URL: gamePageURL, StatusCode: statusErr.StatusCode, Err: error}
 		}
-	}()
-
-	if response.StatusCode < http.StatusOK || response.StatusCode >= http.StatusMultipleChoices {
-		return "", FetchError{URL: gamePageURL, StatusCode: response.StatusCode, Err: errors.New(response.Status)}
-	}
-
-	body, error := io.ReadAll(response.Body)
-	if error != nil {
 		return "", FetchError{URL: gamePageURL, Err: error}
 	}
-	return string(body), nil
+	return string(response.Body), nil
 }
 
 func (service *ErogameScapeService) downloadAndSaveImage(ctx context.Context, imageURL string, gameID string) (string, error) {
-	request, error := http.NewRequestWithContext(ctx, http.MethodGet, imageURL, nil)
-	if error != nil {
-		return "", ImageError{URL: imageURL, Err: error}
-	}
-	request.Header.Set("User-Agent", "CloudLaunch/1.0")
-
-	response, error := service.httpClient.Do(request)
-	if error != nil {
-		return "", ImageError{URL: imageURL, Err: error}
-	}
-	defer func() {
-		if closeErr := response.Body.Close(); closeErr != nil {
-			service.logger.Warn("批評空間画像レスポンスのクローズに失敗", "error", closeErr)
-		}
-	}()
-
-	if response.StatusCode < http.StatusOK || response.StatusCode >= http.StatusMultipleChoices {
-		return "", ImageError{URL: imageURL, Err: errors.New(response.Status)}
-	}
-
-	raw, error := io.ReadAll(response.Body)
+	response, error := service.client.get(ctx, imageURL, service.pageTTL*erogameScapeImageTTLFactor)
 	if error != nil {
 		return "", ImageError{URL: imageURL, Err: error}
 	}
 
-	decoded, format, error := image.Decode(bytes.NewReader(raw))
+	decoded, format, error := image.Decode(bytes.NewReader(response.Body))
 	if error != nil {
 		return "", ImageError{URL: imageURL, Err: error}
 	}
 
 	resized := resizeToShortEdge(decoded, erogameScapeShortEdgePx)
-	ext := chooseImageExtension(imageURL, response.Header.Get("Content-Type"), format)
+	ext := chooseImageExtension(imageURL, response.ContentType, format)
 	if ext == "" {
 		ext = ".jpg"
 	}
@@ -13,8 +13,9 @@ import (
 
 // GameService はゲーム関連の操作を提供する。
 type GameService struct {
-	repository GameRepository
-	logger     *slog.Logger
+	repository     GameRepository
+	logger         *slog.Logger
+	onGamesChanged func() // 作成・更新・削除の成功後に呼ぶ（nil 可）
 }
 
 // NewGameService は GameService を生成する。
@@ -22,6 +23,18 @@ func NewGameService(repository GameRepository, logger *slog.Logger) *GameService
 	return &GameService{repository: repository, logger: logger}
 }
 
+// SetGamesChangedHook はゲームの作成・更新・削除の後に呼ぶ関数を設定する。
+// プロセス監視の実行ファイル索引のような、ゲーム一覧から作ったキャッシュの無効化に使う。
+func (service *GameService) SetGamesChangedHook(hook func()) {
+	service.onGamesChanged = hook
+}
+
+func (service *GameService) notifyGamesChanged() {
+	if service.onGamesChanged != nil {
+		service.onGamesChanged()
+	}
+}
+
 // ListGames は検索・フィルタ・ソート付きでゲーム一覧を取得する。
 func (service *GameService) ListGames(
 	ctx context.Context,
@@ -38,6 +51,18 @@ func (service *GameService) ListGames(
 	return games, nil
 }
 
+// ListGamesPage は検索・フィルタ・ソート付きでゲーム一覧を1ページ分取得する。
+// ホームの仮想スクロールと入力中の検索で、ライブラリ全体を毎回読み込まないために使う。
+func (service *GameService) ListGamesPage(ctx context.Context, query domain.GameListQuery) (domain.GamePage, error) {
+	query.SearchText = strings.TrimSpace(query.SearchText)
+	page, error := service.repository.ListGamesPage(ctx, query)
+	if error != nil {
+		service.logger.Error("ゲーム一覧取得に失敗", "error", error)
+		return domain.GamePage{}, newServiceError("ゲーム一覧取得に失敗しました", error.Error())
+	}
+	return page, nil
+}
+
 // GetGameByID はID指定でゲームを取得する。
 func (service *GameService) GetGameByID(ctx context.Context, gameID string) (*domain.Game, error) {
 	game, error := service.repository.GetGameByID(ctx, strings.TrimSpace(gameID))
@@ -79,6 +104,7 @@ func (service *GameService) CreateGame(ctx context.Context, input GameInput) (*d
 		})
 	}
 
+	service.notifyGamesChanged()
 	service.logger.Info("ゲームを作成", "title", game.Title)
 	return created, nil
 }
@@ -134,6 +160,7 @@ func (service *GameService) UpdateGame(ctx context.Context, gameID string, input
 		service.logger.Error("ゲーム更新に失敗", "error", error)
 		return nil, newServiceError("ゲーム更新に失敗しました", error.Error())
 	}
+	service.notifyGamesChanged()
 	return updated, nil
 }
 
@@ -178,6 +205,7 @@ func (service *GameService) DeleteGame(ctx context.Context, gameID string) error
 		service.logger.Error("ゲーム削除に失敗", "error", error)
 		return newServiceError("ゲーム削除に失敗しました", error.Error())
 	}
+	service.notifyGamesChanged()
 	return nil
 }
 
@@ -24,6 +24,10 @@ func (repository fakeGameRepository) ListGames(ctx context.Context, searchText s
 	return repository.listGamesFn(ctx, searchText, filter, sortBy, sortDirection)
 }
 
+func (repository fakeGameRepository) ListGamesPage(ctx context.Context, query domain.GameListQuery) (domain.GamePage, error) {
+	return domain.GamePage{}, nil
+}
+
 func (repository fakeGameRepository) GetGameByID(ctx context.Context, gameID string) (*domain.Game, error) {
 	return repository.getGameByIDFn(ctx, gameID)
 }
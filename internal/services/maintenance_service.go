@@ -49,6 +49,13 @@ type BackupManifest struct {
 	CredentialNotice      string    `json:"credentialNotice"`
 	CloudLaunchBackupType string    `json:"cloudLaunchBackupType"`
 	BackupVersion         int       `json:"backupVersion"`
+	// 以下は backupVersion 2 以降。Files はバックアップ時点の AppData の全ファイル（slash 区切りの相対パス）で、
+	// 増分バックアップでは ZIP に格納していないファイルも含む。復元後の AppData はこの集合になる。
+	BackupID     string                     `json:"backupId,omitempty"`
+	Kind         string                     `json:"kind,omitempty"`
+	BaseBackup   string                     `json:"baseBackup,omitempty"`
+	BaseBackupID string                     `json:"baseBackupId,omitempty"`
+	Files        map[string]BackupFileEntry `json:"files,omitempty"`
 }
 
 type MaintenanceRuntimeHooks struct {
@@ -57,6 +64,8 @@ type MaintenanceRuntimeHooks struct {
 	CloseDatabaseConnection   func() error
 	ReopenDatabaseAndServices func() error
 	ResumeRuntimeServices     func() error
+	// VerifyDatabase は復元前に展開したバックアップの DB を検査する。nil ならヘッダの確認だけ行う。
+	VerifyDatabase func(databasePath string) error
 }
 
 type MaintenanceService struct {
@@ -105,33 +114,29 @@ func (service *MaintenanceService) ExportGameData(ctx context.Context, outputDir
 		service.logger.Error("セッション取得に失敗しました", "error", err, "operation", "ExportGameData.listSessions")
 		return GameExportResult{}, newServiceError("セッション取得に失敗しました", err.Error())
 	}
+	gameStats, err := service.repository.ListGameStats(ctx)
+	if err != nil {
+		service.logger.Error("統計の取得に失敗しました", "error", err, "operation", "ExportGameData.listStats")
+		return GameExportResult{}, newServiceError("統計の取得に失敗しました", err.Error())
+	}
 
 	stats := make([]GameExportStatistic, 0, len(games))
 	sessionRows := make([]domain.PlaySession, 0, len(games)*2)
 	for _, game := range games {
-		sessions := sessionsByGame[game.ID]
-		sessionRows = append(sessionRows, sessions...)
+		sessionRows = append(sessionRows, sessionsByGame[game.ID]...)
 
-		var total int64
-		for _, session := range sessions {
-			total += session.Duration
-		}
+		stat := gameStats[game.ID]
 		average := float64(0)
-		if len(sessions) > 0 {
-			average = float64(total) / float64(len(sessions))
-		}
-		var lastSessionAt *time.Time
-		if len(sessions) > 0 {
-			last := sessions[0].PlayedAt
-			lastSessionAt = &last
+		if stat.SessionCount > 0 {
+			average = float64(stat.TotalDuration) / float64(stat.SessionCount)
 		}
 		stats = append(stats, GameExportStatistic{
 			GameID:                 game.ID,
 			Title:                  game.Title,
-			SessionCount:           len(sessions),
-			TotalSessionDuration:   total,
+			SessionCount:           int(stat.SessionCount),
+			TotalSessionDuration:   stat.TotalDuration,
 			AverageSessionDuration: average,
-			LastSessionAt:          lastSessionAt,
+			LastSessionAt:          stat.LastPlayedAt,
 		})
 	}
 
@@ -163,6 +168,20 @@ func (service *MaintenanceService) ExportGameData(ctx context.Context, outputDir
 	return GameExportResult{JSONPath: jsonPath, CSVPath: csvPath}, nil
 }
 
+// RebuildGameStats はプレイ統計の集計テーブルをセッションから作り直し、食い違っていた件数を返す。
+// 集計はトリガで差分更新されるため通常は 0 件になる。整合性の確認と、万一ずれた場合の修復に使う。
+func (service *MaintenanceService) RebuildGameStats(ctx context.Context) (int, error) {
+	corrected, err := service.repository.RebuildGameStats(ctx)
+	if err != nil {
+		service.logger.Error("統計の再集計に失敗しました", "error", err, "operation", "RebuildGameStats")
+		return 0, newServiceError("統計の再集計に失敗しました", err.Error())
+	}
+	if corrected > 0 {
+		service.logger.Warn("統計の食い違いを修正しました", "corrected", corrected)
+	}
+	return corrected, nil
+}
+
 func (service *MaintenanceService) CreateFullBackup(outputDir string) (string, error) {
 	trimmed := strings.TrimSpace(outputDir)
 	if trimmed == "" {
@@ -172,7 +191,29 @@ func (service *MaintenanceService) CreateFullBackup(outputDir string) (string, e
 		service.logger.Error("出力先フォルダの作成に失敗しました", "error", err, "operation", "CreateFullBackup.mkdir", "outputDir", trimmed)
 		return "", newServiceError("出力先フォルダの作成に失敗しました", err.Error())
 	}
+	return service.createBackup(trimmed, nil)
+}
+
+// CreateIncrementalBackup は baseBackupPath（フルまたは増分バックアップ）以降に内容が変わったファイルだけを格納した
+// 増分バックアップを baseBackupPath と同じフォルダに作成する。復元時はこのフォルダから基準のバックアップを辿る。
+func (service *MaintenanceService) CreateIncrementalBackup(baseBackupPath string) (string, error) {
+	trimmed := strings.TrimSpace(baseBackupPath)
+	if trimmed == "" {
+		return "", newServiceError("基準のバックアップファイルが不正です", "baseBackupPath is empty")
+	}
+	manifest, err := readArchiveManifest(trimmed)
+	if err != nil {
+		service.logger.Error("基準のバックアップの読み込みに失敗しました", "error", err, "operation", "CreateIncrementalBackup.readManifest", "path", trimmed)
+		return "", newServiceError("基準のバックアップの読み込みに失敗しました", err.Error())
+	}
+	if manifest.Files == nil {
+		return "", newServiceError("このバックアップは増分の基準にできません（フルバックアップを作成し直してください）", "base manifest has no file hashes")
+	}
+	return service.createBackup(filepath.Dir(trimmed), &backupChainLink{path: trimmed, manifest: manifest})
+}
 
+// createBackup は DB スナップショットを取得し、AppData と合わせて outputDir にバックアップ zip を書き出す。
+func (service *MaintenanceService) createBackup(outputDir string, base *backupChainLink) (string, error) {
 	appDataDir := strings.TrimSpace(service.config.AppDataDir)
 	if appDataDir == "" {
 		return "", newServiceError("バックアップ元ディレクトリが不正です", "AppDataDir is empty")
@@ -180,67 +221,68 @@ func (service *MaintenanceService) CreateFullBackup(outputDir string) (string, e
 
 	relDBPath, err := filepath.Rel(appDataDir, service.config.DatabasePath)
 	if err != nil {
-		service.logger.Error("DB相対パスの解決に失敗しました", "error", err, "operation", "CreateFullBackup.relDBPath")
+		service.logger.Error("DB相対パスの解決に失敗しました", "error", err, "operation", "CreateBackup.relDBPath")
 		return "", newServiceError("DB相対パスの解決に失敗しました", err.Error())
 	}
 	if strings.HasPrefix(relDBPath, "..") {
 		return "", newServiceError("バックアップ対象DBが不正です", "database path is outside AppDataDir")
 	}
 
-	stagingDir, err := os.MkdirTemp("", "cloudlaunch-backup-")
+	snapshotDir, err := os.MkdirTemp("", "cloudlaunch-backup-")
 	if err != nil {
-		service.logger.Error("バックアップ準備に失敗しました", "error", err, "operation", "CreateFullBackup.mktemp")
+		service.logger.Error("バックアップ準備に失敗しました", "error", err, "operation", "CreateBackup.mktemp")
 		return "", newServiceError("バックアップ準備に失敗しました", err.Error())
 	}
 	defer func() {
-		_ = os.RemoveAll(stagingDir)
+		_ = os.RemoveAll(snapshotDir)
 	}()
 
-	if err := service.populateBackupStaging(appDataDir, stagingDir, relDBPath); err != nil {
-		return "", err
-	}
-
-	return service.writeBackupArchive(trimmed, stagingDir, appDataDir, relDBPath)
-}
-
-// populateBackupStaging はステージングディレクトリへ AppData をコピーし、
-// DBスナップショットを取得して WAL/SHM の残骸を除去する。
-// stagingDir は呼び出し側が作成・後始末（defer RemoveAll）する前提。
-func (service *MaintenanceService) populateBackupStaging(appDataDir string, stagingDir string, relDBPath string) error {
-	if err := copyDirectoryTree(appDataDir, stagingDir); err != nil {
-		service.logger.Error("バックアップ準備に失敗しました", "error", err, "operation", "CreateFullBackup.copyAppData")
-		return newServiceError("バックアップ準備に失敗しました", err.Error())
-	}
-
-	snapshotPath := filepath.Join(stagingDir, relDBPath)
+	// AppData 全体はコピーせず ZIP へ直接流し込むため、一時領域に置くのは DB スナップショットだけ
+	snapshotPath := filepath.Join(snapshotDir, filepath.Base(relDBPath))
 	if service.hooks.CreateDatabaseSnapshot == nil {
-		return newServiceError("DBスナップショットの取得に失敗しました", "snapshot hook is nil")
+		return "", newServiceError("DBスナップショットの取得に失敗しました", "snapshot hook is nil")
 	}
 	if err := service.hooks.CreateDatabaseSnapshot(snapshotPath); err != nil {
-		service.logger.Error("DBスナップショットの取得に失敗しました", "error", err, "operation", "CreateFullBackup.snapshot")
-		return newServiceError("DBスナップショットの取得に失敗しました", err.Error())
+		service.logger.Error("DBスナップショットの取得に失敗しました", "error", err, "operation", "CreateBackup.snapshot")
+		return "", newServiceError("DBスナップショットの取得に失敗しました", err.Error())
 	}
 	_ = os.Remove(snapshotPath + "-wal")
 	_ = os.Remove(snapshotPath + "-shm")
-	return nil
+
+	return service.writeBackupArchive(outputDir, appDataDir, relDBPath, snapshotPath, base)
 }
 
-// writeBackupArchive はステージング内容からマニフェスト付き zip を生成し、出力先パスを返す。
-func (service *MaintenanceService) writeBackupArchive(outputDir string, stagingDir string, appDataDir string, relDBPath string) (string, error) {
-	stamp := time.Now().Format("20060102_150405")
-	backupPath := filepath.Join(outputDir, fmt.Sprintf("cloudlaunch_backup_%s.zip", stamp))
+// writeBackupArchive はマニフェスト付き zip を生成し、出力先パスを返す。
+// base が nil ならフルバックアップ、そうでなければ base 以降に変わったファイルだけを格納する増分バックアップ。
+func (service *MaintenanceService) writeBackupArchive(outputDir string, appDataDir string, relDBPath string, snapshotPath string, base *backupChainLink) (string, error) {
 	manifest := BackupManifest{
 		CreatedAt:             time.Now(),
 		AppDataDir:            appDataDir,
 		DatabaseRelativePath:  filepath.ToSlash(relDBPath),
 		CredentialNotice:      "OS credential store (Windows Credential Manager) is not included.",
 		CloudLaunchBackupType: BackupTypeV1,
-		BackupVersion:         1,
-	}
-	if err := writeBackupZip(stagingDir, backupPath, manifest); err != nil {
-		service.logger.Error("バックアップ作成に失敗しました", "error", err, "operation", "CreateFullBackup.writeZip", "path", backupPath)
+		BackupVersion:         currentBackupVersion,
+		BackupID:              newBackupID(),
+		Kind:                  BackupKindFull,
+	}
+	var previous *BackupManifest
+	suffix := ""
+	if base != nil {
+		previous = base.manifest
+		manifest.Kind = BackupKindIncremental
+		manifest.BaseBackup = filepath.Base(base.path)
+		manifest.BaseBackupID = base.manifest.BackupID
+		suffix = "_incr"
+	}
+	backupPath := nextBackupPath(outputDir, fmt.Sprintf("cloudlaunch_backup_%s%s", manifest.CreatedAt.Format("20060102_150405"), suffix))
+
+	stored, err := writeStreamingBackup(backupPath, appDataDir, relDBPath, snapshotPath, previous, &manifest)
+	if err != nil {
+		_ = os.Remove(backupPath)
+		service.logger.Error("バックアップ作成に失敗しました", "error", err, "operation", "CreateBackup.writeZip", "path", backupPath)
 		return "", newServiceError("バックアップ作成に失敗しました", err.Error())
 	}
+	service.logger.Info("バックアップを作成しました", "path", backupPath, "kind", manifest.Kind, "files", len(manifest.Files), "stored", stored)
 	return backupPath, nil
 }
 
@@ -257,7 +299,7 @@ func (service *MaintenanceService) RestoreFullBackup(backupPath string) error {
 		return newServiceError("バックアップファイルの確認に失敗しました", err.Error())
 	}
 
-	tmpDir, err := os.MkdirTemp("", "cloudlaunch-restore-")
+	tmpDir, err := siblingTempDir(service.config.AppDataDir, ".cloudlaunch-restore-")
 	if err != nil {
 		service.logger.Error("復元用一時ディレクトリの作成に失敗しました", "error", err, "operation", "RestoreFullBackup.mktemp")
 		return newServiceError("復元用一時ディレクトリの作成に失敗しました", err.Error())
@@ -266,7 +308,7 @@ func (service *MaintenanceService) RestoreFullBackup(backupPath string) error {
 		_ = os.RemoveAll(tmpDir)
 	}()
 
-	if err := UnzipToDirectory(trimmed, tmpDir); err != nil {
+	if err := extractBackup(trimmed, tmpDir); err != nil {
 		service.logger.Error("バックアップ展開に失敗しました", "error", err, "operation", "RestoreFullBackup.unzip", "path", trimmed)
 		return newServiceError("バックアップ展開に失敗しました", err.Error())
 	}
@@ -342,62 +384,6 @@ func formatTimePtr(value *time.Time) string {
 	return value.Format(time.RFC3339)
 }
 
-func writeBackupZip(sourceRoot string, outputPath string, manifest BackupManifest) error {
-	file, err := os.OpenFile(outputPath, os.O_CREATE|os.O_TRUNC|os.O_WRONLY, 0o600)
-	if err != nil {
-		return err
-	}
-	defer func() {
-		_ = file.Close()
-	}()
-
-	zipWriter := zip.NewWriter(file)
-	defer func() {
-		_ = zipWriter.Close()
-	}()
-
-	manifestBytes, err := json.MarshalIndent(manifest, "", "  ")
-	if err != nil {
-		return err
-	}
-	if err := writeZipBytes(zipWriter, "_manifest.json", manifestBytes); err != nil {
-		return err
-	}
-
-	return filepath.WalkDir(sourceRoot, func(path string, d os.DirEntry, walkErr error) error {
-		if walkErr != nil {
-			return walkErr
-		}
-		if d.IsDir() {
-			return nil
-		}
-		relPath, err := filepath.Rel(sourceRoot, path)
-		if err != nil {
-			return err
-		}
-		name := filepath.ToSlash(relPath)
-		if name == "" || name == "_manifest.json" || strings.HasPrefix(name, "../") {
-			return nil
-		}
-		info, err := d.Info()
-		if err != nil {
-			return err
-		}
-		header, err := zip.FileInfoHeader(info)
-		if err != nil {
-			return err
-		}
-		header.Name = name
-		header.Method = zip.Deflate
-
-		dest, err := zipWriter.CreateHeader(header)
-		if err != nil {
-			return err
-		}
-		return copyFileContent(path, dest)
-	})
-}
-
 func writeZipBytes(writer *zip.Writer, name string, payload []byte) error {
 	dest, err := writer.Create(name)
 	if err != nil {
@@ -415,52 +401,11 @@ func UnzipToDirectory(zipPath string, destRoot string) error {
 	defer func() {
 		_ = reader.Close()
 	}()
-
-	for _, file := range reader.File {
-		cleanName := filepath.Clean(file.Name)
-		if cleanName == "." || cleanName == "" {
-			continue
-		}
-		destPath := filepath.Join(destRoot, cleanName)
-		if !strings.HasPrefix(destPath, filepath.Clean(destRoot)+string(os.PathSeparator)) {
-			return errors.New("invalid backup archive path")
-		}
-
-		if file.FileInfo().IsDir() {
-			if err := os.MkdirAll(destPath, 0o700); err != nil {
-				return err
-			}
-			continue
-		}
-
-		if err := os.MkdirAll(filepath.Dir(destPath), 0o700); err != nil {
-			return err
-		}
-
-		src, err := file.Open()
-		if err != nil {
-			return err
-		}
-
-		dst, err := os.OpenFile(destPath, os.O_CREATE|os.O_TRUNC|os.O_WRONLY, 0o600)
-		if err != nil {
-			_ = src.Close()
-			return err
-		}
-
-		if _, err := io.Copy(dst, src); err != nil {
-			_ = dst.Close()
-			_ = src.Close()
-			return err
-		}
-		_ = dst.Close()
-		_ = src.Close()
-	}
-	return nil
+	return extractZipFiles(reader.File, destRoot)
 }
 
 func ReadBackupManifest(extractedRoot string) (*BackupManifest, error) {
-	manifestPath := filepath.Join(extractedRoot, "_manifest.json")
+	manifestPath := filepath.Join(extractedRoot, backupManifestName)
 	data, err := os.ReadFile(manifestPath)
 	if err != nil {
 		if os.IsNotExist(err) {
@@ -468,6 +413,11 @@ func ReadBackupManifest(extractedRoot string) (*BackupManifest, error) {
 		}
 		return nil, err
 	}
+	return parseBackupManifest(data)
+}
+
+// parseBackupManifest はマニフェストの JSON を読み、対応している形式かを検証する。
+func parseBackupManifest(data []byte) (*BackupManifest, error) {
 	var manifest BackupManifest
 	if err := json.Unmarshal(data, &manifest); err != nil {
 		return nil, err
@@ -475,7 +425,7 @@ func ReadBackupManifest(extractedRoot string) (*BackupManifest, error) {
 	if manifest.CloudLaunchBackupType != BackupTypeV1 {
 		return nil, errors.New("unsupported backup type")
 	}
-	if manifest.BackupVersion != 0 && manifest.BackupVersion != 1 {
+	if manifest.BackupVersion < 0 || manifest.BackupVersion > currentBackupVersion {
 		return nil, errors.New("unsupported backup version")
 	}
 	if strings.TrimSpace(manifest.DatabaseRelativePath) == "" {
@@ -495,9 +445,17 @@ func sanitizeRelativePath(pathValue string) (string, error) {
 	return cleaned, nil
 }
 
-// validateExtractedBackup は展開済みバックアップのマニフェストと
-// DB ファイルの存在を検証する（副作用なし）。
-func validateExtractedBackup(extractedRoot string) error {
+// restoreKeptEntries は復元で入れ替えない AppData 直下のエントリ。logs はロガー（internal/logging）が開いたまま書き続けるため、
+// 入れ替えると Windows では rename に失敗して毎回コピーでの復元になり、他の OS では退避先ごと消えるファイルに書き続けてしまう。
+var restoreKeptEntries = map[string]bool{"logs": true}
+
+// sqliteHeader は SQLite データベースファイルの先頭16バイト。
+const sqliteHeader = "SQLite format 3\x00"
+
+// validateExtractedBackup は展開済みバックアップのマニフェストと DB ファイルを検証する（副作用なし）。
+// DB は先頭が SQLite のヘッダであることを確かめ、VerifyDatabase フックがあれば整合性チェックも行う。
+// ランタイム停止より前に呼び、壊れたバックアップで現在のデータを止めたり置き換えたりしないようにする。
+func (service *MaintenanceService) validateExtractedBackup(extractedRoot string) error {
 	manifest, err := ReadBackupManifest(extractedRoot)
 	if err != nil {
 		return err
@@ -507,26 +465,40 @@ func validateExtractedBackup(extractedRoot string) error {
 		return err
 	}
 	backupDBPath := filepath.Join(extractedRoot, relDBPath)
-	if _, err := os.Stat(backupDBPath); err != nil {
+	file, err := os.Open(backupDBPath)
+	if err != nil {
 		if os.IsNotExist(err) {
 			return errors.New("backup database not found")
 		}
 		return err
 	}
-	return nil
+	header := make([]byte, len(sqliteHeader))
+	_, readErr := io.ReadFull(file, header)
+	_ = file.Close()
+	if readErr != nil || string(header) != sqliteHeader {
+		return errors.New("backup database is not a SQLite database")
+	}
+	if service.hooks.VerifyDatabase == nil {
+		return nil
+	}
+	return service.hooks.VerifyDatabase(backupDBPath)
 }
 
-func (service *MaintenanceService) restoreAppDataFrom(extractedRoot string) (restoreErr error) {
+// restoreAppDataFrom は検証済みのバックアップで AppData を置き換え、DB を開き直してランタイムを再開する。
+// extractedRoot は siblingTempDir で AppData と同じ親に作ってある前提で、中身の入れ替えは rename で行う。
+// ランタイムを止めている間の処理がファイル量によらずエントリの rename だけになるため、停止時間は大きな AppData でも短い。
+// rename できない場合（別ボリューム・開いたままのファイル）はコピーで置き換える。restoreKeptEntries はどちらでも残す。
+func (service *MaintenanceService) restoreAppDataFrom(extractedRoot string) error {
 	appDataDir := strings.TrimSpace(service.config.AppDataDir)
 	if appDataDir == "" {
 		return errors.New("appDataDir is empty")
 	}
 
-	if err := validateExtractedBackup(extractedRoot); err != nil {
+	if err := service.validateExtractedBackup(extractedRoot); err != nil {
 		return err
 	}
 
-	rollbackDir, err := os.MkdirTemp("", "cloudlaunch-rollback-")
+	rollbackDir, err := siblingTempDir(appDataDir, ".cloudlaunch-rollback-")
 	if err != nil {
 		return err
 	}
@@ -534,11 +506,6 @@ func (service *MaintenanceService) restoreAppDataFrom(extractedRoot string) (res
 		_ = os.RemoveAll(rollbackDir)
 	}()
 
-	hasCurrentData, err := service.snapshotCurrentAppDataForRollback(appDataDir, rollbackDir)
-	if err != nil {
-		return err
-	}
-
 	if service.hooks.StopRuntimeServices != nil {
 		service.hooks.StopRuntimeServices()
 	}
@@ -548,11 +515,35 @@ func (service *MaintenanceService) restoreAppDataFrom(extractedRoot string) (res
 		}
 	}
 
+	if err := swapDirectoryEntries(appDataDir, extractedRoot, rollbackDir, restoreKeptEntries); err != nil {
+		service.logger.Warn("AppData を rename で入れ替えられないためコピーで復元します", "error", err, "operation", "RestoreFullBackup.swap")
+		return service.restoreAppDataByCopy(extractedRoot, appDataDir, rollbackDir)
+	}
+	if err := service.reopenAndResume(); err != nil {
+		if recoverErr := service.recoverAppDataFromRollback(rollbackDir, appDataDir); recoverErr != nil {
+			return fmt.Errorf("%w (rollback failed: %v)", err, recoverErr)
+		}
+		return err
+	}
+	return nil
+}
+
+// restoreAppDataByCopy は rename で入れ替えられない場合の復元。
+// DB を閉じた後なので、現在の AppData をそのままコピーすればロールバック用の整合した控えになる。
+func (service *MaintenanceService) restoreAppDataByCopy(extractedRoot string, appDataDir string, rollbackDir string) (restoreErr error) {
+	if err := copyDirectoryTree(appDataDir, rollbackDir, restoreKeptEntries); err != nil {
+		// AppData はまだ変更していないため、開き直すだけでよい
+		if resumeErr := service.reopenAndResume(); resumeErr != nil {
+			return fmt.Errorf("%w (reopen failed: %v)", err, resumeErr)
+		}
+		return err
+	}
+
 	defer func() {
 		if restoreErr == nil {
 			return
 		}
-		recoverErr := service.recoverAppDataFromRollback(rollbackDir, appDataDir, hasCurrentData)
+		recoverErr := service.recoverAppDataFromRollback(rollbackDir, appDataDir)
 		if recoverErr != nil {
 			restoreErr = fmt.Errorf("%w (rollback failed: %v)", restoreErr, recoverErr)
 		}
@@ -561,22 +552,6 @@ func (service *MaintenanceService) restoreAppDataFrom(extractedRoot string) (res
 	return service.applyRestoredAppData(extractedRoot, appDataDir)
 }
 
-// snapshotCurrentAppDataForRollback は現状の AppData をロールバック用に退避し、
-// 退避対象が存在したか（hasCurrentData）を返す。
-// ランタイム停止・DBクローズの前に呼ばれる前提で、副作用はファイルコピーのみ。
-func (service *MaintenanceService) snapshotCurrentAppDataForRollback(appDataDir string, rollbackDir string) (bool, error) {
-	hasCurrentData, err := directoryHasAnyEntry(appDataDir)
-	if err != nil {
-		return false, err
-	}
-	if hasCurrentData {
-		if err := copyDirectoryTree(appDataDir, rollbackDir); err != nil {
-			return false, err
-		}
-	}
-	return hasCurrentData, nil
-}
-
 // reopenAndResume は DB再オープン・ランタイム再開フックを順に呼ぶ。
 // ReopenDatabaseAndServices が未設定なら異常としてエラー、
 // ResumeRuntimeServices が未設定なら正常終了とみなす。
@@ -597,27 +572,100 @@ func (service *MaintenanceService) reopenAndResume() error {
 // DB再オープン・ランタイム再開フックを順に呼ぶ。
 // 失敗時は呼び出し側に登録済みのロールバック defer が発火する前提。
 func (service *MaintenanceService) applyRestoredAppData(extractedRoot string, appDataDir string) error {
-	if err := clearDirectory(appDataDir); err != nil {
+	if err := clearDirectory(appDataDir, restoreKeptEntries); err != nil {
 		return err
 	}
-	if err := copyDirectoryTree(extractedRoot, appDataDir); err != nil {
+	if err := copyDirectoryTree(extractedRoot, appDataDir, restoreKeptEntries); err != nil {
 		return err
 	}
 	return service.reopenAndResume()
 }
 
-func directoryHasAnyEntry(path string) (bool, error) {
-	entries, err := os.ReadDir(path)
+// siblingTempDir は dir と同じ親フォルダに一時ディレクトリを作る。同じボリュームに置けば dir との入れ替えを rename で済ませられる。
+// 親に作れない場合は OS の一時フォルダに作る（その場合の入れ替えはコピーになる）。
+func siblingTempDir(dir string, pattern string) (string, error) {
+	if trimmed := strings.TrimSpace(dir); trimmed != "" {
+		if created, err := os.MkdirTemp(filepath.Dir(filepath.Clean(trimmed)), pattern); err == nil {
+			return created, nil
+		}
+	}
+	return os.MkdirTemp("", pattern)
+}
+
+// swapDirectoryEntries は targetDir 直下の各エントリを asideDir へ、replacementDir 直下の各エントリを targetDir へ rename で移す。
+// kept に含まれる名前はどちら側でも動かさない。途中で失敗した場合は移した分を戻し、targetDir を元の状態にしてからエラーを返す。
+func swapDirectoryEntries(targetDir string, replacementDir string, asideDir string, kept map[string]bool) error {
+	if err := os.MkdirAll(targetDir, 0o700); err != nil {
+		return err
+	}
+	movedOut, err := renameDirectoryEntries(targetDir, asideDir, kept)
+	if err != nil {
+		undoRenames(movedOut, asideDir, targetDir)
+		return err
+	}
+	movedIn, err := renameDirectoryEntries(replacementDir, targetDir, kept)
+	if err != nil {
+		undoRenames(movedIn, targetDir, replacementDir)
+		undoRenames(movedOut, asideDir, targetDir)
+		return err
+	}
+	return nil
+}
+
+// renameDirectoryEntries は sourceDir 直下の各エントリ（kept を除く）を destDir へ rename し、移せたエントリ名を返す。
+func renameDirectoryEntries(sourceDir string, destDir string, kept map[string]bool) ([]string, error) {
+	entries, err := os.ReadDir(sourceDir)
+	if err != nil {
+		return nil, err
+	}
+	moved := make([]string, 0, len(entries))
+	for _, entry := range entries {
+		if kept[entry.Name()] {
+			continue
+		}
+		if err := os.Rename(filepath.Join(sourceDir, entry.Name()), filepath.Join(destDir, entry.Name())); err != nil {
+			return moved, err
+		}
+		moved = append(moved, entry.Name())
+	}
+	return moved, nil
+}
+
+func undoRenames(names []string, fromDir string, toDir string) {
+	for _, name := range names {
+		_ = os.Rename(filepath.Join(fromDir, name), filepath.Join(toDir, name))
+	}
+}
+
+// moveDirectoryEntries は sourceDir 直下の各エントリを destDir へ移す。rename できないエントリはコピーする。
+func moveDirectoryEntries(sourceDir string, destDir string) error {
+	entries, err := os.ReadDir(sourceDir)
 	if err != nil {
 		if os.IsNotExist(err) {
-			return false, nil
+			return nil
 		}
-		return false, err
+		return err
 	}
-	return len(entries) > 0, nil
+	for _, entry := range entries {
+		sourcePath := filepath.Join(sourceDir, entry.Name())
+		destPath := filepath.Join(destDir, entry.Name())
+		if err := os.Rename(sourcePath, destPath); err == nil {
+			continue
+		}
+		if entry.IsDir() {
+			err = copyDirectoryTree(sourcePath, destPath, nil)
+		} else {
+			err = CopyFilePath(sourcePath, destPath)
+		}
+		if err != nil {
+			return err
+		}
+	}
+	return nil
 }
 
-func clearDirectory(path string) error {
+// clearDirectory は path 直下のエントリを kept を除いて削除する。
+func clearDirectory(path string, kept map[string]bool) error {
 	if err := os.MkdirAll(path, 0o700); err != nil {
 		return err
 	}
@@ -629,6 +677,9 @@ func clearDirectory(path string) error {
 		return err
 	}
 	for _, entry := range entries {
+		if kept[entry.Name()] {
+			continue
+		}
 		if err := os.RemoveAll(filepath.Join(path, entry.Name())); err != nil {
 			return err
 		}
@@ -636,7 +687,8 @@ func clearDirectory(path string) error {
 	return nil
 }
 
-func copyDirectoryTree(sourceRoot string, destRoot string) error {
+// copyDirectoryTree は sourceRoot 以下を destRoot にコピーする。kept に含まれる sourceRoot 直下の名前は写さない。
+func copyDirectoryTree(sourceRoot string, destRoot string, kept map[string]bool) error {
 	if err := os.MkdirAll(destRoot, 0o700); err != nil {
 		return err
 	}
@@ -651,6 +703,12 @@ func copyDirectoryTree(sourceRoot string, destRoot string) error {
 		if relPath == "." {
 			return nil
 		}
+		if kept[relPath] {
+			if d.IsDir() {
+				return filepath.SkipDir
+			}
+			return nil
+		}
 		destPath := filepath.Join(destRoot, relPath)
 		if d.IsDir() {
 			return os.MkdirAll(destPath, 0o700)
@@ -697,14 +755,19 @@ func CopyFilePath(sourcePath string, destPath string) error {
 	return dest.Close()
 }
 
-func (service *MaintenanceService) recoverAppDataFromRollback(rollbackDir string, appDataDir string, hasRollback bool) error {
-	if err := clearDirectory(appDataDir); err != nil {
+// recoverAppDataFromRollback は AppData を退避しておいた rollbackDir の内容に戻し、DB を開き直してランタイムを再開する。
+func (service *MaintenanceService) recoverAppDataFromRollback(rollbackDir string, appDataDir string) error {
+	// 再オープンまで進んでいた場合は復元した DB を開いたままなので、消す前に閉じる
+	if service.hooks.CloseDatabaseConnection != nil {
+		if err := service.hooks.CloseDatabaseConnection(); err != nil {
+			service.logger.Warn("ロールバック前のDBクローズに失敗しました", "error", err, "operation", "RestoreFullBackup.rollbackClose")
+		}
+	}
+	if err := clearDirectory(appDataDir, restoreKeptEntries); err != nil {
 		return err
 	}
-	if hasRollback {
-		if err := copyDirectoryTree(rollbackDir, appDataDir); err != nil {
-			return err
-		}
+	if err := moveDirectoryEntries(rollbackDir, appDataDir); err != nil {
+		return err
 	}
 	return service.reopenAndResume()
 }
@@ -5,6 +5,7 @@ import (
 	"context"
 	"encoding/csv"
 	"encoding/json"
+	"errors"
 	"io"
 	"log/slog"
 	"os"
@@ -21,6 +22,9 @@ type maintenanceTestRuntime struct {
 	cfg        config.Config
 	repository *db.Repository
 	service    *MaintenanceService
+	// stopCalls は StopRuntimeServices が呼ばれた回数、failNextResume は次の ResumeRuntimeServices が1回だけ返すエラー。
+	stopCalls      int
+	failNextResume error
 }
 
 func TestMaintenanceServiceExportGameDataWritesArtifacts(t *testing.T) {
@@ -171,6 +175,172 @@ func TestMaintenanceServiceRestoreFullBackupReplacesAppData(t *testing.T) {
 	}
 }
 
+// TestMaintenanceServiceIncrementalBackupRestoresChain は、増分バックアップが変わったファイルだけを格納し、
+// 復元時に基準のフルバックアップと増分を辿って最新の状態（削除したファイルは無い状態）に戻せることを確認する。
+func TestMaintenanceServiceIncrementalBackupRestoresChain(t *testing.T) {
+	t.Parallel()
+
+	source := newMaintenanceServiceRuntime(t)
+	game, _ := seedMaintenanceFixture(t, source.repository)
+	notesDir := filepath.Join(source.cfg.AppDataDir, "notes")
+	writeMaintenanceFile(t, filepath.Join(notesDir, "changed.txt"), "v1")
+	writeMaintenanceFile(t, filepath.Join(notesDir, "same.txt"), "unchanged")
+	writeMaintenanceFile(t, filepath.Join(notesDir, "removed.txt"), "remove me")
+
+	outputDir := t.TempDir()
+	fullBackup, err := source.service.CreateFullBackup(outputDir)
+	if err != nil {
+		t.Fatalf("CreateFullBackup failed: %v", err)
+	}
+
+	writeMaintenanceFile(t, filepath.Join(notesDir, "changed.txt"), "v2 (edited)")
+	if err := os.Remove(filepath.Join(notesDir, "removed.txt")); err != nil {
+		t.Fatalf("failed to remove file: %v", err)
+	}
+	firstIncrement, err := source.service.CreateIncrementalBackup(fullBackup)
+	if err != nil {
+		t.Fatalf("CreateIncrementalBackup failed: %v", err)
+	}
+	writeMaintenanceFile(t, filepath.Join(notesDir, "added.txt"), "new file")
+	secondIncrement, err := source.service.CreateIncrementalBackup(firstIncrement)
+	if err != nil {
+		t.Fatalf("second CreateIncrementalBackup failed: %v", err)
+	}
+	if filepath.Dir(secondIncrement) != outputDir {
+		t.Fatalf("expected increment next to its base, got %q", secondIncrement)
+	}
+
+	stored := listZipEntries(t, firstIncrement)
+	if !stored["notes/changed.txt"] || stored["notes/same.txt"] || stored["notes/removed.txt"] {
+		t.Fatalf("unexpected entries in incremental backup: %v", stored)
+	}
+	stored = listZipEntries(t, secondIncrement)
+	if !stored["notes/added.txt"] || stored["notes/changed.txt"] {
+		t.Fatalf("unexpected entries in second incremental backup: %v", stored)
+	}
+
+	target := newMaintenanceServiceRuntime(t)
+	writeMaintenanceFile(t, filepath.Join(target.cfg.AppDataDir, "obsolete.txt"), "remove me")
+	if err := target.service.RestoreFullBackup(secondIncrement); err != nil {
+		t.Fatalf("RestoreFullBackup from increment failed: %v", err)
+	}
+
+	targetNotes := filepath.Join(target.cfg.AppDataDir, "notes")
+	assertMaintenanceFileContent(t, filepath.Join(targetNotes, "changed.txt"), "v2 (edited)")
+	assertMaintenanceFileContent(t, filepath.Join(targetNotes, "same.txt"), "unchanged")
+	assertMaintenanceFileContent(t, filepath.Join(targetNotes, "added.txt"), "new file")
+	for _, gone := range []string{filepath.Join(targetNotes, "removed.txt"), filepath.Join(target.cfg.AppDataDir, "obsolete.txt")} {
+		if _, err := os.Stat(gone); !os.IsNotExist(err) {
+			t.Fatalf("expected %s to be absent after restore, stat err=%v", gone, err)
+		}
+	}
+
+	connection, err := db.Open(target.cfg.DatabasePath)
+	if err != nil {
+		t.Fatalf("failed to reopen restored db: %v", err)
+	}
+	defer func() {
+		_ = connection.Close()
+	}()
+	games, err := db.NewRepository(connection).ListGames(context.Background(), "", domain.PlayStatus(""), "title", "asc")
+	if err != nil {
+		t.Fatalf("failed to list restored games: %v", err)
+	}
+	if len(games) != 1 || games[0].ID != game.ID {
+		t.Fatalf("unexpected restored games: %#v", games)
+	}
+
+	if err := os.Remove(fullBackup); err != nil {
+		t.Fatalf("failed to remove base backup: %v", err)
+	}
+	if err := target.service.RestoreFullBackup(secondIncrement); err == nil {
+		t.Fatal("expected restore to fail without its base backup")
+	}
+}
+
+// TestMaintenanceServiceRestoreFullBackupRollsBackWhenResumeFails は、入れ替え後にランタイムの再開が失敗したら
+// 退避しておいた AppData に戻して開き直すことを確認する。
+func TestMaintenanceServiceRestoreFullBackupRollsBackWhenResumeFails(t *testing.T) {
+	t.Parallel()
+
+	source := newMaintenanceServiceRuntime(t)
+	seedMaintenanceFixture(t, source.repository)
+	writeMaintenanceFile(t, filepath.Join(source.cfg.AppDataDir, "screenshots", "latest.txt"), "from backup")
+	backupResult, err := source.service.CreateFullBackup(t.TempDir())
+	if err != nil {
+		t.Fatalf("CreateFullBackup failed: %v", err)
+	}
+
+	target := newMaintenanceServiceRuntime(t)
+	writeMaintenanceFile(t, filepath.Join(target.cfg.AppDataDir, "keep.txt"), "current")
+	current := createMaintenanceGame(t, target.repository, domain.Game{
+		Title:      "Current Game",
+		Publisher:  "Local",
+		ExePath:    "/games/current.exe",
+		PlayStatus: domain.PlayStatusUnplayed,
+	})
+	target.failNextResume = errors.New("resume failed")
+
+	if err := target.service.RestoreFullBackup(backupResult); err == nil {
+		t.Fatal("expected restore to fail when resume fails")
+	}
+
+	assertMaintenanceFileContent(t, filepath.Join(target.cfg.AppDataDir, "keep.txt"), "current")
+	if _, err := os.Stat(filepath.Join(target.cfg.AppDataDir, "screenshots")); !os.IsNotExist(err) {
+		t.Fatalf("expected restored files to be rolled back, stat err=%v", err)
+	}
+	games, err := target.repository.ListGames(context.Background(), "", domain.PlayStatus(""), "title", "asc")
+	if err != nil {
+		t.Fatalf("failed to list games after rollback: %v", err)
+	}
+	if len(games) != 1 || games[0].ID != current.ID {
+		t.Fatalf("unexpected games after rollback: %#v", games)
+	}
+}
+
+// TestMaintenanceServiceRestoreFullBackupRejectsBrokenDatabaseBeforeStopping は、バックアップの DB が
+// SQLite として開けなければランタイムを止める前に失敗し、AppData に触れないことを確認する。
+func TestMaintenanceServiceRestoreFullBackupRejectsBrokenDatabaseBeforeStopping(t *testing.T) {
+	t.Parallel()
+
+	zipPath := filepath.Join(t.TempDir(), "broken.zip")
+	file, err := os.Create(zipPath)
+	if err != nil {
+		t.Fatalf("failed to create zip file: %v", err)
+	}
+	writer := zip.NewWriter(file)
+	manifest, err := json.Marshal(BackupManifest{
+		CloudLaunchBackupType: BackupTypeV1,
+		BackupVersion:         1,
+		DatabaseRelativePath:  "app.db",
+	})
+	if err != nil {
+		t.Fatalf("failed to marshal manifest: %v", err)
+	}
+	if err := writeZipBytes(writer, "_manifest.json", manifest); err != nil {
+		t.Fatalf("failed to write manifest: %v", err)
+	}
+	if err := writeZipBytes(writer, "app.db", []byte("not a database")); err != nil {
+		t.Fatalf("failed to write database entry: %v", err)
+	}
+	if err := writer.Close(); err != nil {
+		t.Fatalf("failed to close zip writer: %v", err)
+	}
+	if err := file.Close(); err != nil {
+		t.Fatalf("failed to close zip file: %v", err)
+	}
+
+	target := newMaintenanceServiceRuntime(t)
+	writeMaintenanceFile(t, filepath.Join(target.cfg.AppDataDir, "keep.txt"), "current")
+	if err := target.service.RestoreFullBackup(zipPath); err == nil {
+		t.Fatal("expected broken database to be rejected")
+	}
+	if target.stopCalls != 0 {
+		t.Fatalf("expected runtime services to keep running, stop called %d times", target.stopCalls)
+	}
+	assertMaintenanceFileContent(t, filepath.Join(target.cfg.AppDataDir, "keep.txt"), "current")
+}
+
 func TestUnzipToDirectoryRejectsPathTraversalArchive(t *testing.T) {
 	t.Parallel()
 
@@ -248,9 +418,11 @@ func newMaintenanceServiceRuntime(t *testing.T) *maintenanceTestRuntime {
 
 	runtime.service = NewMaintenanceService(cfg, repository, logger, MaintenanceRuntimeHooks{
 		CreateDatabaseSnapshot: func(destinationPath string) error {
-			return CopyFilePath(databasePath, destinationPath)
+			return db.Snapshot(connection, destinationPath)
+		},
+		StopRuntimeServices: func() {
+			runtime.stopCalls++
 		},
-		StopRuntimeServices: func() {},
 		CloseDatabaseConnection: func() error {
 			return connection.Close()
 		},
@@ -268,7 +440,12 @@ func newMaintenanceServiceRuntime(t *testing.T) *maintenanceTestRuntime {
 			runtime.service.repository = runtime.repository
 			return nil
 		},
-		ResumeRuntimeServices: func() error { return nil },
+		ResumeRuntimeServices: func() error {
+			err := runtime.failNextResume
+			runtime.failNextResume = nil
+			return err
+		},
+		VerifyDatabase: db.Verify,
 	})
 
 	t.Cleanup(func() {
@@ -338,6 +515,23 @@ func writeMaintenanceFile(t *testing.T, path string, content string) {
 	}
 }
 
+func listZipEntries(t *testing.T, zipPath string) map[string]bool {
+	t.Helper()
+
+	reader, err := zip.OpenReader(zipPath)
+	if err != nil {
+		t.Fatalf("failed to open zip: %v", err)
+	}
+	defer func() {
+		_ = reader.Close()
+	}()
+	entries := make(map[string]bool, len(reader.File))
+	for _, file := range reader.File {
+		entries[file.Name] = true
+	}
+	return entries
+}
+
 func assertMaintenanceFileContent(t *testing.T, path string, want string) {
 	t.Helper()
 
@@ -349,3 +543,41 @@ func assertMaintenanceFileContent(t *testing.T, path string, want string) {
 		t.Fatalf("expected %q, got %q", want, string(data))
 	}
 }
+
+// TestMaintenanceServiceRestoreFullBackupKeepsOpenLogs は、ロガーが開いたままの AppData/logs を復元で動かさず、
+// 復元の前後に書いたログが同じファイルに残ることを確認する。
+func TestMaintenanceServiceRestoreFullBackupKeepsOpenLogs(t *testing.T) {
+	t.Parallel()
+
+	source := newMaintenanceServiceRuntime(t)
+	seedMaintenanceFixture(t, source.repository)
+	writeMaintenanceFile(t, filepath.Join(source.cfg.AppDataDir, "logs", "app.log"), "from backup\n")
+	backupResult, err := source.service.CreateFullBackup(t.TempDir())
+	if err != nil {
+		t.Fatalf("CreateFullBackup failed: %v", err)
+	}
+
+	target := newMaintenanceServiceRuntime(t)
+	logPath := filepath.Join(target.cfg.AppDataDir, "logs", "app.log")
+	if err := os.MkdirAll(filepath.Dir(logPath), 0o700); err != nil {
+		t.Fatal(err)
+	}
+	logFile, err := os.OpenFile(logPath, os.O_CREATE|os.O_WRONLY|os.O_APPEND, 0o600)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer func() {
+		_ = logFile.Close()
+	}()
+	if _, err := logFile.WriteString("before restore\n"); err != nil {
+		t.Fatal(err)
+	}
+
+	if err := target.service.RestoreFullBackup(backupResult); err != nil {
+		t.Fatalf("RestoreFullBackup failed: %v", err)
+	}
+	if _, err := logFile.WriteString("after restore\n"); err != nil {
+		t.Fatal(err)
+	}
+	assertMaintenanceFileContent(t, logPath, "before restore\nafter restore\n")
+}
@@ -8,6 +8,7 @@ import (
 	"log/slog"
 	"path"
 	"strings"
+	"sync"
 	"time"
 
 	"CloudLaunch_Go/internal/config"
@@ -25,8 +26,13 @@ type CloudMemoInfo struct {
 	MemoID       string    `json:"memoId"`
 	LastModified time.Time `json:"lastModified"`
 	Size         int64     `json:"size"`
+	// ETag は同期時に控えと比べるためだけに使い、フロントエンドには渡さない。
+	ETag string `json:"-"`
 }
 
+// memoListConcurrency は全ゲームのメモを列挙するときに同時に発行する LIST リクエスト数。
+const memoListConcurrency = 8
+
 type MemoSyncResult struct {
 	Success          bool     `json:"success"`
 	Uploaded         int      `json:"uploaded"`
@@ -45,7 +51,9 @@ type MemoCloudService struct {
 	objectStore cloudObjectStore
 	gameService *GameService
 	memoService *MemoService
-	logger      *slog.Logger
+	// stateRepository はクラウド同期状態の控え。nil なら控えを使わず、比較のたびにダウンロードする。
+	stateRepository MemoCloudStateRepository
+	logger          *slog.Logger
 }
 
 func NewMemoCloudService(
@@ -53,15 +61,17 @@ func NewMemoCloudService(
 	store credentials.Store,
 	gameService *GameService,
 	memoService *MemoService,
+	stateRepository MemoCloudStateRepository,
 	logger *slog.Logger,
 ) *MemoCloudService {
 	return &MemoCloudService{
-		config:      cfg,
-		store:       store,
-		objectStore: storageCloudObjectStore{},
-		gameService: gameService,
-		memoService: memoService,
-		logger:      logger,
+		config:          cfg,
+		store:           store,
+		objectStore:     storageCloudObjectStore{concurrency: cfg.S3UploadConcurrency},
+		gameService:     gameService,
+		memoService:     memoService,
+		stateRepository: stateRepository,
+		logger:          logger,
 	}
 }
 
@@ -78,31 +88,64 @@ func (service *MemoCloudService) GetCloudMemos(ctx context.Context) ([]CloudMemo
 	if err != nil {
 		return nil, err
 	}
-	objects, err := service.objectStore.ListObjects(ctx, cfg, credential, "games/")
-	if err != nil {
-		service.logger.Error("クラウドメモ取得に失敗しました", "error", err, "operation", "GetCloudMemos.listObjects", "bucket", cfg.Bucket)
-		return nil, newServiceError("クラウドメモ取得に失敗しました", err.Error())
+	return service.listCloudMemos(ctx, cfg, credential, "")
+}
+
+// listCloudMemos は gameID（空なら全ゲーム）のクラウドメモを、ゲームごとのメモプレフィックスだけ列挙して返す。
+// games/ 全体を列挙するとセーブの objects / trees / commits まで全ページ読むことになるため、
+// 全ゲーム分は区切り文字付きの一覧でゲーム ID だけを得てから、各ゲームの memo/ を並行に列挙する。
+func (service *MemoCloudService) listCloudMemos(ctx context.Context, cfg storage.S3Config, credential credentials.Credential, gameID string) ([]CloudMemoInfo, error) {
+	gameIDs := []string{strings.TrimSpace(gameID)}
+	if gameIDs[0] == "" {
+		ids, err := service.objectStore.ListChildPrefixes(ctx, cfg, credential, "games/")
+		if err != nil {
+			service.logger.Error("クラウドメモ取得に失敗しました", "error", err, "operation", "GetCloudMemos.listGames", "bucket", cfg.Bucket)
+			return nil, newServiceError("クラウドメモ取得に失敗しました", err.Error())
+		}
+		gameIDs = ids
 	}
 
+	perGame := make([][]storage.ObjectInfo, len(gameIDs))
+	errs := make([]error, len(gameIDs))
+	slots := make(chan struct{}, memoListConcurrency)
+	var wg sync.WaitGroup
+	for i, id := range gameIDs {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			slots <- struct{}{}
+			defer func() { <-slots }()
+			perGame[i], errs[i] = service.objectStore.ListObjects(ctx, cfg, credential, memo.BuildMemoPrefix(id))
+		}()
+	}
+	wg.Wait()
+
 	memos := make([]CloudMemoInfo, 0)
-	for _, obj := range objects {
-		if !memo.IsMemoPath(obj.Key) {
-			continue
+	for i, objects := range perGame {
+		if errs[i] != nil {
+			service.logger.Error("クラウドメモ取得に失敗しました", "error", errs[i], "operation", "GetCloudMemos.listObjects", "bucket", cfg.Bucket, "gameId", gameIDs[i])
+			return nil, newServiceError("クラウドメモ取得に失敗しました", errs[i].Error())
 		}
-		gameID, memoTitle, memoID, ok := memo.ExtractMemoInfo(obj.Key)
-		if !ok {
-			continue
+		for _, obj := range objects {
+			if !memo.IsMemoPath(obj.Key) {
+				continue
+			}
+			gameID, memoTitle, memoID, ok := memo.ExtractMemoInfo(obj.Key)
+			if !ok {
+				continue
+			}
+			fileName := obj.Key[strings.LastIndex(obj.Key, "/")+1:]
+			memos = append(memos, CloudMemoInfo{
+				Key:          obj.Key,
+				FileName:     fileName,
+				GameID:       gameID,
+				MemoTitle:    memoTitle,
+				MemoID:       memoID,
+				LastModified: time.UnixMilli(obj.LastModified),
+				Size:         obj.Size,
+				ETag:         obj.ETag,
+			})
 		}
-		fileName := obj.Key[strings.LastIndex(obj.Key, "/")+1:]
-		memos = append(memos, CloudMemoInfo{
-			Key:          obj.Key,
-			FileName:     fileName,
-			GameID:       gameID,
-			MemoTitle:    memoTitle,
-			MemoID:       memoID,
-			LastModified: time.UnixMilli(obj.LastModified),
-			Size:         obj.Size,
-		})
 	}
 	return memos, nil
 }
@@ -154,10 +197,8 @@ func (service *MemoCloudService) UploadMemoToCloud(ctx context.Context, memoID s
 		return newServiceError("ゲームが見つかりません", "指定されたIDが存在しません")
 	}
 
-	key := memo.BuildMemoPath(game.ID, memoData.Title, memoData.ID)
-	payload := memo.GenerateCloudMemoFileContent(memoData.Title, memoData.Content, game.Title)
-	if err := service.objectStore.UploadBytes(ctx, cfg, credential, key, []byte(payload), "text/markdown"); err != nil {
-		service.logger.Error("メモのアップロードに失敗しました", "error", err, "operation", "UploadMemoToCloud.uploadBytes", "key", key)
+	if err := service.uploadMemoContent(ctx, cfg, credential, *game, *memoData); err != nil {
+		service.logger.Error("メモのアップロードに失敗しました", "error", err, "operation", "UploadMemoToCloud.uploadBytes", "memoId", memoData.ID)
 		return newServiceError("メモのアップロードに失敗しました", err.Error())
 	}
 	return nil
@@ -174,7 +215,7 @@ func (service *MemoCloudService) SyncMemosFromCloud(ctx context.Context, gameID
 		Details: []string{},
 	}
 
-	cloudMemos, err := service.GetCloudMemos(ctx)
+	cloudMemos, err := service.listCloudMemos(ctx, cfg, credential, gameID)
 	if err != nil {
 		service.logger.Warn("クラウドメモ取得に失敗しました", "operation", "SyncMemosFromCloud", "detail", err)
 		return MemoSyncResult{}, wrapServiceError(err, "メモ同期に失敗しました")
@@ -201,9 +242,10 @@ func (service *MemoCloudService) SyncMemosFromCloud(ctx context.Context, gameID
 		return MemoSyncResult{}, err
 	}
 
+	states := service.loadCloudStates(ctx, gameID)
 	processed := map[string]bool{}
 
-	service.syncLocalToCloud(ctx, cfg, credential, targetGame, cloudMap, gameByID, localMemos, &resultData, processed)
+	service.syncLocalToCloud(ctx, cfg, credential, targetGame, cloudMap, gameByID, localMemos, states, &resultData, processed)
 
 	service.syncCloudToLocal(ctx, cfg, credential, targetGame, cloudMemos, gameByID, &resultData, processed)
 
@@ -245,6 +287,7 @@ func (service *MemoCloudService) syncLocalToCloud(
 	cloudMap map[string]CloudMemoInfo,
 	gameByID map[string]domain.Game,
 	localMemos []domain.Memo,
+	states map[string]domain.MemoCloudState,
 	resultData *MemoSyncResult,
 	processed map[string]bool,
 ) {
@@ -270,6 +313,23 @@ func (service *MemoCloudService) syncLocalToCloud(
 			continue
 		}
 
+		// クラウドが前回の同期から変わっていなければ、ダウンロードせずにローカル側の変更だけで判断できる
+		// （タイトル変更でキーが変わる場合は従来どおり更新日時で判断する）
+		state, hasState := states[localMemo.ID]
+		if hasState && cloudMemoUnchanged(state, cloudMemo) && cloudMemo.Key == memo.BuildMemoPath(game.ID, localMemo.Title, localMemo.ID) {
+			processed[key] = true
+			if memo.CalculateContentHash(localMemo.Content) == state.ContentHash {
+				resultData.Skipped++
+				continue
+			}
+			if err := service.uploadMemoContent(ctx, cfg, credential, game, localMemo); err != nil {
+				resultData.Details = append(resultData.Details, fmt.Sprintf("クラウド更新失敗: %s", localMemo.Title))
+				continue
+			}
+			resultData.CloudOverwritten++
+			continue
+		}
+
 		localUpdated := localMemo.UpdatedAt
 		cloudUpdated := cloudMemo.LastModified
 		if localUpdated.After(cloudUpdated) {
@@ -294,6 +354,7 @@ func (service *MemoCloudService) syncLocalToCloud(
 		}
 		cloudContent := memo.ExtractMemoContent(string(payload))
 		if memo.CalculateContentHash(localMemo.Content) == memo.CalculateContentHash(cloudContent) {
+			service.saveCloudState(ctx, localMemo.ID, cloudMemo, cloudContent)
 			resultData.Skipped++
 			processed[key] = true
 			continue
@@ -368,12 +429,14 @@ func (service *MemoCloudService) syncCloudToLocal(
 				resultData.Details = append(resultData.Details, fmt.Sprintf("作成失敗: %s", cloudMemo.MemoTitle))
 				continue
 			}
+			service.saveCloudState(ctx, createdMemo.ID, cloudMemo, content)
 			resultData.Created++
 			processed[key] = true
 			continue
 		}
 
 		if memo.CalculateContentHash(existingMemo.Content) == memo.CalculateContentHash(content) {
+			service.saveCloudState(ctx, existingMemo.ID, cloudMemo, content)
 			resultData.Skipped++
 			processed[key] = true
 			continue
@@ -388,6 +451,7 @@ func (service *MemoCloudService) syncCloudToLocal(
 				resultData.Details = append(resultData.Details, fmt.Sprintf("更新失敗: %s", cloudMemo.MemoTitle))
 				continue
 			}
+			service.saveCloudState(ctx, existingMemo.ID, cloudMemo, content)
 			resultData.LocalOverwritten++
 			processed[key] = true
 			continue
@@ -411,7 +475,52 @@ func (service *MemoCloudService) uploadMemoContent(
 ) error {
 	key := memo.BuildMemoPath(game.ID, memoData.Title, memoData.ID)
 	payload := memo.GenerateCloudMemoFileContent(memoData.Title, memoData.Content, game.Title)
-	return service.objectStore.UploadBytes(ctx, cfg, credential, key, []byte(payload), "text/markdown")
+	etag, err := service.objectStore.UploadBytes(ctx, cfg, credential, key, []byte(payload), "text/markdown")
+	if err != nil {
+		return err
+	}
+	service.saveCloudState(ctx, memoData.ID, CloudMemoInfo{Key: key, Size: int64(len(payload)), ETag: etag}, memoData.Content)
+	return nil
+}
+
+// cloudMemoUnchanged は cloudMemo が state を控えた時点のオブジェクトのままかを返す。
+func cloudMemoUnchanged(state domain.MemoCloudState, cloudMemo CloudMemoInfo) bool {
+	return state.ETag != "" && state.CloudKey == cloudMemo.Key && state.ETag == cloudMemo.ETag && state.Size == cloudMemo.Size
+}
+
+// loadCloudStates は gameID（空なら全ゲーム）のメモのクラウド同期状態の控えを memoID → 控えで返す。
+// 読めない場合は控え無しとして、従来どおりダウンロードして比較する。
+func (service *MemoCloudService) loadCloudStates(ctx context.Context, gameID string) map[string]domain.MemoCloudState {
+	states := map[string]domain.MemoCloudState{}
+	if service.stateRepository == nil {
+		return states
+	}
+	list, err := service.stateRepository.ListMemoCloudStates(ctx, strings.TrimSpace(gameID))
+	if err != nil {
+		service.logger.Warn("メモの同期状態の読み込みに失敗", "operation", "SyncMemosFromCloud.loadCloudStates", "error", err)
+		return states
+	}
+	for _, state := range list {
+		states[state.MemoID] = state
+	}
+	return states
+}
+
+// saveCloudState はメモ memoID の本文 content がクラウドの cloudMemo と一致していることを控える。
+func (service *MemoCloudService) saveCloudState(ctx context.Context, memoID string, cloudMemo CloudMemoInfo, content string) {
+	if service.stateRepository == nil || cloudMemo.ETag == "" {
+		return
+	}
+	state := domain.MemoCloudState{
+		MemoID:      memoID,
+		CloudKey:    cloudMemo.Key,
+		ETag:        cloudMemo.ETag,
+		Size:        cloudMemo.Size,
+		ContentHash: memo.CalculateContentHash(content),
+	}
+	if err := service.stateRepository.SaveMemoCloudState(ctx, state); err != nil {
+		service.logger.Warn("メモの同期状態の保存に失敗", "memoId", memoID, "error", err)
+	}
 }
 
 func (service *MemoCloudService) fetchLocalMemos(ctx context.Context, gameID string) ([]domain.Memo, error) {
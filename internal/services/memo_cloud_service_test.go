@@ -2,8 +2,11 @@ package services
 
 import (
 	"context"
+	"fmt"
 	"io"
 	"log/slog"
+	"strings"
+	"sync"
 	"testing"
 	"time"
 
@@ -22,6 +25,10 @@ func (repository fakeMemoCloudGameRepository) ListGames(ctx context.Context, sea
 	return repository.games, nil
 }
 
+func (repository fakeMemoCloudGameRepository) ListGamesPage(ctx context.Context, query domain.GameListQuery) (domain.GamePage, error) {
+	return domain.GamePage{Items: repository.games}, nil
+}
+
 func (repository fakeMemoCloudGameRepository) GetGameByID(ctx context.Context, gameID string) (*domain.Game, error) {
 	return repository.game, nil
 }
@@ -71,23 +78,81 @@ func (repository fakeMemoCloudMemoRepository) ListAllMemos(ctx context.Context)
 	return repository.memoByGame, nil
 }
 
+func (repository fakeMemoCloudMemoRepository) SearchMemos(ctx context.Context, query domain.MemoSearchQuery) (domain.MemoPage, error) {
+	return domain.MemoPage{Items: repository.memoByGame}, nil
+}
+
 func (repository fakeMemoCloudMemoRepository) DeleteMemo(ctx context.Context, memoID string) error {
 	return nil
 }
 
 type fakeCloudObjectStore struct {
+	mu             sync.Mutex
 	listObjects    []storage.ObjectInfo
+	listedPrefixes []string
 	uploadedKeys   []string
 	downloadedKeys []string
 	downloadData   []byte
 }
 
-func (f *fakeCloudObjectStore) ListObjects(_ context.Context, _ storage.S3Config, _ credentials.Credential, _ string) ([]storage.ObjectInfo, error) {
-	return f.listObjects, nil
+func (f *fakeCloudObjectStore) ListObjects(_ context.Context, _ storage.S3Config, _ credentials.Credential, prefix string) ([]storage.ObjectInfo, error) {
+	f.mu.Lock()
+	defer f.mu.Unlock()
+	f.listedPrefixes = append(f.listedPrefixes, prefix)
+	objects := make([]storage.ObjectInfo, 0)
+	for _, obj := range f.listObjects {
+		if strings.HasPrefix(obj.Key, prefix) {
+			objects = append(objects, obj)
+		}
+	}
+	return objects, nil
+}
+
+func (f *fakeCloudObjectStore) ListChildPrefixes(_ context.Context, _ storage.S3Config, _ credentials.Credential, prefix string) ([]string, error) {
+	seen := map[string]bool{}
+	names := make([]string, 0)
+	for _, obj := range f.listObjects {
+		rest, ok := strings.CutPrefix(obj.Key, prefix)
+		if !ok {
+			continue
+		}
+		name, _, _ := strings.Cut(rest, "/")
+		if !seen[name] {
+			seen[name] = true
+			names = append(names, name)
+		}
+	}
+	return names, nil
 }
 
-func (f *fakeCloudObjectStore) UploadBytes(_ context.Context, _ storage.S3Config, _ credentials.Credential, key string, _ []byte, _ string) error {
+func (f *fakeCloudObjectStore) UploadBytes(_ context.Context, _ storage.S3Config, _ credentials.Credential, key string, payload []byte, _ string) (string, error) {
 	f.uploadedKeys = append(f.uploadedKeys, key)
+	etag := fmt.Sprintf("etag-%d", len(f.uploadedKeys))
+	uploaded := storage.ObjectInfo{Key: key, Size: int64(len(payload)), LastModified: time.Now().UnixMilli(), ETag: etag}
+	for i, obj := range f.listObjects {
+		if obj.Key == key {
+			f.listObjects[i] = uploaded
+			return etag, nil
+		}
+	}
+	f.listObjects = append(f.listObjects, uploaded)
+	return etag, nil
+}
+
+type fakeMemoCloudStateRepository struct {
+	states map[string]domain.MemoCloudState
+}
+
+func (f *fakeMemoCloudStateRepository) ListMemoCloudStates(_ context.Context, _ string) ([]domain.MemoCloudState, error) {
+	states := make([]domain.MemoCloudState, 0, len(f.states))
+	for _, state := range f.states {
+		states = append(states, state)
+	}
+	return states, nil
+}
+
+func (f *fakeMemoCloudStateRepository) SaveMemoCloudState(_ context.Context, state domain.MemoCloudState) error {
+	f.states[state.MemoID] = state
 	return nil
 }
 
@@ -113,14 +178,17 @@ func TestMemoCloudServiceGetCloudMemosUsesObjectStorePort(t *testing.T) {
 		}},
 		NewGameService(fakeMemoCloudGameRepository{}, slog.New(slog.NewTextHandler(io.Discard, nil))),
 		NewMemoService(fakeMemoCloudMemoRepository{}, nil, slog.New(slog.NewTextHandler(io.Discard, nil))),
+		nil,
 		slog.New(slog.NewTextHandler(io.Discard, nil)),
 	)
-	service.objectStore = &fakeCloudObjectStore{
+	objectStore := &fakeCloudObjectStore{
 		listObjects: []storage.ObjectInfo{
 			{Key: "games/game-1/memo/Intro__memo-1.md", LastModified: time.Now().UnixMilli(), Size: 123},
 			{Key: "games/game-1/image.png", LastModified: time.Now().UnixMilli(), Size: 456},
+			{Key: "games/game-2/objects/abc", LastModified: time.Now().UnixMilli(), Size: 789},
 		},
 	}
+	service.objectStore = objectStore
 
 	result, err := service.GetCloudMemos(context.Background())
 	if err != nil {
@@ -132,6 +200,70 @@ func TestMemoCloudServiceGetCloudMemosUsesObjectStorePort(t *testing.T) {
 	if result[0].GameID != "game-1" || result[0].MemoID != "memo-1" {
 		t.Fatalf("unexpected memo info: %#v", result[0])
 	}
+	for _, prefix := range objectStore.listedPrefixes {
+		if !strings.HasSuffix(prefix, "/memo/") {
+			t.Fatalf("expected listing scoped to memo prefixes, got %q", prefix)
+		}
+	}
+}
+
+// TestMemoCloudServiceSyncSkipsDownloadWhenCloudUnchanged は、クラウドの ETag / サイズが控えと一致する間は
+// ダウンロードせずに同期を終え、ローカルだけが変わった場合はアップロードすることを確認する。
+func TestMemoCloudServiceSyncSkipsDownloadWhenCloudUnchanged(t *testing.T) {
+	t.Parallel()
+
+	game := domain.Game{ID: "game-1", Title: "Game"}
+	memoData := domain.Memo{ID: "memo-1", GameID: "game-1", Title: "Memo", Content: "Body", UpdatedAt: time.Now().Add(-time.Hour)}
+	memoRepository := &fakeMemoCloudMemoRepository{memo: &memoData, memoByGame: []domain.Memo{memoData}}
+	objectStore := &fakeCloudObjectStore{}
+	stateRepository := &fakeMemoCloudStateRepository{states: map[string]domain.MemoCloudState{}}
+	service := NewMemoCloudService(
+		config.Config{},
+		&fakeCredentialStore{loadResult: &credentials.Credential{
+			AccessKeyID:     "access",
+			SecretAccessKey: "secret",
+			BucketName:      "bucket",
+			Region:          "region",
+			Endpoint:        "endpoint",
+		}},
+		NewGameService(fakeMemoCloudGameRepository{games: []domain.Game{game}, game: &game}, slog.New(slog.NewTextHandler(io.Discard, nil))),
+		NewMemoService(memoRepository, nil, slog.New(slog.NewTextHandler(io.Discard, nil))),
+		stateRepository,
+		slog.New(slog.NewTextHandler(io.Discard, nil)),
+	)
+	service.objectStore = objectStore
+
+	first, err := service.SyncMemosFromCloud(context.Background(), "game-1")
+	if err != nil || first.Uploaded != 1 {
+		t.Fatalf("expected initial upload, got %#v (%v)", first, err)
+	}
+	if _, ok := stateRepository.states["memo-1"]; !ok {
+		t.Fatal("expected cloud state to be recorded after upload")
+	}
+
+	second, err := service.SyncMemosFromCloud(context.Background(), "game-1")
+	if err != nil || second.Skipped != 1 {
+		t.Fatalf("expected unchanged memo to be skipped, got %#v (%v)", second, err)
+	}
+	if len(objectStore.downloadedKeys) != 0 {
+		t.Fatalf("expected no downloads while cloud is unchanged, got %v", objectStore.downloadedKeys)
+	}
+
+	memoData.Content = "Edited"
+	memoRepository.memo = &memoData
+	memoRepository.memoByGame = []domain.Memo{memoData}
+	third, err := service.SyncMemosFromCloud(context.Background(), "game-1")
+	if err != nil || third.CloudOverwritten != 1 {
+		t.Fatalf("expected local edit to be uploaded, got %#v (%v)", third, err)
+	}
+	if len(objectStore.downloadedKeys) != 0 {
+		t.Fatalf("expected no downloads for a local-only edit, got %v", objectStore.downloadedKeys)
+	}
+	for _, prefix := range objectStore.listedPrefixes {
+		if prefix != "games/game-1/memo/" {
+			t.Fatalf("expected per-game sync to list only its memo prefix, got %q", prefix)
+		}
+	}
 }
 
 func TestMemoCloudServiceUploadMemoToCloudUsesObjectStorePort(t *testing.T) {
@@ -156,6 +288,7 @@ func TestMemoCloudServiceUploadMemoToCloudUsesObjectStorePort(t *testing.T) {
 		}},
 		NewGameService(fakeMemoCloudGameRepository{game: game}, slog.New(slog.NewTextHandler(io.Discard, nil))),
 		NewMemoService(fakeMemoCloudMemoRepository{memo: memoData}, nil, slog.New(slog.NewTextHandler(io.Discard, nil))),
+		nil,
 		slog.New(slog.NewTextHandler(io.Discard, nil)),
 	)
 	service.objectStore = objectStore
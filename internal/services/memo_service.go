@@ -151,6 +151,17 @@ func (service *MemoService) ListAllMemos(ctx context.Context) ([]domain.Memo, er
 	return memos, nil
 }
 
+// SearchMemos はメモのタイトル・本文を検索し、1ページ分取得する。
+func (service *MemoService) SearchMemos(ctx context.Context, query domain.MemoSearchQuery) (domain.MemoPage, error) {
+	query.GameID = strings.TrimSpace(query.GameID)
+	page, error := service.repository.SearchMemos(ctx, query)
+	if error != nil {
+		service.logger.Error("メモ検索に失敗", "error", error)
+		return domain.MemoPage{}, newServiceError("メモ検索に失敗しました", error.Error())
+	}
+	return page, nil
+}
+
 // DeleteMemo はメモを削除する。
 func (service *MemoService) DeleteMemo(ctx context.Context, memoID string) error {
 	trimmedID, detail, ok := requireNonEmpty(memoID, "memoID")
@@ -48,6 +48,10 @@ func (repository fakeMemoRepository) ListAllMemos(ctx context.Context) ([]domain
 	return repository.listAllMemosFn(ctx)
 }
 
+func (repository fakeMemoRepository) SearchMemos(ctx context.Context, query domain.MemoSearchQuery) (domain.MemoPage, error) {
+	return domain.MemoPage{}, nil
+}
+
 func (repository fakeMemoRepository) DeleteMemo(ctx context.Context, memoID string) error {
 	return repository.deleteMemoFn(ctx, memoID)
 }
@@ -294,6 +298,9 @@ func (repository *trackingMemoRepository) ListMemosByGame(ctx context.Context, g
 func (repository *trackingMemoRepository) ListAllMemos(ctx context.Context) ([]domain.Memo, error) {
 	return nil, nil
 }
+func (repository *trackingMemoRepository) SearchMemos(ctx context.Context, query domain.MemoSearchQuery) (domain.MemoPage, error) {
+	return domain.MemoPage{}, nil
+}
 func (repository *trackingMemoRepository) DeleteMemo(ctx context.Context, memoID string) error {
 	repository.deleteMemoCalls++
 	return nil
@@ -0,0 +1,223 @@
+// 同期・一覧・プロセス監視の段階ごとの所要時間と転送量を計測し、直近の分布として集計する。
+package services
+
+import (
+	"context"
+	"log/slog"
+	"math"
+	"sort"
+	"sync"
+	"sync/atomic"
+	"time"
+
+	"CloudLaunch_Go/internal/infrastructure/storage"
+)
+
+// perfWindowSize は段階ごとに分位点の計算に残す直近の所要時間の件数。
+const perfWindowSize = 256
+
+// PerfPhaseMetrics は1段階分の集計。Count 以下の回数・量は起動（または Reset）からの通算で、
+// 所要時間の分位点は直近 Samples 件から計算する。
+type PerfPhaseMetrics struct {
+	Name          string    `json:"name"`
+	Count         int64     `json:"count"`
+	Errors        int64     `json:"errors"`
+	Samples       int       `json:"samples"`
+	MeanMs        float64   `json:"meanMs"`
+	P50Ms         float64   `json:"p50Ms"`
+	P90Ms         float64   `json:"p90Ms"`
+	P99Ms         float64   `json:"p99Ms"`
+	MaxMs         float64   `json:"maxMs"`
+	Bytes         int64     `json:"bytes"`   // ローカルで読んだ・書いたバイト数（ハッシュ計算など）
+	Objects       int64     `json:"objects"` // 扱ったファイル・ブロブ・ゲームの数
+	Requests      int64     `json:"requests"`
+	Retries       int64     `json:"retries"`
+	BytesSent     int64     `json:"bytesSent"`
+	BytesReceived int64     `json:"bytesReceived"`
+	LastAt        time.Time `json:"lastAt"`
+}
+
+// perfPhase は1段階分の集計の内部表現。window は直近の所要時間の環状バッファ。
+type perfPhase struct {
+	window   [perfWindowSize]time.Duration
+	next     int
+	filled   int
+	count    int64
+	errors   int64
+	total    time.Duration
+	bytes    int64
+	objects  int64
+	transfer storage.TransferCounts
+	lastAt   time.Time
+}
+
+// PerfMetrics は段階名ごとの計測結果を集める。App が1つ作り、計測する各サービスに共有する。
+// nil のまま使ってよく、その場合は計測もログも行わない。
+type PerfMetrics struct {
+	logger *slog.Logger
+
+	mu     sync.Mutex
+	phases map[string]*perfPhase
+}
+
+// NewPerfMetrics は計測のたびに logger へ Debug で記録する PerfMetrics を生成する。
+func NewPerfMetrics(logger *slog.Logger) *PerfMetrics {
+	return &PerfMetrics{logger: logger, phases: make(map[string]*perfPhase)}
+}
+
+// Snapshot は段階名の昇順で現在の集計を返す。
+func (m *PerfMetrics) Snapshot() []PerfPhaseMetrics {
+	if m == nil {
+		return []PerfPhaseMetrics{}
+	}
+	m.mu.Lock()
+	defer m.mu.Unlock()
+	result := make([]PerfPhaseMetrics, 0, len(m.phases))
+	for name, phase := range m.phases {
+		result = append(result, phase.metrics(name))
+	}
+	sort.Slice(result, func(i, j int) bool { return result[i].Name < result[j].Name })
+	return result
+}
+
+// Reset はすべての集計を捨てる。
+func (m *PerfMetrics) Reset() {
+	if m == nil {
+		return
+	}
+	m.mu.Lock()
+	m.phases = make(map[string]*perfPhase)
+	m.mu.Unlock()
+}
+
+func (phase *perfPhase) metrics(name string) PerfPhaseMetrics {
+	samples := make([]time.Duration, phase.filled)
+	copy(samples, phase.window[:phase.filled])
+	sort.Slice(samples, func(i, j int) bool { return samples[i] < samples[j] })
+	result := PerfPhaseMetrics{
+		Name:          name,
+		Count:         phase.count,
+		Errors:        phase.errors,
+		Samples:       len(samples),
+		Bytes:         phase.bytes,
+		Objects:       phase.objects,
+		Requests:      phase.transfer.Requests,
+		Retries:       phase.transfer.Retries,
+		BytesSent:     phase.transfer.BytesSent,
+		BytesReceived: phase.transfer.BytesReceived,
+		LastAt:        phase.lastAt,
+	}
+	if phase.count > 0 {
+		result.MeanMs = durationMs(phase.total / time.Duration(phase.count))
+	}
+	if len(samples) > 0 {
+		result.P50Ms = durationMs(percentile(samples, 0.50))
+		result.P90Ms = durationMs(percentile(samples, 0.90))
+		result.P99Ms = durationMs(percentile(samples, 0.99))
+		result.MaxMs = durationMs(samples[len(samples)-1])
+	}
+	return result
+}
+
+// percentile は昇順に並んだ sorted の p 分位点（最近傍順位）を返す。
+func percentile(sorted []time.Duration, p float64) time.Duration {
+	rank := int(math.Ceil(p*float64(len(sorted)))) - 1
+	return sorted[max(rank, 0)]
+}
+
+func durationMs(d time.Duration) float64 {
+	return float64(d) / float64(time.Millisecond)
+}
+
+func (m *PerfMetrics) record(name string, elapsed time.Duration, failed bool, bytes, objects int64, transfer storage.TransferCounts, at time.Time) {
+	m.mu.Lock()
+	defer m.mu.Unlock()
+	phase, ok := m.phases[name]
+	if !ok {
+		phase = &perfPhase{}
+		m.phases[name] = phase
+	}
+	phase.window[phase.next] = elapsed
+	phase.next = (phase.next + 1) % perfWindowSize
+	phase.filled = min(phase.filled+1, perfWindowSize)
+	phase.count++
+	if failed {
+		phase.errors++
+	}
+	phase.total += elapsed
+	phase.bytes += bytes
+	phase.objects += objects
+	phase.transfer.Requests += transfer.Requests
+	phase.transfer.Retries += transfer.Retries
+	phase.transfer.BytesSent += transfer.BytesSent
+	phase.transfer.BytesReceived += transfer.BytesReceived
+	phase.lastAt = at
+}
+
+// perfSpan は計測中の1段階。startSpan で始めて end で閉じる。nil のまま呼んでも何もしない。
+type perfSpan struct {
+	metrics *PerfMetrics
+	name    string
+	start   time.Time
+	stats   storage.TransferStats
+	bytes   atomic.Int64
+	objects atomic.Int64
+}
+
+// startSpan は段階 name の計測を始める。戻り値の ctx で送った S3 リクエストはこの段階（と外側の段階）に数えられ、
+// ストレージ内部の段階（PutBlobs の列挙・送信など）は name の下位段階として計測される。
+func (m *PerfMetrics) startSpan(ctx context.Context, name string) (context.Context, *perfSpan) {
+	if m == nil {
+		return ctx, nil
+	}
+	span := &perfSpan{metrics: m, name: name, start: time.Now()}
+	ctx = storage.WithTransferStats(ctx, &span.stats)
+	ctx = storage.WithPhaseHook(ctx, func(ctx context.Context, phase string) (context.Context, func(error)) {
+		ctx, child := m.startSpan(ctx, name+"."+phase)
+		return ctx, child.end
+	})
+	return ctx, span
+}
+
+// addBytes はローカルで扱ったバイト数を加える。
+func (span *perfSpan) addBytes(n int64) {
+	if span != nil {
+		span.bytes.Add(n)
+	}
+}
+
+// addObjects は扱ったファイル・ブロブ・ゲームの数を加える。
+func (span *perfSpan) addObjects(n int64) {
+	if span != nil {
+		span.objects.Add(n)
+	}
+}
+
+// end は計測を閉じて集計に加え、Debug ログに残す。err が非 nil なら失敗として数える。
+func (span *perfSpan) end(err error) {
+	if span == nil {
+		return
+	}
+	now := time.Now()
+	elapsed := now.Sub(span.start)
+	transfer := span.stats.Counts()
+	bytes, objects := span.bytes.Load(), span.objects.Load()
+	span.metrics.record(span.name, elapsed, err != nil, bytes, objects, transfer, now)
+	if span.metrics.logger == nil {
+		return
+	}
+	attrs := []any{
+		"span", span.name,
+		"durationMs", durationMs(elapsed),
+		"bytes", bytes,
+		"objects", objects,
+		"requests", transfer.Requests,
+		"retries", transfer.Retries,
+		"bytesSent", transfer.BytesSent,
+		"bytesReceived", transfer.BytesReceived,
+	}
+	if err != nil {
+		attrs = append(attrs, "error", err)
+	}
+	span.metrics.logger.Debug("計測", attrs...)
+}
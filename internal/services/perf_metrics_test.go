@@ -0,0 +1,73 @@
+package services
+
+import (
+	"context"
+	"errors"
+	"testing"
+	"time"
+
+	"CloudLaunch_Go/internal/infrastructure/storage"
+)
+
+// TestPerfMetricsAggregatesRollingWindow は、通算回数は数え続けつつ分位点は直近 perfWindowSize 件だけから計算することを確認する。
+func TestPerfMetricsAggregatesRollingWindow(t *testing.T) {
+	t.Parallel()
+
+	metrics := NewPerfMetrics(nil)
+	for range perfWindowSize {
+		metrics.record("push", time.Hour, false, 0, 0, storage.TransferCounts{}, time.Now())
+	}
+	for i := 1; i <= perfWindowSize; i++ {
+		metrics.record("push", time.Duration(i)*time.Millisecond, i == 1, 10, 1, storage.TransferCounts{}, time.Now())
+	}
+
+	snapshot := metrics.Snapshot()
+	if len(snapshot) != 1 {
+		t.Fatalf("expected one phase, got %+v", snapshot)
+	}
+	phase := snapshot[0]
+	if phase.Count != 2*perfWindowSize || phase.Errors != 1 || phase.Samples != perfWindowSize {
+		t.Fatalf("unexpected counts: %+v", phase)
+	}
+	if phase.MaxMs != perfWindowSize || phase.P50Ms != perfWindowSize/2 {
+		t.Fatalf("expected old samples to roll out of the window, got p50=%v max=%v", phase.P50Ms, phase.MaxMs)
+	}
+	if phase.Bytes != 10*perfWindowSize || phase.Objects != perfWindowSize {
+		t.Fatalf("unexpected totals: bytes=%d objects=%d", phase.Bytes, phase.Objects)
+	}
+
+	metrics.Reset()
+	if got := metrics.Snapshot(); len(got) != 0 {
+		t.Fatalf("expected reset to drop phases, got %+v", got)
+	}
+}
+
+// TestPerfSpanNestsStoragePhases は、ストレージ側が ctx で知らせた段階が親の段階名の下に記録され、
+// nil の PerfMetrics では何も起きないことを確認する。
+func TestPerfSpanNestsStoragePhases(t *testing.T) {
+	t.Parallel()
+
+	metrics := NewPerfMetrics(nil)
+	ctx, span := metrics.startSpan(context.Background(), "push.upload")
+	_, endList := storage.StartPhase(ctx, "list_blobs")
+	endList(errors.New("list failed"))
+	span.addObjects(3)
+	span.end(nil)
+
+	snapshot := metrics.Snapshot()
+	if len(snapshot) != 2 || snapshot[0].Name != "push.upload" || snapshot[1].Name != "push.upload.list_blobs" {
+		t.Fatalf("unexpected phases: %+v", snapshot)
+	}
+	if snapshot[0].Objects != 3 || snapshot[1].Errors != 1 {
+		t.Fatalf("unexpected phase values: %+v", snapshot)
+	}
+
+	var disabled *PerfMetrics
+	plain := context.Background()
+	if got, span := disabled.startSpan(plain, "push"); got != plain || span != nil {
+		t.Fatalf("expected nil metrics to leave ctx untouched")
+	}
+	if got := disabled.Snapshot(); len(got) != 0 {
+		t.Fatalf("expected empty snapshot from nil metrics, got %+v", got)
+	}
+}
@@ -0,0 +1,9 @@
+//go:build !windows
+
+// Windows 以外でプロセス終了待機のスタブを提供する。
+package services
+
+// watchProcessExit は未対応のため常に false を返す（終了はポーリングで検知する）。
+func watchProcessExit(pid int, stop <-chan struct{}, onExit func()) bool {
+	return false
+}
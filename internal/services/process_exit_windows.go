@@ -0,0 +1,43 @@
+//go:build windows
+
+// プロセスハンドルの待機によるゲーム終了の即時検知を実装する。
+package services
+
+import (
+	"golang.org/x/sys/windows"
+)
+
+// watchProcessExit は pid の終了を別 goroutine で待ち、終了したら onExit を呼ぶ。
+// stop が閉じられたら onExit を呼ばずに待機をやめる。監視を始められなければ false を返す
+// （権限不足やすでに終了している場合。呼び出し側はポーリングで終了を検知する）。
+func watchProcessExit(pid int, stop <-chan struct{}, onExit func()) bool {
+	process, err := windows.OpenProcess(windows.SYNCHRONIZE, false, uint32(pid))
+	if err != nil {
+		return false
+	}
+	// stop を Win32 の待機に混ぜるため、手動リセットのイベントに変換する
+	cancel, err := windows.CreateEvent(nil, 1, 0, nil)
+	if err != nil {
+		_ = windows.CloseHandle(process)
+		return false
+	}
+	done := make(chan struct{})
+	go func() {
+		select {
+		case <-stop:
+			_ = windows.SetEvent(cancel)
+		case <-done:
+		}
+	}()
+	go func() {
+		defer close(done)
+		event, err := windows.WaitForMultipleObjects([]windows.Handle{process, cancel}, false, windows.INFINITE)
+		// 終了したプロセスが列挙に残らないよう、通知前にハンドルを閉じる
+		_ = windows.CloseHandle(process)
+		_ = windows.CloseHandle(cancel)
+		if err == nil && event == windows.WAIT_OBJECT_0 {
+			onExit()
+		}
+	}()
+	return true
+}
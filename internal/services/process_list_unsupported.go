@@ -0,0 +1,14 @@
+//go:build !windows
+
+// Windows 以外でプロセス列挙のスタブを提供する。
+package services
+
+import "errors"
+
+func listProcessesNative() ([]ProcessInfo, error) {
+	return nil, errors.New("native process enumeration is only supported on Windows")
+}
+
+func (service *ProcessMonitorService) getProcessesFallback() ([]ProcessInfo, error) {
+	return nil, errors.New("process enumeration is only supported on Windows")
+}
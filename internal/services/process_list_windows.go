@@ -0,0 +1,281 @@
+//go:build windows
+
+// Windows のプロセス列挙（Toolhelp32 スナップショット、フォールバックの PowerShell / wmic）を実装する。
+package services
+
+import (
+	"bytes"
+	"context"
+	"encoding/csv"
+	"errors"
+	"io"
+	"path/filepath"
+	"strconv"
+	"strings"
+	"sync"
+	"time"
+	"unicode/utf8"
+	"unsafe"
+
+	"golang.org/x/sys/windows"
+	"golang.org/x/text/encoding/japanese"
+	"golang.org/x/text/encoding/unicode"
+	"golang.org/x/text/transform"
+)
+
+// processPathEntry は PID ごとに解決済みの実行ファイルパスと起動時刻。
+// name か起動時刻が変わったら PID が再利用されたとみなす（同じゲームをすぐ起動し直すと name は同じになる）。
+type processPathEntry struct {
+	name      string
+	path      string    // 解決できなかった（保護プロセス等）場合は ""
+	startedAt time.Time // 取得できなかった場合はゼロ値
+}
+
+// nativeProcessPaths は PID → 実行ファイルパスの控え。
+// 監視ループは 2 秒ごとに全プロセスを列挙するため、毎回 OpenProcess + QueryFullProcessImageName を
+// 全件に行うと列挙そのものより重くなる。新しく現れた PID と再利用された PID だけ解決し、消えた PID は列挙のたびに捨てる。
+// 再利用の確認には起動時刻（OpenProcess + GetProcessTimes）だけを読む。
+var (
+	nativeProcessPathsMu sync.Mutex
+	nativeProcessPaths   = map[uint32]processPathEntry{}
+)
+
+func listProcessesNative() ([]ProcessInfo, error) {
+	snapshot, err := windows.CreateToolhelp32Snapshot(windows.TH32CS_SNAPPROCESS, 0)
+	if err != nil {
+		return nil, err
+	}
+	defer func() { _ = windows.CloseHandle(snapshot) }()
+
+	nativeProcessPathsMu.Lock()
+	defer nativeProcessPathsMu.Unlock()
+
+	seen := make(map[uint32]processPathEntry, len(nativeProcessPaths))
+	processes := make([]ProcessInfo, 0, len(nativeProcessPaths))
+	var entry windows.ProcessEntry32
+	entry.Size = uint32(unsafe.Sizeof(entry))
+	for err = windows.Process32First(snapshot, &entry); err == nil; err = windows.Process32Next(snapshot, &entry) {
+		pid := entry.ProcessID
+		name := strings.TrimSpace(windows.UTF16ToString(entry.ExeFile[:]))
+		if pid == 0 || name == "" {
+			continue
+		}
+		cached, ok := nativeProcessPaths[pid]
+		if !ok || cached.name != name || processRestarted(pid, cached) {
+			cached = queryProcessDetails(pid, name)
+		}
+		seen[pid] = cached
+
+		// PowerShell 版（ProcessName + Path）と同じ正規化: 名前は .exe 付き、パスが取れなければ名前で代用
+		if !strings.HasSuffix(strings.ToLower(name), ".exe") {
+			name += ".exe"
+		}
+		fullPath := cached.path
+		if fullPath == "" {
+			fullPath = name
+		}
+		if ext := strings.ToLower(filepath.Ext(fullPath)); ext != ".exe" {
+			continue
+		}
+		processes = append(processes, ProcessInfo{Name: name, Pid: int(pid), Cmd: fullPath, StartedAt: cached.startedAt})
+	}
+	if !errors.Is(err, windows.ERROR_NO_MORE_FILES) {
+		return nil, err
+	}
+	nativeProcessPaths = seen
+	return processes, nil
+}
+
+// queryProcessDetails は PID の実行ファイルのフルパスと起動時刻を返す。権限不足などで取れない項目は空のまま返す。
+// PROCESS_QUERY_LIMITED_INFORMATION は管理者権限で動くゲームや他ユーザーのプロセスにも通ることが多い。
+func queryProcessDetails(pid uint32, name string) processPathEntry {
+	entry := processPathEntry{name: name}
+	handle, err := windows.OpenProcess(windows.PROCESS_QUERY_LIMITED_INFORMATION, false, pid)
+	if err != nil {
+		return entry
+	}
+	defer func() { _ = windows.CloseHandle(handle) }()
+
+	buf := make([]uint16, windows.MAX_LONG_PATH)
+	size := uint32(len(buf))
+	if err := windows.QueryFullProcessImageName(handle, 0, &buf[0], &size); err == nil {
+		entry.path = windows.UTF16ToString(buf[:size])
+	}
+	entry.startedAt = processStartTime(handle)
+	return entry
+}
+
+// processRestarted は控えの起動時刻と PID の今の起動時刻が違うか（PID が同じ名前のプロセスに再利用されたか）を返す。
+// 控えに起動時刻が無い・今の起動時刻を読めない（終了直後など）場合は判定できないので false を返す。
+func processRestarted(pid uint32, cached processPathEntry) bool {
+	if cached.startedAt.IsZero() {
+		return false
+	}
+	handle, err := windows.OpenProcess(windows.PROCESS_QUERY_LIMITED_INFORMATION, false, pid)
+	if err != nil {
+		return false
+	}
+	defer func() { _ = windows.CloseHandle(handle) }()
+	startedAt := processStartTime(handle)
+	return !startedAt.IsZero() && !startedAt.Equal(cached.startedAt)
+}
+
+// processStartTime はプロセスの起動時刻を返す。取得できなければゼロ値。
+func processStartTime(handle windows.Handle) time.Time {
+	var creation, exit, kernel, user windows.Filetime
+	if err := windows.GetProcessTimes(handle, &creation, &exit, &kernel, &user); err != nil {
+		return time.Time{}
+	}
+	return time.Unix(0, creation.Nanoseconds())
+}
+
+func (service *ProcessMonitorService) getProcessesPowerShell() ([]ProcessInfo, error) {
+	ctx, cancel := context.WithTimeout(context.Background(), 5*time.Second)
+	defer cancel()
+	command := execCommandHidden(
+		ctx,
+		"powershell",
+		"-Command",
+		`$OutputEncoding=[System.Text.Encoding]::UTF8; Get-Process | Select-Object ProcessName, Id, Path | ConvertTo-Csv -NoTypeInformation`,
+	)
+	output, err := command.Output()
+	if err != nil {
+		return nil, err
+	}
+
+	records, err := parseCSVBytes(output)
+	if err != nil {
+		return nil, err
+	}
+
+	processes := make([]ProcessInfo, 0, len(records))
+	for i, record := range records {
+		if i == 0 {
+			continue
+		}
+		if len(record) < 3 {
+			continue
+		}
+		name := strings.TrimSpace(record[0])
+		pidStr := strings.TrimSpace(record[1])
+		fullPath := strings.TrimSpace(record[2])
+		pid, err := strconv.Atoi(pidStr)
+		if err != nil || pid <= 0 || name == "" {
+			continue
+		}
+		if !strings.HasSuffix(strings.ToLower(name), ".exe") {
+			name += ".exe"
+		}
+		if fullPath == "" {
+			fullPath = name
+		}
+		if ext := strings.ToLower(filepath.Ext(fullPath)); ext != ".exe" {
+			continue
+		}
+		processes = append(processes, ProcessInfo{Name: name, Pid: pid, Cmd: fullPath})
+	}
+	return processes, nil
+}
+
+// getProcessesFallback はネイティブ列挙が失敗したときの最後の手段。
+// wmic は新しい Windows で削除されつつあるため PowerShell を先に試す。
+func (service *ProcessMonitorService) getProcessesFallback() ([]ProcessInfo, error) {
+	processes, err := service.getProcessesPowerShell()
+	if err == nil {
+		return processes, nil
+	}
+	service.logger.Warn("PowerShell でのプロセス列挙に失敗しました。wmic を使用します", "error", err)
+	return service.getProcessesWmic()
+}
+
+func (service *ProcessMonitorService) getProcessesWmic() ([]ProcessInfo, error) {
+	ctx, cancel := context.WithTimeout(context.Background(), 5*time.Second)
+	defer cancel()
+	command := execCommandHidden(
+		ctx,
+		"wmic",
+		"process",
+		"get",
+		"Name,ProcessId,ExecutablePath",
+		"/FORMAT:CSV",
+	)
+	output, err := command.Output()
+	if err != nil {
+		return nil, err
+	}
+
+	records, err := parseCSVBytes(output)
+	if err != nil {
+		return nil, err
+	}
+
+	processes := make([]ProcessInfo, 0, len(records))
+	for _, record := range records {
+		if len(record) < 4 {
+			continue
+		}
+		name := strings.TrimSpace(record[1])
+		pidStr := strings.TrimSpace(record[2])
+		fullPath := strings.TrimSpace(record[3])
+		if name == "" || pidStr == "" {
+			continue
+		}
+		pid, err := strconv.Atoi(pidStr)
+		if err != nil || pid <= 0 {
+			continue
+		}
+		if !strings.HasSuffix(strings.ToLower(name), ".exe") {
+			name += ".exe"
+		}
+		if fullPath == "" {
+			fullPath = name
+		}
+		if ext := strings.ToLower(filepath.Ext(fullPath)); ext != ".exe" {
+			continue
+		}
+		processes = append(processes, ProcessInfo{Name: name, Pid: pid, Cmd: fullPath})
+	}
+	return processes, nil
+}
+
+func decodeProcessOutput(output []byte) ([]byte, error) {
+	reader := transform.NewReader(bytes.NewReader(output), japanese.ShiftJIS.NewDecoder())
+	return io.ReadAll(reader)
+}
+
+func decodeUTF16LE(output []byte) ([]byte, error) {
+	reader := transform.NewReader(bytes.NewReader(output), unicode.UTF16(unicode.LittleEndian, unicode.IgnoreBOM).NewDecoder())
+	return io.ReadAll(reader)
+}
+
+func parseCSVBytes(output []byte) ([][]string, error) {
+	parse := func(data []byte) ([][]string, error) {
+		reader := csv.NewReader(bytes.NewReader(data))
+		reader.LazyQuotes = true
+		reader.TrimLeadingSpace = true
+		return reader.ReadAll()
+	}
+
+	if bytes.Contains(output, []byte{0x00}) {
+		if decoded, err := decodeUTF16LE(output); err == nil {
+			if records, err := parse(decoded); err == nil {
+				return records, nil
+			}
+		}
+	}
+
+	// まずUTF-8の生データを優先して解釈し、失敗時のみShift-JISへフォールバックする。
+	if utf8.Valid(output) {
+		if records, err := parse(output); err == nil {
+			return records, nil
+		}
+	}
+
+	if decoded, err := decodeProcessOutput(output); err == nil {
+		if records, err := parse(decoded); err == nil {
+			return records, nil
+		}
+	}
+
+	return parse(output)
+}
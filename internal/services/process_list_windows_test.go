@@ -0,0 +1,69 @@
+//go:build windows
+
+package services
+
+import (
+	"os"
+	"path/filepath"
+	"strings"
+	"testing"
+	"time"
+)
+
+func TestListProcessesNativeFindsCurrentProcessWithPath(t *testing.T) {
+	exePath, err := os.Executable()
+	if err != nil {
+		t.Fatal(err)
+	}
+	for attempt := 0; attempt < 2; attempt++ { // 2 回目は PID → パスの控えから返る
+		processes, err := listProcessesNative()
+		if err != nil {
+			t.Fatalf("listProcessesNative: %v", err)
+		}
+		found := false
+		for _, proc := range processes {
+			if proc.Pid != os.Getpid() {
+				continue
+			}
+			found = true
+			if !strings.EqualFold(proc.Name, filepath.Base(exePath)) || !strings.EqualFold(filepath.Clean(proc.Cmd), filepath.Clean(exePath)) {
+				t.Fatalf("unexpected entry for current process: %+v (exe %s)", proc, exePath)
+			}
+		}
+		if !found {
+			t.Fatalf("current process %d not listed", os.Getpid())
+		}
+	}
+}
+
+// TestListProcessesNativeRefreshesReusedPID は、同じ名前のまま起動時刻が控えと違う PID（すぐ起動し直したゲーム）を
+// 再利用とみなして控えを捨て、パスと起動時刻を解決し直すことを確認する。
+func TestListProcessesNativeRefreshesReusedPID(t *testing.T) {
+	exePath, err := os.Executable()
+	if err != nil {
+		t.Fatal(err)
+	}
+	pid := uint32(os.Getpid())
+	stale := processPathEntry{name: filepath.Base(exePath), path: `C:\old\` + filepath.Base(exePath), startedAt: time.Unix(1, 0)}
+	nativeProcessPathsMu.Lock()
+	nativeProcessPaths[pid] = stale
+	nativeProcessPathsMu.Unlock()
+
+	processes, err := listProcessesNative()
+	if err != nil {
+		t.Fatalf("listProcessesNative: %v", err)
+	}
+	for _, proc := range processes {
+		if proc.Pid != int(pid) {
+			continue
+		}
+		if !strings.EqualFold(filepath.Clean(proc.Cmd), filepath.Clean(exePath)) {
+			t.Fatalf("reused PID should be resolved again, got %q want %q", proc.Cmd, exePath)
+		}
+		if proc.StartedAt.Equal(stale.startedAt) {
+			t.Fatal("reused PID should carry the new start time")
+		}
+		return
+	}
+	t.Fatalf("current process %d not listed", pid)
+}
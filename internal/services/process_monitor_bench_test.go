@@ -0,0 +1,116 @@
+package services
+
+import (
+	"context"
+	"fmt"
+	"io"
+	"log/slog"
+	"testing"
+
+	"CloudLaunch_Go/internal/domain"
+)
+
+const (
+	benchProcessCount  = 500
+	benchMonitorGames  = 200
+	benchRunningGames  = 3
+	benchProcessPerExe = 8 // 同名のプロセス（svchost.exe など）が並ぶ数
+)
+
+// benchProcesses は監視1回分のプロセス一覧（大半は同名が並ぶシステムプロセスで、末尾に起動中のゲームを含む）。
+func benchProcesses() []ProcessInfo {
+	processes := make([]ProcessInfo, 0, benchProcessCount)
+	for i := range benchProcessCount - benchRunningGames {
+		name := fmt.Sprintf("service%02d.exe", i/benchProcessPerExe)
+		processes = append(processes, ProcessInfo{
+			Name: name,
+			Pid:  1000 + i,
+			Cmd:  `C:\Windows\System32\` + name + ` -k netsvcs -p`,
+		})
+	}
+	for i := range benchRunningGames {
+		processes = append(processes, ProcessInfo{
+			Name: fmt.Sprintf("game%03d.exe", i),
+			Pid:  9000 + i,
+			Cmd:  fmt.Sprintf(`"D:\Games\Title%03d\game%03d.exe" --windowed`, i, i),
+		})
+	}
+	return processes
+}
+
+// benchMonitorLibrary は実行ファイルを設定済みのゲーム 200 件（先頭 benchRunningGames 件が起動中）。
+func benchMonitorLibrary() []domain.Game {
+	games := make([]domain.Game, 0, benchMonitorGames)
+	for i := range benchMonitorGames {
+		games = append(games, domain.Game{
+			ID:      fmt.Sprintf("game-%03d", i),
+			Title:   fmt.Sprintf("Title %03d", i),
+			ExePath: fmt.Sprintf(`D:\Games\Title%03d\game%03d.exe`, i, i),
+		})
+	}
+	return games
+}
+
+func newBenchProcessMonitorService(games []domain.Game, processes []ProcessInfo) *ProcessMonitorService {
+	service := NewProcessMonitorService(fakeProcessMonitorRepository{
+		createPlaySessionFn: func(ctx context.Context, session domain.PlaySession) (*domain.PlaySession, error) {
+			return &session, nil
+		},
+		getGameByIDFn: func(ctx context.Context, gameID string) (*domain.Game, error) { return nil, nil },
+		updateGameFn:  func(ctx context.Context, game domain.Game) (*domain.Game, error) { return &game, nil },
+		listGamesFn: func(ctx context.Context, searchText string, filter domain.PlayStatus, sortBy string, sortDirection string) ([]domain.Game, error) {
+			return games, nil
+		},
+	}, slog.New(slog.NewTextHandler(io.Discard, nil)), nil)
+	service.processProvider = func() ([]ProcessInfo, string) { return processes, "bench" }
+	return service
+}
+
+// BenchmarkNormalizeProcessList はプロセス 500 件の正規化を測る。
+func BenchmarkNormalizeProcessList(b *testing.B) {
+	processes := benchProcesses()
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		normalizeProcessList(processes)
+	}
+}
+
+// BenchmarkMatchGameProcess はゲーム 200 件それぞれについてプロセス 500 件との照合を総当たりで測る
+// （索引を使わない FindProcessIDsByExe・isGameProcessRunning の最悪ケース）。
+func BenchmarkMatchGameProcess(b *testing.B) {
+	games := benchMonitorLibrary()
+	normalized := normalizeProcessList(benchProcesses())
+	service := newBenchProcessMonitorService(games, nil)
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		matched := 0
+		for _, game := range games {
+			if service.isGameProcessRunning(windowsPathBase(game.ExePath), game.ExePath, normalized) {
+				matched++
+			}
+		}
+		if matched != benchRunningGames {
+			b.Fatalf("expected %d running games, got %d", benchRunningGames, matched)
+		}
+	}
+}
+
+// BenchmarkProcessMonitorCheck は監視1回分（列挙結果の正規化・自動検出・監視中ゲームの状態更新）を、
+// 起動中のゲームを監視に載せ終えた定常状態で測る。
+func BenchmarkProcessMonitorCheck(b *testing.B) {
+	service := newBenchProcessMonitorService(benchMonitorLibrary(), benchProcesses())
+	service.checkProcesses()
+	service.mu.Lock()
+	monitored := len(service.monitoredGames)
+	service.mu.Unlock()
+	if monitored != benchRunningGames {
+		b.Fatalf("expected %d monitored games, got %d", benchRunningGames, monitored)
+	}
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		service.checkProcesses()
+	}
+}
@@ -2,26 +2,17 @@
 package services
 
 import (
-	"bytes"
 	"context"
-	"encoding/csv"
 	"encoding/json"
 	"errors"
-	"io"
 	"log/slog"
-	"path/filepath"
-	"strconv"
 	"strings"
 	"sync"
 	"time"
-	"unicode/utf8"
 
 	"CloudLaunch_Go/internal/domain"
 	"CloudLaunch_Go/internal/logging"
 
-	"golang.org/x/text/encoding/japanese"
-	"golang.org/x/text/encoding/unicode"
-	"golang.org/x/text/transform"
 	"golang.org/x/text/unicode/norm"
 )
 
@@ -44,9 +35,10 @@ type MonitoringGame struct {
 
 // ProcessInfo はプロセス情報を保持する。
 type ProcessInfo struct {
-	Name string
-	Pid  int
-	Cmd  string
+	Name      string
+	Pid       int
+	Cmd       string
+	StartedAt time.Time // プロセスの起動時刻。列挙方法によっては取得できずゼロ値
 }
 
 type normalizedProcess struct {
@@ -72,9 +64,21 @@ func normalizeProcessList(processes []ProcessInfo) []normalizedProcess {
 	return normalizedProcesses
 }
 
-// afterPlaySyncer はプレイ終了後の自動 Push を抽象化するインターフェース。
+// gameIndexMaxAge は実行ファイル索引を無効化の通知が無くても作り直す間隔。
+const gameIndexMaxAge = 10 * time.Minute
+
+// indexedGame は自動検出の索引に載せるゲーム（実行ファイルパス設定済みのもの）。
+type indexedGame struct {
+	id      string
+	title   string
+	exePath string
+	exeName string
+}
+
+// afterPlaySyncer はプレイ終了後のセーブハッシュ計算と自動 Push を抽象化するインターフェース。
 type afterPlaySyncer interface {
 	Push(ctx context.Context, gameID string, onProgress ProgressFunc) error
+	LocalSaveHash(ctx context.Context, gameID, saveFolderPath string) (string, error)
 }
 
 // ProcessMonitorService はゲームプロセス監視を提供する。
@@ -85,16 +89,33 @@ type ProcessMonitorService struct {
 	processProvider    func() ([]ProcessInfo, string)
 	monitoredGames     map[string]*MonitoringGame
 	autoTracking       bool
-	monitoringInterval *time.Ticker
-	monitoringStop     chan struct{}
+	monitoringStop     chan struct{} // 監視中のみ非 nil。閉じると監視ループと終了待機が止まる
 	mu                 sync.Mutex
-	interval           time.Duration
+	interval           time.Duration // 状態が動いている間のポーリング間隔
+	idleInterval       time.Duration // 何も起きていない間のポーリング間隔
+	transitionWindow   time.Duration // 開始・終了の検知後に interval で見続ける時間
 	sessionTimeout     time.Duration
 	gameCleanupTimeout time.Duration
+	// 以下は監視ループの間隔調整用（service.mu で保護）。
+	// fastUntil までは interval、それ以降は idleInterval で列挙する。終了待機できないプレイ中プロセスが
+	// あればポーリングでしか終了を検知できないため、watchMissing の間も interval を使う。
+	fastUntil    time.Time
+	watchMissing bool
+	exitWatches  map[int]struct{} // 終了待機中の PID
+	lastCheckAt  time.Time        // 直前の列挙の開始時刻（ゼロ値なら監視開始直後）
+	wake         chan struct{}    // プロセス終了の通知で次の列挙を前倒しする
+	// gameIndex は自動検出用の「正規化した実行ファイル名 → ゲーム」索引（gameIndexMu で保護）。
+	// 毎回の列挙で全ゲームを読み直さないよう一度だけ組み立て、ゲームの作成・更新・削除や Pull で
+	// InvalidateGameIndex により捨てる。フックを通らない書き込みに備えて gameIndexMaxAge で作り直す。
+	gameIndexMu      sync.Mutex
+	gameIndex        map[string][]indexedGame
+	gameIndexBuiltAt time.Time
 	// lastProcesses は直近の非空プロセス一覧スナップショット（service.mu で保護）。
 	// 監視ループが定期更新するため、ホットキー撮影時の再列挙をほぼ不要にする。
 	lastProcesses   []ProcessInfo
 	lastProcessesAt time.Time
+	// metrics は監視ループ1回分（monitor.tick）とプロセス列挙（monitor.enumerate）の計測先（nil なら計測しない）。
+	metrics *PerfMetrics
 }
 
 // NewProcessMonitorService は ProcessMonitorService を生成する。
@@ -106,20 +127,32 @@ func NewProcessMonitorService(repository ProcessMonitorRepository, logger *slog.
 		monitoredGames:     make(map[string]*MonitoringGame),
 		autoTracking:       true,
 		interval:           2 * time.Second,
+		idleInterval:       5 * time.Second,
+		transitionWindow:   30 * time.Second,
 		sessionTimeout:     0,
 		gameCleanupTimeout: 20 * time.Second,
+		exitWatches:        make(map[int]struct{}),
+		wake:               make(chan struct{}, 1),
 	}
 }
 
+// SetPerfMetrics は監視ループの計測先を設定する。監視開始前に呼ぶこと。
+func (service *ProcessMonitorService) SetPerfMetrics(metrics *PerfMetrics) {
+	service.metrics = metrics
+}
+
 // StartMonitoring は監視を開始する。
+// 列挙の間隔は nextCheckInterval で毎回決め直し、プレイ中のゲームが終了したときは
+// プロセスハンドルの待機（watchProcessExit）で即座に次の列挙を行う。
 func (service *ProcessMonitorService) StartMonitoring() {
 	service.mu.Lock()
-	if service.monitoringInterval != nil {
+	if service.monitoringStop != nil {
 		service.mu.Unlock()
 		return
 	}
-	service.monitoringStop = make(chan struct{})
-	service.monitoringInterval = time.NewTicker(service.interval)
+	stop := make(chan struct{})
+	service.monitoringStop = stop
+	service.lastCheckAt = time.Time{}
 	service.mu.Unlock()
 
 	service.logger.Info("プロセス監視を開始しました")
@@ -132,28 +165,82 @@ func (service *ProcessMonitorService) StartMonitoring() {
 			service.checkProcesses()
 		}
 		tick()
+		timer := time.NewTimer(service.nextCheckInterval())
+		defer timer.Stop()
 		for {
 			select {
-			case <-service.monitoringInterval.C:
-				tick()
-			case <-service.monitoringStop:
+			case <-timer.C:
+			case <-service.wake:
+			case <-stop:
 				return
 			}
+			tick()
+			timer.Reset(service.nextCheckInterval())
 		}
 	}()
 }
 
+// nextCheckInterval は次の列挙までの待ち時間を返す。
+// 開始・終了の前後（transitionWindow）と、終了待機できないプロセスを追っている間は短い間隔で、
+// それ以外は idleInterval で列挙する。終了は待機で即座に分かるため、プレイ中でも間隔を伸ばせる。
+func (service *ProcessMonitorService) nextCheckInterval() time.Duration {
+	service.mu.Lock()
+	defer service.mu.Unlock()
+	if service.watchMissing || time.Now().Before(service.fastUntil) {
+		return service.interval
+	}
+	return service.idleInterval
+}
+
+// markTransition は状態が動いたことを記録し、しばらく短い間隔で列挙させる。
+// service.mu を保持した状態で呼ばれる前提。
+func (service *ProcessMonitorService) markTransition(now time.Time) {
+	service.fastUntil = now.Add(service.transitionWindow)
+}
+
+// watchRunningProcesses はプレイ中のゲームのプロセスのうち、まだ終了待機していないものの待機を始める。
+// service.mu を保持した状態で呼ばれる前提。監視停止中は何もしない。
+func (service *ProcessMonitorService) watchRunningProcesses(pids []int) {
+	service.watchMissing = false
+	stop := service.monitoringStop
+	if stop == nil {
+		return
+	}
+	for _, pid := range pids {
+		if _, watching := service.exitWatches[pid]; watching {
+			continue
+		}
+		exitedPid := pid
+		if !watchProcessExit(pid, stop, func() { service.onProcessExit(exitedPid) }) {
+			service.watchMissing = true
+			continue
+		}
+		service.exitWatches[pid] = struct{}{}
+	}
+}
+
+// onProcessExit は終了待機していたプロセスが終了したときに呼ばれ、監視ループに次の列挙を前倒しさせる。
+func (service *ProcessMonitorService) onProcessExit(pid int) {
+	service.mu.Lock()
+	delete(service.exitWatches, pid)
+	service.markTransition(time.Now())
+	service.mu.Unlock()
+	select {
+	case service.wake <- struct{}{}:
+	default:
+	}
+}
+
 // StopMonitoring は監視を停止する。
 func (service *ProcessMonitorService) StopMonitoring() {
 	service.mu.Lock()
-	if service.monitoringInterval == nil {
+	if service.monitoringStop == nil {
 		service.mu.Unlock()
 		return
 	}
-	service.monitoringInterval.Stop()
 	close(service.monitoringStop)
-	service.monitoringInterval = nil
 	service.monitoringStop = nil
+	service.exitWatches = make(map[int]struct{})
 	service.mu.Unlock()
 
 	service.saveAllActiveSessions()
@@ -164,7 +251,7 @@ func (service *ProcessMonitorService) StopMonitoring() {
 func (service *ProcessMonitorService) IsMonitoring() bool {
 	service.mu.Lock()
 	defer service.mu.Unlock()
-	return service.monitoringInterval != nil
+	return service.monitoringStop != nil
 }
 
 // UpdateAutoTracking は自動ゲーム検出設定を更新する。
@@ -302,6 +389,7 @@ func (service *ProcessMonitorService) addMonitoredGame(gameID string, title stri
 		ExeName:         exeName,
 		AccumulatedTime: 0,
 	}
+	service.markTransition(time.Now())
 	service.logger.Info("ゲーム監視を追加", "title", title, "exeName", exeName, "gameId", gameID)
 }
 
@@ -403,7 +491,13 @@ func (service *ProcessMonitorService) EndSession(gameID string) bool {
 }
 
 func (service *ProcessMonitorService) checkProcesses() {
+	_, span := service.metrics.startSpan(context.Background(), "monitor.tick")
+	defer span.end(nil)
+	scanAt := time.Now()
+	_, enumerateSpan := service.metrics.startSpan(context.Background(), "monitor.enumerate")
 	processes, _ := service.getProcesses()
+	enumerateSpan.addObjects(int64(len(processes)))
+	enumerateSpan.end(nil)
 
 	normalizedProcesses := normalizeProcessList(processes)
 
@@ -423,10 +517,13 @@ func (service *ProcessMonitorService) checkProcesses() {
 	gameIDsToCleanup := make([]string, 0)
 
 	service.mu.Lock()
+	runningPids := make([]int, 0, 2)
 	for _, game := range service.monitoredGames {
-		service.updateMonitoredGameState(game, processMap, now)
+		runningPids = append(runningPids, service.updateMonitoredGameState(game, processMap, now)...)
 	}
+	service.watchRunningProcesses(runningPids)
 	gameIDsToCleanup = service.collectGameIDsToCleanup(now, gameIDsToCleanup)
+	service.lastCheckAt = scanAt
 	service.mu.Unlock()
 
 	for _, session := range sessionsToSave {
@@ -439,35 +536,42 @@ func (service *ProcessMonitorService) checkProcesses() {
 	}
 }
 
-// updateMonitoredGameState は 1 ゲーム分の検知状態を更新する。
+// updateMonitoredGameState は 1 ゲーム分の検知状態を更新し、実行中と判定したプロセスの PID を返す。
 // service.mu を保持した状態で呼ばれる前提（ロックの取得/解放は呼び出し側）。
 // 元コードの paused-running 分岐における continue は、本メソッドでは早期 return に対応する。
 func (service *ProcessMonitorService) updateMonitoredGameState(
 	game *MonitoringGame,
 	processMap map[string][]normalizedProcess,
 	now time.Time,
-) {
+) []int {
 	normalizedExeName := normalizeProcessToken(game.ExeName)
-	matching := processMap[normalizedExeName]
-	isRunning := false
-	if len(matching) > 0 {
-		isRunning = service.isGameProcessRunning(game.ExeName, game.ExePath, matching)
+	var running []normalizedProcess
+	for _, proc := range processMap[normalizedExeName] {
+		if service.matchGameProcess(game.ExeName, game.ExePath, proc) {
+			running = append(running, proc)
+		}
+	}
+	pids := make([]int, 0, len(running))
+	for _, proc := range running {
+		pids = append(pids, proc.info.Pid)
 	}
 
-	if isRunning {
+	if len(running) > 0 {
 		if game.IsPaused {
 			if !game.SuppressResume {
 				game.PendingResume = true
 			}
 			game.LastDetected = &now
 			game.LastNotFound = nil
-			return
+			return pids
 		}
 		game.LastDetected = &now
 		game.LastNotFound = nil
 		if game.PlayStartTime == nil && !game.IsPaused && !game.PendingEnd {
-			game.PlayStartTime = &now
+			startedAt := service.detectedStartTime(running, now)
+			game.PlayStartTime = &startedAt
 			game.AccumulatedTime = 0
+			service.markTransition(now)
 			service.logger.Info("ゲーム開始を検知", "title", game.GameTitle, "exeName", game.ExeName)
 		}
 	} else {
@@ -489,10 +593,30 @@ func (service *ProcessMonitorService) updateMonitoredGameState(
 				game.PlayStartTime = nil
 				game.PendingEnd = true
 				game.LastDetected = nil
+				service.markTransition(now)
 				service.logger.Info("ゲーム終了確認待ち", "title", game.GameTitle, "exeName", game.ExeName)
 			}
 		}
 	}
+	return pids
+}
+
+// detectedStartTime はゲーム開始時刻として記録する時刻を返す。
+// 直前の列挙より後に起動したプロセスならその起動時刻を使い、間隔を伸ばした分だけ開始が遅れて記録されるのを防ぐ。
+// 監視開始前から動いていたプロセス（起動時刻が直前の列挙より前）は、前回終了時に保存済みのぶんと
+// 重複しないよう検知時刻にする。service.mu を保持した状態で呼ばれる前提。
+func (service *ProcessMonitorService) detectedStartTime(running []normalizedProcess, now time.Time) time.Time {
+	if service.lastCheckAt.IsZero() {
+		return now
+	}
+	startedAt := now
+	for _, proc := range running {
+		candidate := proc.info.StartedAt
+		if candidate.After(service.lastCheckAt) && candidate.Before(startedAt) {
+			startedAt = candidate
+		}
+	}
+	return startedAt
 }
 
 // collectGameIDsToCleanup はクリーンアップ対象（一定時間未検出のゲーム）の ID を抽出して append する。
@@ -532,10 +656,9 @@ func (service *ProcessMonitorService) saveSession(game MonitoringGame, endedAt t
 	if current.SaveFolderPath != nil {
 		saveFolderPath := strings.TrimSpace(*current.SaveFolderPath)
 		if saveFolderPath != "" {
-			if snap, hashErr := buildSaveTree(saveFolderPath); hashErr != nil {
+			if h, hashErr := service.localSaveHash(ctx, game.GameID, saveFolderPath); hashErr != nil {
 				service.logger.Warn("ローカルセーブハッシュの計算に失敗", "error", hashErr)
-			} else if snapJSON, merr := json.Marshal(snap); merr == nil {
-				h := hashBytes(snapJSON)
+			} else {
 				current.LocalSaveHash = &h
 				current.LocalSaveHashUpdatedAt = &endedAt
 			}
@@ -551,7 +674,8 @@ func (service *ProcessMonitorService) saveSession(game MonitoringGame, endedAt t
 	if service.cloudSync != nil {
 		go func(gameID string) {
 			defer logging.Recover(service.logger, "process-monitor.afterPlayPush")
-			if err := service.cloudSync.Push(context.Background(), gameID, nil); err != nil {
+			ctx := WithSyncPriority(context.Background(), SyncPriorityPostSession)
+			if err := service.cloudSync.Push(ctx, gameID, nil); err != nil {
 				// オフラインモードはユーザーが明示的に同期を抑止しているので warn 級にしない。
 				if errors.Is(err, ErrOffline) {
 					service.logger.Debug("オフラインモードのためクラウド同期をスキップ", "gameId", gameID)
@@ -563,6 +687,23 @@ func (service *ProcessMonitorService) saveSession(game MonitoringGame, endedAt t
 	}
 }
 
+// localSaveHash はセーブフォルダのハッシュを返す。同期サービスがあればハッシュキャッシュと並列計算を使う
+// （セッション終了のたびに全ファイルを読み直さないため）。
+func (service *ProcessMonitorService) localSaveHash(ctx context.Context, gameID, saveFolderPath string) (string, error) {
+	if service.cloudSync != nil {
+		return service.cloudSync.LocalSaveHash(ctx, gameID, saveFolderPath)
+	}
+	snap, err := buildSaveTree(saveFolderPath, nil, 0)
+	if err != nil {
+		return "", err
+	}
+	snapJSON, err := json.Marshal(snap)
+	if err != nil {
+		return "", err
+	}
+	return hashBytes(snapJSON), nil
+}
+
 func (service *ProcessMonitorService) saveAllActiveSessions() {
 	service.mu.Lock()
 	type pendingSession struct {
@@ -600,9 +741,8 @@ func (service *ProcessMonitorService) autoAddGamesFromDatabase(processes []Proce
 		return
 	}
 
-	ctx := context.Background()
-	games, err := service.repository.ListGames(ctx, "", domain.PlayStatus(""), "title", "asc")
-	if err != nil || len(games) == 0 {
+	index := service.loadGameIndex(context.Background())
+	if len(index) == 0 {
 		return
 	}
 
@@ -614,25 +754,53 @@ func (service *ProcessMonitorService) autoAddGamesFromDatabase(processes []Proce
 		processNames[proc.normalized] = struct{}{}
 	}
 
+	for name := range processNames {
+		for _, game := range index[name] {
+			if !service.isGameProcessRunning(game.exeName, game.exePath, normalized) {
+				continue
+			}
+			service.mu.Lock()
+			if _, exists := service.monitoredGames[game.id]; !exists {
+				service.addMonitoredGame(game.id, game.title, game.exePath)
+			}
+			service.mu.Unlock()
+		}
+	}
+}
+
+// InvalidateGameIndex は実行ファイル索引を捨て、次回の列挙時にゲーム一覧から作り直させる。
+func (service *ProcessMonitorService) InvalidateGameIndex() {
+	service.gameIndexMu.Lock()
+	service.gameIndex = nil
+	service.gameIndexMu.Unlock()
+}
+
+// loadGameIndex は実行ファイル索引を返す。未作成・期限切れなら ListGames から作る。
+// 取得に失敗した場合は nil を返し、索引は次回また作り直す。
+func (service *ProcessMonitorService) loadGameIndex(ctx context.Context) map[string][]indexedGame {
+	service.gameIndexMu.Lock()
+	defer service.gameIndexMu.Unlock()
+	if service.gameIndex != nil && time.Since(service.gameIndexBuiltAt) < gameIndexMaxAge {
+		return service.gameIndex
+	}
+	games, err := service.repository.ListGames(ctx, "", domain.PlayStatus(""), "title", "asc")
+	if err != nil {
+		// 列挙のたびに呼ばれるため、DB 障害時にログを埋め尽くさないよう Debug に留める
+		service.logger.Debug("自動検出用のゲーム一覧取得に失敗", "error", err)
+		return nil
+	}
+	index := make(map[string][]indexedGame)
 	for _, game := range games {
 		if game.ExePath == "" || game.ExePath == UnconfiguredExePath {
 			continue
 		}
 		exeName := windowsPathBase(game.ExePath)
-		normalizedExe := normalizeProcessToken(exeName)
-		if _, ok := processNames[normalizedExe]; !ok {
-			continue
-		}
-		if !service.isGameProcessRunning(exeName, game.ExePath, normalized) {
-			continue
-		}
-
-		service.mu.Lock()
-		if _, exists := service.monitoredGames[game.ID]; !exists {
-			service.addMonitoredGame(game.ID, game.Title, game.ExePath)
-		}
-		service.mu.Unlock()
+		key := normalizeProcessToken(exeName)
+		index[key] = append(index[key], indexedGame{id: game.ID, title: game.Title, exePath: game.ExePath, exeName: exeName})
 	}
+	service.gameIndex = index
+	service.gameIndexBuiltAt = time.Now()
+	return index
 }
 
 func (service *ProcessMonitorService) isGameProcessRunning(
@@ -709,152 +877,10 @@ func (service *ProcessMonitorService) FindProcessIDsByExe(exePath string) ([]int
 	return ids, nil
 }
 
+// getProcessesNative は Toolhelp32 スナップショットで列挙する（process_list_windows.go）。
+// 子プロセスを起動しないため、監視間隔ごとの PowerShell 起動による CPU・メモリ負荷が無い。
 func (service *ProcessMonitorService) getProcessesNative() ([]ProcessInfo, error) {
-	return service.getProcessesPowerShell()
-}
-
-func (service *ProcessMonitorService) getProcessesPowerShell() ([]ProcessInfo, error) {
-	ctx, cancel := context.WithTimeout(context.Background(), 5*time.Second)
-	defer cancel()
-	command := execCommandHidden(
-		ctx,
-		"powershell",
-		"-Command",
-		`$OutputEncoding=[System.Text.Encoding]::UTF8; Get-Process | Select-Object ProcessName, Id, Path | ConvertTo-Csv -NoTypeInformation`,
-	)
-	output, err := command.Output()
-	if err != nil {
-		return nil, err
-	}
-
-	records, err := parseCSVBytes(output)
-	if err != nil {
-		return nil, err
-	}
-
-	processes := make([]ProcessInfo, 0, len(records))
-	for i, record := range records {
-		if i == 0 {
-			continue
-		}
-		if len(record) < 3 {
-			continue
-		}
-		name := strings.TrimSpace(record[0])
-		pidStr := strings.TrimSpace(record[1])
-		fullPath := strings.TrimSpace(record[2])
-		pid, err := strconv.Atoi(pidStr)
-		if err != nil || pid <= 0 || name == "" {
-			continue
-		}
-		if !strings.HasSuffix(strings.ToLower(name), ".exe") {
-			name += ".exe"
-		}
-		if fullPath == "" {
-			fullPath = name
-		}
-		if ext := strings.ToLower(filepath.Ext(fullPath)); ext != ".exe" {
-			continue
-		}
-		processes = append(processes, ProcessInfo{Name: name, Pid: pid, Cmd: fullPath})
-	}
-	return processes, nil
-}
-
-func (service *ProcessMonitorService) getProcessesFallback() ([]ProcessInfo, error) {
-	return service.getProcessesWmic()
-}
-
-func (service *ProcessMonitorService) getProcessesWmic() ([]ProcessInfo, error) {
-	ctx, cancel := context.WithTimeout(context.Background(), 5*time.Second)
-	defer cancel()
-	command := execCommandHidden(
-		ctx,
-		"wmic",
-		"process",
-		"get",
-		"Name,ProcessId,ExecutablePath",
-		"/FORMAT:CSV",
-	)
-	output, err := command.Output()
-	if err != nil {
-		return nil, err
-	}
-
-	records, err := parseCSVBytes(output)
-	if err != nil {
-		return nil, err
-	}
-
-	processes := make([]ProcessInfo, 0, len(records))
-	for _, record := range records {
-		if len(record) < 4 {
-			continue
-		}
-		name := strings.TrimSpace(record[1])
-		pidStr := strings.TrimSpace(record[2])
-		fullPath := strings.TrimSpace(record[3])
-		if name == "" || pidStr == "" {
-			continue
-		}
-		pid, err := strconv.Atoi(pidStr)
-		if err != nil || pid <= 0 {
-			continue
-		}
-		if !strings.HasSuffix(strings.ToLower(name), ".exe") {
-			name += ".exe"
-		}
-		if fullPath == "" {
-			fullPath = name
-		}
-		if ext := strings.ToLower(filepath.Ext(fullPath)); ext != ".exe" {
-			continue
-		}
-		processes = append(processes, ProcessInfo{Name: name, Pid: pid, Cmd: fullPath})
-	}
-	return processes, nil
-}
-
-func decodeProcessOutput(output []byte) ([]byte, error) {
-	reader := transform.NewReader(bytes.NewReader(output), japanese.ShiftJIS.NewDecoder())
-	return io.ReadAll(reader)
-}
-
-func decodeUTF16LE(output []byte) ([]byte, error) {
-	reader := transform.NewReader(bytes.NewReader(output), unicode.UTF16(unicode.LittleEndian, unicode.IgnoreBOM).NewDecoder())
-	return io.ReadAll(reader)
-}
-
-func parseCSVBytes(output []byte) ([][]string, error) {
-	parse := func(data []byte) ([][]string, error) {
-		reader := csv.NewReader(bytes.NewReader(data))
-		reader.LazyQuotes = true
-		reader.TrimLeadingSpace = true
-		return reader.ReadAll()
-	}
-
-	if bytes.Contains(output, []byte{0x00}) {
-		if decoded, err := decodeUTF16LE(output); err == nil {
-			if records, err := parse(decoded); err == nil {
-				return records, nil
-			}
-		}
-	}
-
-	// まずUTF-8の生データを優先して解釈し、失敗時のみShift-JISへフォールバックする。
-	if utf8.Valid(output) {
-		if records, err := parse(output); err == nil {
-			return records, nil
-		}
-	}
-
-	if decoded, err := decodeProcessOutput(output); err == nil {
-		if records, err := parse(decoded); err == nil {
-			return records, nil
-		}
-	}
-
-	return parse(output)
+	return listProcessesNative()
 }
 
 func (service *ProcessMonitorService) getProcesses() ([]ProcessInfo, string) {
@@ -4,6 +4,7 @@ import (
 	"context"
 	"io"
 	"log/slog"
+	"sync"
 	"testing"
 	"time"
 
@@ -449,3 +450,132 @@ func TestProcessMonitorServiceFindProcessIDsByExeUsesCache(t *testing.T) {
 		t.Fatalf("unexpected process ids: %#v", ids)
 	}
 }
+
+// TestProcessMonitorServiceUsesProcessStartTimeAndAdaptiveInterval は、直前の列挙より後に起動したプロセスの
+// 起動時刻がプレイ開始時刻になり、状態が動いた直後だけ短い間隔で列挙することを検証する。
+func TestProcessMonitorServiceUsesProcessStartTimeAndAdaptiveInterval(t *testing.T) {
+	t.Parallel()
+
+	service := newTestProcessMonitorService()
+	service.mu.Lock()
+	service.addMonitoredGame("game-1", "Game", `C:\games\game.exe`)
+	service.fastUntil = time.Time{}
+	service.mu.Unlock()
+
+	var processes []ProcessInfo
+	service.processProvider = func() ([]ProcessInfo, string) { return processes, "test" }
+
+	service.checkProcesses()
+	if got := service.nextCheckInterval(); got != service.idleInterval {
+		t.Fatalf("idle monitor should poll slowly, got %v", got)
+	}
+
+	startedAt := time.Now()
+	processes = []ProcessInfo{{Name: "game.exe", Pid: 42, Cmd: `C:\games\game.exe`, StartedAt: startedAt}}
+	service.checkProcesses()
+
+	service.mu.Lock()
+	playStart := service.monitoredGames["game-1"].PlayStartTime
+	service.mu.Unlock()
+	if playStart == nil || !playStart.Equal(startedAt) {
+		t.Fatalf("expected play start %v, got %v", startedAt, playStart)
+	}
+	if got := service.nextCheckInterval(); got != service.interval {
+		t.Fatalf("monitor should poll quickly right after a start, got %v", got)
+	}
+}
+
+// TestProcessMonitorServiceAutoAddGamesReusesGameIndexUntilInvalidated は、自動検出が毎回 ListGames を
+// 呼ばずに索引を使い回し、InvalidateGameIndex 後だけ読み直すことを検証する。
+func TestProcessMonitorServiceAutoAddGamesReusesGameIndexUntilInvalidated(t *testing.T) {
+	t.Parallel()
+
+	listCalls := 0
+	games := []domain.Game{{ID: "game-1", Title: "Game", ExePath: `C:\games\game.exe`}}
+	service := NewProcessMonitorService(fakeProcessMonitorRepository{
+		listGamesFn: func(ctx context.Context, searchText string, filter domain.PlayStatus, sortBy string, sortDirection string) ([]domain.Game, error) {
+			listCalls++
+			return games, nil
+		},
+	}, slog.New(slog.NewTextHandler(io.Discard, nil)), nil)
+
+	processes := []ProcessInfo{{Name: "other.exe", Pid: 1, Cmd: `C:\games\other.exe`}}
+	normalized := normalizeProcessList(processes)
+	service.autoAddGamesFromDatabase(processes, normalized)
+	service.autoAddGamesFromDatabase(processes, normalized)
+	if listCalls != 1 {
+		t.Fatalf("expected the index to be built once, ListGames called %d times", listCalls)
+	}
+
+	// 実行ファイルの変更は無効化後に反映される
+	games = []domain.Game{{ID: "game-1", Title: "Game", ExePath: `C:\games\other.exe`}}
+	service.InvalidateGameIndex()
+	service.autoAddGamesFromDatabase(processes, normalized)
+	if listCalls != 2 {
+		t.Fatalf("expected a rebuild after invalidation, ListGames called %d times", listCalls)
+	}
+	if _, ok := service.monitoredGames["game-1"]; !ok {
+		t.Fatal("expected the game with the updated exe path to be added")
+	}
+}
+
+// fakeAfterPlaySyncer は LocalSaveHash の呼び出しを記録し、固定のハッシュを返す。Push は何もしない。
+type fakeAfterPlaySyncer struct {
+	mu         sync.Mutex
+	hashedDirs []string
+	pushed     chan string
+}
+
+func (syncer *fakeAfterPlaySyncer) Push(_ context.Context, gameID string, _ ProgressFunc) error {
+	syncer.pushed <- gameID
+	return nil
+}
+
+func (syncer *fakeAfterPlaySyncer) LocalSaveHash(_ context.Context, _ string, saveFolderPath string) (string, error) {
+	syncer.mu.Lock()
+	defer syncer.mu.Unlock()
+	syncer.hashedDirs = append(syncer.hashedDirs, saveFolderPath)
+	return "cached-hash", nil
+}
+
+// TestProcessMonitorServiceSaveSessionHashesThroughSyncer は、セッション終了時のセーブハッシュを
+// 同期サービス（ハッシュキャッシュ・並列計算付き）に計算させ、その値をゲームに記録することを確認する。
+func TestProcessMonitorServiceSaveSessionHashesThroughSyncer(t *testing.T) {
+	t.Parallel()
+
+	saveDir := t.TempDir()
+	var updatedGame domain.Game
+	syncer := &fakeAfterPlaySyncer{pushed: make(chan string, 1)}
+	service := NewProcessMonitorService(fakeProcessMonitorRepository{
+		createPlaySessionFn: func(ctx context.Context, session domain.PlaySession) (*domain.PlaySession, error) {
+			return &session, nil
+		},
+		getGameByIDFn: func(ctx context.Context, gameID string) (*domain.Game, error) {
+			return &domain.Game{ID: gameID, Title: "Game", SaveFolderPath: &saveDir}, nil
+		},
+		updateGameFn: func(ctx context.Context, game domain.Game) (*domain.Game, error) {
+			updatedGame = game
+			return &game, nil
+		},
+		listGamesFn: func(ctx context.Context, searchText string, filter domain.PlayStatus, sortBy string, sortDirection string) ([]domain.Game, error) {
+			return nil, nil
+		},
+	}, slog.New(slog.NewTextHandler(io.Discard, nil)), syncer)
+
+	service.saveSession(MonitoringGame{GameID: "game-1", ExeName: "game.exe", AccumulatedTime: 30}, time.Now())
+
+	syncer.mu.Lock()
+	hashedDirs := append([]string(nil), syncer.hashedDirs...)
+	syncer.mu.Unlock()
+	if len(hashedDirs) != 1 || hashedDirs[0] != saveDir {
+		t.Fatalf("expected the save folder to be hashed through the syncer once, got %v", hashedDirs)
+	}
+	if updatedGame.LocalSaveHash == nil || *updatedGame.LocalSaveHash != "cached-hash" {
+		t.Fatalf("expected the syncer's hash to be stored, got %v", updatedGame.LocalSaveHash)
+	}
+	select {
+	case <-syncer.pushed:
+	case <-time.After(time.Second):
+		t.Fatal("expected the post-session push to run")
+	}
+}
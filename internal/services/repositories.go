@@ -11,6 +11,7 @@ import (
 // GameRepository は GameService が必要とする永続化境界を定義する。
 type GameRepository interface {
 	ListGames(ctx context.Context, searchText string, filter domain.PlayStatus, sortBy string, sortDirection string) ([]domain.Game, error)
+	ListGamesPage(ctx context.Context, query domain.GameListQuery) (domain.GamePage, error)
 	GetGameByID(ctx context.Context, gameID string) (*domain.Game, error)
 	CreateGame(ctx context.Context, game domain.Game) (*domain.Game, error)
 	UpdateGame(ctx context.Context, game domain.Game) (*domain.Game, error)
@@ -40,9 +41,17 @@ type MemoRepository interface {
 	FindMemoByTitle(ctx context.Context, gameID string, title string) (*domain.Memo, error)
 	ListMemosByGame(ctx context.Context, gameID string) ([]domain.Memo, error)
 	ListAllMemos(ctx context.Context) ([]domain.Memo, error)
+	SearchMemos(ctx context.Context, query domain.MemoSearchQuery) (domain.MemoPage, error)
 	DeleteMemo(ctx context.Context, memoID string) error
 }
 
+// MemoCloudStateRepository は MemoCloudService がクラウドとの同期状態の控えに使う永続化境界を定義する。
+// 控えはダウンロードを省くためだけに使うので、読み書きに失敗しても同期は続行できる。
+type MemoCloudStateRepository interface {
+	ListMemoCloudStates(ctx context.Context, gameID string) ([]domain.MemoCloudState, error)
+	SaveMemoCloudState(ctx context.Context, state domain.MemoCloudState) error
+}
+
 // RouteRepository は RouteService が必要とする永続化境界を定義する。
 type RouteRepository interface {
 	ListRoutesByGame(ctx context.Context, gameID string) ([]domain.Route, error)
@@ -73,12 +82,35 @@ type ContentSyncRepository interface {
 	ApplyPullResult(ctx context.Context, game domain.Game, sessions []domain.PlaySession, syncHead, saveTree string) error
 	GetSetting(ctx context.Context, key string) (string, error)
 	UpsertSetting(ctx context.Context, key, value string) error
+	// GetSaveHashCache / UpdateSaveHashCache はセーブファイルの (size, mtime) → hash キャッシュを読み書きする。
+	// キャッシュは最適化用途のみで、読み書き失敗時も呼び出し側はハッシュを再計算して続行できる。
+	GetSaveHashCache(ctx context.Context, gameID string) (map[string]domain.SaveHashCacheEntry, error)
+	UpdateSaveHashCache(ctx context.Context, gameID string, upserts map[string]domain.SaveHashCacheEntry, deletes []string) error
+	// GetRemoteBlobIndex / SaveRemoteBlobIndex / ClearRemoteBlobIndex はリモートに存在が確認済みのブロブの控えを読み書きする。
+	// 控えが無い・壊れている場合は全件列挙に戻るだけなので、失敗しても同期は続行できる。
+	GetRemoteBlobIndex(ctx context.Context, gameID string) (*domain.RemoteBlobIndex, error)
+	SaveRemoteBlobIndex(ctx context.Context, gameID string, index domain.RemoteBlobIndex, replace bool) error
+	ClearRemoteBlobIndex(ctx context.Context, gameID string) error
+	// GetTransferJournal 〜 ClearTransferJournal は中断した Push / Pull の再開用の進捗記録を読み書きする。
+	// 記録は再開の近道にしか使わないため、失敗しても最初から転送し直せば同期は続行できる。
+	GetTransferJournal(ctx context.Context, gameID, direction string) (*domain.TransferJournal, error)
+	StartTransferJournal(ctx context.Context, gameID, direction, head string, startedAt int64) error
+	AppendTransferJournal(ctx context.Context, gameID, direction string, entries []domain.TransferJournalEntry) error
+	ClearTransferJournal(ctx context.Context, gameID, direction string) error
+	// ListMultipartUploads 〜 DeleteMultipartUploadsBefore は未完了マルチパートアップロードの ID を読み書きする。
+	ListMultipartUploads(ctx context.Context, gameID string) ([]domain.MultipartUpload, error)
+	SaveMultipartUpload(ctx context.Context, upload domain.MultipartUpload) error
+	DeleteMultipartUpload(ctx context.Context, key string) error
+	DeleteMultipartUploadsBefore(ctx context.Context, before int64) error
 }
 
 // MaintenanceRepository は MaintenanceService が必要とする永続化境界を定義する。
 type MaintenanceRepository interface {
 	ListGames(ctx context.Context, searchText string, filter domain.PlayStatus, sortBy string, sortDirection string) ([]domain.Game, error)
 	ListPlaySessionsByGames(ctx context.Context, gameIDs []string) (map[string][]domain.PlaySession, error)
+	ListGameStats(ctx context.Context) (map[string]domain.GameStats, error)
+	// RebuildGameStats はセッションから集計を作り直し、食い違っていたゲーム・ルートの数を返す。
+	RebuildGameStats(ctx context.Context) (int, error)
 }
 
 // ScreenshotRepository は ScreenshotService が必要とする永続化境界を定義する。
@@ -0,0 +1,108 @@
+// セーブファイルの (size, mtime) → hash キャッシュを提供する。
+package services
+
+import (
+	"os"
+	"sort"
+	"sync"
+	"time"
+
+	"CloudLaunch_Go/internal/domain"
+)
+
+// saveHashRacyWindow より新しい mtime のファイルはキャッシュに記録しない。
+// FAT32 等の粗い mtime 分解能（2 秒）では、ハッシュ計算と同じ刻み内に書き換えられると
+// stat が一致したまま内容だけ変わりうる（git の "racy" 問題と同じ）。次回走査で再ハッシュさせる。
+const saveHashRacyWindow = 2 * time.Second
+
+// saveHashCache はゲーム1件分の relPath → (size, mtime, hash) キャッシュ。
+// 走査時の stat がキャッシュと一致するファイルは SHA-256 を再計算しない。
+// nil レシーバでも動作し、その場合は常にハッシュを計算する（キャッシュ無効）。
+// 走査の並列化に備えて hash は複数 goroutine から呼んでよい。
+type saveHashCache struct {
+	mu       sync.Mutex
+	paranoid bool
+	now      func() time.Time
+	cached   map[string]domain.SaveHashCacheEntry
+	seen     map[string]struct{}
+	upserts  map[string]domain.SaveHashCacheEntry
+	racy     map[string]struct{}
+}
+
+// newSaveHashCache は DB から読み込んだエントリでキャッシュを作る。
+// paranoid が true の場合はヒットを信用せず常に再ハッシュする（結果の記録は行う）。
+func newSaveHashCache(cached map[string]domain.SaveHashCacheEntry, paranoid bool) *saveHashCache {
+	if cached == nil {
+		cached = make(map[string]domain.SaveHashCacheEntry)
+	}
+	return &saveHashCache{
+		paranoid: paranoid,
+		now:      time.Now,
+		cached:   cached,
+		seen:     make(map[string]struct{}),
+		upserts:  make(map[string]domain.SaveHashCacheEntry),
+		racy:     make(map[string]struct{}),
+	}
+}
+
+// hash は absPath のハッシュを返す。info のサイズ・mtime がキャッシュと一致すればファイルを読まない。
+func (c *saveHashCache) hash(absPath, relPath string, info os.FileInfo) (domain.BlobHash, error) {
+	if c == nil {
+		return hashFileStream(absPath)
+	}
+	size, modTime := info.Size(), info.ModTime().UnixNano()
+	c.mu.Lock()
+	entry, ok := c.cached[relPath]
+	c.mu.Unlock()
+	if ok && !c.paranoid && entry.Size == size && entry.ModTime == modTime {
+		c.record(relPath, entry, info.ModTime())
+		return entry.Hash, nil
+	}
+	hash, err := hashFileStream(absPath)
+	if err != nil {
+		return "", err
+	}
+	c.record(relPath, domain.SaveHashCacheEntry{Size: size, ModTime: modTime, Hash: hash}, info.ModTime())
+	return hash, nil
+}
+
+func (c *saveHashCache) record(relPath string, entry domain.SaveHashCacheEntry, modTime time.Time) {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	c.seen[relPath] = struct{}{}
+	delete(c.upserts, relPath)
+	delete(c.racy, relPath)
+	if c.now().Sub(modTime) < saveHashRacyWindow {
+		// racy なエントリは保存しない。古い値が残っていれば changes で削除させる。
+		c.racy[relPath] = struct{}{}
+		return
+	}
+	if prev, ok := c.cached[relPath]; !ok || prev != entry {
+		c.upserts[relPath] = entry
+	}
+}
+
+// changes は DB へ反映すべき差分を返す。
+// prune が true（saveDir 全体を走査した直後）の場合、今回見なかったパスの古いエントリも削除対象にする。
+// racy で記録を見送ったパスの古いエントリは prune に関係なく削除する。
+func (c *saveHashCache) changes(prune bool) (map[string]domain.SaveHashCacheEntry, []string) {
+	if c == nil {
+		return nil, nil
+	}
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	upserts := make(map[string]domain.SaveHashCacheEntry, len(c.upserts))
+	for relPath, entry := range c.upserts {
+		upserts[relPath] = entry
+	}
+	var deletes []string
+	for relPath := range c.cached {
+		_, racy := c.racy[relPath]
+		_, seen := c.seen[relPath]
+		if racy || (prune && !seen) {
+			deletes = append(deletes, relPath)
+		}
+	}
+	sort.Strings(deletes)
+	return upserts, deletes
+}
@@ -0,0 +1,116 @@
+package services
+
+import (
+	"os"
+	"path/filepath"
+	"testing"
+	"time"
+
+	"CloudLaunch_Go/internal/domain"
+)
+
+// writeOldFile は racy 判定に掛からないよう mtime を過去に設定したファイルを作る。
+func writeOldFile(t *testing.T, path string, content []byte) os.FileInfo {
+	t.Helper()
+	if err := os.WriteFile(path, content, 0o600); err != nil {
+		t.Fatal(err)
+	}
+	old := time.Now().Add(-time.Hour)
+	if err := os.Chtimes(path, old, old); err != nil {
+		t.Fatal(err)
+	}
+	info, err := os.Stat(path)
+	if err != nil {
+		t.Fatal(err)
+	}
+	return info
+}
+
+// TestSaveHashCacheHitSkipsRehash は stat が一致すればファイルを読まずキャッシュの値を返し、
+// paranoid 時は再ハッシュすることを確認する。キャッシュ値をわざと実体と違う値にして見分ける。
+func TestSaveHashCacheHitSkipsRehash(t *testing.T) {
+	t.Parallel()
+	dir := t.TempDir()
+	info := writeOldFile(t, filepath.Join(dir, "a.sav"), []byte("aaa"))
+	cached := map[string]domain.SaveHashCacheEntry{
+		"a.sav": {Size: info.Size(), ModTime: info.ModTime().UnixNano(), Hash: "cached-hash"},
+	}
+
+	tree, err := buildSaveTree(dir, newSaveHashCache(cached, false), 0)
+	if err != nil {
+		t.Fatalf("buildSaveTree: %v", err)
+	}
+	if tree.Files["a.sav"] != "cached-hash" {
+		t.Fatalf("expected cached hash, got %s", tree.Files["a.sav"])
+	}
+
+	paranoid := newSaveHashCache(cached, true)
+	tree, err = buildSaveTree(dir, paranoid, 0)
+	if err != nil {
+		t.Fatalf("buildSaveTree(paranoid): %v", err)
+	}
+	if want := hashBytes([]byte("aaa")); tree.Files["a.sav"] != want {
+		t.Fatalf("paranoid should rehash: got %s want %s", tree.Files["a.sav"], want)
+	}
+	upserts, _ := paranoid.changes(true)
+	if upserts["a.sav"].Hash != hashBytes([]byte("aaa")) {
+		t.Fatalf("paranoid rehash should refresh cache entry, got %+v", upserts)
+	}
+}
+
+// TestSaveHashCacheStatChangeRehashesAndPrunes は size / mtime の変化で再ハッシュされ、
+// 全走査後に消えたファイルのエントリが削除対象になることを確認する。
+func TestSaveHashCacheStatChangeRehashesAndPrunes(t *testing.T) {
+	t.Parallel()
+	dir := t.TempDir()
+	info := writeOldFile(t, filepath.Join(dir, "a.sav"), []byte("new content"))
+	cached := map[string]domain.SaveHashCacheEntry{
+		"a.sav":    {Size: 3, ModTime: info.ModTime().UnixNano(), Hash: "stale"},
+		"gone.sav": {Size: 1, ModTime: 1, Hash: "gone"},
+	}
+	cache := newSaveHashCache(cached, false)
+
+	tree, err := buildSaveTree(dir, cache, 0)
+	if err != nil {
+		t.Fatalf("buildSaveTree: %v", err)
+	}
+	want := hashBytes([]byte("new content"))
+	if tree.Files["a.sav"] != want {
+		t.Fatalf("expected rehash on size change: got %s want %s", tree.Files["a.sav"], want)
+	}
+	upserts, deletes := cache.changes(true)
+	if len(upserts) != 1 || upserts["a.sav"].Hash != want || upserts["a.sav"].Size != info.Size() {
+		t.Fatalf("unexpected upserts: %+v", upserts)
+	}
+	if len(deletes) != 1 || deletes[0] != "gone.sav" {
+		t.Fatalf("unexpected deletes: %v", deletes)
+	}
+	// prune=false（部分走査）では見ていないパスを消さない
+	if _, deletes := cache.changes(false); len(deletes) != 0 {
+		t.Fatalf("partial scan must not prune, got %v", deletes)
+	}
+}
+
+// TestSaveHashCacheSkipsRacyEntries は mtime が新しすぎるファイルを記録せず、
+// 古いエントリを削除させることを確認する（同一 mtime 刻み内の書き換えを見逃さないため）。
+func TestSaveHashCacheSkipsRacyEntries(t *testing.T) {
+	t.Parallel()
+	dir := t.TempDir()
+	if err := os.WriteFile(filepath.Join(dir, "a.sav"), []byte("fresh"), 0o600); err != nil {
+		t.Fatal(err)
+	}
+	cache := newSaveHashCache(map[string]domain.SaveHashCacheEntry{
+		"a.sav": {Size: 1, ModTime: 1, Hash: "old"},
+	}, false)
+
+	if _, err := buildSaveTree(dir, cache, 0); err != nil {
+		t.Fatalf("buildSaveTree: %v", err)
+	}
+	upserts, deletes := cache.changes(false)
+	if len(upserts) != 0 {
+		t.Fatalf("racy entry must not be cached: %+v", upserts)
+	}
+	if len(deletes) != 1 || deletes[0] != "a.sav" {
+		t.Fatalf("stale entry for racy file should be deleted, got %v", deletes)
+	}
+}
@@ -28,6 +28,19 @@ func buildScreencapArgs(pid int, outPath string, localJpeg bool, jpegQuality int
 	return args
 }
 
+// buildScreencapServeArgs は screencap-cli.exe を常駐モード（serve サブコマンド）で起動する引数を返す。
+// 常駐モードは stdin から1行1件の screencapRequest を受け、cap と同じ結果JSONに id を付けて1行ずつ返す。
+// プロセス起動と WGC の初期化を撮影のたびに繰り返さないため。
+func buildScreencapServeArgs() []string {
+	return []string{"serve", "--json", "--no-log"}
+}
+
+// screencapRequest は常駐モードへの撮影要求。Args は buildScreencapArgs と同じ cap サブコマンドの引数。
+type screencapRequest struct {
+	ID   uint64   `json:"id"`
+	Args []string `json:"args"`
+}
+
 func normalizeJpegQuality(value int) int {
 	if value < 1 || value > 100 {
 		return 85
@@ -36,7 +49,9 @@ func normalizeJpegQuality(value int) int {
 }
 
 // screencapResult は screencap-cli の --json 出力（成功/失敗共通）を表す。使用するフィールドのみ定義する。
+// ID は常駐モードで要求の id をそのまま返したもの（cap の単発実行では 0）。
 type screencapResult struct {
+	ID         uint64              `json:"id,omitempty"`
 	OK         bool                `json:"ok"`
 	OutPath    string              `json:"out_path"`
 	ImageStats screencapImageStats `json:"image_stats"`
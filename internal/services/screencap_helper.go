@@ -0,0 +1,185 @@
+// screencap-cli の常駐モード（serve）とのやり取りを提供する。プロセスの起動はプラットフォーム側で行う。
+package services
+
+import (
+	"bufio"
+	"bytes"
+	"context"
+	"encoding/json"
+	"errors"
+	"fmt"
+	"io"
+	"log/slog"
+	"sync"
+	"time"
+)
+
+var (
+	// errScreencapHelperExited は常駐プロセスが終了した（serve に対応していない版を含む）ことを表す。
+	errScreencapHelperExited = errors.New("screencap-cli の常駐プロセスが終了しました")
+	// errScreencapHelperTimeout は常駐プロセスが時間内に応答しなかったことを表す。
+	errScreencapHelperTimeout = errors.New("screencap-cli の常駐プロセスが応答しません")
+	// errScreencapHelperProtocol は常駐プロセスの応答が serve の形式でなかったことを表す。
+	errScreencapHelperProtocol = errors.New("screencap-cli の常駐プロセスの応答を解析できません")
+)
+
+// screencapHelper は常駐させた screencap-cli の stdin / stdout を介して撮影要求をやり取りする。
+// 要求は1件ずつ直列に送り、応答は id で対応づける（時間切れにした要求への遅れた応答は読み捨てる）。
+type screencapHelper struct {
+	stdin   io.WriteCloser
+	lines   chan []byte
+	exited  chan struct{}
+	closing chan struct{}
+	stop    func() error
+
+	mu        sync.Mutex
+	nextID    uint64
+	served    int
+	closeOnce sync.Once
+	closeErr  error
+}
+
+// newScreencapHelper は起動済みプロセスの stdin / stdout から screencapHelper を作る。
+// stop はプロセスの終了を待つ（必要なら強制終了する）関数で、close から1回だけ呼ばれる。
+func newScreencapHelper(stdin io.WriteCloser, stdout io.Reader, stop func() error) *screencapHelper {
+	helper := &screencapHelper{
+		stdin:   stdin,
+		lines:   make(chan []byte, 4),
+		exited:  make(chan struct{}),
+		closing: make(chan struct{}),
+		stop:    stop,
+	}
+	go helper.readLoop(stdout)
+	return helper
+}
+
+func (helper *screencapHelper) readLoop(stdout io.Reader) {
+	defer close(helper.exited)
+	scanner := bufio.NewScanner(stdout)
+	scanner.Buffer(make([]byte, 0, 64<<10), 1<<20)
+	for scanner.Scan() {
+		line := bytes.TrimSpace(scanner.Bytes())
+		if len(line) == 0 {
+			continue
+		}
+		select {
+		case helper.lines <- append([]byte(nil), line...):
+		case <-helper.closing:
+			return
+		}
+	}
+}
+
+// capture は args を常駐プロセスに送り、同じ id の結果を timeout まで待つ。
+// 撮影自体の失敗は結果JSON（OK=false）として返し、エラーはやり取りが壊れた場合
+// （書き込み失敗・応答の解析失敗・プロセス終了・時間切れ）に限る。その場合このヘルパーは使い捨てる。
+func (helper *screencapHelper) capture(ctx context.Context, args []string, timeout time.Duration) (*screencapResult, error) {
+	helper.mu.Lock()
+	defer helper.mu.Unlock()
+
+	helper.nextID++
+	id := helper.nextID
+	payload, err := json.Marshal(screencapRequest{ID: id, Args: args})
+	if err != nil {
+		return nil, err
+	}
+	if _, err := helper.stdin.Write(append(payload, '\n')); err != nil {
+		// 書き込めないのはプロセスが終了して stdin が閉じた場合
+		return nil, fmt.Errorf("%w: 送信に失敗しました: %w", errScreencapHelperExited, err)
+	}
+
+	timer := time.NewTimer(timeout)
+	defer timer.Stop()
+	for {
+		select {
+		case line := <-helper.lines:
+			result, err := helper.matchResult(line, id)
+			if err != nil || result != nil {
+				return result, err
+			}
+		case <-helper.exited:
+			// 終了直前に書かれた応答が残っていればそれを使う
+			for {
+				select {
+				case line := <-helper.lines:
+					if result, err := helper.matchResult(line, id); err != nil || result != nil {
+						return result, err
+					}
+				default:
+					return nil, errScreencapHelperExited
+				}
+			}
+		case <-timer.C:
+			return nil, fmt.Errorf("%w (%s)", errScreencapHelperTimeout, timeout)
+		case <-ctx.Done():
+			return nil, ctx.Err()
+		}
+	}
+}
+
+// matchResult は応答行を解釈し、id が一致すれば結果を返す。別の id の応答は (nil, nil)。
+func (helper *screencapHelper) matchResult(line []byte, id uint64) (*screencapResult, error) {
+	result, err := parseScreencapResult(line)
+	if err != nil {
+		return nil, fmt.Errorf("%w: %w", errScreencapHelperProtocol, err)
+	}
+	if result.ID != id {
+		return nil, nil
+	}
+	helper.served++
+	return result, nil
+}
+
+// hasServed は1件でも応答を返したかを返す。最初の要求から失敗するなら serve 非対応とみなす。
+func (helper *screencapHelper) hasServed() bool {
+	helper.mu.Lock()
+	defer helper.mu.Unlock()
+	return helper.served > 0
+}
+
+// close は stdin を閉じて常駐プロセスを終了させる。多重呼び出しは安全。
+func (helper *screencapHelper) close() error {
+	helper.closeOnce.Do(func() {
+		close(helper.closing)
+		inputErr := helper.stdin.Close()
+		var stopErr error
+		if helper.stop != nil {
+			stopErr = helper.stop()
+		}
+		helper.closeErr = errors.Join(inputErr, stopErr)
+	})
+	return helper.closeErr
+}
+
+// closeScreencapHelper は常駐プロセスを終了させ、以後このサービスでは起動しないようにする。
+func (service *ScreenshotService) closeScreencapHelper() {
+	service.helperMu.Lock()
+	helper := service.helper
+	service.helper = nil
+	service.helperClosed = true
+	service.helperMu.Unlock()
+	if helper == nil {
+		return
+	}
+	if err := helper.close(); err != nil {
+		service.logCapture(slog.LevelDebug, "screencap-cli 常駐プロセスの終了でエラー", "error", err)
+	}
+}
+
+// discardScreencapHelper は capture が err を返した常駐プロセスを捨てる。一度も応答しないまま終了した、
+// または serve の形式でない応答を返した場合は serve 非対応とみなし、以後は単発実行だけを使う
+// （撮影のたびに起動に失敗し続けないため）。時間切れ・キャンセルは初回の撮影が遅かっただけのこともあるため、
+// 次の撮影で起動し直す。
+func (service *ScreenshotService) discardScreencapHelper(helper *screencapHelper, err error) {
+	unsupported := !helper.hasServed() &&
+		(errors.Is(err, errScreencapHelperExited) || errors.Is(err, errScreencapHelperProtocol))
+	service.helperMu.Lock()
+	if service.helper == helper {
+		service.helper = nil
+	}
+	if unsupported {
+		service.helperUnsupported = true
+	}
+	service.helperMu.Unlock()
+	_ = helper.close()
+}
@@ -0,0 +1,115 @@
+package services
+
+import (
+	"bufio"
+	"context"
+	"encoding/json"
+	"errors"
+	"fmt"
+	"io"
+	"testing"
+	"time"
+)
+
+// startFakeScreencapServe は serve を模したゴルーチンを動かし、受け取った要求を respond に渡す。
+// respond が返した行をそのまま stdout に書く。
+func startFakeScreencapServe(t *testing.T, respond func(request screencapRequest) []string) *screencapHelper {
+	t.Helper()
+	stdinReader, stdinWriter := io.Pipe()
+	stdoutReader, stdoutWriter := io.Pipe()
+	go func() {
+		defer stdoutWriter.Close()
+		scanner := bufio.NewScanner(stdinReader)
+		for scanner.Scan() {
+			var request screencapRequest
+			if err := json.Unmarshal(scanner.Bytes(), &request); err != nil {
+				return
+			}
+			for _, line := range respond(request) {
+				if _, err := io.WriteString(stdoutWriter, line+"\n"); err != nil {
+					return
+				}
+			}
+		}
+	}()
+	helper := newScreencapHelper(stdinWriter, stdoutReader, nil)
+	t.Cleanup(func() { _ = helper.close() })
+	return helper
+}
+
+// TestScreencapHelperMatchesResponsesByID は、遅れて届いた別 id の応答を読み捨てて
+// 自分の要求への結果を返すことを確認する。
+func TestScreencapHelperMatchesResponsesByID(t *testing.T) {
+	t.Parallel()
+
+	helper := startFakeScreencapServe(t, func(request screencapRequest) []string {
+		stale := fmt.Sprintf(`{"id":%d,"ok":false,"error":{"code":"stale","message":"old"}}`, request.ID+100)
+		ok := fmt.Sprintf(`{"id":%d,"ok":true,"out_path":"%s"}`, request.ID, request.Args[0])
+		return []string{stale, ok}
+	})
+
+	for _, path := range []string{"first.png", "second.png"} {
+		result, err := helper.capture(context.Background(), []string{path}, time.Second)
+		if err != nil {
+			t.Fatalf("capture: %v", err)
+		}
+		if !result.OK || result.OutPath != path {
+			t.Fatalf("expected ok result for %s, got %+v", path, result)
+		}
+	}
+	if !helper.hasServed() {
+		t.Fatalf("expected helper to be marked as served")
+	}
+}
+
+// TestScreencapHelperReportsExitAndTimeout は、serve 非対応で即終了する場合と
+// 応答しない場合をそれぞれ区別できるエラーで返すことを確認する。
+func TestScreencapHelperReportsExitAndTimeout(t *testing.T) {
+	t.Parallel()
+
+	exitedStdin, exitedStdinWriter := io.Pipe()
+	go func() { _, _ = io.Copy(io.Discard, exitedStdin) }()
+	exitedStdout, exitedStdoutWriter := io.Pipe()
+	_ = exitedStdoutWriter.Close()
+	exited := newScreencapHelper(exitedStdinWriter, exitedStdout, nil)
+	defer exited.close()
+	if _, err := exited.capture(context.Background(), []string{"x.png"}, time.Second); !errors.Is(err, errScreencapHelperExited) {
+		t.Fatalf("expected exited error, got %v", err)
+	}
+	if exited.hasServed() {
+		t.Fatalf("expected exited helper to be treated as unsupported")
+	}
+
+	silent := startFakeScreencapServe(t, func(screencapRequest) []string { return nil })
+	if _, err := silent.capture(context.Background(), []string{"x.png"}, 20*time.Millisecond); !errors.Is(err, errScreencapHelperTimeout) {
+		t.Fatalf("expected timeout error, got %v", err)
+	}
+}
+
+// TestDiscardScreencapHelperMarksUnsupportedOnlyOnExitOrProtocolError は、初回の撮影が時間切れになっただけでは
+// 常駐モードを諦めず、終了や serve 形式でない応答のときだけ非対応とみなすことを確認する。
+func TestDiscardScreencapHelperMarksUnsupportedOnlyOnExitOrProtocolError(t *testing.T) {
+	t.Parallel()
+
+	cases := []struct {
+		name        string
+		respond     func(screencapRequest) []string
+		wantErr     error
+		unsupported bool
+	}{
+		{"timeout", func(screencapRequest) []string { return nil }, errScreencapHelperTimeout, false},
+		{"protocol", func(screencapRequest) []string { return []string{"usage: screencap-cli <out>"} }, errScreencapHelperProtocol, true},
+	}
+	for _, tc := range cases {
+		service := &ScreenshotService{}
+		helper := startFakeScreencapServe(t, tc.respond)
+		_, err := helper.capture(context.Background(), []string{"x.png"}, 20*time.Millisecond)
+		if !errors.Is(err, tc.wantErr) {
+			t.Fatalf("%s: expected %v, got %v", tc.name, tc.wantErr, err)
+		}
+		service.discardScreencapHelper(helper, err)
+		if service.helperUnsupported != tc.unsupported {
+			t.Fatalf("%s: helperUnsupported = %v, want %v", tc.name, service.helperUnsupported, tc.unsupported)
+		}
+	}
+}
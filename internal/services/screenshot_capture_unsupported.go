@@ -13,3 +13,6 @@ import (
 func (service *ScreenshotService) captureWithScreencap(ctx context.Context, pid int, outPath string) error {
 	return errors.New("screenshot capture is only supported on Windows")
 }
+
+// PrewarmCapture は非Windowsでは何もしない。
+func (service *ScreenshotService) PrewarmCapture() {}
@@ -23,6 +23,8 @@ const (
 	screencapTimeout = 10 * time.Second
 	// screencapBlackWarnRatio を超える真っ黒率で警告する（最小化中の可能性）。
 	screencapBlackWarnRatio = 0.98
+	// screencapHelperStopTimeout は常駐プロセスに stdin を閉じて終了を促してから強制終了するまでの猶予。
+	screencapHelperStopTimeout = 2 * time.Second
 )
 
 // screencapPathCache は解決済み CLI パスのメモ化（プロセス生存中は不変）。
@@ -33,6 +35,7 @@ var (
 
 // captureWithScreencap は同梱の screencap-cli.exe を呼び出して outPath に画像を保存する。
 // pid が 0 のときはフォアグラウンドウィンドウを対象にする。
+// 常駐モードが使えればパイプ経由で要求し、使えなければ撮影ごとにプロセスを起動する。
 func (service *ScreenshotService) captureWithScreencap(ctx context.Context, pid int, outPath string) error {
 	cliPath, err := resolveScreencapCLIPath()
 	if err != nil {
@@ -41,6 +44,103 @@ func (service *ScreenshotService) captureWithScreencap(ctx context.Context, pid
 
 	args := buildScreencapArgs(pid, outPath, service.localJpeg, service.jpegQuality, service.clientOnly)
 
+	if helper := service.residentScreencap(cliPath); helper != nil {
+		result, err := helper.capture(ctx, args, screencapTimeout)
+		if err == nil {
+			if !result.OK {
+				return screencapErrorFromResult(result)
+			}
+			service.checkScreencapResult(result)
+			return nil
+		}
+		service.discardScreencapHelper(helper, err)
+		if ctx.Err() != nil {
+			return ctx.Err()
+		}
+		// 撮影が固まった場合に単発実行でもう一度待たせない
+		if errors.Is(err, errScreencapHelperTimeout) {
+			return err
+		}
+		service.logCapture(slog.LevelWarn, "screencap-cli 常駐プロセスが使えないため単発実行します", "error", err)
+	}
+	return service.captureWithScreencapOnce(ctx, cliPath, args, outPath)
+}
+
+// PrewarmCapture は常駐モードの screencap-cli を先に起動しておき、最初のホットキー撮影で起動を待たせない。
+func (service *ScreenshotService) PrewarmCapture() {
+	cliPath, err := resolveScreencapCLIPath()
+	if err != nil {
+		return
+	}
+	service.residentScreencap(cliPath)
+}
+
+// residentScreencap は常駐中の screencap-cli を返し、未起動なら起動する。
+// 常駐モードが無効・非対応・サービス終了後、または起動に失敗した場合は nil を返す。
+func (service *ScreenshotService) residentScreencap(cliPath string) *screencapHelper {
+	service.helperMu.Lock()
+	defer service.helperMu.Unlock()
+	if !service.persistentHelper || service.helperUnsupported || service.helperClosed {
+		return nil
+	}
+	if service.helper != nil {
+		return service.helper
+	}
+	helper, err := startScreencapHelper(cliPath)
+	if err != nil {
+		service.helperUnsupported = true
+		service.logCapture(slog.LevelWarn, "screencap-cli を常駐モードで起動できません", "error", err)
+		return nil
+	}
+	service.helper = helper
+	return helper
+}
+
+// startScreencapHelper は screencap-cli.exe を常駐モードで起動する。
+// 終了時は stdin を閉じて自発的な終了を待ち、screencapHelperStopTimeout を過ぎたら強制終了する。
+func startScreencapHelper(cliPath string) (*screencapHelper, error) {
+	command := execCommandHidden(context.Background(), cliPath, buildScreencapServeArgs()...)
+	stdin, err := command.StdinPipe()
+	if err != nil {
+		return nil, err
+	}
+	stdout, err := command.StdoutPipe()
+	if err != nil {
+		return nil, err
+	}
+	if err := command.Start(); err != nil {
+		return nil, err
+	}
+	return newScreencapHelper(stdin, stdout, func() error {
+		done := make(chan error, 1)
+		go func() {
+			done <- command.Wait()
+		}()
+		select {
+		case err := <-done:
+			return err
+		case <-time.After(screencapHelperStopTimeout):
+			_ = command.Process.Kill()
+			return <-done
+		}
+	}), nil
+}
+
+// checkScreencapResult は成功した撮影結果を記録し、ほぼ真っ黒なら警告する。
+func (service *ScreenshotService) checkScreencapResult(result *screencapResult) {
+	if result.ImageStats.BlackRatio > screencapBlackWarnRatio {
+		service.logCapture(
+			slog.LevelWarn,
+			"キャプチャがほぼ真っ黒（最小化中の可能性）",
+			"blackRatio", result.ImageStats.BlackRatio,
+			"outPath", result.OutPath,
+		)
+	}
+	service.logCapture(slog.LevelDebug, "screencap-cli 実行成功", "outPath", result.OutPath)
+}
+
+// captureWithScreencapOnce は screencap-cli.exe を1回起動して撮影する。
+func (service *ScreenshotService) captureWithScreencapOnce(ctx context.Context, cliPath string, args []string, outPath string) error {
 	runCtx, cancel := context.WithTimeout(ctx, screencapTimeout)
 	defer cancel()
 
@@ -67,15 +167,7 @@ func (service *ScreenshotService) captureWithScreencap(ctx context.Context, pid
 		if !result.OK {
 			return screencapErrorFromResult(result)
 		}
-		if result.ImageStats.BlackRatio > screencapBlackWarnRatio {
-			service.logCapture(
-				slog.LevelWarn,
-				"キャプチャがほぼ真っ黒（最小化中の可能性）",
-				"blackRatio", result.ImageStats.BlackRatio,
-				"outPath", result.OutPath,
-			)
-		}
-		service.logCapture(slog.LevelDebug, "screencap-cli 実行成功", "outPath", result.OutPath)
+		service.checkScreencapResult(result)
 		return nil
 	}
 
@@ -9,6 +9,7 @@ import (
 	"os"
 	"path/filepath"
 	"strings"
+	"sync"
 	"time"
 
 	"CloudLaunch_Go/internal/config"
@@ -33,6 +34,14 @@ type ScreenshotService struct {
 	// captureFunc はプラットフォーム依存のキャプチャ実装。テストで差し替え可能。
 	// pid が 0 のときはフォアグラウンドウィンドウを対象にする。
 	captureFunc func(ctx context.Context, pid int, outPath string) error
+
+	// persistentHelper が true のとき screencap-cli を常駐モードで起動しておき、撮影要求をパイプで送る。
+	// serve に対応していない版と判明したら helperUnsupported を立てて単発実行だけを使う。
+	persistentHelper  bool
+	helperMu          sync.Mutex
+	helper            *screencapHelper
+	helperUnsupported bool
+	helperClosed      bool
 }
 
 // NewScreenshotService は ScreenshotService を生成する。
@@ -54,6 +63,8 @@ func NewScreenshotService(
 		jpegQuality: cfg.ScreenshotJpegQuality,
 		fileLogger:  fileLogger,
 		logFile:     logFile,
+
+		persistentHelper: cfg.ScreencapResident,
 	}
 	s.captureFunc = s.captureWithScreencap
 	return s
@@ -239,7 +250,11 @@ func (service *ScreenshotService) buildScreenshotPaths(gameID string, saveDir st
 }
 
 func (service *ScreenshotService) Close() error {
-	if service == nil || service.logFile == nil {
+	if service == nil {
+		return nil
+	}
+	service.closeScreencapHelper()
+	if service.logFile == nil {
 		return nil
 	}
 	err := service.logFile.Close()
@@ -0,0 +1,154 @@
+// クラウド同期ジョブの同時実行数を優先度付きで配分するスケジューラを提供する。
+package services
+
+import (
+	"context"
+	"sort"
+	"sync"
+)
+
+// SyncPriority は同期ジョブの優先度。値が小さいほど先に実行枠を得る。
+type SyncPriority int
+
+const (
+	// SyncPriorityInteractive はユーザー操作による Pull / Push / 競合解決。
+	SyncPriorityInteractive SyncPriority = iota
+	// SyncPriorityPostSession はプレイ終了後や編集後の自動 Push。
+	SyncPriorityPostSession
+	// SyncPriorityBackground はクラウド一覧の列挙など、待たせても困らない処理。
+	SyncPriorityBackground
+)
+
+// defaultSyncMaxJobs は maxJobs 未指定時の同時実行ジョブ数。
+const defaultSyncMaxJobs = 2
+
+type syncPriorityKey struct{}
+
+type syncAdmittedKey struct{}
+
+// WithSyncPriority は ctx で実行する同期ジョブの優先度を指定する。
+// 指定が無い場合は各操作の既定（Push / Pull は Interactive、一覧は Background）になる。
+func WithSyncPriority(ctx context.Context, priority SyncPriority) context.Context {
+	return context.WithValue(ctx, syncPriorityKey{}, priority)
+}
+
+func syncPriorityFrom(ctx context.Context, fallback SyncPriority) SyncPriority {
+	if priority, ok := ctx.Value(syncPriorityKey{}).(SyncPriority); ok {
+		return priority
+	}
+	return fallback
+}
+
+// syncWaiter は実行枠を待っているジョブ。ready は枠を割り当てたときに閉じる。
+type syncWaiter struct {
+	priority SyncPriority
+	seq      uint64
+	ready    chan struct{}
+}
+
+// SyncScheduler は App が1つだけ持ち、全ゲームの同期ジョブを最大 maxJobs 本に絞る。
+// 待ち行列は優先度順（同じ優先度なら到着順）で、Background は最後の1枠を使わない
+// （一覧の列挙が詰まっていてもユーザー操作の Pull がすぐ始められるように）。
+// ジョブ内の S3 リクエスト数と帯域は storage.SetTransferLimits の上限で別途頭打ちになる。
+// nil の *SyncScheduler は制限なしとして振る舞う。
+type SyncScheduler struct {
+	maxJobs int
+
+	mu      sync.Mutex
+	running int
+	seq     uint64
+	waiting []*syncWaiter
+}
+
+// NewSyncScheduler は同時実行ジョブ数が maxJobs（0 以下なら既定値）のスケジューラを返す。
+func NewSyncScheduler(maxJobs int) *SyncScheduler {
+	if maxJobs <= 0 {
+		maxJobs = defaultSyncMaxJobs
+	}
+	return &SyncScheduler{maxJobs: maxJobs}
+}
+
+// Acquire は priority で実行枠を待ち、枠を得たら解放関数と「枠を取得済み」の印を付けた ctx を返す。
+// 印の付いた ctx で再度呼ぶと待たずに返る（同期操作の中から別の同期操作を呼んだときに、自分の枠の解放を待って止まらないため）。
+// ctx が先に終わった場合はそのエラーを返す。
+func (s *SyncScheduler) Acquire(ctx context.Context, priority SyncPriority) (context.Context, func(), error) {
+	if s == nil || ctx.Value(syncAdmittedKey{}) != nil {
+		return ctx, func() {}, nil
+	}
+	s.mu.Lock()
+	s.seq++
+	waiter := &syncWaiter{priority: priority, seq: s.seq, ready: make(chan struct{})}
+	s.waiting = append(s.waiting, waiter)
+	sort.Slice(s.waiting, func(i, j int) bool {
+		if s.waiting[i].priority != s.waiting[j].priority {
+			return s.waiting[i].priority < s.waiting[j].priority
+		}
+		return s.waiting[i].seq < s.waiting[j].seq
+	})
+	s.dispatchLocked()
+	s.mu.Unlock()
+
+	select {
+	case <-waiter.ready:
+	case <-ctx.Done():
+		s.mu.Lock()
+		select {
+		case <-waiter.ready:
+			// 取り消しと割り当てが競合した。得た枠はそのまま返す
+			s.releaseLocked()
+		default:
+			s.removeWaiterLocked(waiter)
+			s.dispatchLocked()
+		}
+		s.mu.Unlock()
+		return ctx, func() {}, ctx.Err()
+	}
+	var once sync.Once
+	release := func() {
+		once.Do(func() {
+			s.mu.Lock()
+			s.releaseLocked()
+			s.mu.Unlock()
+		})
+	}
+	return context.WithValue(ctx, syncAdmittedKey{}, true), release, nil
+}
+
+// canStartLocked は priority のジョブを今始めてよいかを返す。
+func (s *SyncScheduler) canStartLocked(priority SyncPriority) bool {
+	if s.running >= s.maxJobs {
+		return false
+	}
+	if priority == SyncPriorityBackground && s.maxJobs > 1 && s.running >= s.maxJobs-1 {
+		return false
+	}
+	return true
+}
+
+// dispatchLocked は待ち行列の先頭から、始められるジョブに枠を割り当てる。
+// 先頭が始められない間は後ろを追い越させない（Background の後ろに並ぶのは Background だけなので実害は無い）。
+func (s *SyncScheduler) dispatchLocked() {
+	for len(s.waiting) > 0 {
+		head := s.waiting[0]
+		if !s.canStartLocked(head.priority) {
+			return
+		}
+		s.waiting = s.waiting[1:]
+		s.running++
+		close(head.ready)
+	}
+}
+
+func (s *SyncScheduler) releaseLocked() {
+	s.running--
+	s.dispatchLocked()
+}
+
+func (s *SyncScheduler) removeWaiterLocked(waiter *syncWaiter) {
+	for i, w := range s.waiting {
+		if w == waiter {
+			s.waiting = append(s.waiting[:i], s.waiting[i+1:]...)
+			return
+		}
+	}
+}
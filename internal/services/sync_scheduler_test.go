@@ -0,0 +1,194 @@
+package services
+
+import (
+	"context"
+	"errors"
+	"os"
+	"path/filepath"
+	"testing"
+	"time"
+)
+
+// acquireAsync は Acquire を別 goroutine で呼び、枠を得たら release 関数を送る。
+func acquireAsync(t *testing.T, s *SyncScheduler, priority SyncPriority) <-chan func() {
+	t.Helper()
+	got := make(chan func(), 1)
+	go func() {
+		_, release, err := s.Acquire(context.Background(), priority)
+		if err != nil {
+			t.Errorf("Acquire: %v", err)
+			return
+		}
+		got <- release
+	}()
+	return got
+}
+
+func expectBlocked(t *testing.T, ch <-chan func(), label string) {
+	t.Helper()
+	select {
+	case <-ch:
+		t.Fatalf("%s should still be waiting", label)
+	case <-time.After(30 * time.Millisecond):
+	}
+}
+
+func expectAdmitted(t *testing.T, ch <-chan func(), label string) func() {
+	t.Helper()
+	select {
+	case release := <-ch:
+		return release
+	case <-time.After(time.Second):
+		t.Fatalf("%s was not admitted", label)
+		return nil
+	}
+}
+
+// TestSyncSchedulerAdmitsByPriority は、枠が空いたとき到着順ではなく優先度順に割り当てられることを確認する。
+func TestSyncSchedulerAdmitsByPriority(t *testing.T) {
+	t.Parallel()
+
+	s := NewSyncScheduler(1)
+	_, holder, err := s.Acquire(context.Background(), SyncPriorityInteractive)
+	if err != nil {
+		t.Fatalf("Acquire: %v", err)
+	}
+	background := acquireAsync(t, s, SyncPriorityBackground)
+	expectBlocked(t, background, "background")
+	postSession := acquireAsync(t, s, SyncPriorityPostSession)
+	expectBlocked(t, postSession, "post-session")
+	interactive := acquireAsync(t, s, SyncPriorityInteractive)
+	expectBlocked(t, interactive, "interactive")
+
+	holder()
+	release := expectAdmitted(t, interactive, "interactive")
+	expectBlocked(t, postSession, "post-session")
+	release()
+	release = expectAdmitted(t, postSession, "post-session")
+	expectBlocked(t, background, "background")
+	release()
+	expectAdmitted(t, background, "background")()
+}
+
+// TestSyncSchedulerKeepsLastSlotForForegroundWork は、Background が最後の1枠を使わず、
+// 一覧の列挙中でもユーザー操作がすぐ始められることを確認する。
+func TestSyncSchedulerKeepsLastSlotForForegroundWork(t *testing.T) {
+	t.Parallel()
+
+	s := NewSyncScheduler(2)
+	first := expectAdmitted(t, acquireAsync(t, s, SyncPriorityBackground), "first background")
+	second := acquireAsync(t, s, SyncPriorityBackground)
+	expectBlocked(t, second, "second background")
+
+	interactive := expectAdmitted(t, acquireAsync(t, s, SyncPriorityInteractive), "interactive")
+	interactive()
+	expectBlocked(t, second, "second background")
+	first()
+	expectAdmitted(t, second, "second background")()
+}
+
+// TestSyncSchedulerNestedAndCanceledAcquire は、取得済みの ctx での再取得が待たずに返ること、
+// 待機中に ctx が終わった呼び出しが枠を消費しないことを確認する。
+func TestSyncSchedulerNestedAndCanceledAcquire(t *testing.T) {
+	t.Parallel()
+
+	s := NewSyncScheduler(1)
+	admitted, release, err := s.Acquire(context.Background(), SyncPriorityInteractive)
+	if err != nil {
+		t.Fatalf("Acquire: %v", err)
+	}
+	if _, nested, err := s.Acquire(admitted, SyncPriorityBackground); err != nil {
+		t.Fatalf("nested Acquire: %v", err)
+	} else {
+		nested()
+	}
+
+	ctx, cancel := context.WithTimeout(context.Background(), 20*time.Millisecond)
+	defer cancel()
+	if _, _, err := s.Acquire(ctx, SyncPriorityInteractive); !errors.Is(err, context.DeadlineExceeded) {
+		t.Fatalf("expected deadline exceeded, got %v", err)
+	}
+	release()
+	expectAdmitted(t, acquireAsync(t, s, SyncPriorityBackground), "after release")()
+}
+
+// TestContentSyncServiceLocksGameBeforeAdmit は、同じゲームのロック待ちのジョブが実行枠を握らず、
+// 他のゲームの処理が先に枠を得られることを確認する。
+func TestContentSyncServiceLocksGameBeforeAdmit(t *testing.T) {
+	t.Parallel()
+
+	game := baseGame(t.TempDir())
+	svc := newTestService(newFakeRepo(&game, nil), newFakeBlobStore())
+	scheduler := NewSyncScheduler(1)
+	svc.SetScheduler(scheduler)
+
+	unlock := svc.lockGame(game.ID)
+	done := make(chan error, 1)
+	go func() { done <- svc.DeleteFromCloud(context.Background(), game.ID) }()
+	time.Sleep(30 * time.Millisecond)
+	expectAdmitted(t, acquireAsync(t, scheduler, SyncPriorityInteractive), "other game")()
+
+	unlock()
+	select {
+	case err := <-done:
+		if err != nil {
+			t.Fatalf("DeleteFromCloud: %v", err)
+		}
+	case <-time.After(time.Second):
+		t.Fatal("DeleteFromCloud did not finish after the game lock was released")
+	}
+}
+
+// TestContentSyncServiceCollectAllGarbageDoesNotHoldSlotAcrossGames は、全ゲームの GC がゲームのロック待ちの間
+// 実行枠を握らず、枠が1つでもロックを持って枠を待つ Push とデッドロックしないことを確認する。
+func TestContentSyncServiceCollectAllGarbageDoesNotHoldSlotAcrossGames(t *testing.T) {
+	t.Parallel()
+
+	saveDir := t.TempDir()
+	if err := os.WriteFile(filepath.Join(saveDir, "save.dat"), []byte("v1"), 0o600); err != nil {
+		t.Fatal(err)
+	}
+	game := baseGame(saveDir)
+	svc := newTestService(newFakeRepo(&game, nil), newFakeBlobStore())
+	if err := svc.Push(context.Background(), game.ID, nil); err != nil {
+		t.Fatalf("initial Push: %v", err)
+	}
+	scheduler := NewSyncScheduler(1)
+	svc.SetScheduler(scheduler)
+	if err := os.WriteFile(filepath.Join(saveDir, "save.dat"), []byte("v2"), 0o600); err != nil {
+		t.Fatal(err)
+	}
+
+	unlock := svc.lockGame(game.ID)
+	gcDone := make(chan error, 1)
+	go func() {
+		_, err := svc.CollectAllGarbage(context.Background(), GCOptions{})
+		gcDone <- err
+	}()
+	time.Sleep(30 * time.Millisecond)
+	// GC はゲームのロック待ちなので、枠は空いている
+	expectAdmitted(t, acquireAsync(t, scheduler, SyncPriorityInteractive), "while GC waits for the game lock")()
+
+	// 枠を塞いだ状態でロックを渡し、Push と GC のどちらがロックを先に得ても、枠が空けば両方終わること
+	_, holder, err := scheduler.Acquire(context.Background(), SyncPriorityInteractive)
+	if err != nil {
+		t.Fatalf("Acquire: %v", err)
+	}
+	pushDone := make(chan error, 1)
+	go func() { pushDone <- svc.Push(context.Background(), game.ID, nil) }()
+	time.Sleep(30 * time.Millisecond)
+	unlock()
+	time.Sleep(30 * time.Millisecond)
+	holder()
+
+	for label, done := range map[string]chan error{"Push": pushDone, "CollectAllGarbage": gcDone} {
+		select {
+		case err := <-done:
+			if err != nil {
+				t.Fatalf("%s: %v", label, err)
+			}
+		case <-time.After(2 * time.Second):
+			t.Fatalf("%s did not finish: lock and slot were taken in opposite orders", label)
+		}
+	}
+}
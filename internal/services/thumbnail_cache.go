@@ -0,0 +1,232 @@
+// ローカル画像の縮小版（サムネイル）を AppData にキャッシュする。
+package services
+
+import (
+	"bytes"
+	"context"
+	"crypto/sha256"
+	"encoding/hex"
+	"errors"
+	"image"
+	"io"
+	"log/slog"
+	"os"
+	"path/filepath"
+	"strings"
+	"sync"
+	"time"
+)
+
+// thumbnailShortEdgePx はサムネイルの短辺。ホームのカードを高 DPI で表示しても粗くならない大きさ。
+const thumbnailShortEdgePx = 320
+
+// thumbnailMaxSources は元画像の控えの上限。超えたら控えを捨てて、以後の要求でハッシュを計算し直す。
+const thumbnailMaxSources = 4096
+
+// thumbnailSource は元画像の stat と内容ハッシュの控え。stat が変わらない間は読み直さない。
+// original は縮小せず元画像をそのまま使うと判定済みであること。
+type thumbnailSource struct {
+	size     int64
+	modTime  int64
+	hash     string
+	original bool
+}
+
+// ThumbnailCache は元画像の内容ハッシュをキーにサムネイルを dir に保存する。
+// 同じ画像を別のパスから参照しても1つのサムネイルを共有し、画像を差し替えればハッシュが変わって作り直される。
+// 縮小には批評空間の画像取り込みと同じ resizeToShortEdge / encodeImage を使う。
+type ThumbnailCache struct {
+	dir    string
+	logger *slog.Logger
+
+	mu       sync.Mutex
+	sources  map[string]thumbnailSource
+	building map[string]chan struct{}
+}
+
+// NewThumbnailCache は dir にサムネイルを保存する ThumbnailCache を生成する。
+func NewThumbnailCache(dir string, logger *slog.Logger) *ThumbnailCache {
+	return &ThumbnailCache{
+		dir:      dir,
+		logger:   logger,
+		sources:  make(map[string]thumbnailSource),
+		building: make(map[string]chan struct{}),
+	}
+}
+
+// Thumbnail は sourcePath のサムネイルのパスと、元画像の内容ハッシュを返す。
+// 元画像が既に十分小さい・縮小できない形式の場合は sourcePath 自体を返す。
+func (c *ThumbnailCache) Thumbnail(sourcePath string) (string, string, error) {
+	source, err := c.source(sourcePath)
+	if err != nil {
+		return "", "", err
+	}
+	hash := source.hash
+	// Windows の絶対パスは URL として解釈できないため、拡張子を形式名として渡す
+	ext := chooseImageExtension("", "", strings.TrimPrefix(strings.ToLower(filepath.Ext(sourcePath)), "."))
+	if ext == "" || source.original {
+		return sourcePath, hash, nil
+	}
+	target := filepath.Join(c.dir, hash+ext)
+	if _, err := os.Stat(target); err == nil {
+		return target, hash, nil
+	}
+
+	// 同じ画像を同時に要求されても縮小は1回にする
+	c.mu.Lock()
+	if wait, ok := c.building[hash]; ok {
+		c.mu.Unlock()
+		<-wait
+		if _, err := os.Stat(target); err == nil {
+			return target, hash, nil
+		}
+		return sourcePath, hash, nil
+	}
+	done := make(chan struct{})
+	c.building[hash] = done
+	c.mu.Unlock()
+	defer func() {
+		c.mu.Lock()
+		delete(c.building, hash)
+		c.mu.Unlock()
+		close(done)
+	}()
+
+	built, err := c.build(sourcePath, target, ext)
+	if err != nil {
+		return "", "", err
+	}
+	if !built {
+		c.mu.Lock()
+		source.original = true
+		c.sources[sourcePath] = source
+		c.mu.Unlock()
+		return sourcePath, hash, nil
+	}
+	return target, hash, nil
+}
+
+// Warm は paths のサムネイルを事前に作る。起動時にバックグラウンドで呼び、ホームの初回表示で縮小を待たせない。
+// paths には現在のカバー画像をすべて渡す前提で、最後まで回ったらどれのサムネイルでもなく Warm の開始前に書かれたファイル
+// （削除したゲームや差し替え前の画像の分）を dir から消し、元画像の控えも paths の分だけに絞る。
+// 事前生成の間に他の画像の要求で作ったサムネイルは残す。
+func (c *ThumbnailCache) Warm(ctx context.Context, paths []string) {
+	started := time.Now()
+	current := make(map[string]struct{}, len(paths))
+	for _, sourcePath := range paths {
+		if ctx.Err() != nil {
+			return
+		}
+		if sourcePath == "" {
+			continue
+		}
+		_, hash, err := c.Thumbnail(sourcePath)
+		if err != nil {
+			c.logger.Debug("サムネイルの事前生成に失敗", "path", sourcePath, "error", err)
+			continue
+		}
+		current[hash] = struct{}{}
+	}
+	removed, err := pruneCacheDir(c.dir, 0, func(name string, modTime time.Time) bool {
+		if !modTime.Before(started) {
+			return true
+		}
+		_, ok := current[strings.TrimSuffix(name, filepath.Ext(name))]
+		return ok
+	})
+	c.mu.Lock()
+	for sourcePath, source := range c.sources {
+		if _, ok := current[source.hash]; !ok {
+			delete(c.sources, sourcePath)
+		}
+	}
+	c.mu.Unlock()
+	if err != nil {
+		c.logger.Warn("使われていないサムネイルの削除に失敗", "error", err)
+	}
+	if removed > 0 {
+		c.logger.Debug("使われていないサムネイルを削除しました", "count", removed)
+	}
+}
+
+// source は元画像の控えを返す。stat が前回と同じなら控えを使い、変わっていれば内容ハッシュを計算し直す。
+func (c *ThumbnailCache) source(sourcePath string) (thumbnailSource, error) {
+	info, err := os.Stat(sourcePath)
+	if err != nil {
+		return thumbnailSource{}, err
+	}
+	if info.IsDir() {
+		return thumbnailSource{}, errors.New("画像ファイルではありません")
+	}
+	c.mu.Lock()
+	cached, ok := c.sources[sourcePath]
+	c.mu.Unlock()
+	if ok && cached.size == info.Size() && cached.modTime == info.ModTime().UnixNano() {
+		return cached, nil
+	}
+
+	file, err := os.Open(sourcePath)
+	if err != nil {
+		return thumbnailSource{}, err
+	}
+	defer func() {
+		if closeErr := file.Close(); closeErr != nil {
+			c.logger.Warn("画像ファイルのクローズに失敗", "error", closeErr)
+		}
+	}()
+	sum := sha256.New()
+	if _, err := io.Copy(sum, file); err != nil {
+		return thumbnailSource{}, err
+	}
+	source := thumbnailSource{size: info.Size(), modTime: info.ModTime().UnixNano(), hash: hex.EncodeToString(sum.Sum(nil))}
+	c.mu.Lock()
+	if len(c.sources) >= thumbnailMaxSources {
+		clear(c.sources)
+	}
+	c.sources[sourcePath] = source
+	c.mu.Unlock()
+	return source, nil
+}
+
+// build は sourcePath を縮小して target に書き込む。短辺が既にサムネイル以下なら何もせず false を返す。
+func (c *ThumbnailCache) build(sourcePath, target, ext string) (bool, error) {
+	raw, err := os.ReadFile(sourcePath)
+	if err != nil {
+		return false, err
+	}
+	config, _, err := image.DecodeConfig(bytes.NewReader(raw))
+	if err != nil {
+		return false, err
+	}
+	if min(config.Width, config.Height) <= thumbnailShortEdgePx {
+		return false, nil
+	}
+	decoded, _, err := image.Decode(bytes.NewReader(raw))
+	if err != nil {
+		return false, err
+	}
+	var encoded bytes.Buffer
+	if err := encodeImage(&encoded, resizeToShortEdge(decoded, thumbnailShortEdgePx), ext); err != nil {
+		return false, err
+	}
+
+	if err := os.MkdirAll(c.dir, 0o700); err != nil {
+		return false, err
+	}
+	// 書きかけのファイルを配信しないよう、一時ファイルに書いてから置き換える
+	tmp, err := os.CreateTemp(c.dir, ".tmp-*")
+	if err != nil {
+		return false, err
+	}
+	_, writeErr := encoded.WriteTo(tmp)
+	closeErr := tmp.Close()
+	if err := errors.Join(writeErr, closeErr); err != nil {
+		_ = os.Remove(tmp.Name())
+		return false, err
+	}
+	if err := os.Rename(tmp.Name(), target); err != nil {
+		_ = os.Remove(tmp.Name())
+		return false, err
+	}
+	return true, nil
+}
@@ -0,0 +1,150 @@
+package services
+
+import (
+	"context"
+	"image"
+	"image/png"
+	"io"
+	"log/slog"
+	"os"
+	"path/filepath"
+	"testing"
+	"time"
+)
+
+func writeTestPNG(t *testing.T, path string, width, height int) {
+	t.Helper()
+	file, err := os.Create(path)
+	if err != nil {
+		t.Fatalf("os.Create: %v", err)
+	}
+	defer file.Close()
+	if err := png.Encode(file, image.NewRGBA(image.Rect(0, 0, width, height))); err != nil {
+		t.Fatalf("png.Encode: %v", err)
+	}
+}
+
+// TestThumbnailCacheResizesLargeImagesAndKeepsSmallOnes は、大きい画像は短辺を縮めたサムネイルを
+// ハッシュ名で保存し、既に小さい画像は元のパスを返すことを確認する。
+func TestThumbnailCacheResizesLargeImagesAndKeepsSmallOnes(t *testing.T) {
+	t.Parallel()
+
+	sourceDir, cacheDir := t.TempDir(), filepath.Join(t.TempDir(), "thumbnails")
+	large := filepath.Join(sourceDir, "large.png")
+	small := filepath.Join(sourceDir, "small.png")
+	writeTestPNG(t, large, 1280, 720)
+	writeTestPNG(t, small, 200, 100)
+
+	cache := NewThumbnailCache(cacheDir, slog.New(slog.NewTextHandler(io.Discard, nil)))
+	thumbnail, hash, err := cache.Thumbnail(large)
+	if err != nil {
+		t.Fatalf("Thumbnail: %v", err)
+	}
+	if thumbnail != filepath.Join(cacheDir, hash+".png") {
+		t.Fatalf("expected hash-keyed thumbnail, got %q (hash %q)", thumbnail, hash)
+	}
+	file, err := os.Open(thumbnail)
+	if err != nil {
+		t.Fatalf("open thumbnail: %v", err)
+	}
+	defer file.Close()
+	config, _, err := image.DecodeConfig(file)
+	if err != nil {
+		t.Fatalf("DecodeConfig: %v", err)
+	}
+	if min(config.Width, config.Height) != thumbnailShortEdgePx {
+		t.Fatalf("expected short edge %d, got %dx%d", thumbnailShortEdgePx, config.Width, config.Height)
+	}
+
+	again, againHash, err := cache.Thumbnail(large)
+	if err != nil || again != thumbnail || againHash != hash {
+		t.Fatalf("expected cached thumbnail, got %q %q err=%v", again, againHash, err)
+	}
+
+	original, _, err := cache.Thumbnail(small)
+	if err != nil || original != small {
+		t.Fatalf("expected small image to be served as-is, got %q err=%v", original, err)
+	}
+}
+
+// TestThumbnailCacheWarmRemovesUnusedThumbnails は、Warm が渡された画像のサムネイルを残し、
+// 差し替え前の画像や消えた画像のサムネイルを削除し、Warm の開始後に書かれたサムネイル（事前生成中の他の要求の分）は
+// 残すこと、元画像の控えを渡された画像の分だけに絞ることを確認する。
+func TestThumbnailCacheWarmRemovesUnusedThumbnails(t *testing.T) {
+	t.Parallel()
+
+	sourceDir, cacheDir := t.TempDir(), filepath.Join(t.TempDir(), "thumbnails")
+	kept := filepath.Join(sourceDir, "kept.png")
+	replaced := filepath.Join(sourceDir, "replaced.png")
+	deleted := filepath.Join(sourceDir, "deleted.png")
+	writeTestPNG(t, kept, 1280, 720)
+	writeTestPNG(t, replaced, 1280, 720)
+	writeTestPNG(t, deleted, 640, 480)
+	other := filepath.Join(sourceDir, "other.png")
+	writeTestPNG(t, other, 960, 540)
+
+	cache := NewThumbnailCache(cacheDir, slog.New(slog.NewTextHandler(io.Discard, nil)))
+	var before []string
+	for _, path := range []string{kept, replaced, deleted} {
+		thumbnail, _, err := cache.Thumbnail(path)
+		if err != nil {
+			t.Fatalf("Thumbnail: %v", err)
+		}
+		before = append(before, thumbnail)
+	}
+	// 事前生成より前に作られたことにする
+	past := time.Now().Add(-time.Hour)
+	for _, thumbnail := range before {
+		if err := os.Chtimes(thumbnail, past, past); err != nil {
+			t.Fatal(err)
+		}
+	}
+	// 事前生成の途中に別の要求で作られたことにする
+	concurrent, _, err := cache.Thumbnail(other)
+	if err != nil {
+		t.Fatalf("Thumbnail: %v", err)
+	}
+	future := time.Now().Add(time.Minute)
+	if err := os.Chtimes(concurrent, future, future); err != nil {
+		t.Fatal(err)
+	}
+	writeTestPNG(t, replaced, 1600, 900)
+	if err := os.Remove(deleted); err != nil {
+		t.Fatal(err)
+	}
+
+	cache.Warm(context.Background(), []string{kept, replaced, deleted})
+
+	if _, err := os.Stat(before[0]); err != nil {
+		t.Fatalf("thumbnail of a current image should be kept: %v", err)
+	}
+	if _, err := os.Stat(concurrent); err != nil {
+		t.Fatalf("thumbnail written during warm-up should be kept: %v", err)
+	}
+	for _, stale := range before[1:] {
+		if _, err := os.Stat(stale); !os.IsNotExist(err) {
+			t.Fatalf("stale thumbnail %s should be removed, stat err=%v", stale, err)
+		}
+	}
+	cache.mu.Lock()
+	_, otherCached := cache.sources[other]
+	sourceCount := len(cache.sources)
+	cache.mu.Unlock()
+	if otherCached || sourceCount != 2 {
+		t.Fatalf("source records should be narrowed to the warmed images, got %d (other=%v)", sourceCount, otherCached)
+	}
+	rebuilt, _, err := cache.Thumbnail(replaced)
+	if err != nil {
+		t.Fatalf("Thumbnail: %v", err)
+	}
+	if _, err := os.Stat(rebuilt); err != nil {
+		t.Fatalf("thumbnail of the replaced image should exist: %v", err)
+	}
+	entries, err := os.ReadDir(cacheDir)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if len(entries) != 3 {
+		t.Fatalf("expected the two current thumbnails and the concurrent one, got %d files", len(entries))
+	}
+}
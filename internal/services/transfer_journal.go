@@ -0,0 +1,229 @@
+// 中断した Push / Pull を再開するための転送記録（storage.TransferJournal の DB 実装）を提供する。
+package services
+
+import (
+	"context"
+	"log/slog"
+	"os"
+	"path/filepath"
+	"sync"
+	"time"
+
+	"CloudLaunch_Go/internal/domain"
+	"CloudLaunch_Go/internal/infrastructure/storage"
+)
+
+const (
+	transferPush = "push"
+	transferPull = "pull"
+	// transferJournalFlushEvery は完了分をまとめて DB に書き込む件数。1件ごとのトランザクションで転送を遅くしないため。
+	transferJournalFlushEvery = 64
+	// staleMultipartAge より前に開始された未完了マルチパートアップロードは再開を諦めて破棄する。
+	staleMultipartAge = 24 * time.Hour
+)
+
+// transferJournal はゲーム1件・1方向分の転送記録。完了分はメモリに溜めて transferJournalFlushEvery 件ごとに、
+// マルチパートアップロードの開始・終了は即座に DB へ書き込む（ID を失うとリモートの断片が孤立するため）。
+// 書き込みは ctx が取り消された後も行う（中断時点までの完了分を残すのが目的なので）。
+type transferJournal struct {
+	repository ContentSyncRepository
+	logger     *slog.Logger
+	ctx        context.Context
+	gameID     string
+	direction  string
+	saveDir    string // Pull でファイルの相対パスを求める基準（Push では空）
+
+	// resumed は前回の同じ head の試行で完了していた分（読み取り専用）
+	resumed []domain.TransferJournalEntry
+
+	mu        sync.Mutex
+	pending   []domain.TransferJournalEntry
+	multipart map[string]domain.MultipartUpload
+}
+
+// openTransferJournal は gameID の direction の転送記録を head で開始し、同じ head の前回分があれば引き継ぐ。
+// 記録の読み書きに失敗しても転送は続けられるため、警告を出して空の記録で始める。
+func (s *ContentSyncService) openTransferJournal(ctx context.Context, gameID, direction, head, saveDir string) *transferJournal {
+	journal := &transferJournal{
+		repository: s.repository,
+		logger:     s.logger,
+		ctx:        context.WithoutCancel(ctx),
+		gameID:     gameID,
+		direction:  direction,
+		saveDir:    saveDir,
+		multipart:  make(map[string]domain.MultipartUpload),
+	}
+	prior, err := s.repository.GetTransferJournal(ctx, gameID, direction)
+	if err != nil {
+		s.logger.Warn("転送記録の読み込みに失敗（最初から転送します）", "gameId", gameID, "direction", direction, "error", err)
+	} else if prior != nil && prior.Head == head {
+		journal.resumed = prior.Entries
+	}
+	if err := s.repository.StartTransferJournal(ctx, gameID, direction, head, time.Now().UnixNano()); err != nil {
+		s.logger.Warn("転送記録の開始に失敗", "gameId", gameID, "direction", direction, "error", err)
+	}
+	if direction == transferPush {
+		uploads, err := s.repository.ListMultipartUploads(ctx, gameID)
+		if err != nil {
+			s.logger.Warn("マルチパートアップロード記録の読み込みに失敗", "gameId", gameID, "error", err)
+		}
+		for _, upload := range uploads {
+			journal.multipart[upload.Key] = upload
+		}
+	}
+	if len(journal.resumed) > 0 {
+		s.logger.Info("前回中断した転送を再開します", "gameId", gameID, "direction", direction, "completed", len(journal.resumed))
+	}
+	return journal
+}
+
+// resumedBlobs は前回の試行でリモートに揃ったブロブを kind → ハッシュ集合で返す。
+func (j *transferJournal) resumedBlobs() storage.BlobIndex {
+	index := make(storage.BlobIndex)
+	for _, entry := range j.resumed {
+		if entry.Path != "" {
+			continue
+		}
+		if index[entry.Kind] == nil {
+			index[entry.Kind] = make(map[string]struct{})
+		}
+		index[entry.Kind][entry.Hash] = struct{}{}
+	}
+	return index
+}
+
+// resumedFiles は前回の試行で書き込み済みのファイルを relPath → 記録で返す。
+func (j *transferJournal) resumedFiles() map[string]domain.TransferJournalEntry {
+	files := make(map[string]domain.TransferJournalEntry)
+	for _, entry := range j.resumed {
+		if entry.Path != "" {
+			files[entry.Path] = entry
+		}
+	}
+	return files
+}
+
+// trustsFile は relPath が前回の試行で hash の内容として書き込まれ、その後 stat が変わっていないかを返す。
+// 秒単位の mtime しか持たないファイルシステムでは書き込み直後の上書きを stat で見分けられないため信用しない。
+func trustsFile(files map[string]domain.TransferJournalEntry, relPath, hash string, info os.FileInfo) bool {
+	entry, ok := files[relPath]
+	if !ok || entry.Hash != hash {
+		return false
+	}
+	modTime := info.ModTime().UnixNano()
+	return entry.Size == info.Size() && entry.ModTime == modTime && modTime%int64(time.Second) != 0
+}
+
+func (j *transferJournal) append(entry domain.TransferJournalEntry) {
+	j.mu.Lock()
+	j.pending = append(j.pending, entry)
+	var batch []domain.TransferJournalEntry
+	if len(j.pending) >= transferJournalFlushEvery {
+		batch, j.pending = j.pending, nil
+	}
+	j.mu.Unlock()
+	j.write(batch)
+}
+
+func (j *transferJournal) write(batch []domain.TransferJournalEntry) {
+	if len(batch) == 0 {
+		return
+	}
+	if err := j.repository.AppendTransferJournal(j.ctx, j.gameID, j.direction, batch); err != nil {
+		j.logger.Warn("転送記録の書き込みに失敗", "gameId", j.gameID, "direction", j.direction, "error", err)
+	}
+}
+
+// BlobUploaded は storage.TransferJournal の実装。
+func (j *transferJournal) BlobUploaded(kind, hash string) {
+	j.append(domain.TransferJournalEntry{Kind: kind, Hash: hash})
+}
+
+// FileDownloaded は storage.TransferJournal の実装。書き込み直後の stat を控え、再開時の照合に使う。
+func (j *transferJournal) FileDownloaded(targetPath, hash string) {
+	relPath, err := filepath.Rel(j.saveDir, targetPath)
+	if err != nil {
+		return
+	}
+	info, err := os.Stat(targetPath)
+	if err != nil {
+		return
+	}
+	j.append(domain.TransferJournalEntry{
+		Kind:    storage.BlobKindObject,
+		Hash:    hash,
+		Path:    filepath.ToSlash(relPath),
+		Size:    info.Size(),
+		ModTime: info.ModTime().UnixNano(),
+	})
+}
+
+// MultipartUploadID は storage.TransferJournal の実装。
+func (j *transferJournal) MultipartUploadID(key string, size int64) string {
+	j.mu.Lock()
+	defer j.mu.Unlock()
+	upload, ok := j.multipart[key]
+	if !ok || upload.Size != size || time.Since(time.Unix(0, upload.CreatedAt)) > staleMultipartAge {
+		return ""
+	}
+	return upload.UploadID
+}
+
+// MultipartStarted は storage.TransferJournal の実装。
+func (j *transferJournal) MultipartStarted(key, uploadID string, size int64) {
+	upload := domain.MultipartUpload{Key: key, UploadID: uploadID, GameID: j.gameID, Size: size, CreatedAt: time.Now().UnixNano()}
+	j.mu.Lock()
+	j.multipart[key] = upload
+	j.mu.Unlock()
+	if err := j.repository.SaveMultipartUpload(j.ctx, upload); err != nil {
+		j.logger.Warn("マルチパートアップロード記録の保存に失敗", "gameId", j.gameID, "key", key, "error", err)
+	}
+}
+
+// MultipartFinished は storage.TransferJournal の実装。
+func (j *transferJournal) MultipartFinished(key string) {
+	j.mu.Lock()
+	delete(j.multipart, key)
+	j.mu.Unlock()
+	if err := j.repository.DeleteMultipartUpload(j.ctx, key); err != nil {
+		j.logger.Warn("マルチパートアップロード記録の削除に失敗", "gameId", j.gameID, "key", key, "error", err)
+	}
+}
+
+// finish は転送の終了時に呼ぶ。成功なら記録を消し、失敗なら溜めていた完了分を書き込んで次回の再開に残す。
+func (j *transferJournal) finish(succeeded bool) {
+	j.mu.Lock()
+	batch := j.pending
+	j.pending = nil
+	j.mu.Unlock()
+	if !succeeded {
+		j.write(batch)
+		return
+	}
+	if err := j.repository.ClearTransferJournal(j.ctx, j.gameID, j.direction); err != nil {
+		j.logger.Warn("転送記録の削除に失敗", "gameId", j.gameID, "direction", j.direction, "error", err)
+	}
+}
+
+// AbortStaleMultipartUploads は staleMultipartAge より前に開始された未完了マルチパートアップロードを
+// リモートで破棄し、対応するローカルの記録も削除する。起動時にバックグラウンドで呼ぶ想定。
+// 認証情報が未設定・オフラインの場合は何もしない。
+func (s *ContentSyncService) AbortStaleMultipartUploads(ctx context.Context) error {
+	if s.offline.Load() {
+		return nil
+	}
+	client, cfg, err := s.newClient(ctx)
+	if err != nil {
+		s.logger.Debug("未完了マルチパートの掃除をスキップ", "error", err)
+		return nil
+	}
+	before := time.Now().Add(-staleMultipartAge)
+	aborted, err := storage.AbortStaleMultipartUploads(ctx, client, cfg.Bucket, "games/", before)
+	if aborted > 0 {
+		s.logger.Info("古い未完了マルチパートアップロードを破棄しました", "count", aborted)
+	}
+	if err != nil {
+		return err
+	}
+	return s.repository.DeleteMultipartUploadsBefore(ctx, before.UnixNano())
+}
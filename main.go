@@ -52,6 +52,8 @@ func main() {
 		Frameless: frameless,
 		AssetServer: &assetserver.Options{
 			Assets: assets,
+			// 埋め込みアセットに無いパス（/local-image）はローカル画像の配信に回す
+			Handler: backend.AssetHandler(),
 		},
 		// cloudlaunch テーマの base-200 に合わせた淡い色。初期描画の暗いちらつきや
 		// フレームレス時の角の隙間が目立たないようにする。
@@ -0,0 +1,13 @@
+#!/usr/bin/env bash
+# 同期・監視・一覧のベンチマークを実行し、benchstat で比較できる形式で保存する。
+#   ./scripts/run-benchmarks.sh [出力ファイル] [go test -bench の正規表現]
+# 変更前後で1回ずつ実行し、`benchstat before.txt after.txt` で差分を見る。
+# BENCH_COUNT（既定 6）で繰り返し回数、CLOUDLAUNCH_BENCH_LARGE_MB で大きいセーブの合成サイズを変えられる。
+set -euo pipefail
+
+repo_root="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+output="${1:-bench-$(git -C "$repo_root" rev-parse --short HEAD).txt}"
+pattern="${2:-.}"
+
+echo "==> go test -bench ${pattern} (count=${BENCH_COUNT:-6}) > ${output}"
+(cd "$repo_root" && GOCACHE=/tmp/go-build go test ./internal/... -run '^$' -bench "$pattern" -benchmem -count "${BENCH_COUNT:-6}" -timeout 60m) | tee "$output"